@@ -0,0 +1,125 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver.benchmark;
+
+import static jcuda.jcublas.cublasFillMode.CUBLAS_FILL_MODE_LOWER;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyHostToDevice;
+
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.jcusolver.JCusolverDn;
+import jcuda.jcusolver.cusolverDnHandle;
+import jcuda.runtime.JCuda;
+
+/**
+ * Benchmark for the calls that receive device pointers, using
+ * cusolverDnDpotrf. The matrix is the identity matrix, which is not
+ * changed by the factorization, so that each call does the same work.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+@State(Scope.Thread)
+public class DevicePointerCallBenchmark
+{
+    /**
+     * The size of the matrix
+     */
+    @Param({"1", "16"})
+    public int n;
+    
+    /**
+     * The handle
+     */
+    private cusolverDnHandle handle;
+    
+    /**
+     * The matrix, workspace and info in device memory
+     */
+    private Pointer deviceA;
+    private Pointer deviceWorkspace;
+    private Pointer deviceInfo;
+    
+    /**
+     * The workspace size, in elements
+     */
+    private int lwork;
+    
+    /**
+     * Create the handle and the device data
+     */
+    @Setup
+    public void setup()
+    {
+        handle = new cusolverDnHandle();
+        JCusolverDn.cusolverDnCreate(handle);
+        
+        double a[] = new double[n * n];
+        for (int i = 0; i < n; i++)
+        {
+            a[i + i * n] = 1.0;
+        }
+        deviceA = new Pointer();
+        JCuda.cudaMalloc(deviceA, a.length * Sizeof.DOUBLE);
+        JCuda.cudaMemcpy(deviceA, Pointer.to(a), 
+            a.length * Sizeof.DOUBLE, cudaMemcpyHostToDevice);
+        
+        int bufferSize[] = { 0 };
+        JCusolverDn.cusolverDnDpotrf_bufferSize(handle, 
+            CUBLAS_FILL_MODE_LOWER, n, deviceA, n, bufferSize);
+        lwork = bufferSize[0];
+        deviceWorkspace = new Pointer();
+        JCuda.cudaMalloc(deviceWorkspace, 
+            Math.max(1, lwork) * Sizeof.DOUBLE);
+        deviceInfo = new Pointer();
+        JCuda.cudaMalloc(deviceInfo, Sizeof.INT);
+    }
+    
+    /**
+     * Destroy the handle and free the device data
+     */
+    @TearDown
+    public void tearDown()
+    {
+        JCuda.cudaDeviceSynchronize();
+        JCuda.cudaFree(deviceA);
+        JCuda.cudaFree(deviceWorkspace);
+        JCuda.cudaFree(deviceInfo);
+        JCusolverDn.cusolverDnDestroy(handle);
+    }
+    
+    /**
+     * Call cusolverDnDpotrf. The call is asynchronous on a real device,
+     * so this measures the time for enqueueing the work, once the queue
+     * is saturated.
+     * 
+     * @return The status
+     */
+    @Benchmark
+    public int potrf()
+    {
+        return JCusolverDn.cusolverDnDpotrf(handle, CUBLAS_FILL_MODE_LOWER, 
+            n, deviceA, n, deviceWorkspace, lwork, deviceInfo);
+    }
+}
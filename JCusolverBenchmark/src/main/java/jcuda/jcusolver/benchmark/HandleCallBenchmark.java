@@ -0,0 +1,82 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver.benchmark;
+
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import jcuda.jcusolver.JCusolverDn;
+import jcuda.jcusolver.cusolverDnHandle;
+import jcuda.runtime.JCuda;
+import jcuda.runtime.cudaStream_t;
+
+/**
+ * Benchmark for the calls that only receive handles, which measures
+ * the minimum overhead of a JNI call, using cusolverDnSetStream
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+@State(Scope.Thread)
+public class HandleCallBenchmark
+{
+    /**
+     * The handle
+     */
+    private cusolverDnHandle handle;
+    
+    /**
+     * The stream
+     */
+    private cudaStream_t stream;
+    
+    /**
+     * Create the handle and the stream
+     */
+    @Setup
+    public void setup()
+    {
+        handle = new cusolverDnHandle();
+        JCusolverDn.cusolverDnCreate(handle);
+        stream = new cudaStream_t();
+        JCuda.cudaStreamCreate(stream);
+    }
+    
+    /**
+     * Destroy the handle and the stream
+     */
+    @TearDown
+    public void tearDown()
+    {
+        JCusolverDn.cusolverDnDestroy(handle);
+        JCuda.cudaStreamDestroy(stream);
+    }
+    
+    /**
+     * Call cusolverDnSetStream
+     * 
+     * @return The status
+     */
+    @Benchmark
+    public int setStream()
+    {
+        return JCusolverDn.cusolverDnSetStream(handle, stream);
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver.benchmark;
+
+import java.util.Arrays;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import jcuda.Pointer;
+import jcuda.jcusolver.JCusolverSp;
+import jcuda.jcusolver.cusolverSpHandle;
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * Benchmark for the calls that receive pointers to Java arrays, which
+ * are handled with PointerData in the native layer, using 
+ * cusolverSpDcsrlsvluHost for a tridiagonal matrix.<br>
+ * <br>
+ * The pointers are either created once, or in each call, as it is 
+ * commonly done in client code, to show the allocation that is caused
+ * by the <code>Pointer.to</code> calls.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+@State(Scope.Thread)
+public class HostPointerDataCallBenchmark
+{
+    /**
+     * The size of the matrix
+     */
+    @Param({"4", "64"})
+    public int n;
+    
+    /**
+     * The handle
+     */
+    private cusolverSpHandle handle;
+    
+    /**
+     * The matrix descriptor
+     */
+    private cusparseMatDescr descr;
+    
+    /**
+     * The host data of the matrix and the vectors
+     */
+    private double val[];
+    private int rowPtr[];
+    private int colInd[];
+    private double b[];
+    private double x[];
+    private int singularity[];
+    
+    /**
+     * The pointers to the host data, for the calls that do not create
+     * the pointers
+     */
+    private Pointer valPointer;
+    private Pointer rowPtrPointer;
+    private Pointer colIndPointer;
+    private Pointer bPointer;
+    private Pointer xPointer;
+    
+    /**
+     * Create the handle and the host data
+     */
+    @Setup
+    public void setup()
+    {
+        handle = new cusolverSpHandle();
+        JCusolverSp.cusolverSpCreate(handle);
+        descr = new cusparseMatDescr();
+        JCusparse.cusparseCreateMatDescr(descr);
+        
+        int nnz = 3 * n - 2;
+        val = new double[nnz];
+        rowPtr = new int[n + 1];
+        colInd = new int[nnz];
+        int k = 0;
+        for (int r = 0; r < n; r++)
+        {
+            for (int c = Math.max(0, r - 1); c <= Math.min(n - 1, r + 1); c++)
+            {
+                colInd[k] = c;
+                val[k] = (c == r) ? 4.0 : -1.0;
+                k++;
+            }
+            rowPtr[r + 1] = k;
+        }
+        b = new double[n];
+        Arrays.fill(b, 1.0);
+        x = new double[n];
+        singularity = new int[1];
+        
+        valPointer = Pointer.to(val);
+        rowPtrPointer = Pointer.to(rowPtr);
+        colIndPointer = Pointer.to(colInd);
+        bPointer = Pointer.to(b);
+        xPointer = Pointer.to(x);
+    }
+    
+    /**
+     * Destroy the handle and the descriptor
+     */
+    @TearDown
+    public void tearDown()
+    {
+        JCusparse.cusparseDestroyMatDescr(descr);
+        JCusolverSp.cusolverSpDestroy(handle);
+    }
+    
+    /**
+     * Call cusolverSpDcsrlsvluHost with pointers that have been 
+     * created once
+     * 
+     * @return The status
+     */
+    @Benchmark
+    public int lsvluHostPreallocated()
+    {
+        return JCusolverSp.cusolverSpDcsrlsvluHost(handle, n, val.length, 
+            descr, valPointer, rowPtrPointer, colIndPointer, bPointer, 
+            0.0, 0, xPointer, singularity);
+    }
+    
+    /**
+     * Call cusolverSpDcsrlsvluHost with pointers that are created
+     * in each call
+     * 
+     * @return The status
+     */
+    @Benchmark
+    public int lsvluHostPointersPerCall()
+    {
+        return JCusolverSp.cusolverSpDcsrlsvluHost(handle, n, val.length, 
+            descr, Pointer.to(val), Pointer.to(rowPtr), Pointer.to(colInd), 
+            Pointer.to(b), 0.0, 0, Pointer.to(x), singularity);
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver.benchmark;
+
+import org.openjdk.jmh.profile.GCProfiler;
+import org.openjdk.jmh.results.format.ResultFormatType;
+import org.openjdk.jmh.runner.Runner;
+import org.openjdk.jmh.runner.RunnerException;
+import org.openjdk.jmh.runner.options.ChainedOptionsBuilder;
+import org.openjdk.jmh.runner.options.OptionsBuilder;
+
+/**
+ * Runs all JCusolver call benchmarks, with the GC profiler, so that 
+ * the results contain the time per call and the allocated bytes per
+ * call (<code>gc.alloc.rate.norm</code>). The results are written to
+ * <code>jcusolver-real.json</code> or <code>jcusolver-stub.json</code>.
+ * <br>
+ * <br>
+ * Usage:
+ * <pre><code>
+ * java -jar benchmarks.jar
+ * java -jar benchmarks.jar stub &lt;directory&gt;
+ * </code></pre>
+ * The first form runs against the library that is found by the
+ * usual JCuda library loading. The second form runs against the
+ * JCusolver library that was built with the 
+ * <code>JCUSOLVER_STUB_BACKEND</code> CMake option, and is contained 
+ * in the given directory. The calls that JCuda makes into the CUDA 
+ * runtime only reach the stub when the stub library is preloaded, 
+ * for example with <code>LD_PRELOAD=libJCusolverStub.so</code>.<br>
+ * <br>
+ * Other JMH options can be given by running the <code>benchmarks.jar</code>
+ * with <code>org.openjdk.jmh.Main</code> as the main class.
+ */
+public class JCusolverBenchmarks
+{
+    /**
+     * The entry point
+     * 
+     * @param args The arguments
+     * @throws RunnerException If the benchmarks can not be run
+     */
+    public static void main(String args[]) throws RunnerException
+    {
+        String backend = "real";
+        String libraryPath = null;
+        if (args.length > 0)
+        {
+            if (args.length != 2 || !args[0].equals("stub"))
+            {
+                System.err.println(
+                    "Usage: JCusolverBenchmarks [stub <directory>]");
+                System.exit(1);
+            }
+            backend = args[0];
+            libraryPath = args[1];
+        }
+        ChainedOptionsBuilder builder = new OptionsBuilder()
+            .include(JCusolverBenchmarks.class.getPackage().getName() 
+                + "\\..*Benchmark")
+            .addProfiler(GCProfiler.class)
+            .resultFormat(ResultFormatType.JSON)
+            .result("jcusolver-" + backend + ".json");
+        if (libraryPath != null)
+        {
+            builder = builder.jvmArgsAppend(
+                "-Djava.library.path=" + libraryPath);
+        }
+        new Runner(builder.build()).run();
+    }
+}
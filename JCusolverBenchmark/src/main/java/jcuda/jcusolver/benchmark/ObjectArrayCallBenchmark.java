@@ -0,0 +1,142 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver.benchmark;
+
+import static jcuda.cudaDataType.CUDA_R_64F;
+import static jcuda.jcusolver.cusolverMgGridMapping.CUDALIBMG_GRID_MAPPING_COL_MAJOR;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyHostToDevice;
+
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.jcusolver.JCusolverMg;
+import jcuda.jcusolver.cudaLibMgGrid;
+import jcuda.jcusolver.cudaLibMgMatrixDesc;
+import jcuda.jcusolver.cusolverMgHandle;
+import jcuda.runtime.JCuda;
+
+/**
+ * Benchmark for the calls that receive arrays of pointers, which are
+ * passed as <code>jobjectArray</code> to the native layer, using
+ * cusolverMgGetrf on a single device. The matrix is the identity
+ * matrix, and no pivoting is done, so that each call does the same 
+ * work.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+@State(Scope.Thread)
+public class ObjectArrayCallBenchmark
+{
+    /**
+     * The size of the matrix
+     */
+    @Param({"16"})
+    public int n;
+    
+    /**
+     * The handle, grid and matrix descriptor
+     */
+    private cusolverMgHandle handle;
+    private cudaLibMgGrid grid;
+    private cudaLibMgMatrixDesc descr;
+    
+    /**
+     * The per-device arrays of the matrix and workspace pointers
+     */
+    private Pointer arrayA[];
+    private Pointer arrayWork[];
+    
+    /**
+     * The workspace size, in elements
+     */
+    private long lwork;
+    
+    /**
+     * The info, in pinned host memory
+     */
+    private Pointer info;
+    
+    /**
+     * Create the handle, grid, descriptor and device data
+     */
+    @Setup
+    public void setup()
+    {
+        int deviceIds[] = { 0 };
+        handle = new cusolverMgHandle();
+        JCusolverMg.cusolverMgCreate(handle);
+        JCusolverMg.cusolverMgDeviceSelect(handle, 1, deviceIds);
+        grid = new cudaLibMgGrid();
+        JCusolverMg.cusolverMgCreateDeviceGrid(grid, 1, 1, deviceIds, 
+            CUDALIBMG_GRID_MAPPING_COL_MAJOR);
+        descr = new cudaLibMgMatrixDesc();
+        JCusolverMg.cusolverMgCreateMatrixDesc(descr, n, n, n, n, 
+            CUDA_R_64F, grid);
+        
+        double a[] = new double[n * n];
+        for (int i = 0; i < n; i++)
+        {
+            a[i + i * n] = 1.0;
+        }
+        arrayA = new Pointer[] { new Pointer() };
+        JCuda.cudaMalloc(arrayA[0], a.length * Sizeof.DOUBLE);
+        JCuda.cudaMemcpy(arrayA[0], Pointer.to(a), 
+            a.length * Sizeof.DOUBLE, cudaMemcpyHostToDevice);
+        
+        int bufferSize[] = { 0 };
+        JCusolverMg.cusolverMgGetrf_bufferSize(handle, n, n, arrayA, 1, 1, 
+            descr, null, CUDA_R_64F, bufferSize);
+        lwork = bufferSize[0];
+        arrayWork = new Pointer[] { new Pointer() };
+        JCuda.cudaMalloc(arrayWork[0], Math.max(1, lwork) * Sizeof.DOUBLE);
+        info = new Pointer();
+        JCuda.cudaMallocHost(info, Sizeof.INT);
+    }
+    
+    /**
+     * Destroy the handles and free the data
+     */
+    @TearDown
+    public void tearDown()
+    {
+        JCuda.cudaFree(arrayA[0]);
+        JCuda.cudaFree(arrayWork[0]);
+        JCuda.cudaFreeHost(info);
+        JCusolverMg.cusolverMgDestroyMatrixDesc(descr);
+        JCusolverMg.cusolverMgDestroyGrid(grid);
+        JCusolverMg.cusolverMgDestroy(handle);
+    }
+    
+    /**
+     * Call cusolverMgGetrf
+     * 
+     * @return The status
+     */
+    @Benchmark
+    public int getrf()
+    {
+        return JCusolverMg.cusolverMgGetrf(handle, n, n, arrayA, 1, 1, 
+            descr, null, CUDA_R_64F, arrayWork, lwork, info);
+    }
+}
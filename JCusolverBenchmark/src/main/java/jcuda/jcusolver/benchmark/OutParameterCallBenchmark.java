@@ -0,0 +1,100 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver.benchmark;
+
+import static jcuda.jcublas.cublasFillMode.CUBLAS_FILL_MODE_LOWER;
+
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.jcusolver.JCusolverDn;
+import jcuda.jcusolver.cusolverDnHandle;
+import jcuda.runtime.JCuda;
+
+/**
+ * Benchmark for the calls that return a value in an <code>int[]</code>
+ * output parameter, using cusolverDnDpotrf_bufferSize
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+@State(Scope.Thread)
+public class OutParameterCallBenchmark
+{
+    /**
+     * The size of the matrix
+     */
+    @Param({"16"})
+    public int n;
+    
+    /**
+     * The handle
+     */
+    private cusolverDnHandle handle;
+    
+    /**
+     * The matrix in device memory
+     */
+    private Pointer deviceA;
+    
+    /**
+     * The output parameter
+     */
+    private int lwork[];
+    
+    /**
+     * Create the handle and the device data
+     */
+    @Setup
+    public void setup()
+    {
+        handle = new cusolverDnHandle();
+        JCusolverDn.cusolverDnCreate(handle);
+        deviceA = new Pointer();
+        JCuda.cudaMalloc(deviceA, n * n * Sizeof.DOUBLE);
+        lwork = new int[1];
+    }
+    
+    /**
+     * Destroy the handle and free the device data
+     */
+    @TearDown
+    public void tearDown()
+    {
+        JCuda.cudaFree(deviceA);
+        JCusolverDn.cusolverDnDestroy(handle);
+    }
+    
+    /**
+     * Call cusolverDnDpotrf_bufferSize
+     * 
+     * @return The buffer size
+     */
+    @Benchmark
+    public int potrfBufferSize()
+    {
+        JCusolverDn.cusolverDnDpotrf_bufferSize(handle, 
+            CUBLAS_FILL_MODE_LOWER, n, deviceA, n, lwork);
+        return lwork[0];
+    }
+}
@@ -0,0 +1,314 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// A microbenchmark for the functions of JCudaCommonJNI that all JCusolver
+// functions use for marshalling their arguments. It creates a JVM with 
+// the invocation API, and prints the results as JSON to stdout.
+//
+// Usage:
+//   JCusolverMicrobenchmark <classpath> [iterations]
+//
+// The classpath must contain the JCuda JAR, because the PointerUtils
+// require the jcuda.Pointer class.
+
+#include <jni.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JNIUtils.hpp"
+#include "PointerUtils.hpp"
+
+namespace
+{
+    /**
+     * The number of timed rounds for each benchmark
+     */
+    const int ROUNDS = 7;
+
+    /**
+     * A sink for the results, so that the calls are not optimized away
+     */
+    volatile long long sink = 0;
+
+    /**
+     * The result of one benchmark
+     */
+    struct Result
+    {
+        std::string name;
+        long long iterations;
+        double minNsPerOp;
+        double medianNsPerOp;
+    };
+
+    /**
+     * Runs the given function for the given number of iterations in 
+     * each round, after one warmup round, and returns the result
+     */
+    template <typename F>
+    Result run(const char *name, long long iterations, F f)
+    {
+        f(iterations);
+        std::vector<double> nsPerOp;
+        for (int r = 0; r < ROUNDS; r++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            f(iterations);
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            nsPerOp.push_back(ns / iterations);
+        }
+        std::sort(nsPerOp.begin(), nsPerOp.end());
+        Result result;
+        result.name = name;
+        result.iterations = iterations;
+        result.minNsPerOp = nsPerOp.front();
+        result.medianNsPerOp = nsPerOp[ROUNDS / 2];
+        return result;
+    }
+
+    /**
+     * Calls the static method of jcuda.Pointer with the given signature,
+     * to create a pointer to the given object, and returns the pointer
+     * as a global reference
+     */
+    jobject createPointer(JNIEnv *env, const char *signature, jobject object)
+    {
+        jclass cls = env->FindClass("jcuda/Pointer");
+        if (cls == NULL)
+        {
+            return NULL;
+        }
+        jmethodID method = env->GetStaticMethodID(cls, "to", signature);
+        if (method == NULL)
+        {
+            return NULL;
+        }
+        jobject pointer = env->CallStaticObjectMethod(cls, method, object);
+        if (pointer == NULL)
+        {
+            return NULL;
+        }
+        return env->NewGlobalRef(pointer);
+    }
+
+    /**
+     * Runs all benchmarks, and returns the results
+     */
+    std::vector<Result> runAll(JNIEnv *env, long long iterations)
+    {
+        std::vector<Result> results;
+
+        // A pointer with a native pointer value, as it is used for 
+        // device memory
+        jclass pointerClass = env->FindClass("jcuda/Pointer");
+        jmethodID constructor = env->GetMethodID(pointerClass, "<init>", "()V");
+        jobject devicePointer = env->NewGlobalRef(env->NewObject(pointerClass, constructor));
+        static double deviceData[16];
+        setNativePointerValue(env, devicePointer, (jlong)(intptr_t)deviceData);
+
+        // A pointer to a Java array
+        jobject javaArray = env->NewGlobalRef(env->NewDoubleArray(16));
+        jobject arrayPointer = createPointer(env, "([D)Ljcuda/Pointer;", javaArray);
+
+        // A pointer to a direct buffer
+        static char bufferData[128];
+        jobject buffer = env->NewDirectByteBuffer(bufferData, sizeof(bufferData));
+        jobject directPointer = createPointer(env, "(Ljava/nio/ByteBuffer;)Ljcuda/Pointer;", buffer);
+
+        // An int[] for the output parameters
+        jintArray intArray = (jintArray)env->NewGlobalRef(env->NewIntArray(1));
+
+        if (devicePointer == NULL || arrayPointer == NULL || directPointer == NULL || intArray == NULL)
+        {
+            std::fprintf(stderr, "Could not create the pointers\n");
+            return results;
+        }
+
+        results.push_back(run("getNativePointerValue", iterations, [&](long long n)
+        {
+            for (long long i = 0; i < n; i++)
+            {
+                sink += getNativePointerValue(env, devicePointer);
+            }
+        }));
+        results.push_back(run("getPointer", iterations, [&](long long n)
+        {
+            for (long long i = 0; i < n; i++)
+            {
+                sink += (long long)(intptr_t)getPointer(env, devicePointer);
+            }
+        }));
+
+        // The pointer data is released with mode 0, as in all wrappers
+        const char *pointerNames[] = 
+        {
+            "initReleasePointerData/device",
+            "initReleasePointerData/javaArray",
+            "initReleasePointerData/directBuffer"
+        };
+        jobject pointers[] = { devicePointer, arrayPointer, directPointer };
+        for (int p = 0; p < 3; p++)
+        {
+            jobject pointer = pointers[p];
+            results.push_back(run(pointerNames[p], iterations, [&](long long n)
+            {
+                for (long long i = 0; i < n; i++)
+                {
+                    PointerData *pointerData = initPointerData(env, pointer);
+                    if (pointerData == NULL)
+                    {
+                        return;
+                    }
+                    sink += (long long)(intptr_t)pointerData->getPointer(env);
+                    releasePointerData(env, pointerData, 0);
+                }
+            }));
+        }
+
+        results.push_back(run("set/intArray", iterations, [&](long long n)
+        {
+            for (long long i = 0; i < n; i++)
+            {
+                sink += set(env, intArray, 0, (jint)i);
+            }
+        }));
+
+        // The default log level is LOG_ERROR, so this only measures
+        // the level check
+        Logger::setLogLevel(LOG_ERROR);
+        results.push_back(run("Logger::log/disabled", iterations, [&](long long n)
+        {
+            for (long long i = 0; i < n; i++)
+            {
+                Logger::log(LOG_TRACE, "Executing benchmark(i=%lld, pointer=%p)\n", i, devicePointer);
+            }
+        }));
+
+        // Throwing is slow, so fewer iterations are used. The local 
+        // references of each block are released with a local frame.
+        results.push_back(run("ThrowByName", std::max(1LL, iterations / 100), [&](long long n)
+        {
+            for (long long i = 0; i < n; i += 100)
+            {
+                env->PushLocalFrame(16);
+                for (long long j = i; j < n && j < i + 100; j++)
+                {
+                    ThrowByName(env, "java/lang/NullPointerException", "Parameter 'handle' is null for benchmark");
+                    env->ExceptionClear();
+                }
+                env->PopLocalFrame(NULL);
+            }
+        }));
+
+        env->DeleteGlobalRef(devicePointer);
+        env->DeleteGlobalRef(javaArray);
+        env->DeleteGlobalRef(arrayPointer);
+        env->DeleteGlobalRef(directPointer);
+        env->DeleteGlobalRef(intArray);
+        return results;
+    }
+
+    /**
+     * Prints the given results as JSON to stdout
+     */
+    void printJson(const std::vector<Result> &results)
+    {
+        std::printf("{\n  \"benchmarks\": [\n");
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result &r = results[i];
+            std::printf("    { \"name\": \"%s\", \"iterations\": %lld, \"rounds\": %d, "
+                "\"minNsPerOp\": %.3f, \"medianNsPerOp\": %.3f }%s\n",
+                r.name.c_str(), r.iterations, ROUNDS, r.minNsPerOp, r.medianNsPerOp,
+                i + 1 < results.size() ? "," : "");
+        }
+        std::printf("  ]\n}\n");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s <classpath> [iterations]\n", argv[0]);
+        return 1;
+    }
+    long long iterations = argc > 2 ? std::atoll(argv[2]) : 1000000;
+    if (iterations <= 0)
+    {
+        std::fprintf(stderr, "Invalid number of iterations: %s\n", argv[2]);
+        return 1;
+    }
+
+    std::string classPath = std::string("-Djava.class.path=") + argv[1];
+    JavaVMOption options[1];
+    options[0].optionString = (char*)classPath.c_str();
+    options[0].extraInfo = NULL;
+    JavaVMInitArgs args;
+    args.version = JNI_VERSION_1_8;
+    args.nOptions = 1;
+    args.options = options;
+    args.ignoreUnrecognized = JNI_FALSE;
+
+    JavaVM *jvm = NULL;
+    JNIEnv *env = NULL;
+    if (JNI_CreateJavaVM(&jvm, (void**)&env, &args) != JNI_OK)
+    {
+        std::fprintf(stderr, "Could not create the JVM\n");
+        return 1;
+    }
+    if (initJNIUtils(env) == JNI_ERR || initPointerUtils(env) == JNI_ERR)
+    {
+        std::fprintf(stderr, "Could not initialize the JCudaCommonJNI utilities. "
+            "Is the JCuda JAR in the classpath?\n");
+        if (env->ExceptionCheck())
+        {
+            env->ExceptionDescribe();
+        }
+        jvm->DestroyJavaVM();
+        return 1;
+    }
+
+    std::vector<Result> results = runAll(env, iterations);
+    if (env->ExceptionCheck())
+    {
+        env->ExceptionDescribe();
+        jvm->DestroyJavaVM();
+        return 1;
+    }
+    printJson(results);
+    jvm->DestroyJavaVM();
+    return results.empty() ? 1 : 0;
+}
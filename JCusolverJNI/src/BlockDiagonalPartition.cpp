@@ -0,0 +1,605 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "BlockDiagonalPartition.hpp"
+#include "JCusolver_common.hpp"
+#include "HostUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// The number of rows that one thread processes at once
+#define ROW_GRAIN 4096
+
+// The indices of the results of createNative. These must match the 
+// constants in BlockDiagonalPartition.java
+#define RESULT_PIECE_COUNT 0
+#define RESULT_COMPONENT_COUNT 1
+#define RESULT_LARGEST_COMPONENT_ROWS 2
+#define RESULT_LARGEST_COMPONENT_NNZ 3
+#define RESULT_COUNT 4
+
+/**
+ * The native state of a BlockDiagonalPartition$State. The rows of the
+ * matrix are grouped into pieces, where each piece consists of whole
+ * connected components of the graph of the matrix, and can thus be 
+ * solved independently. Each piece can be indexed with 32 bit.
+ */
+struct PartitionState
+{
+    int64_t n;
+    int indexBase;
+
+    // The rows of all pieces, in ascending order within each piece
+    std::vector<int64_t> rows;
+
+    // The offsets of the pieces in the rows vector
+    std::vector<int64_t> pieceOffsets;
+
+    // The number of nonzeros of each piece
+    std::vector<int64_t> pieceNnz;
+
+    // The number of components of each piece
+    std::vector<int32_t> pieceComponents;
+
+    // The index of each row within its piece
+    std::vector<int32_t> localIndex;
+};
+
+/**
+ * Finds the root of the given element in the given lock-free union-find 
+ * structure, with path halving
+ */
+static int64_t findRoot(std::vector<std::atomic<int64_t> > &parent, int64_t x)
+{
+    while (true)
+    {
+        int64_t p = parent[x].load(std::memory_order_relaxed);
+        if (p == x)
+        {
+            return x;
+        }
+        int64_t gp = parent[p].load(std::memory_order_relaxed);
+        if (gp != p)
+        {
+            parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+        }
+        x = gp;
+    }
+}
+
+/**
+ * Merges the sets of the given elements in the given lock-free union-find
+ * structure, linking the larger root to the smaller one
+ */
+static void unite(std::vector<std::atomic<int64_t> > &parent, int64_t a, int64_t b)
+{
+    while (true)
+    {
+        a = findRoot(parent, a);
+        b = findRoot(parent, b);
+        if (a == b)
+        {
+            return;
+        }
+        if (a < b)
+        {
+            std::swap(a, b);
+        }
+        int64_t expected = a;
+        if (parent[a].compare_exchange_strong(expected, b))
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * Computes the partition for the given matrix. Returns 
+ * CUSOLVER_STATUS_INVALID_VALUE if the row pointers do not start at the
+ * index base, decrease, or do not end at nnz plus the index base, or if
+ * a column index is out of range, and CUSOLVER_STATUS_NOT_SUPPORTED if 
+ * a single component can not be indexed with 32 bit.
+ */
+static cusolverStatus_t createPartition(int64_t n, int64_t nnz, int indexBase, 
+    const int64_t *rowPtr, const int64_t *colInd, int64_t maxPieceNnz,
+    PartitionState *state, jlong results[])
+{
+    if (n < 0 || nnz < 0 || rowPtr[0] != indexBase || rowPtr[n] - indexBase != nnz)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    // Validate all row pointers before any column index is read, so 
+    // that every row range lies within [0, nnz)
+    std::atomic<bool> invalid(false);
+    parallelFor((size_t)n, ROW_GRAIN * 16, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            if (rowPtr[i + 1] < rowPtr[i] || rowPtr[i + 1] - indexBase > nnz)
+            {
+                invalid.store(true);
+                return;
+            }
+        }
+    });
+    if (invalid.load())
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    std::vector<std::atomic<int64_t> > parent(n);
+    parallelFor((size_t)n, ROW_GRAIN * 16, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            parent[i].store((int64_t)i, std::memory_order_relaxed);
+        }
+    });
+    parallelFor((size_t)n, ROW_GRAIN, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            for (int64_t k = rowPtr[i] - indexBase; k < rowPtr[i + 1] - indexBase; k++)
+            {
+                int64_t j = colInd[k] - indexBase;
+                if (j < 0 || j >= n)
+                {
+                    invalid.store(true);
+                    return;
+                }
+                if (j != (int64_t)i)
+                {
+                    unite(parent, (int64_t)i, j);
+                }
+            }
+        }
+    });
+    if (invalid.load())
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    // Compute the root of each row. Since roots are the smallest rows
+    // of their components, numbering the roots in ascending order 
+    // numbers the components by their first row.
+    std::vector<int64_t> root(n);
+    parallelFor((size_t)n, ROW_GRAIN, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            root[i] = findRoot(parent, (int64_t)i);
+        }
+    });
+    std::vector<std::atomic<int64_t> >().swap(parent);
+
+    std::vector<int64_t> componentRows;
+    std::vector<int64_t> componentNnz;
+    for (int64_t i = 0; i < n; i++)
+    {
+        if (root[i] == i)
+        {
+            root[i] = (int64_t)componentRows.size();
+            componentRows.push_back(0);
+            componentNnz.push_back(0);
+        }
+        else
+        {
+            root[i] = root[root[i]];
+        }
+        componentRows[root[i]]++;
+        componentNnz[root[i]] += rowPtr[i + 1] - rowPtr[i];
+    }
+
+    // Assign the components to pieces, greedily in the order of their
+    // first rows
+    int64_t componentCount = (int64_t)componentRows.size();
+    std::vector<int32_t> pieceOf(componentCount);
+    int64_t largestRows = 0;
+    int64_t largestNnz = 0;
+    int64_t currentRows = 0;
+    int64_t currentNnz = 0;
+    for (int64_t c = 0; c < componentCount; c++)
+    {
+        largestRows = std::max(largestRows, componentRows[c]);
+        largestNnz = std::max(largestNnz, componentNnz[c]);
+        if (componentRows[c] > INT_MAX || componentNnz[c] > INT_MAX)
+        {
+            results[RESULT_COMPONENT_COUNT] = componentCount;
+            results[RESULT_LARGEST_COMPONENT_ROWS] = componentRows[c];
+            results[RESULT_LARGEST_COMPONENT_NNZ] = componentNnz[c];
+            return CUSOLVER_STATUS_NOT_SUPPORTED;
+        }
+        bool fits = 
+            currentRows + componentRows[c] <= INT_MAX &&
+            currentNnz + componentNnz[c] <= std::min<int64_t>(maxPieceNnz, INT_MAX);
+        if (state->pieceNnz.empty() || !fits)
+        {
+            state->pieceNnz.push_back(0);
+            state->pieceComponents.push_back(0);
+            state->pieceOffsets.push_back(0);
+            currentRows = 0;
+            currentNnz = 0;
+        }
+        pieceOf[c] = (int32_t)(state->pieceNnz.size() - 1);
+        currentRows += componentRows[c];
+        currentNnz += componentNnz[c];
+        state->pieceNnz.back() = currentNnz;
+        state->pieceComponents.back()++;
+        state->pieceOffsets.back() = currentRows;
+    }
+
+    // Convert the piece sizes into offsets, and sort the rows by piece
+    size_t pieceCount = state->pieceNnz.size();
+    int64_t offset = 0;
+    for (size_t p = 0; p < pieceCount; p++)
+    {
+        int64_t rows = state->pieceOffsets[p];
+        state->pieceOffsets[p] = offset;
+        offset += rows;
+    }
+    state->pieceOffsets.push_back(offset);
+    std::vector<int64_t> fill(state->pieceOffsets.begin(), state->pieceOffsets.end() - 1);
+    state->rows.resize(n);
+    state->localIndex.resize(n);
+    for (int64_t i = 0; i < n; i++)
+    {
+        int32_t p = pieceOf[root[i]];
+        int64_t position = fill[p]++;
+        state->rows[position] = i;
+        state->localIndex[i] = (int32_t)(position - state->pieceOffsets[p]);
+    }
+    state->n = n;
+    state->indexBase = indexBase;
+
+    results[RESULT_PIECE_COUNT] = (jlong)pieceCount;
+    results[RESULT_COMPONENT_COUNT] = componentCount;
+    results[RESULT_LARGEST_COMPONENT_ROWS] = largestRows;
+    results[RESULT_LARGEST_COMPONENT_NNZ] = largestNnz;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_createNative(JNIEnv *env, jclass cls, jlong n, jlong nnz, jint indexBase, jobject csrRowPtrA, jobject csrColIndA, jlong maxPieceNnz, jobject state, jlongArray results)
+{
+    if (csrRowPtrA == NULL || csrColIndA == NULL || state == NULL || results == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for BlockDiagonalPartition create");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    Logger::log(LOG_TRACE, "Executing BlockDiagonalPartition create(n=%ld, nnz=%ld, maxPieceNnz=%ld)\n", 
+        (long)n, (long)nnz, (long)maxPieceNnz);
+
+    PointerData *csrRowPtrA_pointerData = initPointerData(env, csrRowPtrA);
+    if (csrRowPtrA_pointerData == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *csrColIndA_pointerData = initPointerData(env, csrColIndA);
+    if (csrColIndA_pointerData == NULL)
+    {
+        releasePointerData(env, csrRowPtrA_pointerData, JNI_ABORT);
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    PartitionState *partition = new PartitionState();
+    jlong output[RESULT_COUNT] = { 0, 0, 0, 0 };
+    cusolverStatus_t status = createPartition(n, nnz, indexBase,
+        (const int64_t*)csrRowPtrA_pointerData->getPointer(env),
+        (const int64_t*)csrColIndA_pointerData->getPointer(env),
+        maxPieceNnz, partition, output);
+
+    if (!releasePointerData(env, csrRowPtrA_pointerData, JNI_ABORT)) status = (cusolverStatus_t)JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, csrColIndA_pointerData, JNI_ABORT)) status = (cusolverStatus_t)JCUSOLVER_STATUS_INTERNAL_ERROR;
+    env->SetLongArrayRegion(results, 0, RESULT_COUNT, output);
+    if (status != CUSOLVER_STATUS_SUCCESS)
+    {
+        delete partition;
+        return status;
+    }
+    setNativePointerValue(env, state, (jlong)partition);
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_getPieceSizesNative(JNIEnv *env, jclass cls, jobject state, jintArray rows, jintArray nnz, jintArray components)
+{
+    if (state == NULL || rows == NULL || nnz == NULL || components == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for BlockDiagonalPartition getPieceSizes");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PartitionState *partition = (PartitionState*)getNativePointerValue(env, state);
+    if (partition == NULL)
+    {
+        ThrowByName(env, "java/lang/IllegalStateException", "The partition has been destroyed");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    jsize pieceCount = (jsize)partition->pieceNnz.size();
+    std::vector<jint> rowsNative(pieceCount);
+    std::vector<jint> nnzNative(pieceCount);
+    for (jsize p = 0; p < pieceCount; p++)
+    {
+        rowsNative[p] = (jint)(partition->pieceOffsets[p + 1] - partition->pieceOffsets[p]);
+        nnzNative[p] = (jint)partition->pieceNnz[p];
+    }
+    env->SetIntArrayRegion(rows, 0, pieceCount, rowsNative.data());
+    env->SetIntArrayRegion(nnz, 0, pieceCount, nnzNative.data());
+    env->SetIntArrayRegion(components, 0, pieceCount, partition->pieceComponents.data());
+    return env->ExceptionCheck() ? JCUSOLVER_STATUS_INTERNAL_ERROR : CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_extractNative(JNIEnv *env, jclass cls, jobject state, jint piece, jobject csrRowPtrA, jobject csrColIndA, jobject csrValA, jintArray csrRowPtrB, jintArray csrColIndB, jdoubleArray csrValB)
+{
+    if (state == NULL || csrRowPtrA == NULL || csrColIndA == NULL || csrRowPtrB == NULL || csrColIndB == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for BlockDiagonalPartition extract");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    // csrValA and csrValB may be null
+
+    Logger::log(LOG_TRACE, "Executing BlockDiagonalPartition extract(piece=%d)\n", piece);
+
+    PartitionState *partition = (PartitionState*)getNativePointerValue(env, state);
+    if (partition == NULL)
+    {
+        ThrowByName(env, "java/lang/IllegalStateException", "The partition has been destroyed");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    if (piece < 0 || (size_t)piece + 1 >= partition->pieceOffsets.size())
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    PointerData *csrRowPtrA_pointerData = initPointerData(env, csrRowPtrA);
+    if (csrRowPtrA_pointerData == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *csrColIndA_pointerData = initPointerData(env, csrColIndA);
+    if (csrColIndA_pointerData == NULL)
+    {
+        releasePointerData(env, csrRowPtrA_pointerData, JNI_ABORT);
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *csrValA_pointerData = NULL;
+    if (csrValA != NULL && csrValB != NULL)
+    {
+        csrValA_pointerData = initPointerData(env, csrValA);
+        if (csrValA_pointerData == NULL)
+        {
+            releasePointerData(env, csrRowPtrA_pointerData, JNI_ABORT);
+            releasePointerData(env, csrColIndA_pointerData, JNI_ABORT);
+            return JCUSOLVER_STATUS_INTERNAL_ERROR;
+        }
+    }
+    const int64_t *rowPtr = (const int64_t*)csrRowPtrA_pointerData->getPointer(env);
+    const int64_t *colInd = (const int64_t*)csrColIndA_pointerData->getPointer(env);
+    const double *val = csrValA_pointerData == NULL ? NULL : (const double*)csrValA_pointerData->getPointer(env);
+    int64_t base = partition->indexBase;
+    const int64_t *rows = partition->rows.data() + partition->pieceOffsets[piece];
+    size_t rowCount = (size_t)(partition->pieceOffsets[piece + 1] - partition->pieceOffsets[piece]);
+    {
+        CriticalArray<jint> rowPtrB(env, csrRowPtrB, true);
+        CriticalArray<jint> colIndB(env, csrColIndB, true);
+        CriticalArray<jdouble> valB(env, val == NULL ? NULL : csrValB, true);
+        if (!rowPtrB.isFailed() && !colIndB.isFailed() && !valB.isFailed())
+        {
+            jint *rp = rowPtrB.data();
+            jint *ci = colIndB.data();
+            jdouble *v = valB.data();
+            rp[0] = 0;
+            for (size_t r = 0; r < rowCount; r++)
+            {
+                rp[r + 1] = rp[r] + (jint)(rowPtr[rows[r] + 1] - rowPtr[rows[r]]);
+            }
+            const int32_t *localIndex = partition->localIndex.data();
+            parallelFor(rowCount, ROW_GRAIN, [&](size_t begin, size_t end)
+            {
+                for (size_t r = begin; r < end; r++)
+                {
+                    int64_t start = rowPtr[rows[r]] - base;
+                    int64_t length = rowPtr[rows[r] + 1] - rowPtr[rows[r]];
+                    for (int64_t k = 0; k < length; k++)
+                    {
+                        ci[rp[r] + k] = localIndex[colInd[start + k] - base];
+                    }
+                    if (v != NULL)
+                    {
+                        std::memcpy(v + rp[r], val + start, (size_t)length * sizeof(double));
+                    }
+                }
+            });
+        }
+    }
+
+    if (!releasePointerData(env, csrRowPtrA_pointerData, JNI_ABORT)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, csrColIndA_pointerData, JNI_ABORT)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (csrValA_pointerData != NULL && !releasePointerData(env, csrValA_pointerData, JNI_ABORT)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    return env->ExceptionCheck() ? JCUSOLVER_STATUS_INTERNAL_ERROR : CUSOLVER_STATUS_SUCCESS;
+}
+
+/**
+ * Returns the number of bytes that are available behind the given
+ * Pointer, if it points to a Java array or a buffer, or -1 if it points
+ * to native memory, whose size is not known. 
+ */
+static jlong getAvailableBytes(JNIEnv *env, jobject pointer)
+{
+    // The field and method IDs and the buffer classes, which are
+    // initialized once
+    struct BufferInfo
+    {
+        jfieldID buffer = NULL;
+        jfieldID byteOffset = NULL;
+        jmethodID capacity = NULL;
+        jclass classes[7] = {};
+        int elementSizes[7] = { 1, 2, 2, 4, 4, 8, 8 };
+        bool valid = false;
+
+        BufferInfo(JNIEnv *env)
+        {
+            const char *names[] = { "java/nio/ByteBuffer", "java/nio/CharBuffer", "java/nio/ShortBuffer", 
+                "java/nio/IntBuffer", "java/nio/FloatBuffer", "java/nio/LongBuffer", "java/nio/DoubleBuffer" };
+            for (int i = 0; i < 7; i++)
+            {
+                jclass localClass = env->FindClass(names[i]);
+                if (localClass == NULL)
+                {
+                    return;
+                }
+                classes[i] = (jclass)env->NewGlobalRef(localClass);
+                env->DeleteLocalRef(localClass);
+            }
+            jclass pointerClass = env->FindClass("jcuda/Pointer");
+            jclass bufferClass = env->FindClass("java/nio/Buffer");
+            if (pointerClass == NULL || bufferClass == NULL)
+            {
+                return;
+            }
+            buffer = env->GetFieldID(pointerClass, "buffer", "Ljava/nio/Buffer;");
+            byteOffset = env->GetFieldID(pointerClass, "byteOffset", "J");
+            capacity = env->GetMethodID(bufferClass, "capacity", "()I");
+            env->DeleteLocalRef(pointerClass);
+            env->DeleteLocalRef(bufferClass);
+            valid = buffer != NULL && byteOffset != NULL && capacity != NULL;
+        }
+    };
+    static BufferInfo info(env);
+    if (!info.valid)
+    {
+        return -1;
+    }
+    jobject buffer = env->GetObjectField(pointer, info.buffer);
+    if (buffer == NULL)
+    {
+        return -1;
+    }
+    int elementSize = 0;
+    for (int i = 0; i < 7 && elementSize == 0; i++)
+    {
+        if (env->IsInstanceOf(buffer, info.classes[i]))
+        {
+            elementSize = info.elementSizes[i];
+        }
+    }
+    jlong capacity = env->CallIntMethod(buffer, info.capacity);
+    env->DeleteLocalRef(buffer);
+    jlong byteOffset = env->GetLongField(pointer, info.byteOffset);
+    return capacity * elementSize - byteOffset;
+}
+
+/**
+ * Implementation of gatherNative and scatterNative: Copies between the
+ * elements of a global vector that belong to the given piece, and a 
+ * local vector of the piece. Returns CUSOLVER_STATUS_INVALID_VALUE if
+ * the local vector is too small for the piece, or if the global vector 
+ * is a Java array or buffer with less than n elements. 
+ */
+static jint transferPiece(JNIEnv *env, jobject state, jint piece, jobject global, jdoubleArray local, bool toLocal)
+{
+    if (state == NULL || global == NULL || local == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for BlockDiagonalPartition vector transfer");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PartitionState *partition = (PartitionState*)getNativePointerValue(env, state);
+    if (partition == NULL)
+    {
+        ThrowByName(env, "java/lang/IllegalStateException", "The partition has been destroyed");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    if (piece < 0 || (size_t)piece + 1 >= partition->pieceOffsets.size())
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    size_t rowCount = (size_t)(partition->pieceOffsets[piece + 1] - partition->pieceOffsets[piece]);
+    jlong globalBytes = getAvailableBytes(env, global);
+    if (env->ExceptionCheck())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    if ((size_t)env->GetArrayLength(local) < rowCount ||
+        (globalBytes >= 0 && globalBytes < partition->n * (jlong)sizeof(double)))
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    PointerData *global_pointerData = initPointerData(env, global);
+    if (global_pointerData == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    double *globalNative = (double*)global_pointerData->getPointer(env);
+    const int64_t *rows = partition->rows.data() + partition->pieceOffsets[piece];
+    {
+        CriticalArray<jdouble> localArray(env, local, toLocal);
+        if (!localArray.isFailed())
+        {
+            jdouble *localNative = localArray.data();
+            parallelFor(rowCount, ROW_GRAIN * 16, [&](size_t begin, size_t end)
+            {
+                for (size_t r = begin; r < end; r++)
+                {
+                    if (toLocal)
+                    {
+                        localNative[r] = globalNative[rows[r]];
+                    }
+                    else
+                    {
+                        globalNative[rows[r]] = localNative[r];
+                    }
+                }
+            });
+        }
+    }
+    if (!releasePointerData(env, global_pointerData, toLocal ? JNI_ABORT : 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    return env->ExceptionCheck() ? JCUSOLVER_STATUS_INTERNAL_ERROR : CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_gatherNative(JNIEnv *env, jclass cls, jobject state, jint piece, jobject b, jdoubleArray bPiece)
+{
+    return transferPiece(env, state, piece, b, bPiece, true);
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_scatterNative(JNIEnv *env, jclass cls, jobject state, jint piece, jdoubleArray xPiece, jobject x)
+{
+    return transferPiece(env, state, piece, x, xPiece, false);
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_destroyNative(JNIEnv *env, jclass cls, jobject state)
+{
+    if (state == NULL)
+    {
+        return;
+    }
+    Logger::log(LOG_TRACE, "Executing BlockDiagonalPartition destroy\n");
+    PartitionState *partition = (PartitionState*)getNativePointerValue(env, state);
+    delete partition;
+    setNativePointerValue(env, state, 0);
+}
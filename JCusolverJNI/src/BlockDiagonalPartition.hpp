@@ -0,0 +1,89 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+ /* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class jcuda_jcusolver_BlockDiagonalPartition */
+
+#ifndef _Included_jcuda_jcusolver_BlockDiagonalPartition
+#define _Included_jcuda_jcusolver_BlockDiagonalPartition
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*
+     * Class:     jcuda_jcusolver_BlockDiagonalPartition
+     * Method:    createNative
+     * Signature: (JJILjcuda/Pointer;Ljcuda/Pointer;JLjcuda/jcusolver/BlockDiagonalPartition$State;[J)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_createNative
+        (JNIEnv *, jclass, jlong, jlong, jint, jobject, jobject, jlong, jobject, jlongArray);
+
+    /*
+     * Class:     jcuda_jcusolver_BlockDiagonalPartition
+     * Method:    getPieceSizesNative
+     * Signature: (Ljcuda/jcusolver/BlockDiagonalPartition$State;[I[I[I)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_getPieceSizesNative
+        (JNIEnv *, jclass, jobject, jintArray, jintArray, jintArray);
+
+    /*
+     * Class:     jcuda_jcusolver_BlockDiagonalPartition
+     * Method:    extractNative
+     * Signature: (Ljcuda/jcusolver/BlockDiagonalPartition$State;ILjcuda/Pointer;Ljcuda/Pointer;Ljcuda/Pointer;[I[I[D)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_extractNative
+        (JNIEnv *, jclass, jobject, jint, jobject, jobject, jobject, jintArray, jintArray, jdoubleArray);
+
+    /*
+     * Class:     jcuda_jcusolver_BlockDiagonalPartition
+     * Method:    gatherNative
+     * Signature: (Ljcuda/jcusolver/BlockDiagonalPartition$State;ILjcuda/Pointer;[D)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_gatherNative
+        (JNIEnv *, jclass, jobject, jint, jobject, jdoubleArray);
+
+    /*
+     * Class:     jcuda_jcusolver_BlockDiagonalPartition
+     * Method:    scatterNative
+     * Signature: (Ljcuda/jcusolver/BlockDiagonalPartition$State;I[DLjcuda/Pointer;)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_scatterNative
+        (JNIEnv *, jclass, jobject, jint, jdoubleArray, jobject);
+
+    /*
+     * Class:     jcuda_jcusolver_BlockDiagonalPartition
+     * Method:    destroyNative
+     * Signature: (Ljcuda/jcusolver/BlockDiagonalPartition$State;)V
+     */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_BlockDiagonalPartition_destroyNative
+        (JNIEnv *, jclass, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
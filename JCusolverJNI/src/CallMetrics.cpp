@@ -0,0 +1,374 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CallMetrics.hpp"
+#include "JCusolver_common.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// The maximum number of functions for which metrics are recorded
+#define METRICS_MAX_FUNCTIONS 2048
+
+// The indices of the counters. These must match the constants in 
+// CallMetrics.java
+#define METRICS_CALLS 0
+#define METRICS_ERRORS 1
+#define METRICS_TOTAL_NS 2
+#define METRICS_COUNTERS 3
+
+// The number of status slots. Each status up to and including
+// CUSOLVER_STATUS_INVALID_WORKSPACE (31) has its own slot. Statuses that 
+// are negative or larger are counted in the last slot. This must match 
+// the constant in CallMetrics.java
+#define METRICS_STATUS_SLOTS 33
+
+// The latency histogram is log-linear, as in HdrHistogram: Each power 
+// of two is divided into 2^METRICS_SUB_BUCKET_BITS linear sub-buckets, 
+// so that the relative error is at most 1/16. This must match the 
+// constants in CallMetrics.java
+#define METRICS_SUB_BUCKET_BITS 4
+#define METRICS_SUB_BUCKETS (1 << METRICS_SUB_BUCKET_BITS)
+#define METRICS_BUCKETS (METRICS_SUB_BUCKETS + (64 - METRICS_SUB_BUCKET_BITS) * METRICS_SUB_BUCKETS)
+
+namespace
+{
+    /**
+     * The metrics of one function in one thread. The values are only 
+     * written by the owning thread, and read by the thread that 
+     * collects the metrics.
+     */
+    struct FunctionMetrics
+    {
+        std::atomic<uint64_t> counters[METRICS_COUNTERS];
+        std::atomic<uint64_t> statuses[METRICS_STATUS_SLOTS];
+        std::atomic<uint64_t> buckets[METRICS_BUCKETS];
+
+        FunctionMetrics()
+        {
+            for (auto &v : counters) v.store(0, std::memory_order_relaxed);
+            for (auto &v : statuses) v.store(0, std::memory_order_relaxed);
+            for (auto &v : buckets) v.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * The accumulated metrics of one function, used for the metrics of 
+     * threads that have ended, for the baseline that is subtracted 
+     * after a reset, and for the results
+     */
+    struct FunctionTotals
+    {
+        uint64_t counters[METRICS_COUNTERS];
+        uint64_t statuses[METRICS_STATUS_SLOTS];
+        uint64_t buckets[METRICS_BUCKETS];
+
+        FunctionTotals()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            std::memset(this, 0, sizeof(FunctionTotals));
+        }
+
+        void add(const FunctionMetrics &m)
+        {
+            for (int i = 0; i < METRICS_COUNTERS; i++) counters[i] += m.counters[i].load(std::memory_order_relaxed);
+            for (int i = 0; i < METRICS_STATUS_SLOTS; i++) statuses[i] += m.statuses[i].load(std::memory_order_relaxed);
+            for (int i = 0; i < METRICS_BUCKETS; i++) buckets[i] += m.buckets[i].load(std::memory_order_relaxed);
+        }
+
+        void add(const FunctionTotals &t)
+        {
+            for (int i = 0; i < METRICS_COUNTERS; i++) counters[i] += t.counters[i];
+            for (int i = 0; i < METRICS_STATUS_SLOTS; i++) statuses[i] += t.statuses[i];
+            for (int i = 0; i < METRICS_BUCKETS; i++) buckets[i] += t.buckets[i];
+        }
+
+        void subtract(const FunctionTotals &t)
+        {
+            for (int i = 0; i < METRICS_COUNTERS; i++) counters[i] -= t.counters[i];
+            for (int i = 0; i < METRICS_STATUS_SLOTS; i++) statuses[i] -= t.statuses[i];
+            for (int i = 0; i < METRICS_BUCKETS; i++) buckets[i] -= t.buckets[i];
+        }
+    };
+
+    /**
+     * The metrics of one thread. The function metrics are created when 
+     * the thread calls the function for the first time.
+     */
+    struct ThreadMetrics
+    {
+        std::atomic<FunctionMetrics*> functions[METRICS_MAX_FUNCTIONS];
+
+        ThreadMetrics()
+        {
+            for (auto &f : functions) f.store(NULL, std::memory_order_relaxed);
+        }
+
+        ~ThreadMetrics()
+        {
+            for (auto &f : functions) delete f.load(std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * The global state. The mutex protects the list of threads, the
+     * metrics of threads that have ended, and the baseline.
+     */
+    std::mutex mutex;
+    std::vector<ThreadMetrics*> threads;
+    std::vector<std::unique_ptr<FunctionTotals> > retired(METRICS_MAX_FUNCTIONS);
+    std::vector<std::unique_ptr<FunctionTotals> > baseline(METRICS_MAX_FUNCTIONS);
+
+    /**
+     * Moves the metrics of a thread into the 'retired' totals when the
+     * thread ends
+     */
+    struct ThreadMetricsHolder
+    {
+        ThreadMetrics *metrics = NULL;
+
+        ~ThreadMetricsHolder()
+        {
+            if (metrics == NULL)
+            {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            for (int i = 0; i < METRICS_MAX_FUNCTIONS; i++)
+            {
+                FunctionMetrics *f = metrics->functions[i].load(std::memory_order_relaxed);
+                if (f != NULL)
+                {
+                    if (!retired[i])
+                    {
+                        retired[i].reset(new FunctionTotals());
+                    }
+                    retired[i]->add(*f);
+                }
+            }
+            threads.erase(std::find(threads.begin(), threads.end(), metrics));
+            delete metrics;
+        }
+    };
+    thread_local ThreadMetricsHolder threadMetricsHolder;
+
+    /**
+     * Returns the metrics of the given function for the calling thread,
+     * creating them if necessary
+     */
+    FunctionMetrics* functionMetrics(int functionId)
+    {
+        ThreadMetrics *metrics = threadMetricsHolder.metrics;
+        if (metrics == NULL)
+        {
+            metrics = new ThreadMetrics();
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.push_back(metrics);
+            threadMetricsHolder.metrics = metrics;
+        }
+        FunctionMetrics *f = metrics->functions[functionId].load(std::memory_order_relaxed);
+        if (f == NULL)
+        {
+            f = new FunctionMetrics();
+            metrics->functions[functionId].store(f, std::memory_order_release);
+        }
+        return f;
+    }
+
+    /**
+     * Increments the given value. Only called by the owning thread, so 
+     * no read-modify-write operation is necessary.
+     */
+    inline void increment(std::atomic<uint64_t> &value, uint64_t delta)
+    {
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    /**
+     * Returns the histogram bucket for the given duration
+     */
+    inline int bucketIndex(uint64_t value)
+    {
+        if (value < METRICS_SUB_BUCKETS)
+        {
+            return (int)value;
+        }
+#if defined(_MSC_VER)
+        unsigned long msb = 0;
+        _BitScanReverse64(&msb, value);
+        int exponent = (int)msb;
+#else
+        int exponent = 63 - __builtin_clzll(value);
+#endif
+        int shift = exponent - METRICS_SUB_BUCKET_BITS;
+        int subBucket = (int)(value >> shift) - METRICS_SUB_BUCKETS;
+        return METRICS_SUB_BUCKETS + shift * METRICS_SUB_BUCKETS + subBucket;
+    }
+
+    /**
+     * Computes the totals of the given function, without subtracting 
+     * the baseline. The mutex must be held.
+     */
+    void collect(int functionId, FunctionTotals &totals)
+    {
+        totals.clear();
+        if (retired[functionId])
+        {
+            totals.add(*retired[functionId]);
+        }
+        for (ThreadMetrics *metrics : threads)
+        {
+            FunctionMetrics *f = metrics->functions[functionId].load(std::memory_order_acquire);
+            if (f != NULL)
+            {
+                totals.add(*f);
+            }
+        }
+    }
+}
+
+namespace CallMetrics
+{
+    std::atomic<bool> enabled(false);
+
+    void record(int functionId, int status, int64_t durationNs)
+    {
+        if (functionId < 0 || functionId >= METRICS_MAX_FUNCTIONS)
+        {
+            return;
+        }
+        FunctionMetrics *f = functionMetrics(functionId);
+        increment(f->counters[METRICS_CALLS], 1);
+        increment(f->counters[METRICS_TOTAL_NS], (uint64_t)durationNs);
+        if (status != CUSOLVER_STATUS_SUCCESS)
+        {
+            increment(f->counters[METRICS_ERRORS], 1);
+        }
+        int slot = (status >= 0 && status < METRICS_STATUS_SLOTS - 1) ? status : METRICS_STATUS_SLOTS - 1;
+        increment(f->statuses[slot], 1);
+        increment(f->buckets[bucketIndex((uint64_t)std::max((int64_t)0, durationNs))], 1);
+    }
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_CallMetrics_setEnabledNative
+  (JNIEnv *env, jclass cls, jboolean enabled)
+{
+    CallMetrics::enabled.store(enabled == JNI_TRUE, std::memory_order_relaxed);
+}
+
+JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_CallMetrics_isEnabledNative
+  (JNIEnv *env, jclass cls)
+{
+    return CallMetrics::enabled.load(std::memory_order_relaxed) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jobjectArray JNICALL Java_jcuda_jcusolver_CallMetrics_getFunctionNamesNative
+  (JNIEnv *env, jclass cls)
+{
+    int count = std::min(CallTracer::getFunctionCount(), METRICS_MAX_FUNCTIONS);
+    jclass stringClass = env->FindClass("java/lang/String");
+    if (stringClass == NULL)
+    {
+        return NULL;
+    }
+    jobjectArray result = env->NewObjectArray(count, stringClass, NULL);
+    if (result == NULL)
+    {
+        return NULL;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        jstring name = env->NewStringUTF(CallTracer::getFunctionName(i).c_str());
+        if (name == NULL)
+        {
+            return NULL;
+        }
+        env->SetObjectArrayElement(result, i, name);
+        env->DeleteLocalRef(name);
+    }
+    return result;
+}
+
+JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_CallMetrics_getMetricsNative
+  (JNIEnv *env, jclass cls, jint functionId, jlongArray counters, jlongArray statuses, jlongArray buckets)
+{
+    if (counters == NULL || statuses == NULL || buckets == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for getMetrics");
+        return JNI_FALSE;
+    }
+    if (functionId < 0 || functionId >= METRICS_MAX_FUNCTIONS ||
+        env->GetArrayLength(counters) < METRICS_COUNTERS ||
+        env->GetArrayLength(statuses) < METRICS_STATUS_SLOTS ||
+        env->GetArrayLength(buckets) < METRICS_BUCKETS)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException", "Invalid function ID or array length for getMetrics");
+        return JNI_FALSE;
+    }
+    std::unique_ptr<FunctionTotals> totals(new FunctionTotals());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        collect(functionId, *totals);
+        if (baseline[functionId])
+        {
+            totals->subtract(*baseline[functionId]);
+        }
+    }
+    env->SetLongArrayRegion(counters, 0, METRICS_COUNTERS, (const jlong*)totals->counters);
+    env->SetLongArrayRegion(statuses, 0, METRICS_STATUS_SLOTS, (const jlong*)totals->statuses);
+    env->SetLongArrayRegion(buckets, 0, METRICS_BUCKETS, (const jlong*)totals->buckets);
+    return totals->counters[METRICS_CALLS] > 0 ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_CallMetrics_resetNative
+  (JNIEnv *env, jclass cls)
+{
+    // The counters of the threads are never written by other threads.
+    // Instead, the current totals are stored as a baseline, which is 
+    // subtracted when the metrics are read.
+    int count = std::min(CallTracer::getFunctionCount(), METRICS_MAX_FUNCTIONS);
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < count; i++)
+    {
+        if (!baseline[i])
+        {
+            baseline[i].reset(new FunctionTotals());
+        }
+        collect(i, *baseline[i]);
+    }
+}
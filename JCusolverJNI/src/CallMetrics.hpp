@@ -0,0 +1,103 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+ /* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class jcuda_jcusolver_CallMetrics */
+
+#ifndef _Included_jcuda_jcusolver_CallMetrics
+#define _Included_jcuda_jcusolver_CallMetrics
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*
+     * Class:     jcuda_jcusolver_CallMetrics
+     * Method:    setEnabledNative
+     * Signature: (Z)V
+     */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_CallMetrics_setEnabledNative
+        (JNIEnv *, jclass, jboolean);
+
+    /*
+     * Class:     jcuda_jcusolver_CallMetrics
+     * Method:    isEnabledNative
+     * Signature: ()Z
+     */
+    JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_CallMetrics_isEnabledNative
+        (JNIEnv *, jclass);
+
+    /*
+     * Class:     jcuda_jcusolver_CallMetrics
+     * Method:    getFunctionNamesNative
+     * Signature: ()[Ljava/lang/String;
+     */
+    JNIEXPORT jobjectArray JNICALL Java_jcuda_jcusolver_CallMetrics_getFunctionNamesNative
+        (JNIEnv *, jclass);
+
+    /*
+     * Class:     jcuda_jcusolver_CallMetrics
+     * Method:    getMetricsNative
+     * Signature: (I[J[J[J)Z
+     */
+    JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_CallMetrics_getMetricsNative
+        (JNIEnv *, jclass, jint, jlongArray, jlongArray, jlongArray);
+
+    /*
+     * Class:     jcuda_jcusolver_CallMetrics
+     * Method:    resetNative
+     * Signature: ()V
+     */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_CallMetrics_resetNative
+        (JNIEnv *, jclass);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+
+#ifndef JCUSOLVER_CALL_METRICS_HPP
+#define JCUSOLVER_CALL_METRICS_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace CallMetrics
+{
+    /**
+     * Whether the metrics are currently enabled
+     */
+    extern std::atomic<bool> enabled;
+
+    /**
+     * Records a call of the function with the given ID, in the metrics
+     * of the calling thread
+     */
+    void record(int functionId, int status, int64_t durationNs);
+}
+
+#endif
@@ -0,0 +1,653 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CallRecorder.hpp"
+#include "JCusolver_common.hpp"
+#include "LazyInit.hpp"
+#include <cuda_runtime_api.h>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+// The file format. See CallRecorder.hpp
+#define CALL_RECORD_MAGIC 0x5243534A
+#define CALL_RECORD_VERSION 1
+#define CALL_RECORD_FLAG_CONTENTS 1
+#define CALL_RECORD_CHUNK_FUNCTION 1
+#define CALL_RECORD_CHUNK_BLOB 2
+#define CALL_RECORD_CHUNK_CALL 3
+
+// The argument kinds. These must match the constants in CallRecording.java
+#define CALL_RECORD_NULL 0
+#define CALL_RECORD_INT 1
+#define CALL_RECORD_CHAR 2
+#define CALL_RECORD_LONG 3
+#define CALL_RECORD_FLOAT 4
+#define CALL_RECORD_DOUBLE 5
+#define CALL_RECORD_COMPLEX 6
+#define CALL_RECORD_HANDLE 7
+#define CALL_RECORD_DEVICE_POINTER 8
+#define CALL_RECORD_NATIVE_POINTER 9
+#define CALL_RECORD_HOST_BUFFER 10
+#define CALL_RECORD_ARRAY 11
+#define CALL_RECORD_POINTER_ARRAY 12
+#define CALL_RECORD_UNSUPPORTED 13
+
+namespace
+{
+    /**
+     * The signature of cuMemGetAddressRange_v2 of the CUDA driver API,
+     * which returns the base address and size of the device allocation 
+     * that contains a given address
+     */
+    typedef int (*AddressRangeFunction)(unsigned long long *base, size_t *size, unsigned long long address);
+
+    /**
+     * A memory block whose contents are written as a BLOB chunk when
+     * the call ends. The offset is the position of the blob ID in the 
+     * argument data.
+     */
+    struct PendingBlob
+    {
+        size_t offset;
+        std::vector<char> bytes;
+    };
+
+    /**
+     * A blob that was already written, with its ID. The contents are 
+     * kept for comparing them with later blobs that have the same 
+     * hash, so that different contents are never given the same ID.
+     */
+    struct WrittenBlob
+    {
+        int32_t id;
+        std::vector<char> bytes;
+    };
+
+    /**
+     * The call that is currently recorded in one thread. The handles
+     * contain the positions of the values that are written after the
+     * call, and the handle objects.
+     */
+    struct PendingCall
+    {
+        int functionId = -1;
+        int argumentCount = 0;
+        bool synchronized = false;
+        std::vector<char> data;
+        std::vector<std::pair<size_t, jobject> > handles;
+        std::vector<PendingBlob> blobs;
+    };
+    thread_local PendingCall pending;
+    thread_local int threadIndex = -1;
+
+    /**
+     * The state of the recorder. The mutex protects the file and the 
+     * written blobs, which are stored by their hash. The JNI references and the address range function are 
+     * initialized once, by the first call to 'start'.
+     */
+    std::mutex mutex;
+    FILE *file = NULL;
+    bool recordContents = false;
+    std::vector<bool> writtenFunctions;
+    std::unordered_multimap<uint64_t, WrittenBlob> writtenBlobs;
+    int32_t nextBlobId = 0;
+    int nextThreadIndex = 0;
+    bool initialized = false;
+    AddressRangeFunction addressRange = NULL;
+
+    jclass NativePointerObject_class = NULL;
+    jclass Pointer_class = NULL;
+    jfieldID Pointer_buffer = NULL;
+    jfieldID Pointer_pointers = NULL;
+    jfieldID Pointer_byteOffset = NULL;
+    jclass cuComplex_class = NULL;
+    jclass cuDoubleComplex_class = NULL;
+    jmethodID Buffer_capacity = NULL;
+
+    // The buffer classes and the sizes of their elements
+    const char *bufferClassNames[] = { "java/nio/ByteBuffer", "java/nio/CharBuffer", "java/nio/ShortBuffer", 
+        "java/nio/IntBuffer", "java/nio/FloatBuffer", "java/nio/LongBuffer", "java/nio/DoubleBuffer" };
+    const int bufferElementSizes[] = { 1, 2, 2, 4, 4, 8, 8 };
+    jclass bufferClasses[7] = {};
+
+    /**
+     * Returns cuMemGetAddressRange_v2 from the CUDA driver library or 
+     * from the stub backend, if one of them is loaded, or NULL
+     */
+    AddressRangeFunction findAddressRangeFunction()
+    {
+        const char *name = "cuMemGetAddressRange_v2";
+#if defined(_WIN32)
+        HMODULE module = GetModuleHandleA("nvcuda.dll");
+        return module == NULL ? NULL : (AddressRangeFunction)GetProcAddress(module, name);
+#else
+        const char *libraryNames[] = { "libcuda.so.1", "libJCusolverStub.so" };
+        for (const char *libraryName : libraryNames)
+        {
+            void *library = dlopen(libraryName, RTLD_NOW | RTLD_NOLOAD);
+            if (library != NULL)
+            {
+                void *function = dlsym(library, name);
+                dlclose(library);
+                if (function != NULL)
+                {
+                    return (AddressRangeFunction)function;
+                }
+            }
+        }
+        return (AddressRangeFunction)dlsym(RTLD_DEFAULT, name);
+#endif
+    }
+
+    /**
+     * Creates a global reference to the class with the given name
+     */
+    bool initClass(JNIEnv *env, jclass &cls, const char *name)
+    {
+        jclass localClass = env->FindClass(name);
+        if (localClass == NULL)
+        {
+            return false;
+        }
+        cls = (jclass)env->NewGlobalRef(localClass);
+        env->DeleteLocalRef(localClass);
+        return cls != NULL;
+    }
+
+    /**
+     * Initializes the JNI references. The mutex must be held.
+     */
+    bool initialize(JNIEnv *env)
+    {
+        if (initialized)
+        {
+            return true;
+        }
+        if (!LazyInit::ensure(env, LazyInit::POINTER_FIELDS | LazyInit::COMPLEX_FIELDS)) return false;
+        if (!initClass(env, NativePointerObject_class, "jcuda/NativePointerObject")) return false;
+        if (!initClass(env, Pointer_class, "jcuda/Pointer")) return false;
+        if (!initClass(env, cuComplex_class, "jcuda/cuComplex")) return false;
+        if (!initClass(env, cuDoubleComplex_class, "jcuda/cuDoubleComplex")) return false;
+        if (!init(env, Pointer_class, Pointer_buffer, "buffer", "Ljava/nio/Buffer;")) return false;
+        if (!init(env, Pointer_class, Pointer_pointers, "pointers", "[Ljcuda/NativePointerObject;")) return false;
+        if (!init(env, Pointer_class, Pointer_byteOffset, "byteOffset", "J")) return false;
+        for (int i = 0; i < 7; i++)
+        {
+            if (!initClass(env, bufferClasses[i], bufferClassNames[i])) return false;
+        }
+        jclass bufferClass = env->FindClass("java/nio/Buffer");
+        if (bufferClass == NULL)
+        {
+            return false;
+        }
+        Buffer_capacity = env->GetMethodID(bufferClass, "capacity", "()I");
+        env->DeleteLocalRef(bufferClass);
+        if (Buffer_capacity == NULL)
+        {
+            return false;
+        }
+        addressRange = findAddressRangeFunction();
+        initialized = true;
+        return true;
+    }
+
+    /**
+     * Appends the given value to the argument data of the pending call
+     */
+    template <typename T>
+    void put(const T &value)
+    {
+        const char *bytes = (const char*)&value;
+        pending.data.insert(pending.data.end(), bytes, bytes + sizeof(T));
+    }
+
+    /**
+     * Appends the kind of an argument to the argument data
+     */
+    void putKind(int kind)
+    {
+        put((int8_t)kind);
+    }
+
+    /**
+     * Appends a placeholder for the ID of a blob with the given contents
+     */
+    void putBlob(std::vector<char> &bytes)
+    {
+        PendingBlob blob;
+        blob.offset = pending.data.size();
+        blob.bytes.swap(bytes);
+        pending.blobs.push_back(std::move(blob));
+        put((int32_t)-1);
+    }
+
+    /**
+     * Computes the FNV-1a hash of the given bytes, processing 8 bytes 
+     * at a time
+     */
+    uint64_t hash(const std::vector<char> &bytes)
+    {
+        uint64_t h = 14695981039346656037ULL;
+        size_t n = bytes.size();
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            uint64_t v;
+            std::memcpy(&v, bytes.data() + i, 8);
+            h = (h ^ v) * 1099511628211ULL;
+        }
+        for (; i < n; i++)
+        {
+            h = (h ^ (uint8_t)bytes[i]) * 1099511628211ULL;
+        }
+        return h ^ n;
+    }
+
+    /**
+     * Appends a Pointer object to the argument data
+     */
+    void putPointer(JNIEnv *env, jobject pointer)
+    {
+        jobject buffer = env->GetObjectField(pointer, Pointer_buffer);
+        jobject pointers = env->GetObjectField(pointer, Pointer_pointers);
+        if (pointers != NULL)
+        {
+            // Pointers to arrays of pointers in host memory are not 
+            // used by cuSOLVER
+            env->DeleteLocalRef(pointers);
+            env->DeleteLocalRef(buffer);
+            putKind(CALL_RECORD_UNSUPPORTED);
+            return;
+        }
+        if (buffer != NULL)
+        {
+            int elementSize = 0;
+            for (int i = 0; i < 7 && elementSize == 0; i++)
+            {
+                if (env->IsInstanceOf(buffer, bufferClasses[i]))
+                {
+                    elementSize = bufferElementSizes[i];
+                }
+            }
+            jlong capacity = env->CallIntMethod(buffer, Buffer_capacity);
+            jlong byteOffset = env->GetLongField(pointer, Pointer_byteOffset);
+            env->DeleteLocalRef(buffer);
+            jlong size = capacity * elementSize - byteOffset;
+            PointerData *pointerData = initPointerData(env, pointer);
+            if (pointerData == NULL)
+            {
+                env->ExceptionClear();
+                putKind(CALL_RECORD_UNSUPPORTED);
+                return;
+            }
+            std::vector<char> bytes(size > 0 ? (size_t)size : 0);
+            if (!bytes.empty())
+            {
+                std::memcpy(bytes.data(), pointerData->getPointer(env), bytes.size());
+            }
+            releasePointerData(env, pointerData, JNI_ABORT);
+            putKind(CALL_RECORD_HOST_BUFFER);
+            putBlob(bytes);
+            return;
+        }
+        uint64_t address = (uint64_t)(uintptr_t)getPointer(env, pointer);
+        if (address == 0)
+        {
+            putKind(CALL_RECORD_NULL);
+            return;
+        }
+        unsigned long long base = 0;
+        size_t size = 0;
+        if (addressRange == NULL || addressRange(&base, &size, (unsigned long long)address) != 0)
+        {
+            putKind(CALL_RECORD_NATIVE_POINTER);
+            put((int64_t)address);
+            return;
+        }
+        putKind(CALL_RECORD_DEVICE_POINTER);
+        put((int64_t)address);
+        put((int64_t)base);
+        put((int64_t)size);
+        if (!recordContents)
+        {
+            put((int32_t)-1);
+            return;
+        }
+
+        // Make sure that previous operations on other streams that 
+        // write the memory have finished
+        if (!pending.synchronized)
+        {
+            cudaDeviceSynchronize();
+            pending.synchronized = true;
+        }
+        std::vector<char> bytes(size);
+        if (cudaMemcpy(bytes.data(), (void*)(uintptr_t)base, size, cudaMemcpyDeviceToHost) != cudaSuccess)
+        {
+            put((int32_t)-1);
+            return;
+        }
+        putBlob(bytes);
+    }
+}
+
+namespace CallRecorder
+{
+    std::atomic<bool> enabled(false);
+
+    bool start(JNIEnv *env, const char *fileName, bool contents)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file != NULL || !initialize(env))
+        {
+            return false;
+        }
+        file = fopen(fileName, "wb");
+        if (file == NULL)
+        {
+            return false;
+        }
+        int32_t header[3] = { CALL_RECORD_MAGIC, CALL_RECORD_VERSION, contents ? CALL_RECORD_FLAG_CONTENTS : 0 };
+        fwrite(header, sizeof(header), 1, file);
+        recordContents = contents;
+        writtenFunctions.clear();
+        writtenBlobs.clear();
+        nextBlobId = 0;
+        enabled.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    void stop()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file == NULL)
+        {
+            return;
+        }
+        enabled.store(false, std::memory_order_relaxed);
+        fclose(file);
+        file = NULL;
+        writtenBlobs.clear();
+    }
+
+    void begin(int functionId, int argumentCount)
+    {
+        pending.functionId = functionId;
+        pending.argumentCount = argumentCount;
+        pending.synchronized = false;
+        pending.data.clear();
+        pending.handles.clear();
+        pending.blobs.clear();
+    }
+
+    void argument(JNIEnv *env, jint value)
+    {
+        putKind(CALL_RECORD_INT);
+        put((int32_t)value);
+    }
+
+    void argument(JNIEnv *env, jchar value)
+    {
+        putKind(CALL_RECORD_CHAR);
+        put((int32_t)value);
+    }
+
+    void argument(JNIEnv *env, jlong value)
+    {
+        putKind(CALL_RECORD_LONG);
+        put((int64_t)value);
+    }
+
+    void argument(JNIEnv *env, jfloat value)
+    {
+        putKind(CALL_RECORD_FLOAT);
+        put((float)value);
+    }
+
+    void argument(JNIEnv *env, jdouble value)
+    {
+        putKind(CALL_RECORD_DOUBLE);
+        put((double)value);
+    }
+
+    void argument(JNIEnv *env, jobject value)
+    {
+        if (value == NULL)
+        {
+            putKind(CALL_RECORD_NULL);
+        }
+        else if (env->IsInstanceOf(value, Pointer_class))
+        {
+            putPointer(env, value);
+        }
+        else if (env->IsInstanceOf(value, NativePointerObject_class))
+        {
+            putKind(CALL_RECORD_HANDLE);
+            put((int64_t)getNativePointerValue(env, value));
+            pending.handles.push_back(std::make_pair(pending.data.size(), value));
+            put((int64_t)0);
+        }
+        else if (env->IsInstanceOf(value, cuComplex_class))
+        {
+            putKind(CALL_RECORD_COMPLEX);
+            put((double)env->GetFloatField(value, cuComplex_x));
+            put((double)env->GetFloatField(value, cuComplex_y));
+            put((int8_t)0);
+        }
+        else if (env->IsInstanceOf(value, cuDoubleComplex_class))
+        {
+            putKind(CALL_RECORD_COMPLEX);
+            put((double)env->GetDoubleField(value, cuDoubleComplex_x));
+            put((double)env->GetDoubleField(value, cuDoubleComplex_y));
+            put((int8_t)1);
+        }
+        else
+        {
+            putKind(CALL_RECORD_UNSUPPORTED);
+        }
+    }
+
+    void argument(JNIEnv *env, jintArray value)
+    {
+        if (value == NULL)
+        {
+            putKind(CALL_RECORD_NULL);
+            return;
+        }
+        jsize length = env->GetArrayLength(value);
+        std::vector<jint> elements(length);
+        env->GetIntArrayRegion(value, 0, length, elements.data());
+        putKind(CALL_RECORD_ARRAY);
+        put((int8_t)'I');
+        put((int32_t)length);
+        for (jint e : elements) put((int32_t)e);
+    }
+
+    void argument(JNIEnv *env, jlongArray value)
+    {
+        if (value == NULL)
+        {
+            putKind(CALL_RECORD_NULL);
+            return;
+        }
+        jsize length = env->GetArrayLength(value);
+        std::vector<jlong> elements(length);
+        env->GetLongArrayRegion(value, 0, length, elements.data());
+        putKind(CALL_RECORD_ARRAY);
+        put((int8_t)'J');
+        put((int32_t)length);
+        for (jlong e : elements) put((int64_t)e);
+    }
+
+    void argument(JNIEnv *env, jfloatArray value)
+    {
+        if (value == NULL)
+        {
+            putKind(CALL_RECORD_NULL);
+            return;
+        }
+        jsize length = env->GetArrayLength(value);
+        std::vector<jfloat> elements(length);
+        env->GetFloatArrayRegion(value, 0, length, elements.data());
+        putKind(CALL_RECORD_ARRAY);
+        put((int8_t)'F');
+        put((int32_t)length);
+        for (jfloat e : elements) put((float)e);
+    }
+
+    void argument(JNIEnv *env, jdoubleArray value)
+    {
+        if (value == NULL)
+        {
+            putKind(CALL_RECORD_NULL);
+            return;
+        }
+        jsize length = env->GetArrayLength(value);
+        std::vector<jdouble> elements(length);
+        env->GetDoubleArrayRegion(value, 0, length, elements.data());
+        putKind(CALL_RECORD_ARRAY);
+        put((int8_t)'D');
+        put((int32_t)length);
+        for (jdouble e : elements) put((double)e);
+    }
+
+    void argument(JNIEnv *env, jobjectArray value)
+    {
+        if (value == NULL)
+        {
+            putKind(CALL_RECORD_NULL);
+            return;
+        }
+        jsize length = env->GetArrayLength(value);
+        putKind(CALL_RECORD_POINTER_ARRAY);
+        put((int32_t)length);
+        for (jsize i = 0; i < length; i++)
+        {
+            jobject element = env->GetObjectArrayElement(value, i);
+            if (element == NULL)
+            {
+                putKind(CALL_RECORD_NULL);
+            }
+            else if (env->IsInstanceOf(element, Pointer_class))
+            {
+                putPointer(env, element);
+            }
+            else
+            {
+                putKind(CALL_RECORD_UNSUPPORTED);
+            }
+            env->DeleteLocalRef(element);
+        }
+    }
+
+    void end(JNIEnv *env, int status, int64_t durationNs)
+    {
+        int64_t startNs = CallTracer::now() - durationNs;
+        for (const auto &handle : pending.handles)
+        {
+            int64_t after = (int64_t)getNativePointerValue(env, handle.second);
+            std::memcpy(pending.data.data() + handle.first, &after, sizeof(after));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file == NULL || pending.functionId < 0)
+        {
+            pending.blobs.clear();
+            return;
+        }
+        if (threadIndex == -1)
+        {
+            threadIndex = nextThreadIndex++;
+        }
+        int functionId = pending.functionId;
+        if ((int)writtenFunctions.size() <= functionId)
+        {
+            writtenFunctions.resize(functionId + 1, false);
+        }
+        if (!writtenFunctions[functionId])
+        {
+            std::string name = CallTracer::getFunctionName(functionId);
+            int32_t header[4] = { CALL_RECORD_CHUNK_FUNCTION, functionId, (int32_t)name.size(), 0 };
+            fwrite(header, sizeof(header), 1, file);
+            fwrite(name.data(), 1, name.size(), file);
+            writtenFunctions[functionId] = true;
+        }
+
+        // Blobs with the same contents are only written once. The hash
+        // only selects the candidates, which are compared byte by byte.
+        for (PendingBlob &blob : pending.blobs)
+        {
+            uint64_t h = hash(blob.bytes);
+            int32_t id = -1;
+            auto range = writtenBlobs.equal_range(h);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second.bytes == blob.bytes)
+                {
+                    id = it->second.id;
+                    break;
+                }
+            }
+            if (id == -1)
+            {
+                id = nextBlobId++;
+                uint64_t size = blob.bytes.size();
+                int32_t header[4] = { CALL_RECORD_CHUNK_BLOB, id, (int32_t)(size & 0xFFFFFFFFu), (int32_t)(size >> 32) };
+                fwrite(header, sizeof(header), 1, file);
+                fwrite(blob.bytes.data(), 1, blob.bytes.size(), file);
+                WrittenBlob written;
+                written.id = id;
+                written.bytes.swap(blob.bytes);
+                writtenBlobs.insert(std::make_pair(h, std::move(written)));
+            }
+            std::memcpy(pending.data.data() + blob.offset, &id, sizeof(id));
+        }
+
+        int32_t length = (int32_t)(2 * sizeof(int32_t) + 2 * sizeof(int64_t) + pending.data.size());
+        int32_t header[4] = { CALL_RECORD_CHUNK_CALL, functionId, pending.argumentCount, length };
+        fwrite(header, sizeof(header), 1, file);
+        int32_t values[2] = { threadIndex, status };
+        fwrite(values, sizeof(values), 1, file);
+        int64_t times[2] = { startNs, durationNs };
+        fwrite(times, sizeof(times), 1, file);
+        fwrite(pending.data.data(), 1, pending.data.size(), file);
+        pending.functionId = -1;
+        pending.blobs.clear();
+    }
+}
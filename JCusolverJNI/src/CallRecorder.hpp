@@ -0,0 +1,177 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCUSOLVER_CALL_RECORDER_HPP
+#define JCUSOLVER_CALL_RECORDER_HPP
+
+#include <jni.h>
+#include <atomic>
+#include <cstdint>
+#include "CallTracer.hpp"
+
+/**
+ * A recorder for the complete arguments of native function calls, so 
+ * that the sequence of calls can be replayed later. In contrast to the
+ * CallTracer, the recorder is not intended for production use: Each 
+ * call inspects all argument objects, and writes the call to the file 
+ * while holding a lock.
+ *
+ * The file starts with the magic number 0x5243534A ("JSCR"), the 
+ * version, and the flags, as int32 values. Flag 1 means that the 
+ * contents of device memory have been recorded. It is followed by 
+ * chunks that start with a header of four int32 values:
+ *
+ * FUNCTION chunk: 1, id, length, 0, followed by 'length' bytes of the 
+ *     function name.
+ * BLOB chunk: 2, id, sizeLow, sizeHigh, followed by the bytes of the 
+ *     contents of a memory block. 
+ * CALL chunk: 3, functionId, argumentCount, length, followed by 
+ *     'length' bytes: The int32 thread index and status, the int64 
+ *     start time and duration in nanoseconds, and the arguments.
+ *
+ * Each argument starts with an int8 kind, followed by its data:
+ *
+ * NULL (0): -
+ * INT (1), CHAR (2): int32 value
+ * LONG (3): int64 value
+ * FLOAT (4): float32 value
+ * DOUBLE (5): float64 value
+ * COMPLEX (6): float64 real and imaginary part, int8 double precision
+ * HANDLE (7): int64 native pointer before and after the call. The 
+ *     value is 0 before the call for handles that are created by it.
+ * DEVICE_POINTER (8): int64 address, allocation base and allocation 
+ *     size, int32 blob ID of the contents of the allocation, or -1
+ * NATIVE_POINTER (9): int64 address of memory that is not a device 
+ *     allocation, for example, pinned host memory
+ * HOST_BUFFER (10): int32 blob ID of the contents of a Java array or 
+ *     buffer, starting at the byte offset of the pointer
+ * ARRAY (11): int8 element type ('I', 'J', 'F' or 'D'), int32 length, 
+ *     followed by the elements
+ * POINTER_ARRAY (12): int32 length, followed by the elements, which
+ *     are NULL, DEVICE_POINTER, NATIVE_POINTER or HOST_BUFFER arguments
+ * UNSUPPORTED (13): -
+ *
+ * All values are in the native byte order.
+ */
+namespace CallRecorder
+{
+    /**
+     * Whether recording is currently enabled
+     */
+    extern std::atomic<bool> enabled;
+
+    /**
+     * Starts recording into the file with the given name. If 'contents'
+     * is true, then the contents of the device memory allocations are
+     * recorded for each call. Each distinct content is written once, 
+     * and kept in host memory until recording is stopped, for finding 
+     * duplicates. Returns false if the file can not be opened, or 
+     * recording was already started.
+     */
+    bool start(JNIEnv *env, const char *fileName, bool contents);
+
+    /**
+     * Stops recording and closes the file. Does nothing if recording 
+     * was not started.
+     */
+    void stop();
+
+    /**
+     * Starts recording a call of the given function in the calling 
+     * thread
+     */
+    void begin(int functionId, int argumentCount);
+
+    /**
+     * Records one argument of the current call
+     */
+    void argument(JNIEnv *env, jint value);
+    void argument(JNIEnv *env, jchar value);
+    void argument(JNIEnv *env, jlong value);
+    void argument(JNIEnv *env, jfloat value);
+    void argument(JNIEnv *env, jdouble value);
+    void argument(JNIEnv *env, jobject value);
+    void argument(JNIEnv *env, jintArray value);
+    void argument(JNIEnv *env, jlongArray value);
+    void argument(JNIEnv *env, jfloatArray value);
+    void argument(JNIEnv *env, jdoubleArray value);
+    void argument(JNIEnv *env, jobjectArray value);
+
+    /**
+     * Ends the current call, and writes it to the file
+     */
+    void end(JNIEnv *env, int status, int64_t durationNs);
+}
+
+/**
+ * A single recorded call. It is created before the native function is
+ * called, with all arguments of the JNI function, and ended with the 
+ * status of the call. When recording is disabled, only the flag is 
+ * checked.
+ */
+class CallCapture
+{
+public:
+    template <typename... Args>
+    CallCapture(JNIEnv *env, int functionId, Args... args) : env(env), startNs(0)
+    {
+        active = CallRecorder::enabled.load(std::memory_order_relaxed);
+        if (active)
+        {
+            CallRecorder::begin(functionId, (int)sizeof...(args));
+            record(args...);
+            startNs = CallTracer::now();
+        }
+    }
+
+    void end(int status)
+    {
+        if (active)
+        {
+            CallRecorder::end(env, status, CallTracer::now() - startNs);
+        }
+    }
+
+private:
+    void record()
+    {
+    }
+
+    template <typename T, typename... Rest>
+    void record(T arg, Rest... rest)
+    {
+        CallRecorder::argument(env, arg);
+        record(rest...);
+    }
+
+    JNIEnv *env;
+    bool active;
+    int64_t startNs;
+};
+
+#endif
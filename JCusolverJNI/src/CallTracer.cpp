@@ -0,0 +1,295 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CallTracer.hpp"
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The chunk types of the trace file
+#define CALL_TRACE_MAGIC 0x5443534A
+#define CALL_TRACE_VERSION 1
+#define CALL_TRACE_CHUNK_FUNCTION 1
+#define CALL_TRACE_CHUNK_RECORDS 2
+
+// The number of records in the buffer of each thread. Must be a power of 2.
+#define CALL_TRACE_BUFFER_CAPACITY 2048
+
+// The interval in which the buffers are drained, in milliseconds
+#define CALL_TRACE_DRAIN_INTERVAL_MS 10
+
+namespace
+{
+    /**
+     * The ring buffer of one thread. The 'head' is only written by the
+     * owning thread, and the 'tail' only by the draining thread.
+     */
+    struct TraceBuffer
+    {
+        std::atomic<uint64_t> head;
+        std::atomic<uint64_t> tail;
+        std::atomic<uint64_t> dropped;
+        std::atomic<bool> retired;
+        int threadIndex;
+        CallTraceRecord records[CALL_TRACE_BUFFER_CAPACITY];
+
+        TraceBuffer(int threadIndex) : head(0), tail(0), dropped(0), retired(false), threadIndex(threadIndex)
+        {
+        }
+    };
+
+    /**
+     * The state of the tracer. The mutex protects the buffer list, the
+     * function names, and the file.
+     */
+    std::mutex mutex;
+    std::vector<TraceBuffer*> buffers;
+    std::vector<std::string> functionNames;
+    int nextThreadIndex = 0;
+    FILE *file = NULL;
+    size_t writtenFunctionCount = 0;
+
+    /**
+     * The draining thread, and the condition for stopping it
+     */
+    std::thread drainer;
+    std::condition_variable stopCondition;
+    bool stopRequested = false;
+
+    /**
+     * Marks the buffer of a thread as retired when the thread ends, so
+     * that it is deleted after it has been drained
+     */
+    struct BufferHolder
+    {
+        TraceBuffer *buffer = NULL;
+
+        ~BufferHolder()
+        {
+            if (buffer != NULL)
+            {
+                buffer->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+    thread_local BufferHolder bufferHolder;
+
+    /**
+     * Returns the buffer of the calling thread, creating it if necessary
+     */
+    TraceBuffer* threadBuffer()
+    {
+        if (bufferHolder.buffer == NULL)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            TraceBuffer *buffer = new TraceBuffer(nextThreadIndex++);
+            buffers.push_back(buffer);
+            bufferHolder.buffer = buffer;
+        }
+        return bufferHolder.buffer;
+    }
+
+    /**
+     * Writes a chunk header
+     */
+    void writeChunkHeader(int32_t a, int32_t b, int32_t c, int32_t d)
+    {
+        int32_t header[4] = { a, b, c, d };
+        fwrite(header, sizeof(header), 1, file);
+    }
+
+    /**
+     * Writes the names of the functions that have been registered since
+     * the last call. The mutex must be held.
+     */
+    void writeFunctionNames()
+    {
+        for (; writtenFunctionCount < functionNames.size(); writtenFunctionCount++)
+        {
+            const std::string &name = functionNames[writtenFunctionCount];
+            writeChunkHeader(CALL_TRACE_CHUNK_FUNCTION, (int32_t)writtenFunctionCount, (int32_t)name.size(), 0);
+            fwrite(name.data(), 1, name.size(), file);
+        }
+    }
+
+    /**
+     * Writes the pending records of all buffers into the file, and 
+     * deletes the buffers of threads that have ended. The mutex must 
+     * be held.
+     */
+    void drainAll()
+    {
+        writeFunctionNames();
+        for (size_t i = 0; i < buffers.size(); )
+        {
+            TraceBuffer *buffer = buffers[i];
+            bool retired = buffer->retired.load(std::memory_order_acquire);
+            uint64_t head = buffer->head.load(std::memory_order_acquire);
+            uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+            uint64_t dropped = buffer->dropped.exchange(0, std::memory_order_relaxed);
+            if (head != tail || dropped != 0)
+            {
+                writeChunkHeader(CALL_TRACE_CHUNK_RECORDS, buffer->threadIndex, (int32_t)(head - tail), (int32_t)dropped);
+
+                // Write the records in at most two parts, due to the wrap-around
+                while (tail != head)
+                {
+                    size_t index = (size_t)(tail & (CALL_TRACE_BUFFER_CAPACITY - 1));
+                    size_t count = (size_t)(head - tail);
+                    if (index + count > CALL_TRACE_BUFFER_CAPACITY)
+                    {
+                        count = CALL_TRACE_BUFFER_CAPACITY - index;
+                    }
+                    fwrite(buffer->records + index, sizeof(CallTraceRecord), count, file);
+                    tail += count;
+                }
+                buffer->tail.store(tail, std::memory_order_release);
+            }
+            if (retired)
+            {
+                delete buffer;
+                buffers.erase(buffers.begin() + i);
+            }
+            else
+            {
+                i++;
+            }
+        }
+        fflush(file);
+    }
+
+    /**
+     * The function of the draining thread
+     */
+    void drainLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopRequested)
+        {
+            stopCondition.wait_for(lock, std::chrono::milliseconds(CALL_TRACE_DRAIN_INTERVAL_MS));
+            drainAll();
+        }
+    }
+}
+
+namespace CallTracer
+{
+    std::atomic<bool> enabled(false);
+
+    int registerFunction(const char *name, const char *arguments)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        functionNames.push_back(std::string(name) + "(" + arguments + ")");
+        return (int)functionNames.size() - 1;
+    }
+
+    int getFunctionCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return (int)functionNames.size();
+    }
+
+    std::string getFunctionName(int functionId)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const std::string &name = functionNames[functionId];
+        return name.substr(0, name.find('('));
+    }
+
+    std::string getFunctionSignature(int functionId)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return functionNames[functionId];
+    }
+
+    void write(const CallTraceRecord &record)
+    {
+        TraceBuffer *buffer = threadBuffer();
+        uint64_t head = buffer->head.load(std::memory_order_relaxed);
+        uint64_t tail = buffer->tail.load(std::memory_order_acquire);
+        if (head - tail >= CALL_TRACE_BUFFER_CAPACITY)
+        {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer->records[head & (CALL_TRACE_BUFFER_CAPACITY - 1)] = record;
+        buffer->head.store(head + 1, std::memory_order_release);
+    }
+
+    bool start(const char *fileName)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file != NULL)
+        {
+            return false;
+        }
+        file = fopen(fileName, "wb");
+        if (file == NULL)
+        {
+            return false;
+        }
+        int32_t header[2] = { CALL_TRACE_MAGIC, CALL_TRACE_VERSION };
+        fwrite(header, sizeof(header), 1, file);
+
+        // Discard records that were written by calls that were still 
+        // running when the previous trace was stopped
+        for (TraceBuffer *buffer : buffers)
+        {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+        writtenFunctionCount = 0;
+        stopRequested = false;
+        drainer = std::thread(drainLoop);
+        enabled.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (file == NULL || stopRequested)
+            {
+                return;
+            }
+            enabled.store(false, std::memory_order_relaxed);
+            stopRequested = true;
+        }
+        stopCondition.notify_all();
+        drainer.join();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        drainAll();
+        fclose(file);
+        file = NULL;
+    }
+}
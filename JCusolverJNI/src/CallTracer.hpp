@@ -0,0 +1,187 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCUSOLVER_CALL_TRACER_HPP
+#define JCUSOLVER_CALL_TRACER_HPP
+
+#include <jni.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "CallMetrics.hpp"
+#include "StickyErrors.hpp"
+
+/**
+ * A binary call tracer. When tracing is started, each native function
+ * call writes a fixed-size record into a lock-free ring buffer of the 
+ * calling thread. A background thread drains these buffers into the 
+ * trace file. If a buffer is full, the record is dropped and counted, 
+ * so that the calling thread never blocks.
+ *
+ * The file starts with the magic number 0x5443534A ("JSCT") and the 
+ * version, as int32 values. It is followed by chunks that start with 
+ * a header of four int32 values:
+ *
+ * FUNCTION chunk: 1, id, length, 0, followed by 'length' bytes of the 
+ *     name, in the form "cusolverDnDpotrf(uplo, n, lda, Lwork)", 
+ *     where the names in parentheses are the names of the recorded
+ *     arguments.
+ * RECORDS chunk: 2, threadIndex, count, dropped, followed by 'count' 
+ *     CallTraceRecord structures. 'dropped' is the number of records
+ *     of this thread that have been dropped since the last chunk.
+ *
+ * All values are in the native byte order.
+ */
+
+/**
+ * A single call record
+ */
+struct CallTraceRecord
+{
+    int32_t functionId;
+    int32_t status;
+    int64_t startNs;
+    int64_t durationNs;
+    int64_t args[4];
+};
+
+namespace CallTracer
+{
+    /**
+     * Whether tracing is currently enabled
+     */
+    extern std::atomic<bool> enabled;
+
+    /**
+     * Registers the given function, and returns its ID. The arguments 
+     * are the comma-separated names of the arguments that are recorded.
+     * This is called once for each function, when it is called for the 
+     * first time.
+     */
+    int registerFunction(const char *name, const char *arguments);
+
+    /**
+     * Returns the current time stamp, in nanoseconds
+     */
+    inline int64_t now()
+    {
+        return (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * Writes the given record into the buffer of the calling thread
+     */
+    void write(const CallTraceRecord &record);
+
+    /**
+     * Starts tracing into the file with the given name. Returns false 
+     * if the file can not be opened, or tracing was already started.
+     */
+    bool start(const char *fileName);
+
+    /**
+     * Stops tracing, writes all pending records, and closes the file.
+     * Does nothing if tracing was not started.
+     */
+    void stop();
+
+    /**
+     * Returns the number of registered functions
+     */
+    int getFunctionCount();
+
+    /**
+     * Returns the name of the function with the given ID, without the
+     * argument names
+     */
+    std::string getFunctionName(int functionId);
+
+    /**
+     * Returns the name of the function with the given ID, followed by 
+     * the names of the recorded arguments in parentheses
+     */
+    std::string getFunctionSignature(int functionId);
+}
+
+/**
+ * A single traced call. It is created before the native function is 
+ * called, and ended with the status of the call. It writes a trace 
+ * record when tracing is enabled, and updates the metrics when they are
+ * enabled. If the call failed, it is recorded as a sticky error. 
+ * Otherwise, only the flags are checked.
+ */
+class CallTrace
+{
+public:
+    CallTrace(int functionId, int64_t arg0 = 0, int64_t arg1 = 0, int64_t arg2 = 0, int64_t arg3 = 0)
+    {
+        tracing = CallTracer::enabled.load(std::memory_order_relaxed);
+        metrics = CallMetrics::enabled.load(std::memory_order_relaxed);
+        record.functionId = functionId;
+        record.args[0] = arg0;
+        record.args[1] = arg1;
+        record.args[2] = arg2;
+        record.args[3] = arg3;
+        if (tracing || metrics)
+        {
+            record.startNs = CallTracer::now();
+        }
+    }
+
+    void end(int status)
+    {
+        if (status != 0)
+        {
+            StickyErrors::record(record.functionId, status, record.args);
+        }
+        if (tracing || metrics)
+        {
+            record.durationNs = CallTracer::now() - record.startNs;
+            record.status = status;
+            if (tracing)
+            {
+                CallTracer::write(record);
+            }
+            if (metrics)
+            {
+                CallMetrics::record(record.functionId, status, record.durationNs);
+            }
+        }
+    }
+
+private:
+    bool tracing;
+    bool metrics;
+    CallTraceRecord record;
+};
+
+#endif
@@ -0,0 +1,177 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CsrIndexConversion.hpp"
+#include "JCusolver_common.hpp"
+#include "HostUtils.hpp"
+#include <atomic>
+#include <climits>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// The number of indices that one thread converts at once
+#define INDEX_GRAIN (1 << 18)
+
+/**
+ * Computes dst[i] = (int32_t)(src[i] - offset) for i in [begin, end).
+ * Returns false if any result is not in the range of int32_t. The
+ * contents of dst are unspecified in this case.
+ */
+static bool narrow(const int64_t *src, int64_t offset, int32_t *dst, size_t begin, size_t end)
+{
+    size_t i = begin;
+    bool valid = true;
+#if defined(__AVX2__)
+    const __m256i offsets = _mm256_set1_epi64x(offset);
+    const __m256i lower = _mm256_set1_epi64x((int64_t)INT_MIN);
+    const __m256i upper = _mm256_set1_epi64x((int64_t)INT_MAX);
+    const __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    __m256i outOfRange = _mm256_setzero_si256();
+    for (; i + 4 <= end; i += 4)
+    {
+        __m256i value = _mm256_sub_epi64(_mm256_loadu_si256((const __m256i*)(src + i)), offsets);
+        outOfRange = _mm256_or_si256(outOfRange, _mm256_cmpgt_epi64(value, upper));
+        outOfRange = _mm256_or_si256(outOfRange, _mm256_cmpgt_epi64(lower, value));
+        __m256i packed = _mm256_permutevar8x32_epi32(value, lowHalves);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm256_castsi256_si128(packed));
+    }
+    valid = _mm256_testz_si256(outOfRange, outOfRange) != 0;
+#endif
+    for (; i < end; i++)
+    {
+        int64_t value = src[i] - offset;
+        if (value < INT_MIN || value > INT_MAX)
+        {
+            valid = false;
+        }
+        dst[i] = (int32_t)value;
+    }
+    return valid;
+}
+
+/**
+ * Computes dst[i] = (int64_t)src[i] + offset for i in [begin, end)
+ */
+static void widen(const int32_t *src, int64_t offset, int64_t *dst, size_t begin, size_t end)
+{
+    size_t i = begin;
+#if defined(__AVX2__)
+    const __m256i offsets = _mm256_set1_epi64x(offset);
+    for (; i + 4 <= end; i += 4)
+    {
+        __m256i value = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(src + i)));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_add_epi64(value, offsets));
+    }
+#endif
+    for (; i < end; i++)
+    {
+        dst[i] = (int64_t)src[i] + offset;
+    }
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrIndexConversion_narrowNative(JNIEnv *env, jclass cls, jlong count, jobject src, jlong offset, jobject dst)
+{
+    if (src == NULL || dst == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for CsrIndexConversion narrow");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    Logger::log(LOG_TRACE, "Executing CsrIndexConversion narrow(count=%ld, offset=%ld)\n", (long)count, (long)offset);
+
+    static const int traceId = CallTracer::registerFunction("CsrIndexConversion.narrow", "count, offset");
+    CallTrace callTrace(traceId, count, offset);
+
+    PointerData *src_pointerData = initPointerData(env, src);
+    if (src_pointerData == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *dst_pointerData = initPointerData(env, dst);
+    if (dst_pointerData == NULL)
+    {
+        releasePointerData(env, src_pointerData, JNI_ABORT);
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    const int64_t *srcNative = (const int64_t*)src_pointerData->getPointer(env);
+    int32_t *dstNative = (int32_t*)dst_pointerData->getPointer(env);
+    std::atomic<bool> valid(true);
+    parallelFor((size_t)count, INDEX_GRAIN, [&](size_t begin, size_t end)
+    {
+        if (!narrow(srcNative, offset, dstNative, begin, end))
+        {
+            valid.store(false);
+        }
+    });
+
+    if (!releasePointerData(env, src_pointerData, JNI_ABORT)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, dst_pointerData, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    cusolverStatus_t result = valid.load() ? CUSOLVER_STATUS_SUCCESS : CUSOLVER_STATUS_INVALID_VALUE;
+    callTrace.end(result);
+    return result;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrIndexConversion_widenNative(JNIEnv *env, jclass cls, jlong count, jobject src, jlong offset, jobject dst)
+{
+    if (src == NULL || dst == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for CsrIndexConversion widen");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    Logger::log(LOG_TRACE, "Executing CsrIndexConversion widen(count=%ld, offset=%ld)\n", (long)count, (long)offset);
+
+    static const int traceId = CallTracer::registerFunction("CsrIndexConversion.widen", "count, offset");
+    CallTrace callTrace(traceId, count, offset);
+
+    PointerData *src_pointerData = initPointerData(env, src);
+    if (src_pointerData == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *dst_pointerData = initPointerData(env, dst);
+    if (dst_pointerData == NULL)
+    {
+        releasePointerData(env, src_pointerData, JNI_ABORT);
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    const int32_t *srcNative = (const int32_t*)src_pointerData->getPointer(env);
+    int64_t *dstNative = (int64_t*)dst_pointerData->getPointer(env);
+    parallelFor((size_t)count, INDEX_GRAIN, [&](size_t begin, size_t end)
+    {
+        widen(srcNative, offset, dstNative, begin, end);
+    });
+
+    if (!releasePointerData(env, src_pointerData, JNI_ABORT)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, dst_pointerData, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    callTrace.end(CUSOLVER_STATUS_SUCCESS);
+    return CUSOLVER_STATUS_SUCCESS;
+}
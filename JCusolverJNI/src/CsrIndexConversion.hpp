@@ -0,0 +1,57 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+ /* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class jcuda_jcusolver_CsrIndexConversion */
+
+#ifndef _Included_jcuda_jcusolver_CsrIndexConversion
+#define _Included_jcuda_jcusolver_CsrIndexConversion
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*
+     * Class:     jcuda_jcusolver_CsrIndexConversion
+     * Method:    narrowNative
+     * Signature: (JLjcuda/Pointer;JLjcuda/Pointer;)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrIndexConversion_narrowNative
+        (JNIEnv *, jclass, jlong, jobject, jlong, jobject);
+
+    /*
+     * Class:     jcuda_jcusolver_CsrIndexConversion
+     * Method:    widenNative
+     * Signature: (JLjcuda/Pointer;JLjcuda/Pointer;)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrIndexConversion_widenNative
+        (JNIEnv *, jclass, jlong, jobject, jlong, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
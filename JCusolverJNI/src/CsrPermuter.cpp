@@ -0,0 +1,418 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "CsrPermuter.hpp"
+#include "JCusolver_common.hpp"
+#include "HostUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// The number of rows that one thread processes at once
+#define ROW_GRAIN 4096
+
+// The number of values that one thread gathers at once
+#define VALUE_GRAIN (1 << 16)
+
+// Rows up to this length are sorted with insertion sort
+#define INSERTION_SORT_LIMIT 32
+
+/**
+ * Gathers dst[i] = src[map[i]] for i in [begin, end)
+ */
+static void gather(const double *src, const int *map, double *dst, size_t begin, size_t end)
+{
+    size_t i = begin;
+#if defined(__AVX2__)
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128i index = _mm_loadu_si128((const __m128i*)(map + i));
+        _mm256_storeu_pd(dst + i, _mm256_i32gather_pd(src, index, 8));
+    }
+#endif
+    for (; i < end; i++)
+    {
+        dst[i] = src[map[i]];
+    }
+}
+
+/**
+ * Gathers dst[i] = src[map[i]] for i in [begin, end)
+ */
+static void gather(const float *src, const int *map, float *dst, size_t begin, size_t end)
+{
+    size_t i = begin;
+#if defined(__AVX2__)
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256i index = _mm256_loadu_si256((const __m256i*)(map + i));
+        _mm256_storeu_ps(dst + i, _mm256_i32gather_ps(src, index, 4));
+    }
+#endif
+    for (; i < end; i++)
+    {
+        dst[i] = src[map[i]];
+    }
+}
+
+/**
+ * Sorts the given segment of column indices, and applies the same
+ * reordering to the given segment of the map. The pairs vector is
+ * used as temporary storage for long rows.
+ */
+static void sortRow(int *colInd, int *map, int length, std::vector<std::pair<int, int> > &pairs)
+{
+    if (length <= INSERTION_SORT_LIMIT)
+    {
+        for (int i = 1; i < length; i++)
+        {
+            int c = colInd[i];
+            int v = map[i];
+            int j = i - 1;
+            while (j >= 0 && colInd[j] > c)
+            {
+                colInd[j + 1] = colInd[j];
+                map[j + 1] = map[j];
+                j--;
+            }
+            colInd[j + 1] = c;
+            map[j + 1] = v;
+        }
+        return;
+    }
+    pairs.resize(length);
+    for (int i = 0; i < length; i++)
+    {
+        pairs[i] = std::make_pair(colInd[i], map[i]);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    for (int i = 0; i < length; i++)
+    {
+        colInd[i] = pairs[i].first;
+        map[i] = pairs[i].second;
+    }
+}
+
+/**
+ * Returns whether the given array contains a permutation of [0, n)
+ */
+static bool isPermutation(const int *p, int n)
+{
+    std::vector<char> seen(n, 0);
+    for (int i = 0; i < n; i++)
+    {
+        if (p[i] < 0 || p[i] >= n || seen[p[i]])
+        {
+            return false;
+        }
+        seen[p[i]] = 1;
+    }
+    return true;
+}
+
+/**
+ * Returns whether all elements of the given array are in [0, n). This
+ * is a parallel pass without allocations, used for maps that are 
+ * already known to be permutations.
+ */
+static bool isInRange(const int *map, int n)
+{
+    std::atomic<bool> valid(true);
+    parallelFor((size_t)n, VALUE_GRAIN, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            if (map[i] < 0 || map[i] >= n)
+            {
+                valid.store(false);
+                return;
+            }
+        }
+    });
+    return valid.load();
+}
+
+/**
+ * Returns whether the given arrays describe a valid CSR structure with
+ * m rows, n columns and nnz nonzeros: The row pointers start at the
+ * index base, are nondecreasing and end at nnz + base, and all column
+ * indices are in [base, n + base)
+ */
+static bool isValidStructure(int m, int n, int nnz, int base, const int *rowPtr, const int *colInd)
+{
+    if (rowPtr[0] != base || rowPtr[m] - base != nnz)
+    {
+        return false;
+    }
+    for (int r = 0; r < m; r++)
+    {
+        if (rowPtr[r + 1] < rowPtr[r])
+        {
+            return false;
+        }
+    }
+    for (int i = 0; i < nnz; i++)
+    {
+        if (colInd[i] < base || colInd[i] - base >= n)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Computes B = A(p,q), with the columns of each row of B sorted, and
+ * map[i] being the index of the value of A that becomes value i of B.
+ * If valA is not NULL, then the values are permuted in the same pass.
+ * Returns CUSOLVER_STATUS_INVALID_VALUE if p or q are not valid
+ * permutations, or if A is not a valid CSR structure.
+ */
+template <typename T>
+static cusolverStatus_t permuteCsr(int m, int n, int nnz, int base,
+    const int *rowPtrA, const int *colIndA, const T *valA,
+    const int *p, const int *q,
+    int *rowPtrB, int *colIndB, T *valB, int *map)
+{
+    if (!isPermutation(p, m) || !isPermutation(q, n) ||
+        !isValidStructure(m, n, nnz, base, rowPtrA, colIndA))
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    std::vector<int> qInverse(n);
+    for (int j = 0; j < n; j++)
+    {
+        qInverse[q[j]] = j;
+    }
+    rowPtrB[0] = base;
+    for (int k = 0; k < m; k++)
+    {
+        rowPtrB[k + 1] = rowPtrB[k] + (rowPtrA[p[k] + 1] - rowPtrA[p[k]]);
+    }
+    parallelFor((size_t)m, ROW_GRAIN, [&](size_t begin, size_t end)
+    {
+        std::vector<std::pair<int, int> > pairs;
+        for (size_t k = begin; k < end; k++)
+        {
+            int source = rowPtrA[p[k]] - base;
+            int target = rowPtrB[k] - base;
+            int length = rowPtrB[k + 1] - rowPtrB[k];
+            for (int j = 0; j < length; j++)
+            {
+                colIndB[target + j] = qInverse[colIndA[source + j] - base] + base;
+                map[target + j] = source + j;
+            }
+            sortRow(colIndB + target, map + target, length, pairs);
+            if (valA != NULL)
+            {
+                gather(valA, map, valB, (size_t)target, (size_t)(target + length));
+            }
+        }
+    });
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+/**
+ * Gathers valB[i] = valA[map[i]] for all nnz values, in parallel.
+ * Returns CUSOLVER_STATUS_INVALID_VALUE if the map is not a
+ * permutation of [0, nnz). If the map was validated, because it was
+ * computed by permuteCsr, then it is only checked for indices that 
+ * are out of range.
+ */
+template <typename T>
+static cusolverStatus_t permuteValues(int nnz, const T *valA, const int *map, T *valB, bool mapValidated)
+{
+    if (mapValidated ? !isInRange(map, nnz) : !isPermutation(map, nnz))
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    parallelFor((size_t)nnz, VALUE_GRAIN, [&](size_t begin, size_t end)
+    {
+        gather(valA, map, valB, begin, end);
+    });
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+/**
+ * Throws a NullPointerException and returns true if the given
+ * array is NULL
+ */
+static bool isNull(JNIEnv *env, jarray array, const char *name, const char *function)
+{
+    if (array == NULL)
+    {
+        std::string message = std::string("Parameter '") + name + "' is null for " + function;
+        ThrowByName(env, "java/lang/NullPointerException", message.c_str());
+        return true;
+    }
+    return false;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrPermuter_permuteNative(JNIEnv *env, jclass cls, jint m, jint n, jint nnz, jint indexBase, jintArray csrRowPtrA, jintArray csrColIndA, jdoubleArray csrValA, jintArray p, jintArray q, jintArray csrRowPtrB, jintArray csrColIndB, jdoubleArray csrValB, jintArray map)
+{
+    const char *function = "permute";
+    if (isNull(env, csrRowPtrA, "csrRowPtrA", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrColIndA, "csrColIndA", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrValA, "csrValA", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, p, "p", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, q, "q", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrRowPtrB, "csrRowPtrB", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrColIndB, "csrColIndB", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrValB, "csrValB", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    // map may be null
+
+    Logger::log(LOG_TRACE, "Executing CsrPermuter permute(m=%d, n=%d, nnz=%d, indexBase=%d)\n",
+        m, n, nnz, indexBase);
+
+    static const int traceId = CallTracer::registerFunction("CsrPermuter.permute", "m, n, nnz, indexBase");
+    CallTrace callTrace(traceId, m, n, nnz, indexBase);
+
+    // The map is required as temporary storage even if it is not returned
+    std::vector<int> localMap;
+    if (map == NULL)
+    {
+        localMap.resize(nnz);
+    }
+    cusolverStatus_t result;
+    {
+        CriticalArray<jint> rowPtrA(env, csrRowPtrA, false);
+        CriticalArray<jint> colIndA(env, csrColIndA, false);
+        CriticalArray<jdouble> valA(env, csrValA, false);
+        CriticalArray<jint> pNative(env, p, false);
+        CriticalArray<jint> qNative(env, q, false);
+        CriticalArray<jint> rowPtrB(env, csrRowPtrB, true);
+        CriticalArray<jint> colIndB(env, csrColIndB, true);
+        CriticalArray<jdouble> valB(env, csrValB, true);
+        CriticalArray<jint> mapNative(env, map, true);
+        if (rowPtrA.isFailed() || colIndA.isFailed() || valA.isFailed() ||
+            pNative.isFailed() || qNative.isFailed() || rowPtrB.isFailed() ||
+            colIndB.isFailed() || valB.isFailed() || mapNative.isFailed())
+        {
+            return JCUSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        int *mapPointer = map == NULL ? localMap.data() : (int*)mapNative.data();
+        result = permuteCsr<double>(m, n, nnz, indexBase,
+            (const int*)rowPtrA.data(), (const int*)colIndA.data(), valA.data(),
+            (const int*)pNative.data(), (const int*)qNative.data(),
+            (int*)rowPtrB.data(), (int*)colIndB.data(), valB.data(), mapPointer);
+    }
+    callTrace.end(result);
+    return (jint)result;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrPermuter_permuteStructureNative(JNIEnv *env, jclass cls, jint m, jint n, jint nnz, jint indexBase, jintArray csrRowPtrA, jintArray csrColIndA, jintArray p, jintArray q, jintArray csrRowPtrB, jintArray csrColIndB, jintArray map)
+{
+    const char *function = "permuteStructure";
+    if (isNull(env, csrRowPtrA, "csrRowPtrA", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrColIndA, "csrColIndA", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, p, "p", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, q, "q", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrRowPtrB, "csrRowPtrB", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrColIndB, "csrColIndB", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, map, "map", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    Logger::log(LOG_TRACE, "Executing CsrPermuter permuteStructure(m=%d, n=%d, nnz=%d, indexBase=%d)\n",
+        m, n, nnz, indexBase);
+
+    static const int traceId = CallTracer::registerFunction("CsrPermuter.permuteStructure", "m, n, nnz, indexBase");
+    CallTrace callTrace(traceId, m, n, nnz, indexBase);
+
+    CriticalArray<jint> rowPtrA(env, csrRowPtrA, false);
+    CriticalArray<jint> colIndA(env, csrColIndA, false);
+    CriticalArray<jint> pNative(env, p, false);
+    CriticalArray<jint> qNative(env, q, false);
+    CriticalArray<jint> rowPtrB(env, csrRowPtrB, true);
+    CriticalArray<jint> colIndB(env, csrColIndB, true);
+    CriticalArray<jint> mapNative(env, map, true);
+    if (rowPtrA.isFailed() || colIndA.isFailed() || pNative.isFailed() ||
+        qNative.isFailed() || rowPtrB.isFailed() || colIndB.isFailed() ||
+        mapNative.isFailed())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    cusolverStatus_t result = permuteCsr<double>(m, n, nnz, indexBase,
+        (const int*)rowPtrA.data(), (const int*)colIndA.data(), NULL,
+        (const int*)pNative.data(), (const int*)qNative.data(),
+        (int*)rowPtrB.data(), (int*)colIndB.data(), NULL, (int*)mapNative.data());
+    callTrace.end(result);
+    return (jint)result;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrPermuter_permuteValuesDoubleNative(JNIEnv *env, jclass cls, jint nnz, jdoubleArray csrValA, jintArray map, jdoubleArray csrValB, jboolean mapValidated)
+{
+    const char *function = "permuteValues";
+    if (isNull(env, csrValA, "csrValA", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, map, "map", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrValB, "csrValB", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    Logger::log(LOG_TRACE, "Executing CsrPermuter permuteValues(nnz=%d, mapValidated=%d)\n", nnz, (int)mapValidated);
+
+    static const int traceId = CallTracer::registerFunction("CsrPermuter.permuteValues", "nnz");
+    CallTrace callTrace(traceId, nnz);
+
+    CriticalArray<jdouble> valA(env, csrValA, false);
+    CriticalArray<jint> mapNative(env, map, false);
+    CriticalArray<jdouble> valB(env, csrValB, true);
+    if (valA.isFailed() || mapNative.isFailed() || valB.isFailed())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    cusolverStatus_t result = permuteValues<double>(nnz, valA.data(), (const int*)mapNative.data(), valB.data(), mapValidated == JNI_TRUE);
+    callTrace.end(result);
+    return (jint)result;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrPermuter_permuteValuesFloatNative(JNIEnv *env, jclass cls, jint nnz, jfloatArray csrValA, jintArray map, jfloatArray csrValB, jboolean mapValidated)
+{
+    const char *function = "permuteValues";
+    if (isNull(env, csrValA, "csrValA", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, map, "map", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (isNull(env, csrValB, "csrValB", function)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    Logger::log(LOG_TRACE, "Executing CsrPermuter permuteValues(nnz=%d, mapValidated=%d)\n", nnz, (int)mapValidated);
+
+    static const int traceId = CallTracer::registerFunction("CsrPermuter.permuteValues", "nnz");
+    CallTrace callTrace(traceId, nnz);
+
+    CriticalArray<jfloat> valA(env, csrValA, false);
+    CriticalArray<jint> mapNative(env, map, false);
+    CriticalArray<jfloat> valB(env, csrValB, true);
+    if (valA.isFailed() || mapNative.isFailed() || valB.isFailed())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    cusolverStatus_t result = permuteValues<float>(nnz, valA.data(), (const int*)mapNative.data(), valB.data(), mapValidated == JNI_TRUE);
+    callTrace.end(result);
+    return (jint)result;
+}
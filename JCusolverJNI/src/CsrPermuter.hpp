@@ -0,0 +1,73 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+ /* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class jcuda_jcusolver_CsrPermuter */
+
+#ifndef _Included_jcuda_jcusolver_CsrPermuter
+#define _Included_jcuda_jcusolver_CsrPermuter
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*
+     * Class:     jcuda_jcusolver_CsrPermuter
+     * Method:    permuteNative
+     * Signature: (IIII[I[I[D[I[I[I[I[D[I)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrPermuter_permuteNative
+        (JNIEnv *, jclass, jint, jint, jint, jint, jintArray, jintArray, jdoubleArray, jintArray, jintArray, jintArray, jintArray, jdoubleArray, jintArray);
+
+    /*
+     * Class:     jcuda_jcusolver_CsrPermuter
+     * Method:    permuteStructureNative
+     * Signature: (IIII[I[I[I[I[I[I[I)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrPermuter_permuteStructureNative
+        (JNIEnv *, jclass, jint, jint, jint, jint, jintArray, jintArray, jintArray, jintArray, jintArray, jintArray, jintArray);
+
+    /*
+     * Class:     jcuda_jcusolver_CsrPermuter
+     * Method:    permuteValuesDoubleNative
+     * Signature: (I[D[I[DZ)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrPermuter_permuteValuesDoubleNative
+        (JNIEnv *, jclass, jint, jdoubleArray, jintArray, jdoubleArray, jboolean);
+
+    /*
+     * Class:     jcuda_jcusolver_CsrPermuter
+     * Method:    permuteValuesFloatNative
+     * Signature: (I[F[I[FZ)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_CsrPermuter_permuteValuesFloatNative
+        (JNIEnv *, jclass, jint, jfloatArray, jintArray, jfloatArray, jboolean);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
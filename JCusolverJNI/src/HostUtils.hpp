@@ -0,0 +1,157 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCUSOLVER_HOST_UTILS
+#define JCUSOLVER_HOST_UTILS
+
+#include <jni.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/**
+ * Utilities for the hand-written host functions of JCusolver, which
+ * operate on large Java arrays with multiple threads.
+ */
+
+/**
+ * Returns the number of threads that should be used for host functions
+ */
+inline size_t hostThreadCount()
+{
+    size_t threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+}
+
+/**
+ * Calls the given function for all blocks of the range [0, count),
+ * with the blocks having a size of 'grain'. The blocks are distributed
+ * dynamically among up to hostThreadCount() threads, so that blocks
+ * with different costs are balanced. The calling thread takes part
+ * in the computation. The function is called as function(begin, end).
+ */
+template <typename Function>
+void parallelFor(size_t count, size_t grain, Function function)
+{
+    if (grain == 0)
+    {
+        grain = 1;
+    }
+    size_t blocks = (count + grain - 1) / grain;
+    size_t threads = std::min(hostThreadCount(), blocks);
+    if (threads <= 1)
+    {
+        if (count > 0)
+        {
+            function((size_t)0, count);
+        }
+        return;
+    }
+    std::atomic<size_t> next(0);
+    auto worker = [&]()
+    {
+        while (true)
+        {
+            size_t block = next.fetch_add(1);
+            if (block >= blocks)
+            {
+                break;
+            }
+            size_t begin = block * grain;
+            function(begin, std::min(count, begin + grain));
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; t++)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &thread : workers)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * A scoped view on the elements of a Java primitive array, obtained
+ * with GetPrimitiveArrayCritical. No JNI functions may be called while
+ * an instance is alive, except for creating further instances. The
+ * given array may be NULL, in which case data() returns NULL.
+ */
+template <typename T>
+class CriticalArray
+{
+public:
+    CriticalArray(JNIEnv *env, jarray array, bool writeBack)
+        : env(env), array(array), writeBack(writeBack), pointer(NULL), 
+          failed(false)
+    {
+        if (array != NULL)
+        {
+            pointer = (T*)env->GetPrimitiveArrayCritical(array, NULL);
+            failed = (pointer == NULL);
+        }
+    }
+
+    ~CriticalArray()
+    {
+        if (pointer != NULL)
+        {
+            env->ReleasePrimitiveArrayCritical(array, pointer, 
+                writeBack ? 0 : JNI_ABORT);
+        }
+    }
+
+    /**
+     * Returns whether the array was not NULL, but could not be obtained
+     */
+    bool isFailed() const
+    {
+        return failed;
+    }
+
+    T* data() const
+    {
+        return pointer;
+    }
+
+private:
+    CriticalArray(const CriticalArray&);
+    CriticalArray& operator=(const CriticalArray&);
+
+    JNIEnv *env;
+    jarray array;
+    bool writeBack;
+    T *pointer;
+    bool failed;
+};
+
+#endif
@@ -28,6 +28,7 @@
 
 #include "JCusolver_common.hpp"
 #include "JCusolver.hpp"
+#include "LazyInit.hpp"
 #include <iostream>
 #include <string>
 
@@ -38,11 +39,13 @@ jfieldID cuDoubleComplex_x; // double
 jfieldID cuDoubleComplex_y; // double
 
 /**
- * Called when the library is loaded. Will initialize all
- * required field and method IDs
+ * Called when the library is loaded. The field and method IDs are
+ * not initialized here, but by the static initializers of the classes
+ * that use them (see LazyInit.hpp)
  */
 JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *reserved)
 {
+    int64_t startNs = CallTracer::now();
     JNIEnv *env = NULL;
     if (jvm->GetEnv((void **)&env, JNI_VERSION_1_4))
     {
@@ -51,23 +54,7 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *reserved)
 
     Logger::log(LOG_TRACE, "Initializing JCusolver\n");
 
-    jclass cls = NULL;
-
-    // Initialize the JNIUtils and PointerUtils
-    if (initJNIUtils(env) == JNI_ERR) return JNI_ERR;
-    if (initPointerUtils(env) == JNI_ERR) return JNI_ERR;
-
-    // Obtain the fieldIDs for cuComplex#x and cuComplex#y
-    if (!init(env, cls, "jcuda/cuComplex")) return JNI_ERR;
-    if (!init(env, cls, cuComplex_x, "x", "F")) return JNI_ERR;
-    if (!init(env, cls, cuComplex_y, "y", "F")) return JNI_ERR;
-
-
-    // Obtain the fieldIDs for cuDoubleComplex#x and cuDoubleComplex#y
-    if (!init(env, cls, "jcuda/cuDoubleComplex")) return JNI_ERR;
-    if (!init(env, cls, cuDoubleComplex_x, "x", "D")) return JNI_ERR;
-    if (!init(env, cls, cuDoubleComplex_y, "y", "D")) return JNI_ERR;
-
+    LazyInit::recordOnLoad(CallTracer::now() - startNs);
     return JNI_VERSION_1_4;
 }
 
@@ -85,6 +72,229 @@ JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_setLogLevelNative
     Logger::setLogLevel((LogLevel)logLevel);
 }
 
+/*
+ * Start writing the binary call trace into the given file
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    startCallTraceNative
+ * Signature: (Ljava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_startCallTraceNative
+  (JNIEnv *env, jclass cla, jstring fileName)
+{
+    if (fileName == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'fileName' is null for startCallTrace");
+        return;
+    }
+    const char *fileNameNative = env->GetStringUTFChars(fileName, NULL);
+    if (fileNameNative == NULL)
+    {
+        return;
+    }
+    bool started = CallTracer::start(fileNameNative);
+    env->ReleaseStringUTFChars(fileName, fileNameNative);
+    if (!started)
+    {
+        ThrowByName(env, "java/io/IOException", "Could not start the call trace. It is already running, or the file could not be opened");
+    }
+}
+
+/*
+ * Stop writing the binary call trace
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    stopCallTraceNative
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_stopCallTraceNative
+  (JNIEnv *env, jclass cla)
+{
+    CallTracer::stop();
+}
+
+/*
+ * Start recording the native function calls into the given file
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    startCallRecordingNative
+ * Signature: (Ljava/lang/String;Z)V
+ */
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_startCallRecordingNative
+  (JNIEnv *env, jclass cla, jstring fileName, jboolean contents)
+{
+    if (fileName == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'fileName' is null for startCallRecording");
+        return;
+    }
+    const char *fileNameNative = env->GetStringUTFChars(fileName, NULL);
+    if (fileNameNative == NULL)
+    {
+        return;
+    }
+    bool started = CallRecorder::start(env, fileNameNative, contents == JNI_TRUE);
+    env->ReleaseStringUTFChars(fileName, fileNameNative);
+    if (!started)
+    {
+        ThrowByName(env, "java/io/IOException", "Could not start the call recording. It is already running, or the file could not be opened");
+    }
+}
+
+/*
+ * Stop recording the native function calls
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    stopCallRecordingNative
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_stopCallRecordingNative
+  (JNIEnv *env, jclass cla)
+{
+    CallRecorder::stop();
+}
+
+/*
+ * Initialize the given components of the native library
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    initializeNative
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_initializeNative
+  (JNIEnv *env, jclass cla, jint components)
+{
+    if (!LazyInit::ensure(env, components) && !env->ExceptionCheck())
+    {
+        ThrowByName(env, "java/lang/UnsatisfiedLinkError", "Could not initialize the JCusolver native library");
+    }
+}
+
+/*
+ * Obtain the times that have been spent for the startup of the native
+ * library, as described in LazyInit::getStartupTimes
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    getStartupTimesNative
+ * Signature: ([J)V
+ */
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_getStartupTimesNative
+  (JNIEnv *env, jclass cla, jlongArray times)
+{
+    if (times == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'times' is null for getStartupTimes");
+        return;
+    }
+    if (env->GetArrayLength(times) < LazyInit::STARTUP_VALUE_COUNT)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException", "Array for startup times is too small");
+        return;
+    }
+    int64_t values[LazyInit::STARTUP_VALUE_COUNT];
+    LazyInit::getStartupTimes(values);
+    jlong valuesNative[LazyInit::STARTUP_VALUE_COUNT];
+    for (int i = 0; i < LazyInit::STARTUP_VALUE_COUNT; i++)
+    {
+        valuesNative[i] = (jlong)values[i];
+    }
+    env->SetLongArrayRegion(times, 0, LazyInit::STARTUP_VALUE_COUNT, valuesNative);
+}
+
+/*
+ * Enable or disable sticky errors for the calling thread
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    setStickyErrorsEnabledNative
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_setStickyErrorsEnabledNative
+  (JNIEnv *env, jclass cla, jboolean enabled)
+{
+    StickyErrors::setEnabled(enabled == JNI_TRUE);
+}
+
+/*
+ * Returns whether sticky errors are enabled for the calling thread
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    isStickyErrorsEnabledNative
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_JCusolver_isStickyErrorsEnabledNative
+  (JNIEnv *env, jclass cla)
+{
+    return StickyErrors::isEnabled() ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Obtain the sticky error of the calling thread. Returns the function
+ * signature and fills the given array with the status, the number of 
+ * failed calls and the 4 recorded arguments, or returns NULL if no call 
+ * failed.
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    getStickyErrorNative
+ * Signature: ([J)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_jcuda_jcusolver_JCusolver_getStickyErrorNative
+  (JNIEnv *env, jclass cla, jlongArray values)
+{
+    if (values == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'values' is null for getStickyError");
+        return NULL;
+    }
+    if (env->GetArrayLength(values) < 6)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException", "Array for sticky error is too small");
+        return NULL;
+    }
+    int functionId = 0;
+    int status = 0;
+    int64_t args[4];
+    int64_t failedCount = 0;
+    if (!StickyErrors::get(&functionId, &status, args, &failedCount))
+    {
+        return NULL;
+    }
+    jlong valuesNative[6] = { (jlong)status, (jlong)failedCount, (jlong)args[0], (jlong)args[1], (jlong)args[2], (jlong)args[3] };
+    env->SetLongArrayRegion(values, 0, 6, valuesNative);
+    return env->NewStringUTF(CallTracer::getFunctionSignature(functionId).c_str());
+}
+
+/*
+ * Clear the sticky error of the calling thread
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    clearStickyErrorNative
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_clearStickyErrorNative
+  (JNIEnv *env, jclass cla)
+{
+    StickyErrors::clear();
+}
+
+/*
+ * Returns whether the functions of JCusolverDn, JCusolverSp, JCusolverRf
+ * and JCusolverMg are in separate libraries, which have to be loaded in
+ * addition to this one
+ *
+ * Class:     jcuda_jcusolver_JCusolver
+ * Method:    hasFamilyLibrariesNative
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_JCusolver_hasFamilyLibrariesNative
+  (JNIEnv *env, jclass cla)
+{
+#ifdef JCUSOLVER_SPLIT_LIBRARIES
+    return JNI_TRUE;
+#else
+    return JNI_FALSE;
+#endif
+}
+
 
 
 // Initialization / release of handles
@@ -175,10 +385,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolver_cusolverGetPropertyNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverGetProperty(type=%d, value=%p)\n",
-        type, value);
-
     // Native variable declarations
     libraryPropertyType type_native;
     int value_native;
@@ -188,7 +394,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolver_cusolverGetPropertyNative(
     // value is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverGetProperty", "type");
+    CallCapture callCapture(env, traceId, type, value);
+    CallTrace callTrace(traceId, type);
     cusolverStatus_t jniResult_native = cusolverGetProperty(type_native, &value_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // type is primitive
@@ -208,10 +419,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolver_cusolverGetVersionNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverGetVersion(version=%p)\n",
-        version);
-
     // Native variable declarations
     int version_native;
 
@@ -219,7 +426,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolver_cusolverGetVersionNative(J
     // version is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverGetVersion", "");
+    CallCapture callCapture(env, traceId, version);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverGetVersion(&version_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     if (!set(env, version, 0, (jint)version_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
@@ -43,6 +43,94 @@ extern "C" {
     JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_setLogLevelNative
         (JNIEnv *, jclass, jint);
 
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    startCallTraceNative
+    * Signature: (Ljava/lang/String;)V
+    */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_startCallTraceNative
+        (JNIEnv *, jclass, jstring);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    stopCallTraceNative
+    * Signature: ()V
+    */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_stopCallTraceNative
+        (JNIEnv *, jclass);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    startCallRecordingNative
+    * Signature: (Ljava/lang/String;Z)V
+    */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_startCallRecordingNative
+        (JNIEnv *, jclass, jstring, jboolean);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    stopCallRecordingNative
+    * Signature: ()V
+    */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_stopCallRecordingNative
+        (JNIEnv *, jclass);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    initializeNative
+    * Signature: (I)V
+    */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_initializeNative
+        (JNIEnv *, jclass, jint);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    getStartupTimesNative
+    * Signature: ([J)V
+    */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_getStartupTimesNative
+        (JNIEnv *, jclass, jlongArray);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    hasFamilyLibrariesNative
+    * Signature: ()Z
+    */
+    JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_JCusolver_hasFamilyLibrariesNative
+        (JNIEnv *, jclass);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    setStickyErrorsEnabledNative
+    * Signature: (Z)V
+    */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_setStickyErrorsEnabledNative
+        (JNIEnv *, jclass, jboolean);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    isStickyErrorsEnabledNative
+    * Signature: ()Z
+    */
+    JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_JCusolver_isStickyErrorsEnabledNative
+        (JNIEnv *, jclass);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    getStickyErrorNative
+    * Signature: ([J)Ljava/lang/String;
+    */
+    JNIEXPORT jstring JNICALL Java_jcuda_jcusolver_JCusolver_getStickyErrorNative
+        (JNIEnv *, jclass, jlongArray);
+
+    /*
+    * Class:     jcuda_jcusolver_JCusolver
+    * Method:    clearStickyErrorNative
+    * Signature: ()V
+    */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_JCusolver_clearStickyErrorNative
+        (JNIEnv *, jclass);
+
     /*
     * Class:     jcuda_jcusolver_JCusolver
     * Method:    cusolverGetPropertyNative
@@ -31,8 +31,20 @@
 #include <iostream>
 #include <string>
 
+// When the bindings are split into one library per family of functions
+// (see JCUSOLVER_SPLIT_LIBRARIES in CMakeLists.txt), this file is compiled 
+// once for each Dn family, with the define of that family: The core 
+// functions, the iterative refinement (IRS) functions, and the eigenvalue
+// and singular value functions. Otherwise, it contains all of them.
+#if !defined(JCUSOLVER_FAMILY_DN) && !defined(JCUSOLVER_FAMILY_DNIRS) && !defined(JCUSOLVER_FAMILY_DNEIGEN)
+#define JCUSOLVER_FAMILY_DN
+#define JCUSOLVER_FAMILY_DNIRS
+#define JCUSOLVER_FAMILY_DNEIGEN
+#endif
+
 //=== Auto-generated part: ===================================================
 
+#ifdef JCUSOLVER_FAMILY_DN
 JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateNative(JNIEnv *env, jclass cls, jobject handle)
 {
     // Null-checks for non-primitive arguments
@@ -42,10 +54,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCreate(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
 
@@ -53,7 +61,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateNative(J
     // handle is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCreate", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnCreate(&handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, handle, (jlong)handle_native);
@@ -72,10 +85,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDestroyNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDestroy(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
 
@@ -83,11 +92,19 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDestroyNative(
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDestroy", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnDestroy(handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
 
+    // Workspace accounting
+    if (jniResult_native == CUSOLVER_STATUS_SUCCESS) WorkspaceAccounting::release(handle_native);
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -103,10 +120,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSetStreamNativ
     }
     // streamId is checked by the library
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSetStream(handle=%p, streamId=%p)\n",
-        handle, streamId);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cudaStream_t streamId_native;
@@ -116,7 +129,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSetStreamNativ
     streamId_native = (cudaStream_t)getNativePointerValue(env, streamId);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSetStream", "");
+    CallCapture callCapture(env, traceId, handle, streamId);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnSetStream(handle_native, streamId_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -141,10 +159,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetStreamNativ
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnGetStream(handle=%p, streamId=%p)\n",
-        handle, streamId);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cudaStream_t streamId_native;
@@ -154,7 +168,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetStreamNativ
     // streamId is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnGetStream", "");
+    CallCapture callCapture(env, traceId, handle, streamId);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnGetStream(handle_native, &streamId_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -164,6 +183,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetStreamNativ
     jint jniResult = (jint)jniResult_native;
     return jniResult;
 }
+#endif // JCUSOLVER_FAMILY_DN
 
 //============================================================
 // IRS headers
@@ -171,6 +191,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetStreamNativ
 // =============================================================================
 // IRS helper function API
 // =============================================================================
+#ifdef JCUSOLVER_FAMILY_DNIRS
 JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsCreateNative(JNIEnv *env, jclass cls, jobject params_ptr)
 {
     // Null-checks for non-primitive arguments
@@ -180,10 +201,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsCreat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsCreate(params_ptr=%p)\n",
-        params_ptr);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_ptr_native;
 
@@ -191,7 +208,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsCreat
     // params_ptr is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsCreate", "");
+    CallCapture callCapture(env, traceId, params_ptr);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsCreate(&params_ptr_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, params_ptr, (jlong)params_ptr_native);
@@ -210,10 +232,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsDestr
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsDestroy(params=%p)\n",
-        params);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
 
@@ -221,7 +239,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsDestr
     params_native = (cusolverDnIRSParams_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsDestroy", "");
+    CallCapture callCapture(env, traceId, params);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsDestroy(params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -241,10 +264,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetRe
     }
     // refinement_solver is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsSetRefinementSolver(params=%p, refinement_solver=%d)\n",
-        params, refinement_solver);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     cusolverIRSRefinement_t refinement_solver_native;
@@ -254,7 +273,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetRe
     refinement_solver_native = (cusolverIRSRefinement_t)refinement_solver;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsSetRefinementSolver", "refinement_solver");
+    CallCapture callCapture(env, traceId, params, refinement_solver);
+    CallTrace callTrace(traceId, refinement_solver);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsSetRefinementSolver(params_native, refinement_solver_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -275,10 +299,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetSo
     }
     // solver_main_precision is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsSetSolverMainPrecision(params=%p, solver_main_precision=%d)\n",
-        params, solver_main_precision);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     cusolverPrecType_t solver_main_precision_native;
@@ -288,7 +308,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetSo
     solver_main_precision_native = (cusolverPrecType_t)solver_main_precision;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsSetSolverMainPrecision", "solver_main_precision");
+    CallCapture callCapture(env, traceId, params, solver_main_precision);
+    CallTrace callTrace(traceId, solver_main_precision);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsSetSolverMainPrecision(params_native, solver_main_precision_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -309,10 +334,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetSo
     }
     // solver_lowest_precision is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsSetSolverLowestPrecision(params=%p, solver_lowest_precision=%d)\n",
-        params, solver_lowest_precision);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     cusolverPrecType_t solver_lowest_precision_native;
@@ -322,7 +343,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetSo
     solver_lowest_precision_native = (cusolverPrecType_t)solver_lowest_precision;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsSetSolverLowestPrecision", "solver_lowest_precision");
+    CallCapture callCapture(env, traceId, params, solver_lowest_precision);
+    CallTrace callTrace(traceId, solver_lowest_precision);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsSetSolverLowestPrecision(params_native, solver_lowest_precision_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -344,10 +370,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetSo
     // solver_main_precision is primitive
     // solver_lowest_precision is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsSetSolverPrecisions(params=%p, solver_main_precision=%d, solver_lowest_precision=%d)\n",
-        params, solver_main_precision, solver_lowest_precision);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     cusolverPrecType_t solver_main_precision_native;
@@ -359,7 +381,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetSo
     solver_lowest_precision_native = (cusolverPrecType_t)solver_lowest_precision;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsSetSolverPrecisions", "solver_main_precision, solver_lowest_precision");
+    CallCapture callCapture(env, traceId, params, solver_main_precision, solver_lowest_precision);
+    CallTrace callTrace(traceId, solver_main_precision, solver_lowest_precision);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsSetSolverPrecisions(params_native, solver_main_precision_native, solver_lowest_precision_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -381,10 +408,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetTo
     }
     // val is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsSetTol(params=%p, val=%lf)\n",
-        params, val);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     double val_native = 0.0;
@@ -394,7 +417,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetTo
     val_native = (double)val;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsSetTol", "");
+    CallCapture callCapture(env, traceId, params, val);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsSetTol(params_native, val_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -415,10 +443,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetTo
     }
     // val is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsSetTolInner(params=%p, val=%lf)\n",
-        params, val);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     double val_native = 0.0;
@@ -428,7 +452,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetTo
     val_native = (double)val;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsSetTolInner", "");
+    CallCapture callCapture(env, traceId, params, val);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsSetTolInner(params_native, val_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -449,10 +478,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetMa
     }
     // maxiters is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsSetMaxIters(params=%p, maxiters=%d)\n",
-        params, maxiters);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     cusolver_int_t maxiters_native = 0;
@@ -462,7 +487,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetMa
     maxiters_native = (cusolver_int_t)maxiters;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsSetMaxIters", "maxiters");
+    CallCapture callCapture(env, traceId, params, maxiters);
+    CallTrace callTrace(traceId, maxiters);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsSetMaxIters(params_native, maxiters_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -483,10 +513,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetMa
     }
     // maxiters_inner is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsSetMaxItersInner(params=%p, maxiters_inner=%d)\n",
-        params, maxiters_inner);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     cusolver_int_t maxiters_inner_native = 0;
@@ -496,7 +522,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsSetMa
     maxiters_inner_native = (cusolver_int_t)maxiters_inner;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsSetMaxItersInner", "maxiters_inner");
+    CallCapture callCapture(env, traceId, params, maxiters_inner);
+    CallTrace callTrace(traceId, maxiters_inner);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsSetMaxItersInner(params_native, maxiters_inner_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -521,10 +552,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsGetMa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsGetMaxIters(params=%p, maxiters=%p)\n",
-        params, maxiters);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
     cusolver_int_t maxiters_native;
@@ -534,7 +561,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsGetMa
     // maxiters is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsGetMaxIters", "");
+    CallCapture callCapture(env, traceId, params, maxiters);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsGetMaxIters(params_native, &maxiters_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -554,10 +586,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsEnabl
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsEnableFallback(params=%p)\n",
-        params);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
 
@@ -565,7 +593,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsEnabl
     params_native = (cusolverDnIRSParams_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsEnableFallback", "");
+    CallCapture callCapture(env, traceId, params);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsEnableFallback(params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -584,10 +617,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsDisab
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSParamsDisableFallback(params=%p)\n",
-        params);
-
     // Native variable declarations
     cusolverDnIRSParams_t params_native;
 
@@ -595,7 +624,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSParamsDisab
     params_native = (cusolverDnIRSParams_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSParamsDisableFallback", "");
+    CallCapture callCapture(env, traceId, params);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSParamsDisableFallback(params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -617,10 +651,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosDestro
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSInfosDestroy(infos=%p)\n",
-        infos);
-
     // Native variable declarations
     cusolverDnIRSInfos_t infos_native;
 
@@ -628,7 +658,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosDestro
     infos_native = (cusolverDnIRSInfos_t)getNativePointerValue(env, infos);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSInfosDestroy", "");
+    CallCapture callCapture(env, traceId, infos);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSInfosDestroy(infos_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // infos is read-only
@@ -647,10 +682,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosCreate
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSInfosCreate(infos_ptr=%p)\n",
-        infos_ptr);
-
     // Native variable declarations
     cusolverDnIRSInfos_t infos_ptr_native;
 
@@ -658,7 +689,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosCreate
     // infos_ptr is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSInfosCreate", "");
+    CallCapture callCapture(env, traceId, infos_ptr);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSInfosCreate(&infos_ptr_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, infos_ptr, (jlong)infos_ptr_native);
@@ -682,10 +718,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosGetNit
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSInfosGetNiters(infos=%p, niters=%p)\n",
-        infos, niters);
-
     // Native variable declarations
     cusolverDnIRSInfos_t infos_native;
     cusolver_int_t niters_native;
@@ -695,7 +727,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosGetNit
     // niters is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSInfosGetNiters", "");
+    CallCapture callCapture(env, traceId, infos, niters);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSInfosGetNiters(infos_native, &niters_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // infos is read-only
@@ -720,10 +757,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosGetOut
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSInfosGetOuterNiters(infos=%p, outer_niters=%p)\n",
-        infos, outer_niters);
-
     // Native variable declarations
     cusolverDnIRSInfos_t infos_native;
     cusolver_int_t outer_niters_native;
@@ -733,7 +766,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosGetOut
     // outer_niters is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSInfosGetOuterNiters", "");
+    CallCapture callCapture(env, traceId, infos, outer_niters);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSInfosGetOuterNiters(infos_native, &outer_niters_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // infos is read-only
@@ -753,10 +791,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosReques
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSInfosRequestResidual(infos=%p)\n",
-        infos);
-
     // Native variable declarations
     cusolverDnIRSInfos_t infos_native;
 
@@ -764,7 +798,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosReques
     infos_native = (cusolverDnIRSInfos_t)getNativePointerValue(env, infos);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSInfosRequestResidual", "");
+    CallCapture callCapture(env, traceId, infos);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSInfosRequestResidual(infos_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // infos is read-only
@@ -788,10 +827,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosGetRes
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSInfosGetResidualHistory(infos=%p, residual_history=%p)\n",
-        infos, residual_history);
-
     // Native variable declarations
     cusolverDnIRSInfos_t infos_native;
     void * residual_history_native;
@@ -801,7 +836,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosGetRes
     // residual_history is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSInfosGetResidualHistory", "");
+    CallCapture callCapture(env, traceId, infos, residual_history);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSInfosGetResidualHistory(infos_native, &residual_history_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // infos is read-only
@@ -834,10 +874,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosGetMax
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSInfosGetMaxIters(infos=%p, maxiters=%p)\n",
-        infos, maxiters);
-
     // Native variable declarations
     cusolverDnIRSInfos_t infos_native;
     cusolver_int_t maxiters_native;
@@ -847,7 +883,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSInfosGetMax
     // maxiters is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSInfosGetMaxIters", "");
+    CallCapture callCapture(env, traceId, infos, maxiters);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnIRSInfosGetMaxIters(infos_native, &maxiters_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // infos is read-only
@@ -916,10 +957,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZZgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -953,7 +990,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZZgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZZgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1026,10 +1068,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZCgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1063,7 +1101,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZCgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZCgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1136,10 +1179,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZKgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1173,7 +1212,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZKgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZKgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1246,10 +1290,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZEgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1283,7 +1323,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZEgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZEgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1356,10 +1401,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZYgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1393,7 +1434,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZYgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZYgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1466,10 +1512,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCCgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1503,7 +1545,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCCgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnCCgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1576,10 +1623,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCEgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1613,7 +1656,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCEgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnCEgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1686,10 +1734,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCKgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1723,7 +1767,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCKgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnCKgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1796,10 +1845,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCYgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1833,7 +1878,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCYgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnCYgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1906,10 +1956,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDDgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -1943,7 +1989,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDDgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDDgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2016,10 +2067,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDSgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2053,7 +2100,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDSgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDSgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2126,10 +2178,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDHgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2163,7 +2211,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDHgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDHgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2236,10 +2289,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDBgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2273,7 +2322,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDBgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDBgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2346,10 +2400,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDXgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2383,7 +2433,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDXgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDXgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2456,10 +2511,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSSgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2493,7 +2544,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSSgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnSSgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2566,10 +2622,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSHgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2603,7 +2655,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSHgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnSHgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2676,10 +2733,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSBgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2713,7 +2766,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSBgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnSBgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2786,10 +2844,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgesvNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSXgesv(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2823,7 +2877,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgesvNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSXgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnSXgesv(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2880,10 +2939,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZZgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2913,7 +2968,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZZgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZZgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2929,6 +2989,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -2962,10 +3025,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZCgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -2995,7 +3054,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZCgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZCgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3011,6 +3075,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3044,10 +3111,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZKgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3077,7 +3140,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZKgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZKgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3093,6 +3161,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3126,10 +3197,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZEgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3159,7 +3226,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZEgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZEgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3175,6 +3247,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3208,10 +3283,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZYgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3241,7 +3312,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZYgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnZYgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3257,6 +3333,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3290,10 +3369,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCCgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3323,7 +3398,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCCgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnCCgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3339,6 +3419,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3372,10 +3455,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCKgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3405,7 +3484,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCKgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnCKgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3421,6 +3505,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3454,10 +3541,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCEgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3487,7 +3570,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCEgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnCEgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3503,6 +3591,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3536,10 +3627,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCYgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3569,7 +3656,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCYgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnCYgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3585,6 +3677,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3618,10 +3713,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDDgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3651,7 +3742,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDDgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDDgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3667,6 +3763,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3700,10 +3799,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDSgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3733,7 +3828,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDSgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDSgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3749,6 +3849,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3782,10 +3885,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDHgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3815,7 +3914,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDHgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDHgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3831,6 +3935,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3864,10 +3971,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDBgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3897,7 +4000,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDBgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDBgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3913,6 +4021,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -3946,10 +4057,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDXgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -3979,7 +4086,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDXgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnDXgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3995,6 +4107,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -4028,10 +4143,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSSgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -4061,7 +4172,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSSgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnSSgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4077,6 +4193,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -4110,10 +4229,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSHgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -4143,7 +4258,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSHgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnSHgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4159,6 +4279,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -4192,10 +4315,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSBgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -4225,7 +4344,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSBgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnSBgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4241,6 +4365,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -4274,10 +4401,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgesv_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSXgesv_bufferSize(handle=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dipiv=%p, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t n_native = 0;
@@ -4307,7 +4430,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgesv_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSXgesv_bufferSize", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnSXgesv_bufferSize(handle_native, n_native, nrhs_native, dA_native, ldda_native, dipiv_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4323,6 +4451,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgesv_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -4380,10 +4511,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZZgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -4417,7 +4544,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZZgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZZgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4486,10 +4618,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZCgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -4523,7 +4651,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZCgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZCgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4592,10 +4725,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZKgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -4629,7 +4758,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZKgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZKgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4698,10 +4832,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZEgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -4735,7 +4865,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZEgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZEgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4804,10 +4939,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZYgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -4841,7 +4972,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZYgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZYgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4910,10 +5046,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCCgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -4947,7 +5079,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCCgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnCCgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5016,10 +5153,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCKgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5053,7 +5186,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCKgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnCKgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5122,10 +5260,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCEgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5159,7 +5293,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCEgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnCEgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5228,10 +5367,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCYgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5265,7 +5400,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCYgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnCYgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5334,10 +5474,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDDgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5371,7 +5507,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDDgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDDgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5440,10 +5581,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDSgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5477,7 +5614,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDSgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDSgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5546,10 +5688,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDHgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5583,7 +5721,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDHgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDHgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5652,10 +5795,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDBgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5689,7 +5828,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDBgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDBgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5758,10 +5902,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDXgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5795,7 +5935,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDXgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDXgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5864,10 +6009,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSSgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -5901,7 +6042,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSSgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnSSgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5970,10 +6116,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSHgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6007,7 +6149,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSHgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnSHgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6076,10 +6223,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSBgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6113,7 +6256,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSBgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnSBgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6182,10 +6330,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgelsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSXgels(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, iter=%p, d_info=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6219,7 +6363,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgelsNative(J
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSXgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnSXgels(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &iter_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6288,10 +6437,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZZgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6321,7 +6466,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZZgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZZgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6337,6 +6487,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZZgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -6382,10 +6535,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZCgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6415,7 +6564,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZCgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZCgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6431,6 +6585,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZCgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -6476,10 +6633,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZKgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6509,7 +6662,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZKgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZKgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6525,6 +6683,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZKgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -6570,10 +6731,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZEgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6603,7 +6760,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZEgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZEgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6619,6 +6781,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZEgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -6664,10 +6829,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZYgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6697,7 +6858,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZYgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnZYgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6713,6 +6879,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZYgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -6758,10 +6927,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCCgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6791,7 +6956,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCCgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnCCgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6807,6 +6977,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCCgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -6852,10 +7025,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCKgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6885,7 +7054,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCKgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnCKgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6901,6 +7075,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCKgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -6946,10 +7123,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCEgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -6979,7 +7152,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCEgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnCEgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6995,6 +7173,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCEgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7040,10 +7221,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCYgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7073,7 +7250,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCYgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnCYgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7089,6 +7271,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCYgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7134,10 +7319,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDDgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7167,7 +7348,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDDgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDDgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7183,6 +7369,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDDgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7228,10 +7417,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDSgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7261,7 +7446,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDSgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDSgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7277,6 +7467,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDSgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7322,10 +7515,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDHgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7355,7 +7544,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDHgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDHgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7371,6 +7565,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDHgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7416,10 +7613,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDBgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7449,7 +7642,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDBgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDBgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7465,6 +7663,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDBgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7510,10 +7711,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDXgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7543,7 +7740,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDXgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnDXgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7559,6 +7761,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDXgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7604,10 +7809,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSSgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7637,7 +7838,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSSgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnSSgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7653,6 +7859,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSSgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7698,10 +7907,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSHgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7731,7 +7936,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSHgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnSHgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7747,6 +7957,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSHgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7792,10 +8005,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSBgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7825,7 +8034,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSBgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnSBgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7841,6 +8055,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSBgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7886,10 +8103,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgels_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSXgels_bufferSize(handle=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%p)\n",
-        handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolver_int_t m_native = 0;
@@ -7919,7 +8132,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgels_1buffer
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSXgels_bufferSize", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnSXgels_bufferSize(handle_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7935,6 +8153,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSXgels_1buffer
     // dWorkspace is a native pointer
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -7997,10 +8218,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgesvNative
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSXgesv(handle=%p, gesv_irs_params=%p, gesv_irs_infos=%p, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, niters=%p, d_info=%p)\n",
-        handle, gesv_irs_params, gesv_irs_infos, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, niters, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnIRSParams_t gesv_irs_params_native;
@@ -8036,7 +8253,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgesvNative
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSXgesv", "n, nrhs, ldda, lddb");
+    CallCapture callCapture(env, traceId, handle, gesv_irs_params, gesv_irs_infos, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, niters, d_info);
+    CallTrace callTrace(traceId, n, nrhs, ldda, lddb);
     cusolverStatus_t jniResult_native = cusolverDnIRSXgesv(handle_native, gesv_irs_params_native, gesv_irs_infos_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &niters_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8081,10 +8303,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgesv_1buff
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSXgesv_bufferSize(handle=%p, params=%p, n=%d, nrhs=%d, lwork_bytes=%p)\n",
-        handle, params, n, nrhs, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnIRSParams_t params_native;
@@ -8100,7 +8318,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgesv_1buff
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSXgesv_bufferSize", "n, nrhs");
+    CallCapture callCapture(env, traceId, handle, params, n, nrhs, lwork_bytes);
+    CallTrace callTrace(traceId, n, nrhs);
     cusolverStatus_t jniResult_native = cusolverDnIRSXgesv_bufferSize(handle_native, params_native, n_native, nrhs_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8109,6 +8332,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgesv_1buff
     // nrhs is primitive
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -8170,10 +8396,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgelsNative
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSXgels(handle=%p, gels_irs_params=%p, gels_irs_infos=%p, m=%d, n=%d, nrhs=%d, dA=%p, ldda=%d, dB=%p, lddb=%d, dX=%p, lddx=%d, dWorkspace=%p, lwork_bytes=%ld, niters=%p, d_info=%p)\n",
-        handle, gels_irs_params, gels_irs_infos, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, niters, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnIRSParams_t gels_irs_params_native;
@@ -8211,7 +8433,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgelsNative
     d_info_native = (cusolver_int_t *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSXgels", "m, n, nrhs, ldda");
+    CallCapture callCapture(env, traceId, handle, gels_irs_params, gels_irs_infos, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, niters, d_info);
+    CallTrace callTrace(traceId, m, n, nrhs, ldda);
     cusolverStatus_t jniResult_native = cusolverDnIRSXgels(handle_native, gels_irs_params_native, gels_irs_infos_native, m_native, n_native, nrhs_native, dA_native, ldda_native, dB_native, lddb_native, dX_native, lddx_native, dWorkspace_native, lwork_bytes_native, &niters_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8258,10 +8485,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgels_1buff
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnIRSXgels_bufferSize(handle=%p, params=%p, m=%d, n=%d, nrhs=%d, lwork_bytes=%p)\n",
-        handle, params, m, n, nrhs, lwork_bytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnIRSParams_t params_native;
@@ -8279,7 +8502,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgels_1buff
     // lwork_bytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnIRSXgels_bufferSize", "m, n, nrhs");
+    CallCapture callCapture(env, traceId, handle, params, m, n, nrhs, lwork_bytes);
+    CallTrace callTrace(traceId, m, n, nrhs);
     cusolverStatus_t jniResult_native = cusolverDnIRSXgels_bufferSize(handle_native, params_native, m_native, n_native, nrhs_native, &lwork_bytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8289,13 +8517,18 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnIRSXgels_1buff
     // nrhs is primitive
     if (!set(env, lwork_bytes, 0, (jlong)lwork_bytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, lwork_bytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
 }
+#endif // JCUSOLVER_FAMILY_DNIRS
 
 /*******************************************************************************/
 /** Cholesky factorization and its solver */
+#ifdef JCUSOLVER_FAMILY_DN
 JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrf_1bufferSizeNative(JNIEnv *env, jclass cls, jobject handle, jint uplo, jint n, jobject A, jint lda, jintArray Lwork)
 {
     // Null-checks for non-primitive arguments
@@ -8318,10 +8551,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSpotrf_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, Lwork=%p)\n",
-        handle, uplo, n, A, lda, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8339,7 +8568,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrf_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSpotrf_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, Lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSpotrf_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8349,6 +8583,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrf_1buffer
     // lda is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -8376,10 +8613,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDpotrf_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, Lwork=%p)\n",
-        handle, uplo, n, A, lda, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8397,7 +8630,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrf_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDpotrf_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, Lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDpotrf_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8407,6 +8645,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrf_1buffer
     // lda is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -8434,10 +8675,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCpotrf_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, Lwork=%p)\n",
-        handle, uplo, n, A, lda, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8455,7 +8692,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrf_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCpotrf_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, Lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCpotrf_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8465,6 +8707,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrf_1buffer
     // lda is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -8492,10 +8737,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZpotrf_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, Lwork=%p)\n",
-        handle, uplo, n, A, lda, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8513,7 +8754,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrf_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZpotrf_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, Lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZpotrf_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8523,6 +8769,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrf_1buffer
     // lda is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -8556,10 +8805,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSpotrf(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, Workspace=%p, Lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, Workspace, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8581,7 +8826,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSpotrf", "uplo, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, Workspace, Lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnSpotrf(handle_native, uplo_native, n_native, A_native, lda_native, Workspace_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8626,10 +8876,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDpotrf(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, Workspace=%p, Lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, Workspace, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8651,7 +8897,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDpotrf", "uplo, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, Workspace, Lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnDpotrf(handle_native, uplo_native, n_native, A_native, lda_native, Workspace_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8696,10 +8947,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCpotrf(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, Workspace=%p, Lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, Workspace, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8721,7 +8968,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCpotrf", "uplo, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, Workspace, Lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnCpotrf(handle_native, uplo_native, n_native, A_native, lda_native, Workspace_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8766,10 +9018,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZpotrf(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, Workspace=%p, Lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, Workspace, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8791,7 +9039,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZpotrf", "uplo, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, Workspace, Lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnZpotrf(handle_native, uplo_native, n_native, A_native, lda_native, Workspace_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8837,10 +9090,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSpotrs(handle=%p, uplo=%d, n=%d, nrhs=%d, A=%p, lda=%d, B=%p, ldb=%d, devInfo=%p)\n",
-        handle, uplo, n, nrhs, A, lda, B, ldb, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8864,7 +9113,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrsNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSpotrs", "uplo, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, A, lda, B, ldb, devInfo);
+    CallTrace callTrace(traceId, uplo, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnSpotrs(handle_native, uplo_native, n_native, nrhs_native, A_native, lda_native, B_native, ldb_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8911,10 +9165,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDpotrs(handle=%p, uplo=%d, n=%d, nrhs=%d, A=%p, lda=%d, B=%p, ldb=%d, devInfo=%p)\n",
-        handle, uplo, n, nrhs, A, lda, B, ldb, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -8938,7 +9188,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrsNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDpotrs", "uplo, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, A, lda, B, ldb, devInfo);
+    CallTrace callTrace(traceId, uplo, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnDpotrs(handle_native, uplo_native, n_native, nrhs_native, A_native, lda_native, B_native, ldb_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -8985,10 +9240,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCpotrs(handle=%p, uplo=%d, n=%d, nrhs=%d, A=%p, lda=%d, B=%p, ldb=%d, devInfo=%p)\n",
-        handle, uplo, n, nrhs, A, lda, B, ldb, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9012,7 +9263,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrsNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCpotrs", "uplo, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, A, lda, B, ldb, devInfo);
+    CallTrace callTrace(traceId, uplo, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnCpotrs(handle_native, uplo_native, n_native, nrhs_native, A_native, lda_native, B_native, ldb_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9059,10 +9315,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZpotrs(handle=%p, uplo=%d, n=%d, nrhs=%d, A=%p, lda=%d, B=%p, ldb=%d, devInfo=%p)\n",
-        handle, uplo, n, nrhs, A, lda, B, ldb, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9086,7 +9338,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrsNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZpotrs", "uplo, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, A, lda, B, ldb, devInfo);
+    CallTrace callTrace(traceId, uplo, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnZpotrs(handle_native, uplo_native, n_native, nrhs_native, A_native, lda_native, B_native, ldb_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9128,10 +9385,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrfBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSpotrfBatched(handle=%p, uplo=%d, n=%d, Aarray=%p, lda=%d, infoArray=%p, batchSize=%d)\n",
-        handle, uplo, n, Aarray, lda, infoArray, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9151,7 +9404,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrfBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSpotrfBatched", "uplo, n, lda, batchSize");
+    CallCapture callCapture(env, traceId, handle, uplo, n, Aarray, lda, infoArray, batchSize);
+    CallTrace callTrace(traceId, uplo, n, lda, batchSize);
     cusolverStatus_t jniResult_native = cusolverDnSpotrfBatched(handle_native, uplo_native, n_native, Aarray_native, lda_native, infoArray_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9190,10 +9448,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrfBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDpotrfBatched(handle=%p, uplo=%d, n=%d, Aarray=%p, lda=%d, infoArray=%p, batchSize=%d)\n",
-        handle, uplo, n, Aarray, lda, infoArray, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9213,7 +9467,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrfBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDpotrfBatched", "uplo, n, lda, batchSize");
+    CallCapture callCapture(env, traceId, handle, uplo, n, Aarray, lda, infoArray, batchSize);
+    CallTrace callTrace(traceId, uplo, n, lda, batchSize);
     cusolverStatus_t jniResult_native = cusolverDnDpotrfBatched(handle_native, uplo_native, n_native, Aarray_native, lda_native, infoArray_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9252,10 +9511,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrfBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCpotrfBatched(handle=%p, uplo=%d, n=%d, Aarray=%p, lda=%d, infoArray=%p, batchSize=%d)\n",
-        handle, uplo, n, Aarray, lda, infoArray, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9275,7 +9530,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrfBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCpotrfBatched", "uplo, n, lda, batchSize");
+    CallCapture callCapture(env, traceId, handle, uplo, n, Aarray, lda, infoArray, batchSize);
+    CallTrace callTrace(traceId, uplo, n, lda, batchSize);
     cusolverStatus_t jniResult_native = cusolverDnCpotrfBatched(handle_native, uplo_native, n_native, Aarray_native, lda_native, infoArray_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9314,10 +9574,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrfBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZpotrfBatched(handle=%p, uplo=%d, n=%d, Aarray=%p, lda=%d, infoArray=%p, batchSize=%d)\n",
-        handle, uplo, n, Aarray, lda, infoArray, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9337,7 +9593,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrfBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZpotrfBatched", "uplo, n, lda, batchSize");
+    CallCapture callCapture(env, traceId, handle, uplo, n, Aarray, lda, infoArray, batchSize);
+    CallTrace callTrace(traceId, uplo, n, lda, batchSize);
     cusolverStatus_t jniResult_native = cusolverDnZpotrfBatched(handle_native, uplo_native, n_native, Aarray_native, lda_native, infoArray_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9383,10 +9644,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrsBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSpotrsBatched(handle=%p, uplo=%d, n=%d, nrhs=%d, A=%p, lda=%d, B=%p, ldb=%d, d_info=%p, batchSize=%d)\n",
-        handle, uplo, n, nrhs, A, lda, B, ldb, d_info, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9412,7 +9669,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotrsBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSpotrsBatched", "uplo, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, A, lda, B, ldb, d_info, batchSize);
+    CallTrace callTrace(traceId, uplo, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnSpotrsBatched(handle_native, uplo_native, n_native, nrhs_native, A_native, lda_native, B_native, ldb_native, d_info_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9461,10 +9723,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrsBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDpotrsBatched(handle=%p, uplo=%d, n=%d, nrhs=%d, A=%p, lda=%d, B=%p, ldb=%d, d_info=%p, batchSize=%d)\n",
-        handle, uplo, n, nrhs, A, lda, B, ldb, d_info, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9490,7 +9748,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotrsBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDpotrsBatched", "uplo, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, A, lda, B, ldb, d_info, batchSize);
+    CallTrace callTrace(traceId, uplo, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnDpotrsBatched(handle_native, uplo_native, n_native, nrhs_native, A_native, lda_native, B_native, ldb_native, d_info_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9539,10 +9802,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrsBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCpotrsBatched(handle=%p, uplo=%d, n=%d, nrhs=%d, A=%p, lda=%d, B=%p, ldb=%d, d_info=%p, batchSize=%d)\n",
-        handle, uplo, n, nrhs, A, lda, B, ldb, d_info, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9568,7 +9827,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotrsBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCpotrsBatched", "uplo, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, A, lda, B, ldb, d_info, batchSize);
+    CallTrace callTrace(traceId, uplo, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnCpotrsBatched(handle_native, uplo_native, n_native, nrhs_native, A_native, lda_native, B_native, ldb_native, d_info_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9617,10 +9881,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrsBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZpotrsBatched(handle=%p, uplo=%d, n=%d, nrhs=%d, A=%p, lda=%d, B=%p, ldb=%d, d_info=%p, batchSize=%d)\n",
-        handle, uplo, n, nrhs, A, lda, B, ldb, d_info, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9646,7 +9906,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotrsBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZpotrsBatched", "uplo, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, A, lda, B, ldb, d_info, batchSize);
+    CallTrace callTrace(traceId, uplo, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnZpotrsBatched(handle_native, uplo_native, n_native, nrhs_native, A_native, lda_native, B_native, ldb_native, d_info_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9688,10 +9953,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSpotri_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, uplo, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9709,7 +9970,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotri_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSpotri_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSpotri_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9719,6 +9985,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotri_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -9746,10 +10015,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDpotri_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, uplo, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9767,7 +10032,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotri_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDpotri_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDpotri_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9777,6 +10047,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotri_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -9804,10 +10077,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCpotri_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, uplo, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9825,7 +10094,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotri_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCpotri_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCpotri_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9835,6 +10109,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotri_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -9862,10 +10139,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZpotri_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, uplo, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9883,7 +10156,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotri_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZpotri_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZpotri_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9893,6 +10171,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotri_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -9926,10 +10207,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSpotri(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -9951,7 +10228,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSpotriNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSpotri", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, work, lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnSpotri(handle_native, uplo_native, n_native, A_native, lda_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -9996,10 +10278,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDpotri(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10021,7 +10299,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDpotriNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDpotri", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, work, lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnDpotri(handle_native, uplo_native, n_native, A_native, lda_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10066,10 +10349,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCpotri(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10091,7 +10370,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCpotriNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCpotri", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, work, lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnCpotri(handle_native, uplo_native, n_native, A_native, lda_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10136,10 +10420,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZpotri(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10161,7 +10441,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZpotriNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZpotri", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, work, lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnZpotri(handle_native, uplo_native, n_native, A_native, lda_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10207,10 +10492,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXtrtri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXtrtri_bufferSize(handle=%p, uplo=%d, diag=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, uplo, diag, n, dataTypeA, A, lda, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10219,8 +10500,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXtrtri_1buffer
     cudaDataType dataTypeA_native;
     void * A_native = NULL;
     int64_t lda_native = 0;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -10230,11 +10511,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXtrtri_1buffer
     dataTypeA_native = (cudaDataType)dataTypeA;
     A_native = (void *)getPointer(env, A);
     lda_native = (int64_t)lda;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXtrtri_bufferSize(handle_native, uplo_native, diag_native, n_native, dataTypeA_native, A_native, lda_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXtrtri_bufferSize", "uplo, diag, n, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, uplo, diag, n, dataTypeA, A, lda, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, uplo, diag, n, dataTypeA);
+    cusolverStatus_t jniResult_native = cusolverDnXtrtri_bufferSize(handle_native, uplo_native, diag_native, n_native, dataTypeA_native, A_native, lda_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10244,8 +10530,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXtrtri_1buffer
     // dataTypeA is primitive
     // A is a native pointer
     // lda is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -10288,10 +10577,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXtrtriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXtrtri(handle=%p, uplo=%d, diag=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, devInfo=%p)\n",
-        handle, uplo, diag, n, dataTypeA, A, lda, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10321,7 +10606,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXtrtriNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXtrtri", "uplo, diag, n, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, uplo, diag, n, dataTypeA, A, lda, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, devInfo);
+    CallTrace callTrace(traceId, uplo, diag, n, dataTypeA);
     cusolverStatus_t jniResult_native = cusolverDnXtrtri(handle_native, uplo_native, diag_native, n_native, dataTypeA_native, A_native, lda_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10365,10 +10655,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSlauum_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSlauum_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, uplo, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10386,7 +10672,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSlauum_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSlauum_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSlauum_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10396,6 +10687,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSlauum_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -10423,10 +10717,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDlauum_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDlauum_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, uplo, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10444,7 +10734,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDlauum_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDlauum_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDlauum_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10454,6 +10749,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDlauum_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -10481,10 +10779,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnClauum_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnClauum_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, uplo, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10502,7 +10796,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnClauum_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnClauum_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnClauum_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10512,6 +10811,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnClauum_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -10539,10 +10841,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZlauum_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZlauum_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, uplo, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10560,7 +10858,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZlauum_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZlauum_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZlauum_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10570,6 +10873,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZlauum_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -10603,10 +10909,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSlauumNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSlauum(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10628,7 +10930,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSlauumNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSlauum", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, work, lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnSlauum(handle_native, uplo_native, n_native, A_native, lda_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10673,10 +10980,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDlauumNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDlauum(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10698,7 +11001,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDlauumNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDlauum", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, work, lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnDlauum(handle_native, uplo_native, n_native, A_native, lda_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10743,10 +11051,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnClauumNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnClauum(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10768,7 +11072,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnClauumNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnClauum", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, work, lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnClauum(handle_native, uplo_native, n_native, A_native, lda_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10813,10 +11122,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZlauumNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZlauum(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, uplo, n, A, lda, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -10838,7 +11143,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZlauumNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZlauum", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, work, lwork, devInfo);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnZlauum(handle_native, uplo_native, n_native, A_native, lda_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10878,10 +11188,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgetrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgetrf_bufferSize(handle=%p, m=%d, n=%d, A=%p, lda=%d, Lwork=%p)\n",
-        handle, m, n, A, lda, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -10899,7 +11205,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgetrf_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgetrf_bufferSize", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, Lwork);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSgetrf_bufferSize(handle_native, m_native, n_native, A_native, lda_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10909,6 +11220,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgetrf_1buffer
     // lda is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -10936,10 +11250,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgetrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgetrf_bufferSize(handle=%p, m=%d, n=%d, A=%p, lda=%d, Lwork=%p)\n",
-        handle, m, n, A, lda, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -10957,7 +11267,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgetrf_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgetrf_bufferSize", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, Lwork);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDgetrf_bufferSize(handle_native, m_native, n_native, A_native, lda_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -10967,6 +11282,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgetrf_1buffer
     // lda is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -10994,10 +11312,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgetrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgetrf_bufferSize(handle=%p, m=%d, n=%d, A=%p, lda=%d, Lwork=%p)\n",
-        handle, m, n, A, lda, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -11015,7 +11329,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgetrf_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgetrf_bufferSize", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, Lwork);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCgetrf_bufferSize(handle_native, m_native, n_native, A_native, lda_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11025,6 +11344,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgetrf_1buffer
     // lda is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -11052,10 +11374,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgetrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgetrf_bufferSize(handle=%p, m=%d, n=%d, A=%p, lda=%d, Lwork=%p)\n",
-        handle, m, n, A, lda, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -11073,7 +11391,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgetrf_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgetrf_bufferSize", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, Lwork);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZgetrf_bufferSize(handle_native, m_native, n_native, A_native, lda_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11083,6 +11406,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgetrf_1buffer
     // lda is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -11120,10 +11446,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgetrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgetrf(handle=%p, m=%d, n=%d, A=%p, lda=%d, Workspace=%p, devIpiv=%p, devInfo=%p)\n",
-        handle, m, n, A, lda, Workspace, devIpiv, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -11145,7 +11467,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgetrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgetrf", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, Workspace, devIpiv, devInfo);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSgetrf(handle_native, m_native, n_native, A_native, lda_native, Workspace_native, devIpiv_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11194,10 +11521,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgetrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgetrf(handle=%p, m=%d, n=%d, A=%p, lda=%d, Workspace=%p, devIpiv=%p, devInfo=%p)\n",
-        handle, m, n, A, lda, Workspace, devIpiv, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -11219,7 +11542,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgetrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgetrf", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, Workspace, devIpiv, devInfo);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDgetrf(handle_native, m_native, n_native, A_native, lda_native, Workspace_native, devIpiv_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11268,10 +11596,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgetrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgetrf(handle=%p, m=%d, n=%d, A=%p, lda=%d, Workspace=%p, devIpiv=%p, devInfo=%p)\n",
-        handle, m, n, A, lda, Workspace, devIpiv, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -11293,7 +11617,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgetrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgetrf", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, Workspace, devIpiv, devInfo);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCgetrf(handle_native, m_native, n_native, A_native, lda_native, Workspace_native, devIpiv_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11342,10 +11671,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgetrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgetrf(handle=%p, m=%d, n=%d, A=%p, lda=%d, Workspace=%p, devIpiv=%p, devInfo=%p)\n",
-        handle, m, n, A, lda, Workspace, devIpiv, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -11367,7 +11692,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgetrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgetrf", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, Workspace, devIpiv, devInfo);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZgetrf(handle_native, m_native, n_native, A_native, lda_native, Workspace_native, devIpiv_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11409,10 +11739,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSlaswpNative(J
     }
     // incx is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSlaswp(handle=%p, n=%d, A=%p, lda=%d, k1=%d, k2=%d, devIpiv=%p, incx=%d)\n",
-        handle, n, A, lda, k1, k2, devIpiv, incx);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int n_native = 0;
@@ -11434,7 +11760,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSlaswpNative(J
     incx_native = (int)incx;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSlaswp", "n, lda, k1, k2");
+    CallCapture callCapture(env, traceId, handle, n, A, lda, k1, k2, devIpiv, incx);
+    CallTrace callTrace(traceId, n, lda, k1, k2);
     cusolverStatus_t jniResult_native = cusolverDnSlaswp(handle_native, n_native, A_native, lda_native, k1_native, k2_native, devIpiv_native, incx_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11475,10 +11806,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDlaswpNative(J
     }
     // incx is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDlaswp(handle=%p, n=%d, A=%p, lda=%d, k1=%d, k2=%d, devIpiv=%p, incx=%d)\n",
-        handle, n, A, lda, k1, k2, devIpiv, incx);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int n_native = 0;
@@ -11500,7 +11827,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDlaswpNative(J
     incx_native = (int)incx;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDlaswp", "n, lda, k1, k2");
+    CallCapture callCapture(env, traceId, handle, n, A, lda, k1, k2, devIpiv, incx);
+    CallTrace callTrace(traceId, n, lda, k1, k2);
     cusolverStatus_t jniResult_native = cusolverDnDlaswp(handle_native, n_native, A_native, lda_native, k1_native, k2_native, devIpiv_native, incx_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11541,10 +11873,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnClaswpNative(J
     }
     // incx is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnClaswp(handle=%p, n=%d, A=%p, lda=%d, k1=%d, k2=%d, devIpiv=%p, incx=%d)\n",
-        handle, n, A, lda, k1, k2, devIpiv, incx);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int n_native = 0;
@@ -11566,7 +11894,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnClaswpNative(J
     incx_native = (int)incx;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnClaswp", "n, lda, k1, k2");
+    CallCapture callCapture(env, traceId, handle, n, A, lda, k1, k2, devIpiv, incx);
+    CallTrace callTrace(traceId, n, lda, k1, k2);
     cusolverStatus_t jniResult_native = cusolverDnClaswp(handle_native, n_native, A_native, lda_native, k1_native, k2_native, devIpiv_native, incx_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11607,10 +11940,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZlaswpNative(J
     }
     // incx is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZlaswp(handle=%p, n=%d, A=%p, lda=%d, k1=%d, k2=%d, devIpiv=%p, incx=%d)\n",
-        handle, n, A, lda, k1, k2, devIpiv, incx);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int n_native = 0;
@@ -11632,7 +11961,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZlaswpNative(J
     incx_native = (int)incx;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZlaswp", "n, lda, k1, k2");
+    CallCapture callCapture(env, traceId, handle, n, A, lda, k1, k2, devIpiv, incx);
+    CallTrace callTrace(traceId, n, lda, k1, k2);
     cusolverStatus_t jniResult_native = cusolverDnZlaswp(handle_native, n_native, A_native, lda_native, k1_native, k2_native, devIpiv_native, incx_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11684,10 +12018,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgetrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgetrs(handle=%p, trans=%d, n=%d, nrhs=%d, A=%p, lda=%d, devIpiv=%p, B=%p, ldb=%d, devInfo=%p)\n",
-        handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasOperation_t trans_native;
@@ -11713,7 +12043,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgetrsNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgetrs", "trans, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, devInfo);
+    CallTrace callTrace(traceId, trans, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnSgetrs(handle_native, trans_native, n_native, nrhs_native, A_native, lda_native, devIpiv_native, B_native, ldb_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11766,10 +12101,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgetrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgetrs(handle=%p, trans=%d, n=%d, nrhs=%d, A=%p, lda=%d, devIpiv=%p, B=%p, ldb=%d, devInfo=%p)\n",
-        handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasOperation_t trans_native;
@@ -11795,7 +12126,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgetrsNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgetrs", "trans, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, devInfo);
+    CallTrace callTrace(traceId, trans, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnDgetrs(handle_native, trans_native, n_native, nrhs_native, A_native, lda_native, devIpiv_native, B_native, ldb_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11848,10 +12184,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgetrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgetrs(handle=%p, trans=%d, n=%d, nrhs=%d, A=%p, lda=%d, devIpiv=%p, B=%p, ldb=%d, devInfo=%p)\n",
-        handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasOperation_t trans_native;
@@ -11877,7 +12209,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgetrsNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgetrs", "trans, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, devInfo);
+    CallTrace callTrace(traceId, trans, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnCgetrs(handle_native, trans_native, n_native, nrhs_native, A_native, lda_native, devIpiv_native, B_native, ldb_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -11930,10 +12267,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgetrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgetrs(handle=%p, trans=%d, n=%d, nrhs=%d, A=%p, lda=%d, devIpiv=%p, B=%p, ldb=%d, devInfo=%p)\n",
-        handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasOperation_t trans_native;
@@ -11959,7 +12292,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgetrsNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgetrs", "trans, n, nrhs, lda");
+    CallCapture callCapture(env, traceId, handle, trans, n, nrhs, A, lda, devIpiv, B, ldb, devInfo);
+    CallTrace callTrace(traceId, trans, n, nrhs, lda);
     cusolverStatus_t jniResult_native = cusolverDnZgetrs(handle_native, trans_native, n_native, nrhs_native, A_native, lda_native, devIpiv_native, B_native, ldb_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12001,10 +12339,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgeqrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgeqrf_bufferSize(handle=%p, m=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, m, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12022,7 +12356,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgeqrf_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgeqrf_bufferSize", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, lwork);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSgeqrf_bufferSize(handle_native, m_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12032,6 +12371,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgeqrf_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -12059,10 +12401,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgeqrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgeqrf_bufferSize(handle=%p, m=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, m, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12080,7 +12418,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgeqrf_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgeqrf_bufferSize", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, lwork);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDgeqrf_bufferSize(handle_native, m_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12090,6 +12433,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgeqrf_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -12117,10 +12463,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgeqrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgeqrf_bufferSize(handle=%p, m=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, m, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12138,7 +12480,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgeqrf_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgeqrf_bufferSize", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, lwork);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCgeqrf_bufferSize(handle_native, m_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12148,6 +12495,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgeqrf_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -12175,10 +12525,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgeqrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgeqrf_bufferSize(handle=%p, m=%d, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, m, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12196,7 +12542,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgeqrf_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgeqrf_bufferSize", "m, n, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, lwork);
+    CallTrace callTrace(traceId, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZgeqrf_bufferSize(handle_native, m_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12206,6 +12557,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgeqrf_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -12244,10 +12598,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgeqrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgeqrf(handle=%p, m=%d, n=%d, A=%p, lda=%d, TAU=%p, Workspace=%p, Lwork=%d, devInfo=%p)\n",
-        handle, m, n, A, lda, TAU, Workspace, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12271,7 +12621,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgeqrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgeqrf", "m, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, TAU, Workspace, Lwork, devInfo);
+    CallTrace callTrace(traceId, m, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnSgeqrf(handle_native, m_native, n_native, A_native, lda_native, TAU_native, Workspace_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12322,10 +12677,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgeqrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgeqrf(handle=%p, m=%d, n=%d, A=%p, lda=%d, TAU=%p, Workspace=%p, Lwork=%d, devInfo=%p)\n",
-        handle, m, n, A, lda, TAU, Workspace, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12349,7 +12700,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgeqrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgeqrf", "m, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, TAU, Workspace, Lwork, devInfo);
+    CallTrace callTrace(traceId, m, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnDgeqrf(handle_native, m_native, n_native, A_native, lda_native, TAU_native, Workspace_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12400,10 +12756,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgeqrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgeqrf(handle=%p, m=%d, n=%d, A=%p, lda=%d, TAU=%p, Workspace=%p, Lwork=%d, devInfo=%p)\n",
-        handle, m, n, A, lda, TAU, Workspace, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12427,7 +12779,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgeqrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgeqrf", "m, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, TAU, Workspace, Lwork, devInfo);
+    CallTrace callTrace(traceId, m, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnCgeqrf(handle_native, m_native, n_native, A_native, lda_native, TAU_native, Workspace_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12478,10 +12835,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgeqrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgeqrf(handle=%p, m=%d, n=%d, A=%p, lda=%d, TAU=%p, Workspace=%p, Lwork=%d, devInfo=%p)\n",
-        handle, m, n, A, lda, TAU, Workspace, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12505,7 +12858,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgeqrfNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgeqrf", "m, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, TAU, Workspace, Lwork, devInfo);
+    CallTrace callTrace(traceId, m, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnZgeqrf(handle_native, m_native, n_native, A_native, lda_native, TAU_native, Workspace_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12552,10 +12910,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgqr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSorgqr_bufferSize(handle=%p, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, m, n, k, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12577,7 +12931,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgqr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSorgqr_bufferSize", "m, n, k, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, k, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, m, n, k, lda);
     cusolverStatus_t jniResult_native = cusolverDnSorgqr_bufferSize(handle_native, m_native, n_native, k_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12589,6 +12948,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgqr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -12622,10 +12984,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgqr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDorgqr_bufferSize(handle=%p, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, m, n, k, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12647,7 +13005,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgqr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDorgqr_bufferSize", "m, n, k, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, k, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, m, n, k, lda);
     cusolverStatus_t jniResult_native = cusolverDnDorgqr_bufferSize(handle_native, m_native, n_native, k_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12659,6 +13022,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgqr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -12692,10 +13058,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungqr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCungqr_bufferSize(handle=%p, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, m, n, k, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12717,7 +13079,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungqr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCungqr_bufferSize", "m, n, k, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, k, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, m, n, k, lda);
     cusolverStatus_t jniResult_native = cusolverDnCungqr_bufferSize(handle_native, m_native, n_native, k_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12729,6 +13096,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungqr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -12762,10 +13132,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungqr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZungqr_bufferSize(handle=%p, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, m, n, k, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12787,7 +13153,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungqr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZungqr_bufferSize", "m, n, k, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, k, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, m, n, k, lda);
     cusolverStatus_t jniResult_native = cusolverDnZungqr_bufferSize(handle_native, m_native, n_native, k_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12799,6 +13170,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungqr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -12838,10 +13212,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgqrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSorgqr(handle=%p, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, m, n, k, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12867,7 +13237,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgqrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSorgqr", "m, n, k, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, k, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, m, n, k, lda);
     cusolverStatus_t jniResult_native = cusolverDnSorgqr(handle_native, m_native, n_native, k_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -12920,10 +13295,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgqrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDorgqr(handle=%p, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, m, n, k, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -12949,7 +13320,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgqrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDorgqr", "m, n, k, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, k, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, m, n, k, lda);
     cusolverStatus_t jniResult_native = cusolverDnDorgqr(handle_native, m_native, n_native, k_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13002,10 +13378,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungqrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCungqr(handle=%p, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, m, n, k, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -13031,7 +13403,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungqrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCungqr", "m, n, k, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, k, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, m, n, k, lda);
     cusolverStatus_t jniResult_native = cusolverDnCungqr(handle_native, m_native, n_native, k_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13084,10 +13461,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungqrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZungqr(handle=%p, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, m, n, k, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -13113,7 +13486,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungqrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZungqr", "m, n, k, lda");
+    CallCapture callCapture(env, traceId, handle, m, n, k, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, m, n, k, lda);
     cusolverStatus_t jniResult_native = cusolverDnZungqr(handle_native, m_native, n_native, k_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13169,10 +13547,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormqr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSormqr_bufferSize(handle=%p, side=%d, trans=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, lwork=%p)\n",
-        handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -13202,7 +13576,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormqr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSormqr_bufferSize", "side, trans, m, n");
+    CallCapture callCapture(env, traceId, handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    CallTrace callTrace(traceId, side, trans, m, n);
     cusolverStatus_t jniResult_native = cusolverDnSormqr_bufferSize(handle_native, side_native, trans_native, m_native, n_native, k_native, A_native, lda_native, tau_native, C_native, ldc_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13218,6 +13597,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormqr_1buffer
     // ldc is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -13259,10 +13641,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormqr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDormqr_bufferSize(handle=%p, side=%d, trans=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, lwork=%p)\n",
-        handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -13292,7 +13670,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormqr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDormqr_bufferSize", "side, trans, m, n");
+    CallCapture callCapture(env, traceId, handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    CallTrace callTrace(traceId, side, trans, m, n);
     cusolverStatus_t jniResult_native = cusolverDnDormqr_bufferSize(handle_native, side_native, trans_native, m_native, n_native, k_native, A_native, lda_native, tau_native, C_native, ldc_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13308,6 +13691,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormqr_1buffer
     // ldc is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -13349,10 +13735,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmqr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCunmqr_bufferSize(handle=%p, side=%d, trans=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, lwork=%p)\n",
-        handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -13382,7 +13764,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmqr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCunmqr_bufferSize", "side, trans, m, n");
+    CallCapture callCapture(env, traceId, handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    CallTrace callTrace(traceId, side, trans, m, n);
     cusolverStatus_t jniResult_native = cusolverDnCunmqr_bufferSize(handle_native, side_native, trans_native, m_native, n_native, k_native, A_native, lda_native, tau_native, C_native, ldc_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13398,6 +13785,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmqr_1buffer
     // ldc is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -13439,10 +13829,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmqr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZunmqr_bufferSize(handle=%p, side=%d, trans=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, lwork=%p)\n",
-        handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -13472,7 +13858,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmqr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZunmqr_bufferSize", "side, trans, m, n");
+    CallCapture callCapture(env, traceId, handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    CallTrace callTrace(traceId, side, trans, m, n);
     cusolverStatus_t jniResult_native = cusolverDnZunmqr_bufferSize(handle_native, side_native, trans_native, m_native, n_native, k_native, A_native, lda_native, tau_native, C_native, ldc_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13488,6 +13879,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmqr_1buffer
     // ldc is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -13535,10 +13929,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormqrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSormqr(handle=%p, side=%d, trans=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -13572,7 +13962,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormqrNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSormqr", "side, trans, m, n");
+    CallCapture callCapture(env, traceId, handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, devInfo);
+    CallTrace callTrace(traceId, side, trans, m, n);
     cusolverStatus_t jniResult_native = cusolverDnSormqr(handle_native, side_native, trans_native, m_native, n_native, k_native, A_native, lda_native, tau_native, C_native, ldc_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13637,10 +14032,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormqrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDormqr(handle=%p, side=%d, trans=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -13674,7 +14065,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormqrNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDormqr", "side, trans, m, n");
+    CallCapture callCapture(env, traceId, handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, devInfo);
+    CallTrace callTrace(traceId, side, trans, m, n);
     cusolverStatus_t jniResult_native = cusolverDnDormqr(handle_native, side_native, trans_native, m_native, n_native, k_native, A_native, lda_native, tau_native, C_native, ldc_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13739,10 +14135,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmqrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCunmqr(handle=%p, side=%d, trans=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -13776,7 +14168,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmqrNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCunmqr", "side, trans, m, n");
+    CallCapture callCapture(env, traceId, handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, devInfo);
+    CallTrace callTrace(traceId, side, trans, m, n);
     cusolverStatus_t jniResult_native = cusolverDnCunmqr(handle_native, side_native, trans_native, m_native, n_native, k_native, A_native, lda_native, tau_native, C_native, ldc_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13841,10 +14238,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmqrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZunmqr(handle=%p, side=%d, trans=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, work=%p, lwork=%d, devInfo=%p)\n",
-        handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -13878,7 +14271,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmqrNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZunmqr", "side, trans, m, n");
+    CallCapture callCapture(env, traceId, handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, devInfo);
+    CallTrace callTrace(traceId, side, trans, m, n);
     cusolverStatus_t jniResult_native = cusolverDnZunmqr(handle_native, side_native, trans_native, m_native, n_native, k_native, A_native, lda_native, tau_native, C_native, ldc_native, work_native, lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13923,10 +14321,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsytrf_bufferSize(handle=%p, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int n_native = 0;
@@ -13942,7 +14336,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrf_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsytrf_bufferSize", "n, lda");
+    CallCapture callCapture(env, traceId, handle, n, A, lda, lwork);
+    CallTrace callTrace(traceId, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsytrf_bufferSize(handle_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -13951,6 +14350,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrf_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -13977,10 +14379,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsytrf_bufferSize(handle=%p, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int n_native = 0;
@@ -13996,7 +14394,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrf_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsytrf_bufferSize", "n, lda");
+    CallCapture callCapture(env, traceId, handle, n, A, lda, lwork);
+    CallTrace callTrace(traceId, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsytrf_bufferSize(handle_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14005,6 +14408,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrf_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -14031,10 +14437,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCsytrf_bufferSize(handle=%p, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int n_native = 0;
@@ -14050,7 +14452,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytrf_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCsytrf_bufferSize", "n, lda");
+    CallCapture callCapture(env, traceId, handle, n, A, lda, lwork);
+    CallTrace callTrace(traceId, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCsytrf_bufferSize(handle_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14059,6 +14466,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytrf_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -14085,10 +14495,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZsytrf_bufferSize(handle=%p, n=%d, A=%p, lda=%d, lwork=%p)\n",
-        handle, n, A, lda, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int n_native = 0;
@@ -14104,7 +14510,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytrf_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZsytrf_bufferSize", "n, lda");
+    CallCapture callCapture(env, traceId, handle, n, A, lda, lwork);
+    CallTrace callTrace(traceId, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZsytrf_bufferSize(handle_native, n_native, A_native, lda_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14113,6 +14524,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytrf_1buffer
     // lda is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -14151,10 +14565,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsytrf(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, ipiv, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14178,7 +14588,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrfNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsytrf", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnSsytrf(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14229,10 +14644,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsytrf(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, ipiv, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14256,7 +14667,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrfNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsytrf", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnDsytrf(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14307,10 +14723,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCsytrf(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, ipiv, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14334,7 +14746,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytrfNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCsytrf", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnCsytrf(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14385,10 +14802,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZsytrf(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, ipiv, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14412,7 +14825,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytrfNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZsytrf", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnZsytrf(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14472,10 +14890,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsytrs_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsytrs_bufferSize(handle=%p, uplo=%d, n=%ld, nrhs=%ld, dataTypeA=%d, A=%p, lda=%ld, ipiv=%p, dataTypeB=%d, B=%p, ldb=%ld, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, uplo, n, nrhs, dataTypeA, A, lda, ipiv, dataTypeB, B, ldb, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14488,8 +14902,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsytrs_1buffer
     cudaDataType dataTypeB_native;
     void * B_native = NULL;
     int64_t ldb_native = 0;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -14503,11 +14917,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsytrs_1buffer
     dataTypeB_native = (cudaDataType)dataTypeB;
     B_native = (void *)getPointer(env, B);
     ldb_native = (int64_t)ldb;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXsytrs_bufferSize(handle_native, uplo_native, n_native, nrhs_native, dataTypeA_native, A_native, lda_native, ipiv_native, dataTypeB_native, B_native, ldb_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsytrs_bufferSize", "uplo, n, nrhs, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, dataTypeA, A, lda, ipiv, dataTypeB, B, ldb, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, uplo, n, nrhs, dataTypeA);
+    cusolverStatus_t jniResult_native = cusolverDnXsytrs_bufferSize(handle_native, uplo_native, n_native, nrhs_native, dataTypeA_native, A_native, lda_native, ipiv_native, dataTypeB_native, B_native, ldb_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14521,8 +14940,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsytrs_1buffer
     // dataTypeB is primitive
     // B is a native pointer
     // ldb is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -14577,10 +14999,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsytrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsytrs(handle=%p, uplo=%d, n=%ld, nrhs=%ld, dataTypeA=%d, A=%p, lda=%ld, ipiv=%p, dataTypeB=%d, B=%p, ldb=%ld, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, info=%p)\n",
-        handle, uplo, n, nrhs, dataTypeA, A, lda, ipiv, dataTypeB, B, ldb, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14618,7 +15036,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsytrsNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsytrs", "uplo, n, nrhs, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, dataTypeA, A, lda, ipiv, dataTypeB, B, ldb, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
+    CallTrace callTrace(traceId, uplo, n, nrhs, dataTypeA);
     cusolverStatus_t jniResult_native = cusolverDnXsytrs(handle_native, uplo_native, n_native, nrhs_native, dataTypeA_native, A_native, lda_native, ipiv_native, dataTypeB_native, B_native, ldb_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14671,10 +15094,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsytri_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, ipiv, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14694,7 +15113,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytri_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsytri_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsytri_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14705,6 +15129,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytri_1buffer
     // ipiv is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -14737,10 +15164,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsytri_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, ipiv, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14760,7 +15183,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytri_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsytri_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsytri_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14771,6 +15199,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytri_1buffer
     // ipiv is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -14803,10 +15234,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCsytri_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, ipiv, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14826,7 +15253,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytri_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCsytri_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCsytri_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14837,6 +15269,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytri_1buffer
     // ipiv is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -14869,10 +15304,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytri_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZsytri_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, ipiv, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14892,7 +15323,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytri_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZsytri_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZsytri_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -14903,6 +15339,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytri_1buffer
     // ipiv is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -14941,10 +15380,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsytri(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, ipiv, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -14968,7 +15403,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytriNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsytri", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnSsytri(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15019,10 +15459,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsytri(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, ipiv, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -15046,7 +15482,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytriNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsytri", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnDsytri(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15097,10 +15538,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCsytri(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, ipiv, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -15124,7 +15561,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCsytriNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCsytri", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnCsytri(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15175,10 +15617,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytriNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZsytri(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, ipiv=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, ipiv, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -15202,7 +15640,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytriNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZsytri", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnZsytri(handle_native, uplo_native, n_native, A_native, lda_native, ipiv_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15219,8 +15662,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZsytriNative(J
     jint jniResult = (jint)jniResult_native;
     return jniResult;
 }
+#endif // JCUSOLVER_FAMILY_DN
 
 /** bidiagonal factorization */
+#ifdef JCUSOLVER_FAMILY_DNEIGEN
 JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgebrd_1bufferSizeNative(JNIEnv *env, jclass cls, jobject handle, jint m, jint n, jintArray Lwork)
 {
     // Null-checks for non-primitive arguments
@@ -15237,10 +15682,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgebrd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgebrd_bufferSize(handle=%p, m=%d, n=%d, Lwork=%p)\n",
-        handle, m, n, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -15254,7 +15695,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgebrd_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgebrd_bufferSize", "m, n");
+    CallCapture callCapture(env, traceId, handle, m, n, Lwork);
+    CallTrace callTrace(traceId, m, n);
     cusolverStatus_t jniResult_native = cusolverDnSgebrd_bufferSize(handle_native, m_native, n_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15262,6 +15708,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgebrd_1buffer
     // n is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -15283,10 +15732,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgebrd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgebrd_bufferSize(handle=%p, m=%d, n=%d, Lwork=%p)\n",
-        handle, m, n, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -15300,7 +15745,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgebrd_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgebrd_bufferSize", "m, n");
+    CallCapture callCapture(env, traceId, handle, m, n, Lwork);
+    CallTrace callTrace(traceId, m, n);
     cusolverStatus_t jniResult_native = cusolverDnDgebrd_bufferSize(handle_native, m_native, n_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15308,6 +15758,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgebrd_1buffer
     // n is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -15329,10 +15782,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgebrd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgebrd_bufferSize(handle=%p, m=%d, n=%d, Lwork=%p)\n",
-        handle, m, n, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -15346,7 +15795,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgebrd_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgebrd_bufferSize", "m, n");
+    CallCapture callCapture(env, traceId, handle, m, n, Lwork);
+    CallTrace callTrace(traceId, m, n);
     cusolverStatus_t jniResult_native = cusolverDnCgebrd_bufferSize(handle_native, m_native, n_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15354,6 +15808,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgebrd_1buffer
     // n is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -15375,10 +15832,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgebrd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgebrd_bufferSize(handle=%p, m=%d, n=%d, Lwork=%p)\n",
-        handle, m, n, Lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -15392,7 +15845,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgebrd_1buffer
     // Lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgebrd_bufferSize", "m, n");
+    CallCapture callCapture(env, traceId, handle, m, n, Lwork);
+    CallTrace callTrace(traceId, m, n);
     cusolverStatus_t jniResult_native = cusolverDnZgebrd_bufferSize(handle_native, m_native, n_native, &Lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15400,6 +15858,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgebrd_1buffer
     // n is primitive
     if (!set(env, Lwork, 0, (jint)Lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)Lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -15453,10 +15914,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgebrdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgebrd(handle=%p, m=%d, n=%d, A=%p, lda=%d, D=%p, E=%p, TAUQ=%p, TAUP=%p, Work=%p, Lwork=%d, devInfo=%p)\n",
-        handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -15486,7 +15943,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgebrdNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgebrd", "m, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo);
+    CallTrace callTrace(traceId, m, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnSgebrd(handle_native, m_native, n_native, A_native, lda_native, D_native, E_native, TAUQ_native, TAUP_native, Work_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15555,10 +16017,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgebrdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgebrd(handle=%p, m=%d, n=%d, A=%p, lda=%d, D=%p, E=%p, TAUQ=%p, TAUP=%p, Work=%p, Lwork=%d, devInfo=%p)\n",
-        handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -15588,7 +16046,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgebrdNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgebrd", "m, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo);
+    CallTrace callTrace(traceId, m, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnDgebrd(handle_native, m_native, n_native, A_native, lda_native, D_native, E_native, TAUQ_native, TAUP_native, Work_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15657,10 +16120,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgebrdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgebrd(handle=%p, m=%d, n=%d, A=%p, lda=%d, D=%p, E=%p, TAUQ=%p, TAUP=%p, Work=%p, Lwork=%d, devInfo=%p)\n",
-        handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -15690,7 +16149,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgebrdNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgebrd", "m, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo);
+    CallTrace callTrace(traceId, m, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnCgebrd(handle_native, m_native, n_native, A_native, lda_native, D_native, E_native, TAUQ_native, TAUP_native, Work_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15759,10 +16223,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgebrdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgebrd(handle=%p, m=%d, n=%d, A=%p, lda=%d, D=%p, E=%p, TAUQ=%p, TAUP=%p, Work=%p, Lwork=%d, devInfo=%p)\n",
-        handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -15792,7 +16252,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgebrdNative(J
     devInfo_native = (int *)getPointer(env, devInfo);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgebrd", "m, n, lda, Lwork");
+    CallCapture callCapture(env, traceId, handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo);
+    CallTrace callTrace(traceId, m, n, lda, Lwork);
     cusolverStatus_t jniResult_native = cusolverDnZgebrd(handle_native, m_native, n_native, A_native, lda_native, D_native, E_native, TAUQ_native, TAUP_native, Work_native, Lwork_native, devInfo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15843,10 +16308,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgbr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSorgbr_bufferSize(handle=%p, side=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, side, m, n, k, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -15870,7 +16331,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgbr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSorgbr_bufferSize", "side, m, n, k");
+    CallCapture callCapture(env, traceId, handle, side, m, n, k, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, side, m, n, k);
     cusolverStatus_t jniResult_native = cusolverDnSorgbr_bufferSize(handle_native, side_native, m_native, n_native, k_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15883,6 +16349,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgbr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -15917,10 +16386,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgbr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDorgbr_bufferSize(handle=%p, side=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, side, m, n, k, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -15944,7 +16409,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgbr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDorgbr_bufferSize", "side, m, n, k");
+    CallCapture callCapture(env, traceId, handle, side, m, n, k, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, side, m, n, k);
     cusolverStatus_t jniResult_native = cusolverDnDorgbr_bufferSize(handle_native, side_native, m_native, n_native, k_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -15957,6 +16427,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgbr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -15991,10 +16464,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungbr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCungbr_bufferSize(handle=%p, side=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, side, m, n, k, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -16018,7 +16487,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungbr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCungbr_bufferSize", "side, m, n, k");
+    CallCapture callCapture(env, traceId, handle, side, m, n, k, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, side, m, n, k);
     cusolverStatus_t jniResult_native = cusolverDnCungbr_bufferSize(handle_native, side_native, m_native, n_native, k_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16031,6 +16505,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungbr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -16065,10 +16542,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungbr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZungbr_bufferSize(handle=%p, side=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, side, m, n, k, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -16092,7 +16565,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungbr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZungbr_bufferSize", "side, m, n, k");
+    CallCapture callCapture(env, traceId, handle, side, m, n, k, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, side, m, n, k);
     cusolverStatus_t jniResult_native = cusolverDnZungbr_bufferSize(handle_native, side_native, m_native, n_native, k_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16105,6 +16583,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungbr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -16145,10 +16626,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgbrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSorgbr(handle=%p, side=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, side, m, n, k, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -16176,7 +16653,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgbrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSorgbr", "side, m, n, k");
+    CallCapture callCapture(env, traceId, handle, side, m, n, k, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, side, m, n, k);
     cusolverStatus_t jniResult_native = cusolverDnSorgbr(handle_native, side_native, m_native, n_native, k_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16231,10 +16713,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgbrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDorgbr(handle=%p, side=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, side, m, n, k, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -16262,7 +16740,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgbrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDorgbr", "side, m, n, k");
+    CallCapture callCapture(env, traceId, handle, side, m, n, k, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, side, m, n, k);
     cusolverStatus_t jniResult_native = cusolverDnDorgbr(handle_native, side_native, m_native, n_native, k_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16317,10 +16800,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungbrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCungbr(handle=%p, side=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, side, m, n, k, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -16348,7 +16827,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungbrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCungbr", "side, m, n, k");
+    CallCapture callCapture(env, traceId, handle, side, m, n, k, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, side, m, n, k);
     cusolverStatus_t jniResult_native = cusolverDnCungbr(handle_native, side_native, m_native, n_native, k_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16403,10 +16887,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungbrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZungbr(handle=%p, side=%d, m=%d, n=%d, k=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, side, m, n, k, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -16434,7 +16914,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungbrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZungbr", "side, m, n, k");
+    CallCapture callCapture(env, traceId, handle, side, m, n, k, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, side, m, n, k);
     cusolverStatus_t jniResult_native = cusolverDnZungbr(handle_native, side_native, m_native, n_native, k_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16492,10 +16977,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsytrd_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, d=%p, e=%p, tau=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, d, e, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -16519,7 +17000,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsytrd_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, d, e, tau, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsytrd_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, d_native, e_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16532,6 +17018,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrd_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -16574,10 +17063,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsytrd_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, d=%p, e=%p, tau=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, d, e, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -16601,7 +17086,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsytrd_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, d, e, tau, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsytrd_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, d_native, e_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16614,6 +17104,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrd_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -16656,10 +17149,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChetrd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnChetrd_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, d=%p, e=%p, tau=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, d, e, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -16683,7 +17172,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChetrd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnChetrd_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, d, e, tau, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnChetrd_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, d_native, e_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16696,6 +17190,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChetrd_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -16738,10 +17235,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhetrd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZhetrd_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, d=%p, e=%p, tau=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, d, e, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -16765,7 +17258,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhetrd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZhetrd_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, d, e, tau, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZhetrd_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, d_native, e_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16778,6 +17276,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhetrd_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -16826,10 +17327,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsytrd(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, d=%p, e=%p, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, d, e, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -16857,7 +17354,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsytrdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsytrd", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, d, e, tau, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnSsytrd(handle_native, uplo_native, n_native, A_native, lda_native, d_native, e_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -16920,10 +17422,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsytrd(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, d=%p, e=%p, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, d, e, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -16951,7 +17449,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsytrdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsytrd", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, d, e, tau, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnDsytrd(handle_native, uplo_native, n_native, A_native, lda_native, d_native, e_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17014,10 +17517,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChetrdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnChetrd(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, d=%p, e=%p, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, d, e, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17045,7 +17544,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChetrdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnChetrd", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, d, e, tau, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnChetrd(handle_native, uplo_native, n_native, A_native, lda_native, d_native, e_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17108,10 +17612,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhetrdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZhetrd(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, d=%p, e=%p, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, d, e, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17139,7 +17639,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhetrdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZhetrd", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, d, e, tau, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnZhetrd(handle_native, uplo_native, n_native, A_native, lda_native, d_native, e_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17187,10 +17692,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgtr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSorgtr_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17210,7 +17711,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgtr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSorgtr_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSorgtr_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17221,6 +17727,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgtr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -17253,10 +17762,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgtr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDorgtr_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17276,7 +17781,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgtr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDorgtr_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDorgtr_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17287,6 +17797,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgtr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -17319,10 +17832,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungtr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCungtr_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17342,7 +17851,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungtr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCungtr_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCungtr_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17353,6 +17867,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungtr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -17385,10 +17902,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungtr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZungtr_bufferSize(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, tau=%p, lwork=%p)\n",
-        handle, uplo, n, A, lda, tau, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17408,7 +17921,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungtr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZungtr_bufferSize", "uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, tau, lwork);
+    CallTrace callTrace(traceId, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZungtr_bufferSize(handle_native, uplo_native, n_native, A_native, lda_native, tau_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17419,6 +17937,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungtr_1buffer
     // tau is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -17457,10 +17978,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgtrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSorgtr(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17484,7 +18001,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSorgtrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSorgtr", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnSorgtr(handle_native, uplo_native, n_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17535,10 +18057,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgtrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDorgtr(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17562,7 +18080,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDorgtrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDorgtr", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnDorgtr(handle_native, uplo_native, n_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17613,10 +18136,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungtrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCungtr(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17640,7 +18159,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCungtrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCungtr", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnCungtr(handle_native, uplo_native, n_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17691,10 +18215,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungtrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZungtr(handle=%p, uplo=%d, n=%d, A=%p, lda=%d, tau=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, uplo, n, A, lda, tau, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -17718,7 +18238,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZungtrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZungtr", "uplo, n, lda, lwork");
+    CallCapture callCapture(env, traceId, handle, uplo, n, A, lda, tau, work, lwork, info);
+    CallTrace callTrace(traceId, uplo, n, lda, lwork);
     cusolverStatus_t jniResult_native = cusolverDnZungtr(handle_native, uplo_native, n_native, A_native, lda_native, tau_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17773,10 +18298,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormtr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSormtr_bufferSize(handle=%p, side=%d, uplo=%d, trans=%d, m=%d, n=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, lwork=%p)\n",
-        handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -17806,7 +18327,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormtr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSormtr_bufferSize", "side, uplo, trans, m");
+    CallCapture callCapture(env, traceId, handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    CallTrace callTrace(traceId, side, uplo, trans, m);
     cusolverStatus_t jniResult_native = cusolverDnSormtr_bufferSize(handle_native, side_native, uplo_native, trans_native, m_native, n_native, A_native, lda_native, tau_native, C_native, ldc_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17822,6 +18348,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormtr_1buffer
     // ldc is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -17863,10 +18392,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormtr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDormtr_bufferSize(handle=%p, side=%d, uplo=%d, trans=%d, m=%d, n=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, lwork=%p)\n",
-        handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -17896,7 +18421,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormtr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDormtr_bufferSize", "side, uplo, trans, m");
+    CallCapture callCapture(env, traceId, handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    CallTrace callTrace(traceId, side, uplo, trans, m);
     cusolverStatus_t jniResult_native = cusolverDnDormtr_bufferSize(handle_native, side_native, uplo_native, trans_native, m_native, n_native, A_native, lda_native, tau_native, C_native, ldc_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -17912,6 +18442,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormtr_1buffer
     // ldc is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -17953,10 +18486,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmtr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCunmtr_bufferSize(handle=%p, side=%d, uplo=%d, trans=%d, m=%d, n=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, lwork=%p)\n",
-        handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -17986,7 +18515,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmtr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCunmtr_bufferSize", "side, uplo, trans, m");
+    CallCapture callCapture(env, traceId, handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    CallTrace callTrace(traceId, side, uplo, trans, m);
     cusolverStatus_t jniResult_native = cusolverDnCunmtr_bufferSize(handle_native, side_native, uplo_native, trans_native, m_native, n_native, A_native, lda_native, tau_native, C_native, ldc_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18002,6 +18536,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmtr_1buffer
     // ldc is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -18043,10 +18580,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmtr_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZunmtr_bufferSize(handle=%p, side=%d, uplo=%d, trans=%d, m=%d, n=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, lwork=%p)\n",
-        handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -18076,7 +18609,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmtr_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZunmtr_bufferSize", "side, uplo, trans, m");
+    CallCapture callCapture(env, traceId, handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    CallTrace callTrace(traceId, side, uplo, trans, m);
     cusolverStatus_t jniResult_native = cusolverDnZunmtr_bufferSize(handle_native, side_native, uplo_native, trans_native, m_native, n_native, A_native, lda_native, tau_native, C_native, ldc_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18092,6 +18630,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmtr_1buffer
     // ldc is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -18139,10 +18680,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormtrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSormtr(handle=%p, side=%d, uplo=%d, trans=%d, m=%d, n=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, work=%p, lwork=%d, info=%p)\n",
-        handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -18176,7 +18713,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSormtrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSormtr", "side, uplo, trans, m");
+    CallCapture callCapture(env, traceId, handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    CallTrace callTrace(traceId, side, uplo, trans, m);
     cusolverStatus_t jniResult_native = cusolverDnSormtr(handle_native, side_native, uplo_native, trans_native, m_native, n_native, A_native, lda_native, tau_native, C_native, ldc_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18241,10 +18783,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormtrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDormtr(handle=%p, side=%d, uplo=%d, trans=%d, m=%d, n=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, work=%p, lwork=%d, info=%p)\n",
-        handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -18278,7 +18816,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDormtrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDormtr", "side, uplo, trans, m");
+    CallCapture callCapture(env, traceId, handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    CallTrace callTrace(traceId, side, uplo, trans, m);
     cusolverStatus_t jniResult_native = cusolverDnDormtr(handle_native, side_native, uplo_native, trans_native, m_native, n_native, A_native, lda_native, tau_native, C_native, ldc_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18343,10 +18886,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmtrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCunmtr(handle=%p, side=%d, uplo=%d, trans=%d, m=%d, n=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, work=%p, lwork=%d, info=%p)\n",
-        handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -18380,7 +18919,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCunmtrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCunmtr", "side, uplo, trans, m");
+    CallCapture callCapture(env, traceId, handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    CallTrace callTrace(traceId, side, uplo, trans, m);
     cusolverStatus_t jniResult_native = cusolverDnCunmtr(handle_native, side_native, uplo_native, trans_native, m_native, n_native, A_native, lda_native, tau_native, C_native, ldc_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18445,10 +18989,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmtrNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZunmtr(handle=%p, side=%d, uplo=%d, trans=%d, m=%d, n=%d, A=%p, lda=%d, tau=%p, C=%p, ldc=%d, work=%p, lwork=%d, info=%p)\n",
-        handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cublasSideMode_t side_native;
@@ -18482,7 +19022,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZunmtrNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZunmtr", "side, uplo, trans, m");
+    CallCapture callCapture(env, traceId, handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    CallTrace callTrace(traceId, side, uplo, trans, m);
     cusolverStatus_t jniResult_native = cusolverDnZunmtr(handle_native, side_native, uplo_native, trans_native, m_native, n_native, A_native, lda_native, tau_native, C_native, ldc_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18522,10 +19067,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgesvd_bufferSize(handle=%p, m=%d, n=%d, lwork=%p)\n",
-        handle, m, n, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -18539,7 +19080,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgesvd_bufferSize", "m, n");
+    CallCapture callCapture(env, traceId, handle, m, n, lwork);
+    CallTrace callTrace(traceId, m, n);
     cusolverStatus_t jniResult_native = cusolverDnSgesvd_bufferSize(handle_native, m_native, n_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18547,6 +19093,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvd_1buffer
     // n is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -18568,10 +19117,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgesvd_bufferSize(handle=%p, m=%d, n=%d, lwork=%p)\n",
-        handle, m, n, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -18585,7 +19130,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgesvd_bufferSize", "m, n");
+    CallCapture callCapture(env, traceId, handle, m, n, lwork);
+    CallTrace callTrace(traceId, m, n);
     cusolverStatus_t jniResult_native = cusolverDnDgesvd_bufferSize(handle_native, m_native, n_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18593,6 +19143,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvd_1buffer
     // n is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -18614,10 +19167,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgesvd_bufferSize(handle=%p, m=%d, n=%d, lwork=%p)\n",
-        handle, m, n, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -18631,7 +19180,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgesvd_bufferSize", "m, n");
+    CallCapture callCapture(env, traceId, handle, m, n, lwork);
+    CallTrace callTrace(traceId, m, n);
     cusolverStatus_t jniResult_native = cusolverDnCgesvd_bufferSize(handle_native, m_native, n_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18639,6 +19193,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvd_1buffer
     // n is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -18660,10 +19217,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgesvd_bufferSize(handle=%p, m=%d, n=%d, lwork=%p)\n",
-        handle, m, n, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     int m_native = 0;
@@ -18677,7 +19230,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgesvd_bufferSize", "m, n");
+    CallCapture callCapture(env, traceId, handle, m, n, lwork);
+    CallTrace callTrace(traceId, m, n);
     cusolverStatus_t jniResult_native = cusolverDnZgesvd_bufferSize(handle_native, m_native, n_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18685,6 +19243,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvd_1buffer
     // n is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -18742,10 +19303,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgesvd(handle=%p, jobu=%c, jobvt=%c, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, VT=%p, ldvt=%d, work=%p, lwork=%d, rwork=%p, info=%p)\n",
-        handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     char jobu_native = 0;
@@ -18788,7 +19345,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgesvd", "m, n, lda, ldu");
+    CallCapture callCapture(env, traceId, handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info);
+    CallTrace callTrace(traceId, m, n, lda, ldu);
     cusolverStatus_t jniResult_native = cusolverDnSgesvd(handle_native, jobu_native, jobvt_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, VT_native, ldvt_native, work_native, lwork_native, rwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18865,10 +19427,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgesvd(handle=%p, jobu=%c, jobvt=%c, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, VT=%p, ldvt=%d, work=%p, lwork=%d, rwork=%p, info=%p)\n",
-        handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     char jobu_native = 0;
@@ -18911,7 +19469,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgesvd", "m, n, lda, ldu");
+    CallCapture callCapture(env, traceId, handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info);
+    CallTrace callTrace(traceId, m, n, lda, ldu);
     cusolverStatus_t jniResult_native = cusolverDnDgesvd(handle_native, jobu_native, jobvt_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, VT_native, ldvt_native, work_native, lwork_native, rwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -18988,10 +19551,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgesvd(handle=%p, jobu=%c, jobvt=%c, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, VT=%p, ldvt=%d, work=%p, lwork=%d, rwork=%p, info=%p)\n",
-        handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     char jobu_native = 0;
@@ -19034,7 +19593,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgesvd", "m, n, lda, ldu");
+    CallCapture callCapture(env, traceId, handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info);
+    CallTrace callTrace(traceId, m, n, lda, ldu);
     cusolverStatus_t jniResult_native = cusolverDnCgesvd(handle_native, jobu_native, jobvt_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, VT_native, ldvt_native, work_native, lwork_native, rwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19111,10 +19675,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgesvd(handle=%p, jobu=%c, jobvt=%c, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, VT=%p, ldvt=%d, work=%p, lwork=%d, rwork=%p, info=%p)\n",
-        handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     char jobu_native = 0;
@@ -19157,7 +19717,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgesvd", "m, n, lda, ldu");
+    CallCapture callCapture(env, traceId, handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info);
+    CallTrace callTrace(traceId, m, n, lda, ldu);
     cusolverStatus_t jniResult_native = cusolverDnZgesvd(handle_native, jobu_native, jobvt_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, VT_native, ldvt_native, work_native, lwork_native, rwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19212,10 +19777,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsyevd_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19237,7 +19798,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsyevd_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsyevd_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19249,6 +19815,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevd_1buffer
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -19282,10 +19851,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsyevd_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19307,7 +19872,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsyevd_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsyevd_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19319,6 +19889,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevd_1buffer
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -19352,10 +19925,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCheevd_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19377,7 +19946,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCheevd_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCheevd_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19389,6 +19963,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevd_1buffer
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -19422,10 +19999,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZheevd_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19447,7 +20020,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZheevd_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZheevd_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19459,6 +20037,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevd_1buffer
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -19498,10 +20079,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsyevd(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19527,7 +20104,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsyevd", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsyevd(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19580,10 +20162,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsyevd(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19609,7 +20187,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsyevd", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsyevd(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19662,10 +20245,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCheevd(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19691,7 +20270,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCheevd", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCheevd(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19744,10 +20328,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZheevd(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19773,7 +20353,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZheevd", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZheevd(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19832,10 +20417,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsyevdx_bufferSize(handle=%p, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, vl=%f, vu=%f, il=%d, iu=%d, meig=%p, W=%p, lwork=%p)\n",
-        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19869,7 +20450,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevdx_1buffe
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsyevdx_bufferSize", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnSsyevdx_bufferSize(handle_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19887,6 +20473,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevdx_1buffe
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -19930,10 +20519,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsyevdx_bufferSize(handle=%p, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, vl=%lf, vu=%lf, il=%d, iu=%d, meig=%p, W=%p, lwork=%p)\n",
-        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -19967,7 +20552,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevdx_1buffe
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsyevdx_bufferSize", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnDsyevdx_bufferSize(handle_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -19985,6 +20575,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevdx_1buffe
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -20028,10 +20621,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCheevdx_bufferSize(handle=%p, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, vl=%f, vu=%f, il=%d, iu=%d, meig=%p, W=%p, lwork=%p)\n",
-        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -20065,7 +20654,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevdx_1buffe
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCheevdx_bufferSize", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnCheevdx_bufferSize(handle_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20083,6 +20677,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevdx_1buffe
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -20126,10 +20723,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZheevdx_bufferSize(handle=%p, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, vl=%lf, vu=%lf, il=%d, iu=%d, meig=%p, W=%p, lwork=%p)\n",
-        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -20163,7 +20756,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevdx_1buffe
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZheevdx_bufferSize", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnZheevdx_bufferSize(handle_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20181,6 +20779,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevdx_1buffe
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -20230,10 +20831,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsyevdx(handle=%p, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, vl=%f, vu=%f, il=%d, iu=%d, meig=%p, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -20271,7 +20868,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsyevdx", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnSsyevdx(handle_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20340,10 +20942,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsyevdx(handle=%p, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, vl=%lf, vu=%lf, il=%d, iu=%d, meig=%p, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -20381,7 +20979,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsyevdx", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnDsyevdx(handle_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20450,10 +21053,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCheevdx(handle=%p, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, vl=%f, vu=%f, il=%d, iu=%d, meig=%p, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -20491,7 +21090,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCheevdx", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnCheevdx(handle_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20560,10 +21164,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZheevdx(handle=%p, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, vl=%lf, vu=%lf, il=%d, iu=%d, meig=%p, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -20601,7 +21201,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZheevdx", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnZheevdx(handle_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20673,10 +21278,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsygvdx_bufferSize(handle=%p, itype=%d, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, vl=%f, vu=%f, il=%d, iu=%d, meig=%p, W=%p, lwork=%p)\n",
-        handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -20716,7 +21317,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvdx_1buffe
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsygvdx_bufferSize", "itype, jobz, range, uplo");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork);
+    CallTrace callTrace(traceId, itype, jobz, range, uplo);
     cusolverStatus_t jniResult_native = cusolverDnSsygvdx_bufferSize(handle_native, itype_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20737,6 +21343,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvdx_1buffe
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -20787,10 +21396,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsygvdx_bufferSize(handle=%p, itype=%d, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, vl=%lf, vu=%lf, il=%d, iu=%d, meig=%p, W=%p, lwork=%p)\n",
-        handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -20830,7 +21435,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvdx_1buffe
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsygvdx_bufferSize", "itype, jobz, range, uplo");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork);
+    CallTrace callTrace(traceId, itype, jobz, range, uplo);
     cusolverStatus_t jniResult_native = cusolverDnDsygvdx_bufferSize(handle_native, itype_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20851,6 +21461,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvdx_1buffe
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -20901,10 +21514,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnChegvdx_bufferSize(handle=%p, itype=%d, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, vl=%f, vu=%f, il=%d, iu=%d, meig=%p, W=%p, lwork=%p)\n",
-        handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -20944,7 +21553,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvdx_1buffe
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnChegvdx_bufferSize", "itype, jobz, range, uplo");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork);
+    CallTrace callTrace(traceId, itype, jobz, range, uplo);
     cusolverStatus_t jniResult_native = cusolverDnChegvdx_bufferSize(handle_native, itype_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -20965,6 +21579,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvdx_1buffe
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -21015,10 +21632,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZhegvdx_bufferSize(handle=%p, itype=%d, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, vl=%lf, vu=%lf, il=%d, iu=%d, meig=%p, W=%p, lwork=%p)\n",
-        handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21058,7 +21671,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvdx_1buffe
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZhegvdx_bufferSize", "itype, jobz, range, uplo");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork);
+    CallTrace callTrace(traceId, itype, jobz, range, uplo);
     cusolverStatus_t jniResult_native = cusolverDnZhegvdx_bufferSize(handle_native, itype_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21079,6 +21697,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvdx_1buffe
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -21135,10 +21756,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsygvdx(handle=%p, itype=%d, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, vl=%f, vu=%f, il=%d, iu=%d, meig=%p, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21182,7 +21799,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsygvdx", "itype, jobz, range, uplo");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info);
+    CallTrace callTrace(traceId, itype, jobz, range, uplo);
     cusolverStatus_t jniResult_native = cusolverDnSsygvdx(handle_native, itype_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21261,10 +21883,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsygvdx(handle=%p, itype=%d, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, vl=%lf, vu=%lf, il=%d, iu=%d, meig=%p, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21308,7 +21926,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsygvdx", "itype, jobz, range, uplo");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info);
+    CallTrace callTrace(traceId, itype, jobz, range, uplo);
     cusolverStatus_t jniResult_native = cusolverDnDsygvdx(handle_native, itype_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21387,10 +22010,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnChegvdx(handle=%p, itype=%d, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, vl=%f, vu=%f, il=%d, iu=%d, meig=%p, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21434,7 +22053,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnChegvdx", "itype, jobz, range, uplo");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info);
+    CallTrace callTrace(traceId, itype, jobz, range, uplo);
     cusolverStatus_t jniResult_native = cusolverDnChegvdx(handle_native, itype_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21513,10 +22137,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZhegvdx(handle=%p, itype=%d, jobz=%d, range=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, vl=%lf, vu=%lf, il=%d, iu=%d, meig=%p, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21560,7 +22180,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZhegvdx", "itype, jobz, range, uplo");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info);
+    CallTrace callTrace(traceId, itype, jobz, range, uplo);
     cusolverStatus_t jniResult_native = cusolverDnZhegvdx(handle_native, itype_native, jobz_native, range_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, vl_native, vu_native, il_native, iu_native, meig_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21625,10 +22250,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsygvd_bufferSize(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, lwork=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21656,7 +22277,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsygvd_bufferSize", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnSsygvd_bufferSize(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21671,6 +22297,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvd_1buffer
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -21711,10 +22340,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsygvd_bufferSize(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, lwork=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21742,7 +22367,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsygvd_bufferSize", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnDsygvd_bufferSize(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21757,6 +22387,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvd_1buffer
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -21797,10 +22430,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnChegvd_bufferSize(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, lwork=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21828,7 +22457,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnChegvd_bufferSize", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnChegvd_bufferSize(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21843,6 +22477,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvd_1buffer
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -21883,10 +22520,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZhegvd_bufferSize(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, lwork=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -21914,7 +22547,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvd_1buffer
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZhegvd_bufferSize", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnZhegvd_bufferSize(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -21929,6 +22567,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvd_1buffer
     // W is a native pointer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -21975,10 +22616,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsygvd(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -22010,7 +22647,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsygvd", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnSsygvd(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22073,10 +22715,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsygvd(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -22108,7 +22746,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsygvd", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnDsygvd(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22171,10 +22814,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnChegvd(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -22206,7 +22845,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnChegvd", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnChegvd(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22269,10 +22913,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZhegvd(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, work=%p, lwork=%d, info=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -22304,7 +22944,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZhegvd", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnZhegvd(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22335,10 +22980,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateSyevjInf
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCreateSyevjInfo(info=%p)\n",
-        info);
-
     // Native variable declarations
     syevjInfo_t * info_native;
 
@@ -22346,7 +22987,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateSyevjInf
     info_native = (syevjInfo_t *)getNativePointerValue(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCreateSyevjInfo", "");
+    CallCapture callCapture(env, traceId, info);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnCreateSyevjInfo(info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -22365,10 +23011,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDestroySyevjIn
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDestroySyevjInfo(info=%p)\n",
-        info);
-
     // Native variable declarations
     syevjInfo_t info_native;
 
@@ -22376,7 +23018,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDestroySyevjIn
     info_native = (syevjInfo_t)getNativePointerValue(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDestroySyevjInfo", "");
+    CallCapture callCapture(env, traceId, info);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnDestroySyevjInfo(info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -22396,10 +23043,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjSetToler
     }
     // tolerance is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevjSetTolerance(info=%p, tolerance=%lf)\n",
-        info, tolerance);
-
     // Native variable declarations
     syevjInfo_t info_native;
     double tolerance_native = 0.0;
@@ -22409,7 +23052,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjSetToler
     tolerance_native = (double)tolerance;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevjSetTolerance", "");
+    CallCapture callCapture(env, traceId, info, tolerance);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnXsyevjSetTolerance(info_native, tolerance_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -22430,10 +23078,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjSetMaxSw
     }
     // max_sweeps is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevjSetMaxSweeps(info=%p, max_sweeps=%d)\n",
-        info, max_sweeps);
-
     // Native variable declarations
     syevjInfo_t info_native;
     int max_sweeps_native = 0;
@@ -22443,7 +23087,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjSetMaxSw
     max_sweeps_native = (int)max_sweeps;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevjSetMaxSweeps", "max_sweeps");
+    CallCapture callCapture(env, traceId, info, max_sweeps);
+    CallTrace callTrace(traceId, max_sweeps);
     cusolverStatus_t jniResult_native = cusolverDnXsyevjSetMaxSweeps(info_native, max_sweeps_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -22464,10 +23113,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjSetSortE
     }
     // sort_eig is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevjSetSortEig(info=%p, sort_eig=%d)\n",
-        info, sort_eig);
-
     // Native variable declarations
     syevjInfo_t info_native;
     int sort_eig_native = 0;
@@ -22477,7 +23122,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjSetSortE
     sort_eig_native = (int)sort_eig;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevjSetSortEig", "sort_eig");
+    CallCapture callCapture(env, traceId, info, sort_eig);
+    CallTrace callTrace(traceId, sort_eig);
     cusolverStatus_t jniResult_native = cusolverDnXsyevjSetSortEig(info_native, sort_eig_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -22507,10 +23157,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjGetResid
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevjGetResidual(handle=%p, info=%p, residual=%p)\n",
-        handle, info, residual);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     syevjInfo_t info_native;
@@ -22522,7 +23168,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjGetResid
     residual_native = (double *)getPointer(env, residual);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevjGetResidual", "");
+    CallCapture callCapture(env, traceId, handle, info, residual);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnXsyevjGetResidual(handle_native, info_native, residual_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22553,10 +23204,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjGetSweep
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevjGetSweeps(handle=%p, info=%p, executed_sweeps=%p)\n",
-        handle, info, executed_sweeps);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     syevjInfo_t info_native;
@@ -22568,7 +23215,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevjGetSweep
     executed_sweeps_native = (int *)getPointer(env, executed_sweeps);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevjGetSweeps", "");
+    CallCapture callCapture(env, traceId, handle, info, executed_sweeps);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnXsyevjGetSweeps(handle_native, info_native, executed_sweeps_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22614,10 +23266,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevjBatched_
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsyevjBatched_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -22643,7 +23291,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevjBatched_
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsyevjBatched_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsyevjBatched_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22657,6 +23310,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevjBatched_
     // params is read-only
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -22696,10 +23352,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevjBatched_
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsyevjBatched_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -22725,7 +23377,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevjBatched_
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsyevjBatched_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsyevjBatched_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22739,6 +23396,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevjBatched_
     // params is read-only
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -22778,10 +23438,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevjBatched_
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCheevjBatched_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -22807,7 +23463,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevjBatched_
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCheevjBatched_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCheevjBatched_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22821,6 +23482,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevjBatched_
     // params is read-only
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -22860,10 +23524,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevjBatched_
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZheevjBatched_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -22889,7 +23549,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevjBatched_
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZheevjBatched_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZheevjBatched_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -22903,6 +23568,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevjBatched_
     // params is read-only
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -22948,10 +23616,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevjBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsyevjBatched(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -22981,7 +23645,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevjBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsyevjBatched", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsyevjBatched(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23042,10 +23711,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevjBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsyevjBatched(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23075,7 +23740,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevjBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsyevjBatched", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsyevjBatched(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23136,10 +23806,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevjBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCheevjBatched(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23169,7 +23835,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevjBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCheevjBatched", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCheevjBatched(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23230,10 +23901,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevjBatchedN
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZheevjBatched(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23263,7 +23930,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevjBatchedN
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZheevjBatched", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZheevjBatched(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23317,10 +23989,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevj_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsyevj_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p, params=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23344,7 +24012,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevj_1buffer
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsyevj_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork, params);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsyevj_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23357,6 +24030,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevj_1buffer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -23395,10 +24071,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevj_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsyevj_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p, params=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23422,7 +24094,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevj_1buffer
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsyevj_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork, params);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsyevj_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23435,6 +24112,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevj_1buffer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -23473,10 +24153,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevj_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCheevj_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p, params=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23500,7 +24176,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevj_1buffer
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCheevj_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork, params);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCheevj_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23513,6 +24194,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevj_1buffer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -23551,10 +24235,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevj_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZheevj_bufferSize(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, lwork=%p, params=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23578,7 +24258,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevj_1buffer
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZheevj_bufferSize", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, lwork, params);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZheevj_bufferSize(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23591,6 +24276,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevj_1buffer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -23635,10 +24323,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevjNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsyevj(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23666,7 +24350,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsyevjNative(J
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsyevj", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSsyevj(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23725,10 +24414,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevjNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsyevj(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23756,7 +24441,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsyevjNative(J
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsyevj", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDsyevj(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23815,10 +24505,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevjNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCheevj(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23846,7 +24532,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCheevjNative(J
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCheevj", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCheevj(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23905,10 +24596,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevjNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZheevj(handle=%p, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -23936,7 +24623,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZheevjNative(J
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZheevj", "jobz, uplo, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    CallTrace callTrace(traceId, jobz, uplo, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZheevj(handle_native, jobz_native, uplo_native, n_native, A_native, lda_native, W_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -23996,10 +24688,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvj_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsygvj_bufferSize(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, lwork=%p, params=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -24029,7 +24717,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvj_1buffer
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsygvj_bufferSize", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnSsygvj_bufferSize(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24045,6 +24738,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvj_1buffer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -24090,10 +24786,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvj_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsygvj_bufferSize(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, lwork=%p, params=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -24123,7 +24815,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvj_1buffer
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsygvj_bufferSize", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnDsygvj_bufferSize(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24139,6 +24836,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvj_1buffer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -24184,10 +24884,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvj_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnChegvj_bufferSize(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, lwork=%p, params=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -24217,7 +24913,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvj_1buffer
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnChegvj_bufferSize", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnChegvj_bufferSize(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24233,6 +24934,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvj_1buffer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -24278,10 +24982,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvj_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZhegvj_bufferSize(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, lwork=%p, params=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -24311,7 +25011,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvj_1buffer
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZhegvj_bufferSize", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnZhegvj_bufferSize(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24327,6 +25032,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvj_1buffer
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -24378,10 +25086,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvjNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSsygvj(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -24415,7 +25119,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSsygvjNative(J
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSsygvj", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnSsygvj(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24484,10 +25193,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvjNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDsygvj(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -24521,7 +25226,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDsygvjNative(J
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDsygvj", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnDsygvj(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24590,10 +25300,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvjNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnChegvj(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -24627,7 +25333,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnChegvjNative(J
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnChegvj", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnChegvj(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24696,10 +25407,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvjNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZhegvj(handle=%p, itype=%d, jobz=%d, uplo=%d, n=%d, A=%p, lda=%d, B=%p, ldb=%d, W=%p, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigType_t itype_native;
@@ -24733,7 +25440,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZhegvjNative(J
     params_native = (syevjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZhegvj", "itype, jobz, uplo, n");
+    CallCapture callCapture(env, traceId, handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    CallTrace callTrace(traceId, itype, jobz, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnZhegvj(handle_native, itype_native, jobz_native, uplo_native, n_native, A_native, lda_native, B_native, ldb_native, W_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24765,10 +25477,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateGesvdjIn
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCreateGesvdjInfo(info=%p)\n",
-        info);
-
     // Native variable declarations
     gesvdjInfo_t * info_native;
 
@@ -24776,7 +25484,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateGesvdjIn
     info_native = (gesvdjInfo_t *)getNativePointerValue(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCreateGesvdjInfo", "");
+    CallCapture callCapture(env, traceId, info);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnCreateGesvdjInfo(info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -24795,10 +25508,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDestroyGesvdjI
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDestroyGesvdjInfo(info=%p)\n",
-        info);
-
     // Native variable declarations
     gesvdjInfo_t info_native;
 
@@ -24806,7 +25515,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDestroyGesvdjI
     info_native = (gesvdjInfo_t)getNativePointerValue(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDestroyGesvdjInfo", "");
+    CallCapture callCapture(env, traceId, info);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnDestroyGesvdjInfo(info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -24826,10 +25540,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjSetTole
     }
     // tolerance is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdjSetTolerance(info=%p, tolerance=%lf)\n",
-        info, tolerance);
-
     // Native variable declarations
     gesvdjInfo_t info_native;
     double tolerance_native = 0.0;
@@ -24839,7 +25549,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjSetTole
     tolerance_native = (double)tolerance;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdjSetTolerance", "");
+    CallCapture callCapture(env, traceId, info, tolerance);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnXgesvdjSetTolerance(info_native, tolerance_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -24860,10 +25575,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjSetMaxS
     }
     // max_sweeps is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdjSetMaxSweeps(info=%p, max_sweeps=%d)\n",
-        info, max_sweeps);
-
     // Native variable declarations
     gesvdjInfo_t info_native;
     int max_sweeps_native = 0;
@@ -24873,7 +25584,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjSetMaxS
     max_sweeps_native = (int)max_sweeps;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdjSetMaxSweeps", "max_sweeps");
+    CallCapture callCapture(env, traceId, info, max_sweeps);
+    CallTrace callTrace(traceId, max_sweeps);
     cusolverStatus_t jniResult_native = cusolverDnXgesvdjSetMaxSweeps(info_native, max_sweeps_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -24894,10 +25610,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjSetSort
     }
     // sort_svd is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdjSetSortEig(info=%p, sort_svd=%d)\n",
-        info, sort_svd);
-
     // Native variable declarations
     gesvdjInfo_t info_native;
     int sort_svd_native = 0;
@@ -24907,7 +25619,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjSetSort
     sort_svd_native = (int)sort_svd;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdjSetSortEig", "sort_svd");
+    CallCapture callCapture(env, traceId, info, sort_svd);
+    CallTrace callTrace(traceId, sort_svd);
     cusolverStatus_t jniResult_native = cusolverDnXgesvdjSetSortEig(info_native, sort_svd_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -24937,10 +25654,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjGetResi
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdjGetResidual(handle=%p, info=%p, residual=%p)\n",
-        handle, info, residual);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     gesvdjInfo_t info_native;
@@ -24952,7 +25665,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjGetResi
     residual_native = (double *)getPointer(env, residual);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdjGetResidual", "");
+    CallCapture callCapture(env, traceId, handle, info, residual);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnXgesvdjGetResidual(handle_native, info_native, residual_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -24983,10 +25701,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjGetSwee
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdjGetSweeps(handle=%p, info=%p, executed_sweeps=%p)\n",
-        handle, info, executed_sweeps);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     gesvdjInfo_t info_native;
@@ -24998,7 +25712,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdjGetSwee
     executed_sweeps_native = (int *)getPointer(env, executed_sweeps);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdjGetSweeps", "");
+    CallCapture callCapture(env, traceId, handle, info, executed_sweeps);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnXgesvdjGetSweeps(handle_native, info_native, executed_sweeps_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25056,10 +25775,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdjBatched
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgesvdjBatched_bufferSize(handle=%p, jobz=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, lwork=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25093,7 +25808,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdjBatched
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgesvdjBatched_bufferSize", "jobz, m, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize);
+    CallTrace callTrace(traceId, jobz, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSgesvdjBatched_bufferSize(handle_native, jobz_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, &lwork_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25111,6 +25831,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdjBatched
     // params is read-only
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -25162,10 +25885,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdjBatched
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgesvdjBatched_bufferSize(handle=%p, jobz=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, lwork=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25199,7 +25918,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdjBatched
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgesvdjBatched_bufferSize", "jobz, m, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize);
+    CallTrace callTrace(traceId, jobz, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDgesvdjBatched_bufferSize(handle_native, jobz_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, &lwork_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25217,6 +25941,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdjBatched
     // params is read-only
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -25268,10 +25995,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdjBatched
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgesvdjBatched_bufferSize(handle=%p, jobz=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, lwork=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25305,7 +26028,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdjBatched
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgesvdjBatched_bufferSize", "jobz, m, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize);
+    CallTrace callTrace(traceId, jobz, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCgesvdjBatched_bufferSize(handle_native, jobz_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, &lwork_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25323,6 +26051,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdjBatched
     // params is read-only
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -25374,10 +26105,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdjBatched
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgesvdjBatched_bufferSize(handle=%p, jobz=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, lwork=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25411,7 +26138,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdjBatched
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgesvdjBatched_bufferSize", "jobz, m, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize);
+    CallTrace callTrace(traceId, jobz, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZgesvdjBatched_bufferSize(handle_native, jobz_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, &lwork_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25429,6 +26161,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdjBatched
     // params is read-only
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -25486,10 +26221,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdjBatched
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgesvdjBatched(handle=%p, jobz=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, work=%p, lwork=%d, info=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25527,7 +26258,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdjBatched
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgesvdjBatched", "jobz, m, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize);
+    CallTrace callTrace(traceId, jobz, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnSgesvdjBatched(handle_native, jobz_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, work_native, lwork_native, info_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25604,10 +26340,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdjBatched
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgesvdjBatched(handle=%p, jobz=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, work=%p, lwork=%d, info=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25645,7 +26377,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdjBatched
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgesvdjBatched", "jobz, m, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize);
+    CallTrace callTrace(traceId, jobz, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnDgesvdjBatched(handle_native, jobz_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, work_native, lwork_native, info_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25722,10 +26459,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdjBatched
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgesvdjBatched(handle=%p, jobz=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, work=%p, lwork=%d, info=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25763,7 +26496,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdjBatched
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgesvdjBatched", "jobz, m, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize);
+    CallTrace callTrace(traceId, jobz, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnCgesvdjBatched(handle_native, jobz_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, work_native, lwork_native, info_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25840,10 +26578,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdjBatched
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgesvdjBatched(handle=%p, jobz=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, work=%p, lwork=%d, info=%p, params=%p, batchSize=%d)\n",
-        handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25881,7 +26615,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdjBatched
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgesvdjBatched", "jobz, m, n, lda");
+    CallCapture callCapture(env, traceId, handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize);
+    CallTrace callTrace(traceId, jobz, m, n, lda);
     cusolverStatus_t jniResult_native = cusolverDnZgesvdjBatched(handle_native, jobz_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, work_native, lwork_native, info_native, params_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -25952,10 +26691,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdj_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgesvdj_bufferSize(handle=%p, jobz=%d, econ=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, lwork=%p, params=%p)\n",
-        handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -25989,7 +26724,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdj_1buffe
     params_native = (gesvdjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgesvdj_bufferSize", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnSgesvdj_bufferSize(handle_native, jobz_native, econ_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26007,6 +26747,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdj_1buffe
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -26058,10 +26801,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdj_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgesvdj_bufferSize(handle=%p, jobz=%d, econ=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, lwork=%p, params=%p)\n",
-        handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -26095,7 +26834,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdj_1buffe
     params_native = (gesvdjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgesvdj_bufferSize", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnDgesvdj_bufferSize(handle_native, jobz_native, econ_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26113,6 +26857,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdj_1buffe
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -26164,10 +26911,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdj_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgesvdj_bufferSize(handle=%p, jobz=%d, econ=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, lwork=%p, params=%p)\n",
-        handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -26201,7 +26944,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdj_1buffe
     params_native = (gesvdjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgesvdj_bufferSize", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnCgesvdj_bufferSize(handle_native, jobz_native, econ_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26219,6 +26967,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdj_1buffe
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -26270,10 +27021,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdj_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgesvdj_bufferSize(handle=%p, jobz=%d, econ=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, lwork=%p, params=%p)\n",
-        handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -26307,7 +27054,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdj_1buffe
     params_native = (gesvdjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgesvdj_bufferSize", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnZgesvdj_bufferSize(handle_native, jobz_native, econ_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, &lwork_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26325,6 +27077,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdj_1buffe
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // params is read-only
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -26382,10 +27137,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdjNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgesvdj(handle=%p, jobz=%d, econ=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -26423,7 +27174,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdjNative(
     params_native = (gesvdjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgesvdj", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnSgesvdj(handle_native, jobz_native, econ_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26500,10 +27256,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdjNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgesvdj(handle=%p, jobz=%d, econ=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -26541,7 +27293,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdjNative(
     params_native = (gesvdjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgesvdj", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnDgesvdj(handle_native, jobz_native, econ_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26618,10 +27375,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdjNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgesvdj(handle=%p, jobz=%d, econ=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -26659,7 +27412,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdjNative(
     params_native = (gesvdjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgesvdj", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnCgesvdj(handle_native, jobz_native, econ_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26736,10 +27494,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdjNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgesvdj(handle=%p, jobz=%d, econ=%d, m=%d, n=%d, A=%p, lda=%d, S=%p, U=%p, ldu=%d, V=%p, ldv=%d, work=%p, lwork=%d, info=%p, params=%p)\n",
-        handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -26777,7 +27531,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdjNative(
     params_native = (gesvdjInfo_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgesvdj", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnZgesvdj(handle_native, jobz_native, econ_native, m_native, n_native, A_native, lda_native, S_native, U_native, ldu_native, V_native, ldv_native, work_native, lwork_native, info_native, params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26849,10 +27608,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdaStrided
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgesvdaStridedBatched_bufferSize(handle=%p, jobz=%d, rank=%d, m=%d, n=%d, d_A=%p, lda=%d, strideA=%ld, d_S=%p, strideS=%ld, d_U=%p, ldu=%d, strideU=%ld, d_V=%p, ldv=%d, strideV=%ld, lwork=%p, batchSize=%d)\n",
-        handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -26894,7 +27649,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdaStrided
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgesvdaStridedBatched_bufferSize", "jobz, rank, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize);
+    CallTrace callTrace(traceId, jobz, rank, m, n);
     cusolverStatus_t jniResult_native = cusolverDnSgesvdaStridedBatched_bufferSize(handle_native, jobz_native, rank_native, m_native, n_native, d_A_native, lda_native, strideA_native, d_S_native, strideS_native, d_U_native, ldu_native, strideU_native, d_V_native, ldv_native, strideV_native, &lwork_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -26916,6 +27676,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdaStrided
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(float), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -26967,10 +27730,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdaStrided
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgesvdaStridedBatched_bufferSize(handle=%p, jobz=%d, rank=%d, m=%d, n=%d, d_A=%p, lda=%d, strideA=%ld, d_S=%p, strideS=%ld, d_U=%p, ldu=%d, strideU=%ld, d_V=%p, ldv=%d, strideV=%ld, lwork=%p, batchSize=%d)\n",
-        handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -27012,7 +27771,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdaStrided
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgesvdaStridedBatched_bufferSize", "jobz, rank, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize);
+    CallTrace callTrace(traceId, jobz, rank, m, n);
     cusolverStatus_t jniResult_native = cusolverDnDgesvdaStridedBatched_bufferSize(handle_native, jobz_native, rank_native, m_native, n_native, d_A_native, lda_native, strideA_native, d_S_native, strideS_native, d_U_native, ldu_native, strideU_native, d_V_native, ldv_native, strideV_native, &lwork_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -27034,6 +27798,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdaStrided
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(double), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -27085,10 +27852,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdaStrided
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgesvdaStridedBatched_bufferSize(handle=%p, jobz=%d, rank=%d, m=%d, n=%d, d_A=%p, lda=%d, strideA=%ld, d_S=%p, strideS=%ld, d_U=%p, ldu=%d, strideU=%ld, d_V=%p, ldv=%d, strideV=%ld, lwork=%p, batchSize=%d)\n",
-        handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -27130,7 +27893,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdaStrided
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgesvdaStridedBatched_bufferSize", "jobz, rank, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize);
+    CallTrace callTrace(traceId, jobz, rank, m, n);
     cusolverStatus_t jniResult_native = cusolverDnCgesvdaStridedBatched_bufferSize(handle_native, jobz_native, rank_native, m_native, n_native, d_A_native, lda_native, strideA_native, d_S_native, strideS_native, d_U_native, ldu_native, strideU_native, d_V_native, ldv_native, strideV_native, &lwork_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -27152,6 +27920,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdaStrided
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -27203,10 +27974,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdaStrided
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgesvdaStridedBatched_bufferSize(handle=%p, jobz=%d, rank=%d, m=%d, n=%d, d_A=%p, lda=%d, strideA=%ld, d_S=%p, strideS=%ld, d_U=%p, ldu=%d, strideU=%ld, d_V=%p, ldv=%d, strideV=%ld, lwork=%p, batchSize=%d)\n",
-        handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -27248,7 +28015,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdaStrided
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgesvdaStridedBatched_bufferSize", "jobz, rank, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize);
+    CallTrace callTrace(traceId, jobz, rank, m, n);
     cusolverStatus_t jniResult_native = cusolverDnZgesvdaStridedBatched_bufferSize(handle_native, jobz_native, rank_native, m_native, n_native, d_A_native, lda_native, strideA_native, d_S_native, strideS_native, d_U_native, ldu_native, strideU_native, d_V_native, ldv_native, strideV_native, &lwork_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -27270,6 +28042,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdaStrided
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     // batchSize is primitive
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * sizeof(cuDoubleComplex), 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -27332,10 +28107,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdaStrided
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSgesvdaStridedBatched(handle=%p, jobz=%d, rank=%d, m=%d, n=%d, d_A=%p, lda=%d, strideA=%ld, d_S=%p, strideS=%ld, d_U=%p, ldu=%d, strideU=%ld, d_V=%p, ldv=%d, strideV=%ld, d_work=%p, lwork=%d, d_info=%p, h_R_nrmF=%p, batchSize=%d)\n",
-        handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -27383,7 +28154,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSgesvdaStrided
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSgesvdaStridedBatched", "jobz, rank, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize);
+    CallTrace callTrace(traceId, jobz, rank, m, n);
     cusolverStatus_t jniResult_native = cusolverDnSgesvdaStridedBatched(handle_native, jobz_native, rank_native, m_native, n_native, d_A_native, lda_native, strideA_native, d_S_native, strideS_native, d_U_native, ldu_native, strideU_native, d_V_native, ldv_native, strideV_native, d_work_native, lwork_native, d_info_native, h_R_nrmF_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -27470,10 +28246,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdaStrided
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDgesvdaStridedBatched(handle=%p, jobz=%d, rank=%d, m=%d, n=%d, d_A=%p, lda=%d, strideA=%ld, d_S=%p, strideS=%ld, d_U=%p, ldu=%d, strideU=%ld, d_V=%p, ldv=%d, strideV=%ld, d_work=%p, lwork=%d, d_info=%p, h_R_nrmF=%p, batchSize=%d)\n",
-        handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -27521,7 +28293,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDgesvdaStrided
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDgesvdaStridedBatched", "jobz, rank, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize);
+    CallTrace callTrace(traceId, jobz, rank, m, n);
     cusolverStatus_t jniResult_native = cusolverDnDgesvdaStridedBatched(handle_native, jobz_native, rank_native, m_native, n_native, d_A_native, lda_native, strideA_native, d_S_native, strideS_native, d_U_native, ldu_native, strideU_native, d_V_native, ldv_native, strideV_native, d_work_native, lwork_native, d_info_native, h_R_nrmF_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -27608,10 +28385,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdaStrided
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCgesvdaStridedBatched(handle=%p, jobz=%d, rank=%d, m=%d, n=%d, d_A=%p, lda=%d, strideA=%ld, d_S=%p, strideS=%ld, d_U=%p, ldu=%d, strideU=%ld, d_V=%p, ldv=%d, strideV=%ld, d_work=%p, lwork=%d, d_info=%p, h_R_nrmF=%p, batchSize=%d)\n",
-        handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -27659,7 +28432,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCgesvdaStrided
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCgesvdaStridedBatched", "jobz, rank, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize);
+    CallTrace callTrace(traceId, jobz, rank, m, n);
     cusolverStatus_t jniResult_native = cusolverDnCgesvdaStridedBatched(handle_native, jobz_native, rank_native, m_native, n_native, d_A_native, lda_native, strideA_native, d_S_native, strideS_native, d_U_native, ldu_native, strideU_native, d_V_native, ldv_native, strideV_native, d_work_native, lwork_native, d_info_native, h_R_nrmF_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -27746,10 +28524,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdaStrided
     }
     // batchSize is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnZgesvdaStridedBatched(handle=%p, jobz=%d, rank=%d, m=%d, n=%d, d_A=%p, lda=%d, strideA=%ld, d_S=%p, strideS=%ld, d_U=%p, ldu=%d, strideU=%ld, d_V=%p, ldv=%d, strideV=%ld, d_work=%p, lwork=%d, d_info=%p, h_R_nrmF=%p, batchSize=%d)\n",
-        handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -27797,7 +28571,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdaStrided
     batchSize_native = (int)batchSize;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnZgesvdaStridedBatched", "jobz, rank, m, n");
+    CallCapture callCapture(env, traceId, handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize);
+    CallTrace callTrace(traceId, jobz, rank, m, n);
     cusolverStatus_t jniResult_native = cusolverDnZgesvdaStridedBatched(handle_native, jobz_native, rank_native, m_native, n_native, d_A_native, lda_native, strideA_native, d_S_native, strideS_native, d_U_native, ldu_native, strideU_native, d_V_native, ldv_native, strideV_native, d_work_native, lwork_native, d_info_native, h_R_nrmF_native, batchSize_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -27826,7 +28605,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnZgesvdaStrided
     jint jniResult = (jint)jniResult_native;
     return jniResult;
 }
+#endif // JCUSOLVER_FAMILY_DNEIGEN
 
+#ifdef JCUSOLVER_FAMILY_DN
 JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateParamsNative(JNIEnv *env, jclass cls, jobject params)
 {
     // Null-checks for non-primitive arguments
@@ -27836,10 +28617,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateParamsNa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnCreateParams(params=%p)\n",
-        params);
-
     // Native variable declarations
     cusolverDnParams_t params_native;
 
@@ -27847,7 +28624,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnCreateParamsNa
     // params is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnCreateParams", "");
+    CallCapture callCapture(env, traceId, params);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnCreateParams(&params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, params, (jlong)params_native);
@@ -27866,10 +28648,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDestroyParamsN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnDestroyParams(params=%p)\n",
-        params);
-
     // Native variable declarations
     cusolverDnParams_t params_native;
 
@@ -27877,7 +28655,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnDestroyParamsN
     params_native = (cusolverDnParams_t)getNativePointerValue(env, params);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnDestroyParams", "");
+    CallCapture callCapture(env, traceId, params);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverDnDestroyParams(params_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -27898,10 +28681,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSetAdvOptionsN
     // function is primitive
     // algo is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSetAdvOptions(params=%p, function=%d, algo=%d)\n",
-        params, function, algo);
-
     // Native variable declarations
     cusolverDnParams_t params_native;
     cusolverDnFunction_t function_native;
@@ -27913,7 +28692,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSetAdvOptionsN
     algo_native = (cusolverAlgMode_t)algo;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSetAdvOptions", "function, algo");
+    CallCapture callCapture(env, traceId, params, function, algo);
+    CallTrace callTrace(traceId, function, algo);
     cusolverStatus_t jniResult_native = cusolverDnSetAdvOptions(params_native, function_native, algo_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // params is read-only
@@ -27955,10 +28739,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnPotrf_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnPotrf_bufferSize(handle=%p, params=%p, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, computeType=%d, workspaceInBytes=%p)\n",
-        handle, params, uplo, n, dataTypeA, A, lda, computeType, workspaceInBytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -27968,7 +28748,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnPotrf_1bufferS
     void * A_native = NULL;
     int64_t lda_native = 0;
     cudaDataType computeType_native;
-    size_t * workspaceInBytes_native = NULL;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -27979,10 +28759,15 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnPotrf_1bufferS
     A_native = (void *)getPointer(env, A);
     lda_native = (int64_t)lda;
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnPotrf_bufferSize(handle_native, params_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnPotrf_bufferSize", "uplo, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, uplo, n, dataTypeA, A, lda, computeType, workspaceInBytes);
+    CallTrace callTrace(traceId, uplo, n, dataTypeA, lda);
+    cusolverStatus_t jniResult_native = cusolverDnPotrf_bufferSize(handle_native, params_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -27993,7 +28778,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnPotrf_1bufferS
     // A is a native pointer
     // lda is primitive
     // computeType is primitive
-    // workspaceInBytes is a native pointer
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -28035,10 +28823,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnPotrfNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnPotrf(handle=%p, params=%p, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, computeType=%d, pBuffer=%p, workspaceInBytes=%ld, info=%p)\n",
-        handle, params, uplo, n, dataTypeA, A, lda, computeType, pBuffer, workspaceInBytes, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28066,7 +28850,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnPotrfNative(JN
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnPotrf", "uplo, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, uplo, n, dataTypeA, A, lda, computeType, pBuffer, workspaceInBytes, info);
+    CallTrace callTrace(traceId, uplo, n, dataTypeA, lda);
     cusolverStatus_t jniResult_native = cusolverDnPotrf(handle_native, params_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, pBuffer_native, workspaceInBytes_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28123,10 +28912,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnPotrsNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnPotrs(handle=%p, params=%p, uplo=%d, n=%ld, nrhs=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeB=%d, B=%p, ldb=%ld, info=%p)\n",
-        handle, params, uplo, n, nrhs, dataTypeA, A, lda, dataTypeB, B, ldb, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28156,7 +28941,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnPotrsNative(JN
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnPotrs", "uplo, n, nrhs, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, params, uplo, n, nrhs, dataTypeA, A, lda, dataTypeB, B, ldb, info);
+    CallTrace callTrace(traceId, uplo, n, nrhs, dataTypeA);
     cusolverStatus_t jniResult_native = cusolverDnPotrs(handle_native, params_native, uplo_native, n_native, nrhs_native, dataTypeA_native, A_native, lda_native, dataTypeB_native, B_native, ldb_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28213,10 +29003,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGeqrf_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnGeqrf_bufferSize(handle=%p, params=%p, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeTau=%d, tau=%p, computeType=%d, workspaceInBytes=%p)\n",
-        handle, params, m, n, dataTypeA, A, lda, dataTypeTau, tau, computeType, workspaceInBytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28228,7 +29014,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGeqrf_1bufferS
     cudaDataType dataTypeTau_native;
     void * tau_native = NULL;
     cudaDataType computeType_native;
-    size_t * workspaceInBytes_native = NULL;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -28241,10 +29027,15 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGeqrf_1bufferS
     dataTypeTau_native = (cudaDataType)dataTypeTau;
     tau_native = (void *)getPointer(env, tau);
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnGeqrf_bufferSize(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeTau_native, tau_native, computeType_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnGeqrf_bufferSize", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, m, n, dataTypeA, A, lda, dataTypeTau, tau, computeType, workspaceInBytes);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
+    cusolverStatus_t jniResult_native = cusolverDnGeqrf_bufferSize(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeTau_native, tau_native, computeType_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28257,7 +29048,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGeqrf_1bufferS
     // dataTypeTau is primitive
     // tau is a native pointer
     // computeType is primitive
-    // workspaceInBytes is a native pointer
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -28305,10 +29099,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGeqrfNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnGeqrf(handle=%p, params=%p, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeTau=%d, tau=%p, computeType=%d, pBuffer=%p, workspaceInBytes=%ld, info=%p)\n",
-        handle, params, m, n, dataTypeA, A, lda, dataTypeTau, tau, computeType, pBuffer, workspaceInBytes, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28340,7 +29130,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGeqrfNative(JN
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnGeqrf", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, m, n, dataTypeA, A, lda, dataTypeTau, tau, computeType, pBuffer, workspaceInBytes, info);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
     cusolverStatus_t jniResult_native = cusolverDnGeqrf(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeTau_native, tau_native, computeType_native, pBuffer_native, workspaceInBytes_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28392,10 +29187,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrf_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnGetrf_bufferSize(handle=%p, params=%p, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, computeType=%d, workspaceInBytes=%p)\n",
-        handle, params, m, n, dataTypeA, A, lda, computeType, workspaceInBytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28405,7 +29196,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrf_1bufferS
     void * A_native = NULL;
     int64_t lda_native = 0;
     cudaDataType computeType_native;
-    size_t * workspaceInBytes_native = NULL;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -28416,10 +29207,15 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrf_1bufferS
     A_native = (void *)getPointer(env, A);
     lda_native = (int64_t)lda;
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnGetrf_bufferSize(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnGetrf_bufferSize", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, m, n, dataTypeA, A, lda, computeType, workspaceInBytes);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
+    cusolverStatus_t jniResult_native = cusolverDnGetrf_bufferSize(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28430,7 +29226,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrf_1bufferS
     // A is a native pointer
     // lda is primitive
     // computeType is primitive
-    // workspaceInBytes is a native pointer
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -28477,10 +29276,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrfNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnGetrf(handle=%p, params=%p, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, ipiv=%p, computeType=%d, pBuffer=%p, workspaceInBytes=%ld, info=%p)\n",
-        handle, params, m, n, dataTypeA, A, lda, ipiv, computeType, pBuffer, workspaceInBytes, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28510,7 +29305,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrfNative(JN
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnGetrf", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, m, n, dataTypeA, A, lda, ipiv, computeType, pBuffer, workspaceInBytes, info);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
     cusolverStatus_t jniResult_native = cusolverDnGetrf(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, ipiv_native, computeType_native, pBuffer_native, workspaceInBytes_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28573,10 +29373,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrsNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnGetrs(handle=%p, params=%p, trans=%d, n=%ld, nrhs=%ld, dataTypeA=%d, A=%p, lda=%ld, ipiv=%p, dataTypeB=%d, B=%p, ldb=%ld, info=%p)\n",
-        handle, params, trans, n, nrhs, dataTypeA, A, lda, ipiv, dataTypeB, B, ldb, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28608,7 +29404,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrsNative(JN
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnGetrs", "trans, n, nrhs, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, params, trans, n, nrhs, dataTypeA, A, lda, ipiv, dataTypeB, B, ldb, info);
+    CallTrace callTrace(traceId, trans, n, nrhs, dataTypeA);
     cusolverStatus_t jniResult_native = cusolverDnGetrs(handle_native, params_native, trans_native, n_native, nrhs_native, dataTypeA_native, A_native, lda_native, ipiv_native, dataTypeB_native, B_native, ldb_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28629,8 +29430,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGetrsNative(JN
     jint jniResult = (jint)jniResult_native;
     return jniResult;
 }
+#endif // JCUSOLVER_FAMILY_DN
 
 /** 64-bit API for SYEVD */
+#ifdef JCUSOLVER_FAMILY_DNEIGEN
 JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevd_1bufferSizeNative(JNIEnv *env, jclass cls, jobject handle, jobject params, jint jobz, jint uplo, jlong n, jint dataTypeA, jobject A, jlong lda, jint dataTypeW, jobject W, jint computeType, jlongArray workspaceInBytes)
 {
     // Null-checks for non-primitive arguments
@@ -28667,10 +29470,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevd_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSyevd_bufferSize(handle=%p, params=%p, jobz=%d, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeW=%d, W=%p, computeType=%d, workspaceInBytes=%p)\n",
-        handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, workspaceInBytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28683,7 +29482,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevd_1bufferS
     cudaDataType dataTypeW_native;
     void * W_native = NULL;
     cudaDataType computeType_native;
-    size_t * workspaceInBytes_native = NULL;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -28697,10 +29496,15 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevd_1bufferS
     dataTypeW_native = (cudaDataType)dataTypeW;
     W_native = (void *)getPointer(env, W);
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnSyevd_bufferSize(handle_native, params_native, jobz_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeW_native, W_native, computeType_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnSyevd_bufferSize", "jobz, uplo, n, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, workspaceInBytes);
+    CallTrace callTrace(traceId, jobz, uplo, n, dataTypeA);
+    cusolverStatus_t jniResult_native = cusolverDnSyevd_bufferSize(handle_native, params_native, jobz_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeW_native, W_native, computeType_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28714,7 +29518,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevd_1bufferS
     // dataTypeW is primitive
     // W is a native pointer
     // computeType is primitive
-    // workspaceInBytes is a native pointer
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -28763,10 +29570,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevdNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSyevd(handle=%p, params=%p, jobz=%d, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeW=%d, W=%p, computeType=%d, pBuffer=%p, workspaceInBytes=%ld, info=%p)\n",
-        handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, pBuffer, workspaceInBytes, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28800,7 +29603,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevdNative(JN
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSyevd", "jobz, uplo, n, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, pBuffer, workspaceInBytes, info);
+    CallTrace callTrace(traceId, jobz, uplo, n, dataTypeA);
     cusolverStatus_t jniResult_native = cusolverDnSyevd(handle_native, params_native, jobz_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeW_native, W_native, computeType_native, pBuffer_native, workspaceInBytes_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28878,10 +29686,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevdx_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSyevdx_bufferSize(handle=%p, params=%p, jobz=%d, range=%d, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, vl=%p, vu=%p, il=%ld, iu=%ld, h_meig=%p, dataTypeW=%d, W=%p, computeType=%d, workspaceInBytes=%p)\n",
-        handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, h_meig, dataTypeW, W, computeType, workspaceInBytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -28900,7 +29704,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevdx_1buffer
     cudaDataType dataTypeW_native;
     void * W_native = NULL;
     cudaDataType computeType_native;
-    size_t * workspaceInBytes_native = NULL;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -28920,10 +29724,15 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevdx_1buffer
     dataTypeW_native = (cudaDataType)dataTypeW;
     W_native = (void *)getPointer(env, W);
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnSyevdx_bufferSize(handle_native, params_native, jobz_native, range_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, h_meig_native, dataTypeW_native, W_native, computeType_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnSyevdx_bufferSize", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, h_meig, dataTypeW, W, computeType, workspaceInBytes);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
+    cusolverStatus_t jniResult_native = cusolverDnSyevdx_bufferSize(handle_native, params_native, jobz_native, range_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, h_meig_native, dataTypeW_native, W_native, computeType_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -28943,7 +29752,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevdx_1buffer
     // dataTypeW is primitive
     // W is a native pointer
     // computeType is primitive
-    // workspaceInBytes is a native pointer
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -29010,10 +29822,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevdxNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnSyevdx(handle=%p, params=%p, jobz=%d, range=%d, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, vl=%p, vu=%p, il=%ld, iu=%ld, meig64=%p, dataTypeW=%d, W=%p, computeType=%d, pBuffer=%p, workspaceInBytes=%ld, info=%p)\n",
-        handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, meig64, dataTypeW, W, computeType, pBuffer, workspaceInBytes, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29059,7 +29867,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnSyevdxNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnSyevdx", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, meig64, dataTypeW, W, computeType, pBuffer, workspaceInBytes, info);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnSyevdx(handle_native, params_native, jobz_native, range_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig64_native, dataTypeW_native, W_native, computeType_native, pBuffer_native, workspaceInBytes_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29140,10 +29953,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGesvd_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnGesvd_bufferSize(handle=%p, params=%p, jobu=%c, jobvt=%c, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeS=%d, S=%p, dataTypeU=%d, U=%p, ldu=%ld, dataTypeVT=%d, VT=%p, ldvt=%ld, computeType=%d, workspaceInBytes=%p)\n",
-        handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, workspaceInBytes);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29163,7 +29972,7 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGesvd_1bufferS
     void * VT_native = NULL;
     int64_t ldvt_native = 0;
     cudaDataType computeType_native;
-    size_t * workspaceInBytes_native = NULL;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -29184,10 +29993,15 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGesvd_1bufferS
     VT_native = (void *)getPointer(env, VT);
     ldvt_native = (int64_t)ldvt;
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnGesvd_bufferSize(handle_native, params_native, jobu_native, jobvt_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeVT_native, VT_native, ldvt_native, computeType_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnGesvd_bufferSize", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, workspaceInBytes);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
+    cusolverStatus_t jniResult_native = cusolverDnGesvd_bufferSize(handle_native, params_native, jobu_native, jobvt_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeVT_native, VT_native, ldvt_native, computeType_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29208,7 +30022,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGesvd_1bufferS
     // VT is a native pointer
     // ldvt is primitive
     // computeType is primitive
-    // workspaceInBytes is a native pointer
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -29272,10 +30089,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGesvdNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnGesvd(handle=%p, params=%p, jobu=%c, jobvt=%c, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeS=%d, S=%p, dataTypeU=%d, U=%p, ldu=%ld, dataTypeVT=%d, VT=%p, ldvt=%ld, computeType=%d, pBuffer=%p, workspaceInBytes=%ld, info=%p)\n",
-        handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, pBuffer, workspaceInBytes, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29323,7 +30136,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGesvdNative(JN
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnGesvd", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, pBuffer, workspaceInBytes, info);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
     cusolverStatus_t jniResult_native = cusolverDnGesvd(handle_native, params_native, jobu_native, jobvt_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeVT_native, VT_native, ldvt_native, computeType_native, pBuffer_native, workspaceInBytes_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29352,11 +30170,13 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnGesvdNative(JN
     jint jniResult = (jint)jniResult_native;
     return jniResult;
 }
+#endif // JCUSOLVER_FAMILY_DNEIGEN
 
 /**
  * new 64-bit API
  */
 /** 64-bit API for POTRF */
+#ifdef JCUSOLVER_FAMILY_DN
 JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrf_1bufferSizeNative(JNIEnv *env, jclass cls, jobject handle, jobject params, jint uplo, jlong n, jint dataTypeA, jobject A, jlong lda, jint computeType, jlongArray workspaceInBytesOnDevice, jlongArray workspaceInBytesOnHost)
 {
     // Null-checks for non-primitive arguments
@@ -29391,10 +30211,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXpotrf_bufferSize(handle=%p, params=%p, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, computeType=%d, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, params, uplo, n, dataTypeA, A, lda, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29404,8 +30220,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrf_1buffer
     void * A_native = NULL;
     int64_t lda_native = 0;
     cudaDataType computeType_native;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -29416,11 +30232,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrf_1buffer
     A_native = (void *)getPointer(env, A);
     lda_native = (int64_t)lda;
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXpotrf_bufferSize(handle_native, params_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXpotrf_bufferSize", "uplo, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, uplo, n, dataTypeA, A, lda, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, uplo, n, dataTypeA, lda);
+    cusolverStatus_t jniResult_native = cusolverDnXpotrf_bufferSize(handle_native, params_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29431,8 +30252,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrf_1buffer
     // A is a native pointer
     // lda is primitive
     // computeType is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -29480,10 +30304,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXpotrf(handle=%p, params=%p, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, computeType=%d, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, info=%p)\n",
-        handle, params, uplo, n, dataTypeA, A, lda, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29515,7 +30335,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrfNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXpotrf", "uplo, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, uplo, n, dataTypeA, A, lda, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
+    CallTrace callTrace(traceId, uplo, n, dataTypeA, lda);
     cusolverStatus_t jniResult_native = cusolverDnXpotrf(handle_native, params_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29574,10 +30399,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXpotrs(handle=%p, params=%p, uplo=%d, n=%ld, nrhs=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeB=%d, B=%p, ldb=%ld, info=%p)\n",
-        handle, params, uplo, n, nrhs, dataTypeA, A, lda, dataTypeB, B, ldb, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29607,7 +30428,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXpotrsNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXpotrs", "uplo, n, nrhs, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, params, uplo, n, nrhs, dataTypeA, A, lda, dataTypeB, B, ldb, info);
+    CallTrace callTrace(traceId, uplo, n, nrhs, dataTypeA);
     cusolverStatus_t jniResult_native = cusolverDnXpotrs(handle_native, params_native, uplo_native, n_native, nrhs_native, dataTypeA_native, A_native, lda_native, dataTypeB_native, B_native, ldb_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29669,10 +30495,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgeqrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgeqrf_bufferSize(handle=%p, params=%p, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeTau=%d, tau=%p, computeType=%d, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, params, m, n, dataTypeA, A, lda, dataTypeTau, tau, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29684,8 +30506,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgeqrf_1buffer
     cudaDataType dataTypeTau_native;
     void * tau_native = NULL;
     cudaDataType computeType_native;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -29698,11 +30520,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgeqrf_1buffer
     dataTypeTau_native = (cudaDataType)dataTypeTau;
     tau_native = (void *)getPointer(env, tau);
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXgeqrf_bufferSize(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeTau_native, tau_native, computeType_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgeqrf_bufferSize", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, m, n, dataTypeA, A, lda, dataTypeTau, tau, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
+    cusolverStatus_t jniResult_native = cusolverDnXgeqrf_bufferSize(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeTau_native, tau_native, computeType_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29715,8 +30542,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgeqrf_1buffer
     // dataTypeTau is primitive
     // tau is a native pointer
     // computeType is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -29770,10 +30600,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgeqrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgeqrf(handle=%p, params=%p, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeTau=%d, tau=%p, computeType=%d, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, info=%p)\n",
-        handle, params, m, n, dataTypeA, A, lda, dataTypeTau, tau, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29809,7 +30635,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgeqrfNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgeqrf", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, m, n, dataTypeA, A, lda, dataTypeTau, tau, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
     cusolverStatus_t jniResult_native = cusolverDnXgeqrf(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeTau_native, tau_native, computeType_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29868,10 +30699,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrf_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgetrf_bufferSize(handle=%p, params=%p, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, computeType=%d, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, params, m, n, dataTypeA, A, lda, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29881,8 +30708,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrf_1buffer
     void * A_native = NULL;
     int64_t lda_native = 0;
     cudaDataType computeType_native;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -29893,11 +30720,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrf_1buffer
     A_native = (void *)getPointer(env, A);
     lda_native = (int64_t)lda;
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXgetrf_bufferSize(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgetrf_bufferSize", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, m, n, dataTypeA, A, lda, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
+    cusolverStatus_t jniResult_native = cusolverDnXgetrf_bufferSize(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, computeType_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -29908,8 +30740,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrf_1buffer
     // A is a native pointer
     // lda is primitive
     // computeType is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -29962,10 +30797,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrfNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgetrf(handle=%p, params=%p, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, ipiv=%p, computeType=%d, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, info=%p)\n",
-        handle, params, m, n, dataTypeA, A, lda, ipiv, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -29999,7 +30830,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrfNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgetrf", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, m, n, dataTypeA, A, lda, ipiv, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
     cusolverStatus_t jniResult_native = cusolverDnXgetrf(handle_native, params_native, m_native, n_native, dataTypeA_native, A_native, lda_native, ipiv_native, computeType_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -30064,10 +30900,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrsNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgetrs(handle=%p, params=%p, trans=%d, n=%ld, nrhs=%ld, dataTypeA=%d, A=%p, lda=%ld, ipiv=%p, dataTypeB=%d, B=%p, ldb=%ld, info=%p)\n",
-        handle, params, trans, n, nrhs, dataTypeA, A, lda, ipiv, dataTypeB, B, ldb, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -30099,7 +30931,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrsNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgetrs", "trans, n, nrhs, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, params, trans, n, nrhs, dataTypeA, A, lda, ipiv, dataTypeB, B, ldb, info);
+    CallTrace callTrace(traceId, trans, n, nrhs, dataTypeA);
     cusolverStatus_t jniResult_native = cusolverDnXgetrs(handle_native, params_native, trans_native, n_native, nrhs_native, dataTypeA_native, A_native, lda_native, ipiv_native, dataTypeB_native, B_native, ldb_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -30120,8 +30957,10 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgetrsNative(J
     jint jniResult = (jint)jniResult_native;
     return jniResult;
 }
+#endif // JCUSOLVER_FAMILY_DN
 
 /** 64-bit API for SYEVD */
+#ifdef JCUSOLVER_FAMILY_DNEIGEN
 JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevd_1bufferSizeNative(JNIEnv *env, jclass cls, jobject handle, jobject params, jint jobz, jint uplo, jlong n, jint dataTypeA, jobject A, jlong lda, jint dataTypeW, jobject W, jint computeType, jlongArray workspaceInBytesOnDevice, jlongArray workspaceInBytesOnHost)
 {
     // Null-checks for non-primitive arguments
@@ -30163,10 +31002,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevd_bufferSize(handle=%p, params=%p, jobz=%d, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeW=%d, W=%p, computeType=%d, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -30179,8 +31014,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevd_1buffer
     cudaDataType dataTypeW_native;
     void * W_native = NULL;
     cudaDataType computeType_native;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -30194,11 +31029,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevd_1buffer
     dataTypeW_native = (cudaDataType)dataTypeW;
     W_native = (void *)getPointer(env, W);
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXsyevd_bufferSize(handle_native, params_native, jobz_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeW_native, W_native, computeType_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevd_bufferSize", "jobz, uplo, n, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, jobz, uplo, n, dataTypeA);
+    cusolverStatus_t jniResult_native = cusolverDnXsyevd_bufferSize(handle_native, params_native, jobz_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeW_native, W_native, computeType_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -30212,8 +31052,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevd_1buffer
     // dataTypeW is primitive
     // W is a native pointer
     // computeType is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -30268,10 +31111,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevd(handle=%p, params=%p, jobz=%d, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeW=%d, W=%p, computeType=%d, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, info=%p)\n",
-        handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -30309,7 +31148,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevd", "jobz, uplo, n, dataTypeA");
+    CallCapture callCapture(env, traceId, handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
+    CallTrace callTrace(traceId, jobz, uplo, n, dataTypeA);
     cusolverStatus_t jniResult_native = cusolverDnXsyevd(handle_native, params_native, jobz_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeW_native, W_native, computeType_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -30394,10 +31238,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevdx_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevdx_bufferSize(handle=%p, params=%p, jobz=%d, range=%d, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, vl=%p, vu=%p, il=%ld, iu=%ld, h_meig=%p, dataTypeW=%d, W=%p, computeType=%d, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, h_meig, dataTypeW, W, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -30416,8 +31256,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevdx_1buffe
     cudaDataType dataTypeW_native;
     void * W_native = NULL;
     cudaDataType computeType_native;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -30437,11 +31277,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevdx_1buffe
     dataTypeW_native = (cudaDataType)dataTypeW;
     W_native = (void *)getPointer(env, W);
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXsyevdx_bufferSize(handle_native, params_native, jobz_native, range_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, h_meig_native, dataTypeW_native, W_native, computeType_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevdx_bufferSize", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, h_meig, dataTypeW, W, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
+    cusolverStatus_t jniResult_native = cusolverDnXsyevdx_bufferSize(handle_native, params_native, jobz_native, range_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, h_meig_native, dataTypeW_native, W_native, computeType_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -30461,8 +31306,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevdx_1buffe
     // dataTypeW is primitive
     // W is a native pointer
     // computeType is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -30535,10 +31383,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevdxNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXsyevdx(handle=%p, params=%p, jobz=%d, range=%d, uplo=%d, n=%ld, dataTypeA=%d, A=%p, lda=%ld, vl=%p, vu=%p, il=%ld, iu=%ld, meig64=%p, dataTypeW=%d, W=%p, computeType=%d, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, info=%p)\n",
-        handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, meig64, dataTypeW, W, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -30588,7 +31432,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXsyevdxNative(
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXsyevdx", "jobz, range, uplo, n");
+    CallCapture callCapture(env, traceId, handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, meig64, dataTypeW, W, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
+    CallTrace callTrace(traceId, jobz, range, uplo, n);
     cusolverStatus_t jniResult_native = cusolverDnXsyevdx(handle_native, params_native, jobz_native, range_native, uplo_native, n_native, dataTypeA_native, A_native, lda_native, vl_native, vu_native, il_native, iu_native, meig64_native, dataTypeW_native, W_native, computeType_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -30676,10 +31525,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvd_1buffer
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvd_bufferSize(handle=%p, params=%p, jobu=%c, jobvt=%c, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeS=%d, S=%p, dataTypeU=%d, U=%p, ldu=%ld, dataTypeVT=%d, VT=%p, ldvt=%ld, computeType=%d, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -30699,8 +31544,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvd_1buffer
     void * VT_native = NULL;
     int64_t ldvt_native = 0;
     cudaDataType computeType_native;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -30721,11 +31566,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvd_1buffer
     VT_native = (void *)getPointer(env, VT);
     ldvt_native = (int64_t)ldvt;
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXgesvd_bufferSize(handle_native, params_native, jobu_native, jobvt_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeVT_native, VT_native, ldvt_native, computeType_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvd_bufferSize", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
+    cusolverStatus_t jniResult_native = cusolverDnXgesvd_bufferSize(handle_native, params_native, jobu_native, jobvt_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeVT_native, VT_native, ldvt_native, computeType_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -30746,8 +31596,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvd_1buffer
     // VT is a native pointer
     // ldvt is primitive
     // computeType is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -30817,10 +31670,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvd(handle=%p, params=%p, jobu=%c, jobvt=%c, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeS=%d, S=%p, dataTypeU=%d, U=%p, ldu=%ld, dataTypeVT=%d, VT=%p, ldvt=%ld, computeType=%d, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, info=%p)\n",
-        handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -30872,7 +31721,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdNative(J
     info_native = (int *)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvd", "m, n, dataTypeA, lda");
+    CallCapture callCapture(env, traceId, handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info);
+    CallTrace callTrace(traceId, m, n, dataTypeA, lda);
     cusolverStatus_t jniResult_native = cusolverDnXgesvd(handle_native, params_native, jobu_native, jobvt_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeVT_native, VT_native, ldvt_native, computeType_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -30961,10 +31815,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdp_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdp_bufferSize(handle=%p, params=%p, jobz=%d, econ=%d, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeS=%d, S=%p, dataTypeU=%d, U=%p, ldu=%ld, dataTypeV=%d, V=%p, ldv=%ld, computeType=%d, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, params, jobz, econ, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeV, V, ldv, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -30984,8 +31834,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdp_1buffe
     void * V_native = NULL;
     int64_t ldv_native = 0;
     cudaDataType computeType_native;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -31006,11 +31856,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdp_1buffe
     V_native = (void *)getPointer(env, V);
     ldv_native = (int64_t)ldv;
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXgesvdp_bufferSize(handle_native, params_native, jobz_native, econ_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeV_native, V_native, ldv_native, computeType_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdp_bufferSize", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, params, jobz, econ, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeV, V, ldv, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
+    cusolverStatus_t jniResult_native = cusolverDnXgesvdp_bufferSize(handle_native, params_native, jobz_native, econ_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeV_native, V_native, ldv_native, computeType_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -31031,8 +31886,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdp_1buffe
     // V is a native pointer
     // ldv is primitive
     // computeType is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -31107,10 +31965,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdpNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdp(handle=%p, params=%p, jobz=%d, econ=%d, m=%ld, n=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeS=%d, S=%p, dataTypeU=%d, U=%p, ldu=%ld, dataTypeV=%d, V=%p, ldv=%ld, computeType=%d, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, d_info=%p, h_err_sigma=%p)\n",
-        handle, params, jobz, econ, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeV, V, ldv, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, d_info, h_err_sigma);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -31164,7 +32018,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdpNative(
     h_err_sigma_native = (double *)getPointer(env, h_err_sigma);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdp", "jobz, econ, m, n");
+    CallCapture callCapture(env, traceId, handle, params, jobz, econ, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeV, V, ldv, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, d_info, h_err_sigma);
+    CallTrace callTrace(traceId, jobz, econ, m, n);
     cusolverStatus_t jniResult_native = cusolverDnXgesvdp(handle_native, params_native, jobz_native, econ_native, m_native, n_native, dataTypeA_native, A_native, lda_native, dataTypeS_native, S_native, dataTypeU_native, U_native, ldu_native, dataTypeV_native, V_native, ldv_native, computeType_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, d_info_native, h_err_sigma_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -31256,10 +32115,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdr_1buffe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdr_bufferSize(handle=%p, params=%p, jobu=%c, jobv=%c, m=%ld, n=%ld, k=%ld, p=%ld, niters=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeSrand=%d, Srand=%p, dataTypeUrand=%d, Urand=%p, ldUrand=%ld, dataTypeVrand=%d, Vrand=%p, ldVrand=%ld, computeType=%d, workspaceInBytesOnDevice=%p, workspaceInBytesOnHost=%p)\n",
-        handle, params, jobu, jobv, m, n, k, p, niters, dataTypeA, A, lda, dataTypeSrand, Srand, dataTypeUrand, Urand, ldUrand, dataTypeVrand, Vrand, ldVrand, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -31282,8 +32137,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdr_1buffe
     void * Vrand_native = NULL;
     int64_t ldVrand_native = 0;
     cudaDataType computeType_native;
-    size_t * workspaceInBytesOnDevice_native = NULL;
-    size_t * workspaceInBytesOnHost_native = NULL;
+    size_t workspaceInBytesOnDevice_native;
+    size_t workspaceInBytesOnHost_native;
 
     // Obtain native variable values
     handle_native = (cusolverDnHandle_t)getNativePointerValue(env, handle);
@@ -31307,11 +32162,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdr_1buffe
     Vrand_native = (void *)getPointer(env, Vrand);
     ldVrand_native = (int64_t)ldVrand;
     computeType_native = (cudaDataType)computeType;
-    workspaceInBytesOnDevice_native = (size_t *)getPointer(env, workspaceInBytesOnDevice);
-    workspaceInBytesOnHost_native = (size_t *)getPointer(env, workspaceInBytesOnHost);
+    // workspaceInBytesOnDevice is write-only
+    // workspaceInBytesOnHost is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverDnXgesvdr_bufferSize(handle_native, params_native, jobu_native, jobv_native, m_native, n_native, k_native, p_native, niters_native, dataTypeA_native, A_native, lda_native, dataTypeSrand_native, Srand_native, dataTypeUrand_native, Urand_native, ldUrand_native, dataTypeVrand_native, Vrand_native, ldVrand_native, computeType_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native);
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdr_bufferSize", "m, n, k, p");
+    CallCapture callCapture(env, traceId, handle, params, jobu, jobv, m, n, k, p, niters, dataTypeA, A, lda, dataTypeSrand, Srand, dataTypeUrand, Urand, ldUrand, dataTypeVrand, Vrand, ldVrand, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost);
+    CallTrace callTrace(traceId, m, n, k, p);
+    cusolverStatus_t jniResult_native = cusolverDnXgesvdr_bufferSize(handle_native, params_native, jobu_native, jobv_native, m_native, n_native, k_native, p_native, niters_native, dataTypeA_native, A_native, lda_native, dataTypeSrand_native, Srand_native, dataTypeUrand_native, Urand_native, ldUrand_native, dataTypeVrand_native, Vrand_native, ldVrand_native, computeType_native, &workspaceInBytesOnDevice_native, &workspaceInBytesOnHost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -31335,8 +32195,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdr_1buffe
     // Vrand is a native pointer
     // ldVrand is primitive
     // computeType is primitive
-    // workspaceInBytesOnDevice is a native pointer
-    // workspaceInBytesOnHost is a native pointer
+    if (!set(env, workspaceInBytesOnDevice, 0, (jlong)workspaceInBytesOnDevice_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytesOnHost, 0, (jlong)workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, workspaceInBytesOnDevice_native, workspaceInBytesOnHost_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -31409,10 +32272,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdrNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverDnXgesvdr(handle=%p, params=%p, jobu=%c, jobv=%c, m=%ld, n=%ld, k=%ld, p=%ld, niters=%ld, dataTypeA=%d, A=%p, lda=%ld, dataTypeSrand=%d, Srand=%p, dataTypeUrand=%d, Urand=%p, ldUrand=%ld, dataTypeVrand=%d, Vrand=%p, ldVrand=%ld, computeType=%d, bufferOnDevice=%p, workspaceInBytesOnDevice=%ld, bufferOnHost=%p, workspaceInBytesOnHost=%ld, d_info=%p)\n",
-        handle, params, jobu, jobv, m, n, k, p, niters, dataTypeA, A, lda, dataTypeSrand, Srand, dataTypeUrand, Urand, ldUrand, dataTypeVrand, Vrand, ldVrand, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, d_info);
-
     // Native variable declarations
     cusolverDnHandle_t handle_native;
     cusolverDnParams_t params_native;
@@ -31470,7 +32329,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdrNative(
     d_info_native = (int *)getPointer(env, d_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverDnXgesvdr", "m, n, k, p");
+    CallCapture callCapture(env, traceId, handle, params, jobu, jobv, m, n, k, p, niters, dataTypeA, A, lda, dataTypeSrand, Srand, dataTypeUrand, Urand, ldUrand, dataTypeVrand, Vrand, ldVrand, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, d_info);
+    CallTrace callTrace(traceId, m, n, k, p);
     cusolverStatus_t jniResult_native = cusolverDnXgesvdr(handle_native, params_native, jobu_native, jobv_native, m_native, n_native, k_native, p_native, niters_native, dataTypeA_native, A_native, lda_native, dataTypeSrand_native, Srand_native, dataTypeUrand_native, Urand_native, ldUrand_native, dataTypeVrand_native, Vrand_native, ldVrand_native, computeType_native, bufferOnDevice_native, workspaceInBytesOnDevice_native, bufferOnHost_native, workspaceInBytesOnHost_native, d_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -31504,4 +32368,5 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverDn_cusolverDnXgesvdrNative(
     jint jniResult = (jint)jniResult_native;
     return jniResult;
 }
+#endif // JCUSOLVER_FAMILY_DNEIGEN
 
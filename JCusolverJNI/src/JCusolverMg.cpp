@@ -45,10 +45,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgCreateNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgCreate(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
 
@@ -56,7 +52,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgCreateNative(J
     // handle is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgCreate", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverMgCreate(&handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, handle, (jlong)handle_native);
@@ -75,10 +76,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgDestroyNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgDestroy(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
 
@@ -86,11 +83,19 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgDestroyNative(
     handle_native = (cusolverMgHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgDestroy", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverMgDestroy(handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
 
+    // Workspace accounting
+    if (jniResult_native == CUSOLVER_STATUS_SUCCESS) WorkspaceAccounting::release(handle_native);
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -111,10 +116,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgDeviceSelectNa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgDeviceSelect(handle=%p, nbDevices=%d, deviceId=%p)\n",
-        handle, nbDevices, deviceId);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     int nbDevices_native = 0;
@@ -126,13 +127,21 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgDeviceSelectNa
     if (!initNative(env, deviceId, deviceId_native, true)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgDeviceSelect", "nbDevices");
+    CallCapture callCapture(env, traceId, handle, nbDevices, deviceId);
+    CallTrace callTrace(traceId, nbDevices);
     cusolverStatus_t jniResult_native = cusolverMgDeviceSelect(handle_native, nbDevices_native, deviceId_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
     // nbDevices is primitive
     if (!releaseNative(env, deviceId_native, deviceId, true)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (jniResult_native == CUSOLVER_STATUS_SUCCESS) WorkspaceAccounting::setDeviceCount(handle_native, nbDevices_native);
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -167,10 +176,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgCreateDeviceGr
     }
     // mapping is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgCreateDeviceGrid(grid=%p, numRowDevices=%d, numColDevices=%d, deviceId=%p, mapping=%d)\n",
-        grid, numRowDevices, numColDevices, deviceId, mapping);
-
     // Native variable declarations
     cudaLibMgGrid_t grid_native;
     int32_t numRowDevices_native = 0;
@@ -186,7 +191,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgCreateDeviceGr
     mapping_native = (cusolverMgGridMapping_t)mapping;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgCreateDeviceGrid", "numRowDevices, numColDevices, mapping");
+    CallCapture callCapture(env, traceId, grid, numRowDevices, numColDevices, deviceId, mapping);
+    CallTrace callTrace(traceId, numRowDevices, numColDevices, mapping);
     cusolverStatus_t jniResult_native = cusolverMgCreateDeviceGrid(&grid_native, numRowDevices_native, numColDevices_native, deviceId_native, mapping_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, grid, (jlong)grid_native);
@@ -216,10 +226,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgDestroyGridNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgDestroyGrid(grid=%p)\n",
-        grid);
-
     // Native variable declarations
     cudaLibMgGrid_t grid_native;
 
@@ -227,7 +233,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgDestroyGridNat
     grid_native = (cudaLibMgGrid_t)getNativePointerValue(env, grid);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgDestroyGrid", "");
+    CallCapture callCapture(env, traceId, grid);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverMgDestroyGrid(grid_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // grid is read-only
@@ -269,10 +280,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgCreateMatrixDe
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgCreateMatrixDesc(desc=%p, numRows=%ld, numCols=%ld, rowBlockSize=%ld, colBlockSize=%ld, dataType=%d, grid=%p)\n",
-        desc, numRows, numCols, rowBlockSize, colBlockSize, dataType, grid);
-
     // Native variable declarations
     cudaLibMgMatrixDesc_t desc_native;
     int64_t numRows_native = 0;
@@ -292,7 +299,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgCreateMatrixDe
     grid_native = (cudaLibMgGrid_t)getNativePointerValue(env, grid);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgCreateMatrixDesc", "numRows, numCols, rowBlockSize, colBlockSize");
+    CallCapture callCapture(env, traceId, desc, numRows, numCols, rowBlockSize, colBlockSize, dataType, grid);
+    CallTrace callTrace(traceId, numRows, numCols, rowBlockSize, colBlockSize);
     cusolverStatus_t jniResult_native = cusolverMgCreateMatrixDesc(&desc_native, numRows_native, numCols_native, rowBlockSize_native, colBlockSize_native, dataType_native, grid_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, desc, (jlong)desc_native);
@@ -324,10 +336,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgDestroyMatrixD
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgDestroyMatrixDesc(desc=%p)\n",
-        desc);
-
     // Native variable declarations
     cudaLibMgMatrixDesc_t desc_native;
 
@@ -335,7 +343,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgDestroyMatrixD
     desc_native = (cudaLibMgMatrixDesc_t)getNativePointerValue(env, desc);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgDestroyMatrixDesc", "");
+    CallCapture callCapture(env, traceId, desc);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverMgDestroyMatrixDesc(desc_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // desc is read-only
@@ -381,10 +394,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgSyevd_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgSyevd_bufferSize(handle=%p, jobz=%d, uplo=%d, N=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, W=%p, dataTypeW=%d, computeType=%d, lwork=%p)\n",
-        handle, jobz, uplo, N, array_d_A, IA, JA, descrA, W, dataTypeW, computeType, lwork);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -414,7 +423,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgSyevd_1bufferS
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgSyevd_bufferSize", "jobz, uplo, N, IA");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, N, array_d_A, IA, JA, descrA, W, dataTypeW, computeType, lwork);
+    CallTrace callTrace(traceId, jobz, uplo, N, IA);
     cusolverStatus_t jniResult_native = cusolverMgSyevd_bufferSize(handle_native, jobz_native, uplo_native, N_native, array_d_A_native, IA_native, JA_native, descrA_native, W_native, dataTypeW_native, computeType_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -430,6 +444,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgSyevd_1bufferS
     // computeType is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::accountPerDevice(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * WorkspaceAccounting::elementSize(computeType_native))) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -477,10 +494,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgSyevdNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgSyevd(handle=%p, jobz=%d, uplo=%d, N=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, W=%p, dataTypeW=%d, computeType=%d, array_d_work=%p, lwork=%ld, info=%p)\n",
-        handle, jobz, uplo, N, array_d_A, IA, JA, descrA, W, dataTypeW, computeType, array_d_work, lwork, info);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cusolverEigMode_t jobz_native;
@@ -514,7 +527,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgSyevdNative(JN
     info_native = (int*)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgSyevd", "jobz, uplo, N, IA");
+    CallCapture callCapture(env, traceId, handle, jobz, uplo, N, array_d_A, IA, JA, descrA, W, dataTypeW, computeType, array_d_work, lwork, info);
+    CallTrace callTrace(traceId, jobz, uplo, N, IA);
     cusolverStatus_t jniResult_native = cusolverMgSyevd(handle_native, jobz_native, uplo_native, N_native, array_d_A_native, IA_native, JA_native, descrA_native, W_native, dataTypeW_native, computeType_native, array_d_work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -567,10 +585,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrf_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgGetrf_bufferSize(handle=%p, M=%d, N=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, array_d_IPIV=%p, computeType=%d, lwork=%p)\n",
-        handle, M, N, array_d_A, IA, JA, descrA, array_d_IPIV, computeType, lwork);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     int M_native = 0;
@@ -596,7 +610,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrf_1bufferS
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgGetrf_bufferSize", "M, N, IA, JA");
+    CallCapture callCapture(env, traceId, handle, M, N, array_d_A, IA, JA, descrA, array_d_IPIV, computeType, lwork);
+    CallTrace callTrace(traceId, M, N, IA, JA);
     cusolverStatus_t jniResult_native = cusolverMgGetrf_bufferSize(handle_native, M_native, N_native, array_d_A_native, IA_native, JA_native, descrA_native, array_d_IPIV_native, computeType_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -610,6 +629,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrf_1bufferS
     // computeType is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::accountPerDevice(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * WorkspaceAccounting::elementSize(computeType_native))) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -651,10 +673,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrfNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgGetrf(handle=%p, M=%d, N=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, array_d_IPIV=%p, computeType=%d, array_d_work=%p, lwork=%ld, info=%p)\n",
-        handle, M, N, array_d_A, IA, JA, descrA, array_d_IPIV, computeType, array_d_work, lwork, info);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     int M_native = 0;
@@ -684,7 +702,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrfNative(JN
     info_native = (int*)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgGetrf", "M, N, IA, JA");
+    CallCapture callCapture(env, traceId, handle, M, N, array_d_A, IA, JA, descrA, array_d_IPIV, computeType, array_d_work, lwork, info);
+    CallTrace callTrace(traceId, M, N, IA, JA);
     cusolverStatus_t jniResult_native = cusolverMgGetrf(handle_native, M_native, N_native, array_d_A_native, IA_native, JA_native, descrA_native, array_d_IPIV_native, computeType_native, array_d_work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -752,10 +775,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrs_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgGetrs_bufferSize(handle=%p, TRANS=%d, N=%d, NRHS=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, array_d_IPIV=%p, array_d_B=%p, IB=%d, JB=%d, descrB=%p, computeType=%d, lwork=%p)\n",
-        handle, TRANS, N, NRHS, array_d_A, IA, JA, descrA, array_d_IPIV, array_d_B, IB, JB, descrB, computeType, lwork);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cublasOperation_t TRANS_native;
@@ -791,7 +810,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrs_1bufferS
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgGetrs_bufferSize", "TRANS, N, NRHS, IA");
+    CallCapture callCapture(env, traceId, handle, TRANS, N, NRHS, array_d_A, IA, JA, descrA, array_d_IPIV, array_d_B, IB, JB, descrB, computeType, lwork);
+    CallTrace callTrace(traceId, TRANS, N, NRHS, IA);
     cusolverStatus_t jniResult_native = cusolverMgGetrs_bufferSize(handle_native, TRANS_native, N_native, NRHS_native, array_d_A_native, IA_native, JA_native, descrA_native, array_d_IPIV_native, array_d_B_native, IB_native, JB_native, descrB_native, computeType_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -810,6 +834,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrs_1bufferS
     // computeType is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::accountPerDevice(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * WorkspaceAccounting::elementSize(computeType_native))) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -868,10 +895,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrsNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgGetrs(handle=%p, TRANS=%d, N=%d, NRHS=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, array_d_IPIV=%p, array_d_B=%p, IB=%d, JB=%d, descrB=%p, computeType=%d, array_d_work=%p, lwork=%ld, info=%p)\n",
-        handle, TRANS, N, NRHS, array_d_A, IA, JA, descrA, array_d_IPIV, array_d_B, IB, JB, descrB, computeType, array_d_work, lwork, info);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cublasOperation_t TRANS_native;
@@ -911,7 +934,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgGetrsNative(JN
     info_native = (int*)getPointer(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgGetrs", "TRANS, N, NRHS, IA");
+    CallCapture callCapture(env, traceId, handle, TRANS, N, NRHS, array_d_A, IA, JA, descrA, array_d_IPIV, array_d_B, IB, JB, descrB, computeType, array_d_work, lwork, info);
+    CallTrace callTrace(traceId, TRANS, N, NRHS, IA);
     cusolverStatus_t jniResult_native = cusolverMgGetrs(handle_native, TRANS_native, N_native, NRHS_native, array_d_A_native, IA_native, JA_native, descrA_native, array_d_IPIV_native, array_d_B_native, IB_native, JB_native, descrB_native, computeType_native, array_d_work_native, lwork_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -966,10 +994,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrf_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgPotrf_bufferSize(handle=%p, uplo=%d, N=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, computeType=%d, lwork=%p)\n",
-        handle, uplo, N, array_d_A, IA, JA, descrA, computeType, lwork);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -993,7 +1017,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrf_1bufferS
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgPotrf_bufferSize", "uplo, N, IA, JA");
+    CallCapture callCapture(env, traceId, handle, uplo, N, array_d_A, IA, JA, descrA, computeType, lwork);
+    CallTrace callTrace(traceId, uplo, N, IA, JA);
     cusolverStatus_t jniResult_native = cusolverMgPotrf_bufferSize(handle_native, uplo_native, N_native, array_d_A_native, IA_native, JA_native, descrA_native, computeType_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1006,6 +1035,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrf_1bufferS
     // computeType is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::accountPerDevice(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * WorkspaceAccounting::elementSize(computeType_native))) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -1046,10 +1078,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrfNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgPotrf(handle=%p, uplo=%d, N=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, computeType=%d, array_d_work=%p, lwork=%ld, h_info=%p)\n",
-        handle, uplo, N, array_d_A, IA, JA, descrA, computeType, array_d_work, lwork, h_info);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -1077,7 +1105,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrfNative(JN
     h_info_native = (int*)getPointer(env, h_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgPotrf", "uplo, N, IA, JA");
+    CallCapture callCapture(env, traceId, handle, uplo, N, array_d_A, IA, JA, descrA, computeType, array_d_work, lwork, h_info);
+    CallTrace callTrace(traceId, uplo, N, IA, JA);
     cusolverStatus_t jniResult_native = cusolverMgPotrf(handle_native, uplo_native, N_native, array_d_A_native, IA_native, JA_native, descrA_native, computeType_native, array_d_work_native, lwork_native, h_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1139,10 +1172,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrs_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgPotrs_bufferSize(handle=%p, uplo=%d, n=%d, nrhs=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, array_d_B=%p, IB=%d, JB=%d, descrB=%p, computeType=%d, lwork=%p)\n",
-        handle, uplo, n, nrhs, array_d_A, IA, JA, descrA, array_d_B, IB, JB, descrB, computeType, lwork);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -1176,7 +1205,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrs_1bufferS
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgPotrs_bufferSize", "uplo, n, nrhs, IA");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, array_d_A, IA, JA, descrA, array_d_B, IB, JB, descrB, computeType, lwork);
+    CallTrace callTrace(traceId, uplo, n, nrhs, IA);
     cusolverStatus_t jniResult_native = cusolverMgPotrs_bufferSize(handle_native, uplo_native, n_native, nrhs_native, array_d_A_native, IA_native, JA_native, descrA_native, array_d_B_native, IB_native, JB_native, descrB_native, computeType_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1194,6 +1228,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrs_1bufferS
     // computeType is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::accountPerDevice(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * WorkspaceAccounting::elementSize(computeType_native))) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -1247,10 +1284,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrsNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgPotrs(handle=%p, uplo=%d, n=%d, nrhs=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, array_d_B=%p, IB=%d, JB=%d, descrB=%p, computeType=%d, array_d_work=%p, lwork=%ld, h_info=%p)\n",
-        handle, uplo, n, nrhs, array_d_A, IA, JA, descrA, array_d_B, IB, JB, descrB, computeType, array_d_work, lwork, h_info);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -1288,7 +1321,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotrsNative(JN
     h_info_native = (int*)getPointer(env, h_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgPotrs", "uplo, n, nrhs, IA");
+    CallCapture callCapture(env, traceId, handle, uplo, n, nrhs, array_d_A, IA, JA, descrA, array_d_B, IB, JB, descrB, computeType, array_d_work, lwork, h_info);
+    CallTrace callTrace(traceId, uplo, n, nrhs, IA);
     cusolverStatus_t jniResult_native = cusolverMgPotrs(handle_native, uplo_native, n_native, nrhs_native, array_d_A_native, IA_native, JA_native, descrA_native, array_d_B_native, IB_native, JB_native, descrB_native, computeType_native, array_d_work_native, lwork_native, h_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1342,10 +1380,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotri_1bufferS
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgPotri_bufferSize(handle=%p, uplo=%d, N=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, computeType=%d, lwork=%p)\n",
-        handle, uplo, N, array_d_A, IA, JA, descrA, computeType, lwork);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -1369,7 +1403,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotri_1bufferS
     // lwork is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgPotri_bufferSize", "uplo, N, IA, JA");
+    CallCapture callCapture(env, traceId, handle, uplo, N, array_d_A, IA, JA, descrA, computeType, lwork);
+    CallTrace callTrace(traceId, uplo, N, IA, JA);
     cusolverStatus_t jniResult_native = cusolverMgPotri_bufferSize(handle_native, uplo_native, N_native, array_d_A_native, IA_native, JA_native, descrA_native, computeType_native, &lwork_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1382,6 +1421,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotri_1bufferS
     // computeType is primitive
     if (!set(env, lwork, 0, (jint)lwork_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::accountPerDevice(env, traceId, jniResult_native, handle_native, (uint64_t)lwork_native * WorkspaceAccounting::elementSize(computeType_native))) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -1422,10 +1464,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotriNative(JN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverMgPotri(handle=%p, uplo=%d, N=%d, array_d_A=%p, IA=%d, JA=%d, descrA=%p, computeType=%d, array_d_work=%p, lwork=%ld, h_info=%p)\n",
-        handle, uplo, N, array_d_A, IA, JA, descrA, computeType, array_d_work, lwork, h_info);
-
     // Native variable declarations
     cusolverMgHandle_t handle_native;
     cublasFillMode_t uplo_native;
@@ -1453,7 +1491,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverMg_cusolverMgPotriNative(JN
     h_info_native = (int*)getPointer(env, h_info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverMgPotri", "uplo, N, IA, JA");
+    CallCapture callCapture(env, traceId, handle, uplo, N, array_d_A, IA, JA, descrA, computeType, array_d_work, lwork, h_info);
+    CallTrace callTrace(traceId, uplo, N, IA, JA);
     cusolverStatus_t jniResult_native = cusolverMgPotri(handle_native, uplo_native, N_native, array_d_A_native, IA_native, JA_native, descrA_native, computeType_native, array_d_work_native, lwork_native, h_info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
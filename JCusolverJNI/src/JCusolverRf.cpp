@@ -46,10 +46,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfCreateNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfCreate(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
 
@@ -57,7 +53,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfCreateNative(J
     // handle is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfCreate", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfCreate(&handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, handle, (jlong)handle_native);
@@ -76,10 +77,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfDestroyNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfDestroy(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
 
@@ -87,7 +84,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfDestroyNative(
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfDestroy", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfDestroy(handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -117,10 +119,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetMatrixForma
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfGetMatrixFormat(handle=%p, format=%p, diag=%p)\n",
-        handle, format, diag);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     cusolverRfMatrixFormat_t format_native;
@@ -132,7 +130,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetMatrixForma
     // diag is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfGetMatrixFormat", "");
+    CallCapture callCapture(env, traceId, handle, format, diag);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfGetMatrixFormat(handle_native, &format_native, &diag_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -155,10 +158,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetMatrixForma
     // format is primitive
     // diag is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfSetMatrixFormat(handle=%p, format=%d, diag=%d)\n",
-        handle, format, diag);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     cusolverRfMatrixFormat_t format_native;
@@ -170,7 +169,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetMatrixForma
     diag_native = (cusolverRfUnitDiagonal_t)diag;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfSetMatrixFormat", "format, diag");
+    CallCapture callCapture(env, traceId, handle, format, diag);
+    CallTrace callTrace(traceId, format, diag);
     cusolverStatus_t jniResult_native = cusolverRfSetMatrixFormat(handle_native, format_native, diag_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -194,10 +198,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetNumericProp
     // zero is primitive
     // boost is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfSetNumericProperties(handle=%p, zero=%lf, boost=%lf)\n",
-        handle, zero, boost);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     double zero_native = 0.0;
@@ -209,7 +209,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetNumericProp
     boost_native = (double)boost;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfSetNumericProperties", "");
+    CallCapture callCapture(env, traceId, handle, zero, boost);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfSetNumericProperties(handle_native, zero_native, boost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -240,10 +245,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetNumericProp
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfGetNumericProperties(handle=%p, zero=%p, boost=%p)\n",
-        handle, zero, boost);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     double zero_native;
@@ -255,7 +256,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetNumericProp
     // boost is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfGetNumericProperties", "");
+    CallCapture callCapture(env, traceId, handle, zero, boost);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfGetNumericProperties(handle_native, &zero_native, &boost_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -281,10 +287,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetNumericBoos
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfGetNumericBoostReport(handle=%p, report=%p)\n",
-        handle, report);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     cusolverRfNumericBoostReport_t report_native;
@@ -294,7 +296,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetNumericBoos
     // report is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfGetNumericBoostReport", "");
+    CallCapture callCapture(env, traceId, handle, report);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfGetNumericBoostReport(handle_native, &report_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -317,10 +324,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetAlgsNative(
     // factAlg is primitive
     // solveAlg is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfSetAlgs(handle=%p, factAlg=%d, solveAlg=%d)\n",
-        handle, factAlg, solveAlg);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     cusolverRfFactorization_t factAlg_native;
@@ -332,7 +335,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetAlgsNative(
     solveAlg_native = (cusolverRfTriangularSolve_t)solveAlg;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfSetAlgs", "factAlg, solveAlg");
+    CallCapture callCapture(env, traceId, handle, factAlg, solveAlg);
+    CallTrace callTrace(traceId, factAlg, solveAlg);
     cusolverStatus_t jniResult_native = cusolverRfSetAlgs(handle_native, factAlg_native, solveAlg_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -363,10 +371,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetAlgsNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfGetAlgs(handle=%p, factAlg=%p, solveAlg=%p)\n",
-        handle, factAlg, solveAlg);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     cusolverRfFactorization_t factAlg_native;
@@ -378,7 +382,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetAlgsNative(
     // solveAlg is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfGetAlgs", "");
+    CallCapture callCapture(env, traceId, handle, factAlg, solveAlg);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfGetAlgs(handle_native, &factAlg_native, &solveAlg_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -405,10 +414,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetResetValues
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfGetResetValuesFastMode(handle=%p, fastMode=%p)\n",
-        handle, fastMode);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     cusolverRfResetValuesFastMode_t fastMode_native;
@@ -418,7 +423,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfGetResetValues
     // fastMode is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfGetResetValuesFastMode", "");
+    CallCapture callCapture(env, traceId, handle, fastMode);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfGetResetValuesFastMode(handle_native, &fastMode_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -439,10 +449,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetResetValues
     }
     // fastMode is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfSetResetValuesFastMode(handle=%p, fastMode=%d)\n",
-        handle, fastMode);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     cusolverRfResetValuesFastMode_t fastMode_native;
@@ -452,7 +458,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetResetValues
     fastMode_native = (cusolverRfResetValuesFastMode_t)fastMode;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfSetResetValuesFastMode", "fastMode");
+    CallCapture callCapture(env, traceId, handle, fastMode);
+    CallTrace callTrace(traceId, fastMode);
     cusolverStatus_t jniResult_native = cusolverRfSetResetValuesFastMode(handle_native, fastMode_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -533,10 +544,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetupHostNativ
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfSetupHost(n=%d, nnzA=%d, h_csrRowPtrA=%p, h_csrColIndA=%p, h_csrValA=%p, nnzL=%d, h_csrRowPtrL=%p, h_csrColIndL=%p, h_csrValL=%p, nnzU=%d, h_csrRowPtrU=%p, h_csrColIndU=%p, h_csrValU=%p, h_P=%p, h_Q=%p, handle=%p)\n",
-        n, nnzA, h_csrRowPtrA, h_csrColIndA, h_csrValA, nnzL, h_csrRowPtrL, h_csrColIndL, h_csrValL, nnzU, h_csrRowPtrU, h_csrColIndU, h_csrValU, h_P, h_Q, handle);
-
     // Native variable declarations
     int n_native = 0;
     int nnzA_native = 0;
@@ -629,7 +636,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetupHostNativ
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfSetupHost", "n, nnzA, nnzL, nnzU");
+    CallCapture callCapture(env, traceId, n, nnzA, h_csrRowPtrA, h_csrColIndA, h_csrValA, nnzL, h_csrRowPtrL, h_csrColIndL, h_csrValL, nnzU, h_csrRowPtrU, h_csrColIndU, h_csrValU, h_P, h_Q, handle);
+    CallTrace callTrace(traceId, n, nnzA, nnzL, nnzU);
     cusolverStatus_t jniResult_native = cusolverRfSetupHost(n_native, nnzA_native, h_csrRowPtrA_native, h_csrColIndA_native, h_csrValA_native, nnzL_native, h_csrRowPtrL_native, h_csrColIndL_native, h_csrValL_native, nnzU_native, h_csrRowPtrU_native, h_csrColIndU_native, h_csrValU_native, h_P_native, h_Q_native, handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // n is primitive
@@ -777,10 +789,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetupDeviceNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfSetupDevice(n=%d, nnzA=%d, csrRowPtrA=%p, csrColIndA=%p, csrValA=%p, nnzL=%d, csrRowPtrL=%p, csrColIndL=%p, csrValL=%p, nnzU=%d, csrRowPtrU=%p, csrColIndU=%p, csrValU=%p, P=%p, Q=%p, handle=%p)\n",
-        n, nnzA, csrRowPtrA, csrColIndA, csrValA, nnzL, csrRowPtrL, csrColIndL, csrValL, nnzU, csrRowPtrU, csrColIndU, csrValU, P, Q, handle);
-
     // Native variable declarations
     int n_native = 0;
     int nnzA_native = 0;
@@ -818,7 +826,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSetupDeviceNat
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfSetupDevice", "n, nnzA, nnzL, nnzU");
+    CallCapture callCapture(env, traceId, n, nnzA, csrRowPtrA, csrColIndA, csrValA, nnzL, csrRowPtrL, csrColIndL, csrValL, nnzU, csrRowPtrU, csrColIndU, csrValU, P, Q, handle);
+    CallTrace callTrace(traceId, n, nnzA, nnzL, nnzU);
     cusolverStatus_t jniResult_native = cusolverRfSetupDevice(n_native, nnzA_native, csrRowPtrA_native, csrColIndA_native, csrValA_native, nnzL_native, csrRowPtrL_native, csrColIndL_native, csrValL_native, nnzU_native, csrRowPtrU_native, csrColIndU_native, csrValU_native, P_native, Q_native, handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // n is primitive
@@ -882,10 +895,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfResetValuesNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfResetValues(n=%d, nnzA=%d, csrRowPtrA=%p, csrColIndA=%p, csrValA=%p, P=%p, Q=%p, handle=%p)\n",
-        n, nnzA, csrRowPtrA, csrColIndA, csrValA, P, Q, handle);
-
     // Native variable declarations
     int n_native = 0;
     int nnzA_native = 0;
@@ -907,7 +916,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfResetValuesNat
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfResetValues", "n, nnzA");
+    CallCapture callCapture(env, traceId, n, nnzA, csrRowPtrA, csrColIndA, csrValA, P, Q, handle);
+    CallTrace callTrace(traceId, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverRfResetValues(n_native, nnzA_native, csrRowPtrA_native, csrColIndA_native, csrValA_native, P_native, Q_native, handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // n is primitive
@@ -934,10 +948,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfAnalyzeNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfAnalyze(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
 
@@ -945,7 +955,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfAnalyzeNative(
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfAnalyze", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfAnalyze(handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -965,10 +980,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfRefactorNative
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfRefactor(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
 
@@ -976,7 +987,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfRefactorNative
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfRefactor", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfRefactor(handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1016,10 +1032,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfAccessBundledF
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfAccessBundledFactorsDevice(handle=%p, nnzM=%p, Mp=%p, Mi=%p, Mx=%p)\n",
-        handle, nnzM, Mp, Mi, Mx);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     int * nnzM_native = NULL;
@@ -1035,7 +1047,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfAccessBundledF
     Mx_native = (double * *)getPointer(env, Mx);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfAccessBundledFactorsDevice", "");
+    CallCapture callCapture(env, traceId, handle, nnzM, Mp, Mi, Mx);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfAccessBundledFactorsDevice(handle_native, nnzM_native, Mp_native, Mi_native, Mx_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1078,10 +1095,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfExtractBundled
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfExtractBundledFactorsHost(handle=%p, h_nnzM=%p, h_Mp=%p, h_Mi=%p, h_Mx=%p)\n",
-        handle, h_nnzM, h_Mp, h_Mi, h_Mx);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     int * h_nnzM_native = NULL;
@@ -1117,7 +1130,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfExtractBundled
     h_Mx_native = (double * *)h_Mx_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfExtractBundledFactorsHost", "");
+    CallCapture callCapture(env, traceId, handle, h_nnzM, h_Mp, h_Mi, h_Mx);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfExtractBundledFactorsHost(handle_native, h_nnzM_native, h_Mp_native, h_Mi_native, h_Mx_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1201,10 +1219,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfExtractSplitFa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfExtractSplitFactorsHost(handle=%p, h_nnzL=%p, h_csrRowPtrL=%p, h_csrColIndL=%p, h_csrValL=%p, h_nnzU=%p, h_csrRowPtrU=%p, h_csrColIndU=%p, h_csrValU=%p)\n",
-        handle, h_nnzL, h_csrRowPtrL, h_csrColIndL, h_csrValL, h_nnzU, h_csrRowPtrU, h_csrColIndU, h_csrValU);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     int * h_nnzL_native = NULL;
@@ -1268,7 +1282,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfExtractSplitFa
     h_csrValU_native = (double * *)h_csrValU_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfExtractSplitFactorsHost", "");
+    CallCapture callCapture(env, traceId, handle, h_nnzL, h_csrRowPtrL, h_csrColIndL, h_csrValL, h_nnzU, h_csrRowPtrU, h_csrColIndU, h_csrValU);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfExtractSplitFactorsHost(handle_native, h_nnzL_native, h_csrRowPtrL_native, h_csrColIndL_native, h_csrValL_native, h_nnzU_native, h_csrRowPtrU_native, h_csrColIndU_native, h_csrValU_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1359,10 +1378,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSolveNative(JN
     }
     // ldxf is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfSolve(handle=%p, P=%p, Q=%p, nrhs=%d, Temp=%p, ldt=%d, XF=%p, ldxf=%d)\n",
-        handle, P, Q, nrhs, Temp, ldt, XF, ldxf);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     int * P_native = NULL;
@@ -1384,7 +1399,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfSolveNative(JN
     ldxf_native = (int)ldxf;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfSolve", "nrhs, ldt, ldxf");
+    CallCapture callCapture(env, traceId, handle, P, Q, nrhs, Temp, ldt, XF, ldxf);
+    CallTrace callTrace(traceId, nrhs, ldt, ldxf);
     cusolverStatus_t jniResult_native = cusolverRfSolve(handle_native, P_native, Q_native, nrhs_native, Temp_native, ldt_native, XF_native, ldxf_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1472,10 +1492,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchSetupHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfBatchSetupHost(batchSize=%d, n=%d, nnzA=%d, h_csrRowPtrA=%p, h_csrColIndA=%p, h_csrValA_array=%p, nnzL=%d, h_csrRowPtrL=%p, h_csrColIndL=%p, h_csrValL=%p, nnzU=%d, h_csrRowPtrU=%p, h_csrColIndU=%p, h_csrValU=%p, h_P=%p, h_Q=%p, handle=%p)\n",
-        batchSize, n, nnzA, h_csrRowPtrA, h_csrColIndA, h_csrValA_array, nnzL, h_csrRowPtrL, h_csrColIndL, h_csrValL, nnzU, h_csrRowPtrU, h_csrColIndU, h_csrValU, h_P, h_Q, handle);
-
     // Native variable declarations
     int batchSize_native = 0;
     int n_native = 0;
@@ -1565,7 +1581,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchSetupHost
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfBatchSetupHost", "batchSize, n, nnzA, nnzL");
+    CallCapture callCapture(env, traceId, batchSize, n, nnzA, h_csrRowPtrA, h_csrColIndA, h_csrValA_array, nnzL, h_csrRowPtrL, h_csrColIndL, h_csrValL, nnzU, h_csrRowPtrU, h_csrColIndU, h_csrValU, h_P, h_Q, handle);
+    CallTrace callTrace(traceId, batchSize, n, nnzA, nnzL);
     cusolverStatus_t jniResult_native = cusolverRfBatchSetupHost(batchSize_native, n_native, nnzA_native, h_csrRowPtrA_native, h_csrColIndA_native, h_csrValA_array_native, nnzL_native, h_csrRowPtrL_native, h_csrColIndL_native, h_csrValL_native, nnzU_native, h_csrRowPtrU_native, h_csrColIndU_native, h_csrValU_native, h_P_native, h_Q_native, handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // batchSize is primitive
@@ -1681,10 +1702,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchResetValu
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfBatchResetValues(batchSize=%d, n=%d, nnzA=%d, csrRowPtrA=%p, csrColIndA=%p, csrValA_array=%p, P=%p, Q=%p, handle=%p)\n",
-        batchSize, n, nnzA, csrRowPtrA, csrColIndA, csrValA_array, P, Q, handle);
-
     // Native variable declarations
     int batchSize_native = 0;
     int n_native = 0;
@@ -1708,7 +1725,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchResetValu
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfBatchResetValues", "batchSize, n, nnzA");
+    CallCapture callCapture(env, traceId, batchSize, n, nnzA, csrRowPtrA, csrColIndA, csrValA_array, P, Q, handle);
+    CallTrace callTrace(traceId, batchSize, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverRfBatchResetValues(batchSize_native, n_native, nnzA_native, csrRowPtrA_native, csrColIndA_native, csrValA_array_native, P_native, Q_native, handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // batchSize is primitive
@@ -1736,10 +1758,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchAnalyzeNa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfBatchAnalyze(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
 
@@ -1747,7 +1765,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchAnalyzeNa
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfBatchAnalyze", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfBatchAnalyze(handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1767,10 +1790,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchRefactorN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfBatchRefactor(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
 
@@ -1778,7 +1797,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchRefactorN
     handle_native = (cusolverRfHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfBatchRefactor", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfBatchRefactor(handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1821,10 +1845,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchSolveNati
     }
     // ldxf is primitive
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfBatchSolve(handle=%p, P=%p, Q=%p, nrhs=%d, Temp=%p, ldt=%d, XF_array=%p, ldxf=%d)\n",
-        handle, P, Q, nrhs, Temp, ldt, XF_array, ldxf);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     int * P_native = NULL;
@@ -1846,7 +1866,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchSolveNati
     ldxf_native = (int)ldxf;
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfBatchSolve", "nrhs, ldt, ldxf");
+    CallCapture callCapture(env, traceId, handle, P, Q, nrhs, Temp, ldt, XF_array, ldxf);
+    CallTrace callTrace(traceId, nrhs, ldt, ldxf);
     cusolverStatus_t jniResult_native = cusolverRfBatchSolve(handle_native, P_native, Q_native, nrhs_native, Temp_native, ldt_native, XF_array_native, ldxf_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1878,10 +1903,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchZeroPivot
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverRfBatchZeroPivot(handle=%p, position=%p)\n",
-        handle, position);
-
     // Native variable declarations
     cusolverRfHandle_t handle_native;
     int * position_native = NULL;
@@ -1896,7 +1917,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverRf_cusolverRfBatchZeroPivot
     position_native = (int *)position_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverRfBatchZeroPivot", "");
+    CallCapture callCapture(env, traceId, handle, position);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverRfBatchZeroPivot(handle_native, position_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -108,10 +108,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCreateNative(J
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCreate(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
 
@@ -119,7 +115,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCreateNative(J
     // handle is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCreate", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverSpCreate(&handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, handle, (jlong)handle_native);
@@ -138,10 +139,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDestroyNative(
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDestroy(handle=%p)\n",
-        handle);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
 
@@ -149,11 +146,19 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDestroyNative(
     handle_native = (cusolverSpHandle_t)getNativePointerValue(env, handle);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDestroy", "");
+    CallCapture callCapture(env, traceId, handle);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverSpDestroy(handle_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
 
+    // Workspace accounting
+    if (jniResult_native == CUSOLVER_STATUS_SUCCESS) WorkspaceAccounting::release(handle_native);
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -169,10 +174,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpSetStreamNativ
     }
     // streamId is checked by the library
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpSetStream(handle=%p, streamId=%p)\n",
-        handle, streamId);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     cudaStream_t streamId_native;
@@ -182,7 +183,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpSetStreamNativ
     streamId_native = (cudaStream_t)getNativePointerValue(env, streamId);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpSetStream", "");
+    CallCapture callCapture(env, traceId, handle, streamId);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverSpSetStream(handle_native, streamId_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -207,10 +213,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpGetStreamNativ
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpGetStream(handle=%p, streamId=%p)\n",
-        handle, streamId);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     cudaStream_t streamId_native;
@@ -220,7 +222,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpGetStreamNativ
     // streamId is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpGetStream", "");
+    CallCapture callCapture(env, traceId, handle, streamId);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverSpGetStream(handle_native, &streamId_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -267,10 +274,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrissymHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpXcsrissymHost(handle=%p, m=%d, nnzA=%d, descrA=%p, csrRowPtrA=%p, csrEndPtrA=%p, csrColIndA=%p, issym=%p)\n",
-        handle, m, nnzA, descrA, csrRowPtrA, csrEndPtrA, csrColIndA, issym);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -312,7 +315,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrissymHostN
     issym_native = (int *)issym_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpXcsrissymHost", "m, nnzA");
+    CallCapture callCapture(env, traceId, handle, m, nnzA, descrA, csrRowPtrA, csrEndPtrA, csrColIndA, issym);
+    CallTrace callTrace(traceId, m, nnzA);
     cusolverStatus_t jniResult_native = cusolverSpXcsrissymHost(handle_native, m_native, nnzA_native, descrA_native, csrRowPtrA_native, csrEndPtrA_native, csrColIndA_native, issym_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -406,10 +414,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvluHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrlsvluHost(handle=%p, n=%d, nnzA=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, n, nnzA, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -464,7 +468,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvluHostN
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrlsvluHost", "n, nnzA, reorder");
+    CallCapture callCapture(env, traceId, handle, n, nnzA, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, n, nnzA, reorder);
     cusolverStatus_t jniResult_native = cusolverSpScsrlsvluHost(handle_native, n_native, nnzA_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -558,10 +567,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvluHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrlsvluHost(handle=%p, n=%d, nnzA=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, n, nnzA, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -616,7 +621,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvluHostN
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrlsvluHost", "n, nnzA, reorder");
+    CallCapture callCapture(env, traceId, handle, n, nnzA, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, n, nnzA, reorder);
     cusolverStatus_t jniResult_native = cusolverSpDcsrlsvluHost(handle_native, n_native, nnzA_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -710,10 +720,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvluHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrlsvluHost(handle=%p, n=%d, nnzA=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, n, nnzA, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -768,7 +774,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvluHostN
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrlsvluHost", "n, nnzA, reorder");
+    CallCapture callCapture(env, traceId, handle, n, nnzA, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, n, nnzA, reorder);
     cusolverStatus_t jniResult_native = cusolverSpCcsrlsvluHost(handle_native, n_native, nnzA_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -862,10 +873,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvluHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrlsvluHost(handle=%p, n=%d, nnzA=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, n, nnzA, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -920,7 +927,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvluHostN
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrlsvluHost", "n, nnzA, reorder");
+    CallCapture callCapture(env, traceId, handle, n, nnzA, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, n, nnzA, reorder);
     cusolverStatus_t jniResult_native = cusolverSpZcsrlsvluHost(handle_native, n_native, nnzA_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1023,10 +1035,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvqrNativ
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrlsvqr(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -1056,7 +1064,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvqrNativ
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrlsvqr", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpScsrlsvqr(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1125,10 +1138,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvqrNativ
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrlsvqr(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -1158,7 +1167,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvqrNativ
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrlsvqr", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpDcsrlsvqr(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1227,10 +1241,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvqrNativ
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrlsvqr(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -1260,7 +1270,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvqrNativ
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrlsvqr", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpCcsrlsvqr(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1329,10 +1344,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvqrNativ
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrlsvqr(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -1362,7 +1373,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvqrNativ
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrlsvqr", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpZcsrlsvqr(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1440,10 +1456,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvqrHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrlsvqrHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -1498,7 +1510,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvqrHostN
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrlsvqrHost", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpScsrlsvqrHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1592,10 +1609,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvqrHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrlsvqrHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -1650,7 +1663,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvqrHostN
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrlsvqrHost", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpDcsrlsvqrHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1744,10 +1762,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvqrHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrlsvqrHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -1802,7 +1816,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvqrHostN
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrlsvqrHost", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpCcsrlsvqrHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -1896,10 +1915,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvqrHostN
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrlsvqrHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -1954,7 +1969,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvqrHostN
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrlsvqrHost", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpZcsrlsvqrHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2060,10 +2080,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvcholHos
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrlsvcholHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -2118,7 +2134,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvcholHos
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrlsvcholHost", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpScsrlsvcholHost(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2212,10 +2233,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvcholHos
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrlsvcholHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -2270,7 +2287,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvcholHos
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrlsvcholHost", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpDcsrlsvcholHost(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2364,10 +2386,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvcholHos
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrlsvcholHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -2422,7 +2440,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvcholHos
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrlsvcholHost", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpCcsrlsvcholHost(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2516,10 +2539,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvcholHos
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrlsvcholHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -2574,7 +2593,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvcholHos
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrlsvcholHost", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpZcsrlsvcholHost(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2680,10 +2704,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvcholNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrlsvchol(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -2713,7 +2733,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsvcholNat
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrlsvchol", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpScsrlsvchol(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2782,10 +2807,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvcholNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrlsvchol(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -2815,7 +2836,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsvcholNat
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrlsvchol", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpDcsrlsvchol(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2884,10 +2910,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvcholNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrlsvchol(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%f, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -2917,7 +2939,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsvcholNat
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrlsvchol", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpCcsrlsvchol(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -2986,10 +3013,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvcholNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrlsvchol(handle=%p, m=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, b=%p, tol=%lf, reorder=%d, x=%p, singularity=%p)\n",
-        handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -3019,7 +3042,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsvcholNat
     // singularity is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrlsvchol", "m, nnz, reorder");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrVal, csrRowPtr, csrColInd, b, tol, reorder, x, singularity);
+    CallTrace callTrace(traceId, m, nnz, reorder);
     cusolverStatus_t jniResult_native = cusolverSpZcsrlsvchol(handle_native, m_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, b_native, tol_native, reorder_native, x_native, &singularity_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3107,10 +3135,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsqvqrHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrlsqvqrHost(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%f, rankA=%p, x=%p, p=%p, min_norm=%p)\n",
-        handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, rankA, x, p, min_norm);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -3184,7 +3208,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrlsqvqrHost
     min_norm_native = (float *)min_norm_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrlsqvqrHost", "m, n, nnz");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, rankA, x, p, min_norm);
+    CallTrace callTrace(traceId, m, n, nnz);
     cusolverStatus_t jniResult_native = cusolverSpScsrlsqvqrHost(handle_native, m_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, rankA_native, x_native, p_native, min_norm_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3305,10 +3334,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsqvqrHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrlsqvqrHost(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%lf, rankA=%p, x=%p, p=%p, min_norm=%p)\n",
-        handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, rankA, x, p, min_norm);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -3382,7 +3407,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrlsqvqrHost
     min_norm_native = (double *)min_norm_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrlsqvqrHost", "m, n, nnz");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, rankA, x, p, min_norm);
+    CallTrace callTrace(traceId, m, n, nnz);
     cusolverStatus_t jniResult_native = cusolverSpDcsrlsqvqrHost(handle_native, m_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, rankA_native, x_native, p_native, min_norm_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3503,10 +3533,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsqvqrHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrlsqvqrHost(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%f, rankA=%p, x=%p, p=%p, min_norm=%p)\n",
-        handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, rankA, x, p, min_norm);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -3580,7 +3606,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrlsqvqrHost
     min_norm_native = (float *)min_norm_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrlsqvqrHost", "m, n, nnz");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, rankA, x, p, min_norm);
+    CallTrace callTrace(traceId, m, n, nnz);
     cusolverStatus_t jniResult_native = cusolverSpCcsrlsqvqrHost(handle_native, m_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, rankA_native, x_native, p_native, min_norm_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3701,10 +3732,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsqvqrHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrlsqvqrHost(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, tol=%lf, rankA=%p, x=%p, p=%p, min_norm=%p)\n",
-        handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, rankA, x, p, min_norm);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -3778,7 +3805,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrlsqvqrHost
     min_norm_native = (double *)min_norm_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrlsqvqrHost", "m, n, nnz");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, tol, rankA, x, p, min_norm);
+    CallTrace callTrace(traceId, m, n, nnz);
     cusolverStatus_t jniResult_native = cusolverSpZcsrlsqvqrHost(handle_native, m_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, tol_native, rankA_native, x_native, p_native, min_norm_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -3899,10 +3931,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsreigvsiHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsreigvsiHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, mu0=%f, x0=%p, maxite=%d, tol=%f, mu=%p, x=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, tol, mu, x);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -3964,7 +3992,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsreigvsiHost
     x_native = (float *)x_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsreigvsiHost", "m, nnz, maxite");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, tol, mu, x);
+    CallTrace callTrace(traceId, m, nnz, maxite);
     cusolverStatus_t jniResult_native = cusolverSpScsreigvsiHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, mu0_native, x0_native, maxite_native, tol_native, mu_native, x_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4065,10 +4098,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsreigvsiHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsreigvsiHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, mu0=%lf, x0=%p, maxite=%d, tol=%lf, mu=%p, x=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, tol, mu, x);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -4130,7 +4159,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsreigvsiHost
     x_native = (double *)x_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsreigvsiHost", "m, nnz, maxite");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, tol, mu, x);
+    CallTrace callTrace(traceId, m, nnz, maxite);
     cusolverStatus_t jniResult_native = cusolverSpDcsreigvsiHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, mu0_native, x0_native, maxite_native, tol_native, mu_native, x_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4235,10 +4269,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsreigvsiHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsreigvsiHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, mu0=%p, x0=%p, maxite=%d, tol=%f, mu=%p, x=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, tol, mu, x);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -4300,7 +4330,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsreigvsiHost
     x_native = (cuComplex *)x_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsreigvsiHost", "m, nnz, maxite");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, tol, mu, x);
+    CallTrace callTrace(traceId, m, nnz, maxite);
     cusolverStatus_t jniResult_native = cusolverSpCcsreigvsiHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, mu0_native, x0_native, maxite_native, tol_native, mu_native, x_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4405,10 +4440,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsreigvsiHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsreigvsiHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, mu0=%p, x0=%p, maxite=%d, tol=%lf, mu=%p, x=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, tol, mu, x);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -4470,7 +4501,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsreigvsiHost
     x_native = (cuDoubleComplex *)x_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsreigvsiHost", "m, nnz, maxite");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, tol, mu, x);
+    CallTrace callTrace(traceId, m, nnz, maxite);
     cusolverStatus_t jniResult_native = cusolverSpZcsreigvsiHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, mu0_native, x0_native, maxite_native, tol_native, mu_native, x_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4580,10 +4616,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsreigvsiNati
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsreigvsi(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, mu0=%f, x0=%p, maxite=%d, eps=%f, mu=%p, x=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, eps, mu, x);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -4615,7 +4647,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsreigvsiNati
     x_native = (float *)getPointer(env, x);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsreigvsi", "m, nnz, maxite");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, eps, mu, x);
+    CallTrace callTrace(traceId, m, nnz, maxite);
     cusolverStatus_t jniResult_native = cusolverSpScsreigvsi(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, mu0_native, x0_native, maxite_native, eps_native, mu_native, x_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4686,10 +4723,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsreigvsiNati
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsreigvsi(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, mu0=%lf, x0=%p, maxite=%d, eps=%lf, mu=%p, x=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, eps, mu, x);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -4721,7 +4754,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsreigvsiNati
     x_native = (double *)getPointer(env, x);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsreigvsi", "m, nnz, maxite");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, eps, mu, x);
+    CallTrace callTrace(traceId, m, nnz, maxite);
     cusolverStatus_t jniResult_native = cusolverSpDcsreigvsi(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, mu0_native, x0_native, maxite_native, eps_native, mu_native, x_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4796,10 +4834,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsreigvsiNati
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsreigvsi(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, mu0=%p, x0=%p, maxite=%d, eps=%f, mu=%p, x=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, eps, mu, x);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -4831,7 +4865,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsreigvsiNati
     x_native = (cuComplex *)getPointer(env, x);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsreigvsi", "m, nnz, maxite");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, eps, mu, x);
+    CallTrace callTrace(traceId, m, nnz, maxite);
     cusolverStatus_t jniResult_native = cusolverSpCcsreigvsi(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, mu0_native, x0_native, maxite_native, eps_native, mu_native, x_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -4906,10 +4945,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsreigvsiNati
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsreigvsi(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, mu0=%p, x0=%p, maxite=%d, eps=%lf, mu=%p, x=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, eps, mu, x);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -4941,7 +4976,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsreigvsiNati
     x_native = (cuDoubleComplex *)getPointer(env, x);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsreigvsi", "m, nnz, maxite");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, mu0, x0, maxite, eps, mu, x);
+    CallTrace callTrace(traceId, m, nnz, maxite);
     cusolverStatus_t jniResult_native = cusolverSpZcsreigvsi(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, mu0_native, x0_native, maxite_native, eps_native, mu_native, x_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5010,10 +5050,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsreigsHostNa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsreigsHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, left_bottom_corner=%p, right_upper_corner=%p, num_eigs=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, left_bottom_corner, right_upper_corner, num_eigs);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -5059,7 +5095,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsreigsHostNa
     num_eigs_native = (int *)num_eigs_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsreigsHost", "m, nnz");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, left_bottom_corner, right_upper_corner, num_eigs);
+    CallTrace callTrace(traceId, m, nnz);
     cusolverStatus_t jniResult_native = cusolverSpScsreigsHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, left_bottom_corner_native, right_upper_corner_native, num_eigs_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5144,10 +5185,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsreigsHostNa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsreigsHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, left_bottom_corner=%p, right_upper_corner=%p, num_eigs=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, left_bottom_corner, right_upper_corner, num_eigs);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -5193,7 +5230,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsreigsHostNa
     num_eigs_native = (int *)num_eigs_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsreigsHost", "m, nnz");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, left_bottom_corner, right_upper_corner, num_eigs);
+    CallTrace callTrace(traceId, m, nnz);
     cusolverStatus_t jniResult_native = cusolverSpDcsreigsHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, left_bottom_corner_native, right_upper_corner_native, num_eigs_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5278,10 +5320,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsreigsHostNa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsreigsHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, left_bottom_corner=%p, right_upper_corner=%p, num_eigs=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, left_bottom_corner, right_upper_corner, num_eigs);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -5327,7 +5365,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsreigsHostNa
     num_eigs_native = (int *)num_eigs_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsreigsHost", "m, nnz");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, left_bottom_corner, right_upper_corner, num_eigs);
+    CallTrace callTrace(traceId, m, nnz);
     cusolverStatus_t jniResult_native = cusolverSpCcsreigsHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, left_bottom_corner_native, right_upper_corner_native, num_eigs_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5412,10 +5455,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsreigsHostNa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsreigsHost(handle=%p, m=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, left_bottom_corner=%p, right_upper_corner=%p, num_eigs=%p)\n",
-        handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, left_bottom_corner, right_upper_corner, num_eigs);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -5461,7 +5500,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsreigsHostNa
     num_eigs_native = (int *)num_eigs_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsreigsHost", "m, nnz");
+    CallCapture callCapture(env, traceId, handle, m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, left_bottom_corner, right_upper_corner, num_eigs);
+    CallTrace callTrace(traceId, m, nnz);
     cusolverStatus_t jniResult_native = cusolverSpZcsreigsHost(handle_native, m_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, left_bottom_corner_native, right_upper_corner_native, num_eigs_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5538,10 +5582,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrsymrcmHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpXcsrsymrcmHost(handle=%p, n=%d, nnzA=%d, descrA=%p, csrRowPtrA=%p, csrColIndA=%p, p=%p)\n",
-        handle, n, nnzA, descrA, csrRowPtrA, csrColIndA, p);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -5576,7 +5616,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrsymrcmHost
     p_native = (int *)p_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpXcsrsymrcmHost", "n, nnzA");
+    CallCapture callCapture(env, traceId, handle, n, nnzA, descrA, csrRowPtrA, csrColIndA, p);
+    CallTrace callTrace(traceId, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverSpXcsrsymrcmHost(handle_native, n_native, nnzA_native, descrA_native, csrRowPtrA_native, csrColIndA_native, p_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5645,10 +5690,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrsymmdqHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpXcsrsymmdqHost(handle=%p, n=%d, nnzA=%d, descrA=%p, csrRowPtrA=%p, csrColIndA=%p, p=%p)\n",
-        handle, n, nnzA, descrA, csrRowPtrA, csrColIndA, p);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -5683,7 +5724,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrsymmdqHost
     p_native = (int *)p_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpXcsrsymmdqHost", "n, nnzA");
+    CallCapture callCapture(env, traceId, handle, n, nnzA, descrA, csrRowPtrA, csrColIndA, p);
+    CallTrace callTrace(traceId, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverSpXcsrsymmdqHost(handle_native, n_native, nnzA_native, descrA_native, csrRowPtrA_native, csrColIndA_native, p_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5752,10 +5798,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrsymamdHost
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpXcsrsymamdHost(handle=%p, n=%d, nnzA=%d, descrA=%p, csrRowPtrA=%p, csrColIndA=%p, p=%p)\n",
-        handle, n, nnzA, descrA, csrRowPtrA, csrColIndA, p);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -5790,7 +5832,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrsymamdHost
     p_native = (int *)p_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpXcsrsymamdHost", "n, nnzA");
+    CallCapture callCapture(env, traceId, handle, n, nnzA, descrA, csrRowPtrA, csrColIndA, p);
+    CallTrace callTrace(traceId, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverSpXcsrsymamdHost(handle_native, n_native, nnzA_native, descrA_native, csrRowPtrA_native, csrColIndA_native, p_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5860,10 +5907,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrmetisndHos
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpXcsrmetisndHost(handle=%p, n=%d, nnzA=%d, descrA=%p, csrRowPtrA=%p, csrColIndA=%p, options=%p, p=%p)\n",
-        handle, n, nnzA, descrA, csrRowPtrA, csrColIndA, options, p);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -5905,7 +5948,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrmetisndHos
     p_native = (int *)p_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpXcsrmetisndHost", "n, nnzA");
+    CallCapture callCapture(env, traceId, handle, n, nnzA, descrA, csrRowPtrA, csrColIndA, options, p);
+    CallTrace callTrace(traceId, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverSpXcsrmetisndHost(handle_native, n_native, nnzA_native, descrA_native, csrRowPtrA_native, csrColIndA_native, options_native, p_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -5986,10 +6034,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrzfdHostNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrzfdHost(handle=%p, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, P=%p, numnz=%p)\n",
-        handle, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, P, numnz);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -6038,7 +6082,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrzfdHostNat
     numnz_native = (int *)numnz_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrzfdHost", "n, nnz");
+    CallCapture callCapture(env, traceId, handle, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, P, numnz);
+    CallTrace callTrace(traceId, n, nnz);
     cusolverStatus_t jniResult_native = cusolverSpScsrzfdHost(handle_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, P_native, numnz_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6122,10 +6171,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrzfdHostNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrzfdHost(handle=%p, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, P=%p, numnz=%p)\n",
-        handle, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, P, numnz);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -6174,7 +6219,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrzfdHostNat
     numnz_native = (int *)numnz_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrzfdHost", "n, nnz");
+    CallCapture callCapture(env, traceId, handle, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, P, numnz);
+    CallTrace callTrace(traceId, n, nnz);
     cusolverStatus_t jniResult_native = cusolverSpDcsrzfdHost(handle_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, P_native, numnz_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6258,10 +6308,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrzfdHostNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrzfdHost(handle=%p, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, P=%p, numnz=%p)\n",
-        handle, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, P, numnz);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -6310,7 +6356,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrzfdHostNat
     numnz_native = (int *)numnz_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrzfdHost", "n, nnz");
+    CallCapture callCapture(env, traceId, handle, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, P, numnz);
+    CallTrace callTrace(traceId, n, nnz);
     cusolverStatus_t jniResult_native = cusolverSpCcsrzfdHost(handle_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, P_native, numnz_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6394,10 +6445,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrzfdHostNat
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrzfdHost(handle=%p, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, P=%p, numnz=%p)\n",
-        handle, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, P, numnz);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int n_native = 0;
@@ -6446,7 +6493,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrzfdHostNat
     numnz_native = (int *)numnz_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrzfdHost", "n, nnz");
+    CallCapture callCapture(env, traceId, handle, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, P, numnz);
+    CallTrace callTrace(traceId, n, nnz);
     cusolverStatus_t jniResult_native = cusolverSpZcsrzfdHost(handle_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, P_native, numnz_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6538,10 +6590,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrperm_1buff
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpXcsrperm_bufferSizeHost(handle=%p, m=%d, n=%d, nnzA=%d, descrA=%p, csrRowPtrA=%p, csrColIndA=%p, p=%p, q=%p, bufferSizeInBytes=%p)\n",
-        handle, m, n, nnzA, descrA, csrRowPtrA, csrColIndA, p, q, bufferSizeInBytes);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -6587,7 +6635,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrperm_1buff
     // bufferSizeInBytes is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpXcsrperm_bufferSizeHost", "m, n, nnzA");
+    CallCapture callCapture(env, traceId, handle, m, n, nnzA, descrA, csrRowPtrA, csrColIndA, p, q, bufferSizeInBytes);
+    CallTrace callTrace(traceId, m, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverSpXcsrperm_bufferSizeHost(handle_native, m_native, n_native, nnzA_native, descrA_native, csrRowPtrA_native, csrColIndA_native, p_native, q_native, &bufferSizeInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6621,6 +6674,9 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrperm_1buff
     if (!releasePointerData(env, q_pointerData, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
     if (!set(env, bufferSizeInBytes, 0, (jlong)bufferSizeInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, 0, bufferSizeInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
     // Return the result
     jint jniResult = (jint)jniResult_native;
     return jniResult;
@@ -6673,10 +6729,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrpermHostNa
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpXcsrpermHost(handle=%p, m=%d, n=%d, nnzA=%d, descrA=%p, csrRowPtrA=%p, csrColIndA=%p, p=%p, q=%p, map=%p, pBuffer=%p)\n",
-        handle, m, n, nnzA, descrA, csrRowPtrA, csrColIndA, p, q, map, pBuffer);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -6734,7 +6786,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrpermHostNa
     pBuffer_native = (void *)pBuffer_pointerData->getPointer(env);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpXcsrpermHost", "m, n, nnzA");
+    CallCapture callCapture(env, traceId, handle, m, n, nnzA, descrA, csrRowPtrA, csrColIndA, p, q, map, pBuffer);
+    CallTrace callTrace(traceId, m, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverSpXcsrpermHost(handle_native, m_native, n_native, nnzA_native, descrA_native, csrRowPtrA_native, csrColIndA_native, p_native, q_native, map_native, pBuffer_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6799,10 +6856,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCreateCsrqrInf
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCreateCsrqrInfo(info=%p)\n",
-        info);
-
     // Native variable declarations
     csrqrInfo_t info_native;
 
@@ -6810,7 +6863,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCreateCsrqrInf
     // info is write-only
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCreateCsrqrInfo", "");
+    CallCapture callCapture(env, traceId, info);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverSpCreateCsrqrInfo(&info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     setNativePointerValue(env, info, (jlong)info_native);
@@ -6829,10 +6887,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDestroyCsrqrIn
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDestroyCsrqrInfo(info=%p)\n",
-        info);
-
     // Native variable declarations
     csrqrInfo_t info_native;
 
@@ -6840,7 +6894,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDestroyCsrqrIn
     info_native = (csrqrInfo_t)getNativePointerValue(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDestroyCsrqrInfo", "");
+    CallCapture callCapture(env, traceId, info);
+    CallTrace callTrace(traceId);
     cusolverStatus_t jniResult_native = cusolverSpDestroyCsrqrInfo(info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // info is read-only
@@ -6882,10 +6941,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrqrAnalysis
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpXcsrqrAnalysisBatched(handle=%p, m=%d, n=%d, nnzA=%d, descrA=%p, csrRowPtrA=%p, csrColIndA=%p, info=%p)\n",
-        handle, m, n, nnzA, descrA, csrRowPtrA, csrColIndA, info);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -6907,7 +6962,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpXcsrqrAnalysis
     info_native = (csrqrInfo_t)getNativePointerValue(env, info);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpXcsrqrAnalysisBatched", "m, n, nnzA");
+    CallCapture callCapture(env, traceId, handle, m, n, nnzA, descrA, csrRowPtrA, csrColIndA, info);
+    CallTrace callTrace(traceId, m, n, nnzA);
     cusolverStatus_t jniResult_native = cusolverSpXcsrqrAnalysisBatched(handle_native, m_native, n_native, nnzA_native, descrA_native, csrRowPtrA_native, csrColIndA_native, info_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -6972,10 +7032,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrqrBufferIn
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrqrBufferInfoBatched(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, batchSize=%d, info=%p, internalDataInBytes=%p, workspaceInBytes=%p)\n",
-        handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -6987,8 +7043,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrqrBufferIn
     int * csrColInd_native = NULL;
     int batchSize_native = 0;
     csrqrInfo_t info_native;
-    size_t * internalDataInBytes_native = NULL;
-    size_t * workspaceInBytes_native = NULL;
+    size_t internalDataInBytes_native;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverSpHandle_t)getNativePointerValue(env, handle);
@@ -7001,11 +7057,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrqrBufferIn
     csrColInd_native = (int *)getPointer(env, csrColInd);
     batchSize_native = (int)batchSize;
     info_native = (csrqrInfo_t)getNativePointerValue(env, info);
-    internalDataInBytes_native = (size_t *)getPointer(env, internalDataInBytes);
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // internalDataInBytes is write-only
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverSpScsrqrBufferInfoBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, batchSize_native, info_native, internalDataInBytes_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrqrBufferInfoBatched", "m, n, nnz, batchSize");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
+    CallTrace callTrace(traceId, m, n, nnz, batchSize);
+    cusolverStatus_t jniResult_native = cusolverSpScsrqrBufferInfoBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, batchSize_native, info_native, &internalDataInBytes_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7018,8 +7079,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrqrBufferIn
     // csrColInd is a native pointer
     // batchSize is primitive
     // info is read-only
-    // internalDataInBytes is a native pointer
-    // workspaceInBytes is a native pointer
+    if (!set(env, internalDataInBytes, 0, (jlong)internalDataInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, internalDataInBytes_native + workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -7074,10 +7138,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrqrBufferIn
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrqrBufferInfoBatched(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, batchSize=%d, info=%p, internalDataInBytes=%p, workspaceInBytes=%p)\n",
-        handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -7089,8 +7149,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrqrBufferIn
     int * csrColInd_native = NULL;
     int batchSize_native = 0;
     csrqrInfo_t info_native;
-    size_t * internalDataInBytes_native = NULL;
-    size_t * workspaceInBytes_native = NULL;
+    size_t internalDataInBytes_native;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverSpHandle_t)getNativePointerValue(env, handle);
@@ -7103,11 +7163,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrqrBufferIn
     csrColInd_native = (int *)getPointer(env, csrColInd);
     batchSize_native = (int)batchSize;
     info_native = (csrqrInfo_t)getNativePointerValue(env, info);
-    internalDataInBytes_native = (size_t *)getPointer(env, internalDataInBytes);
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // internalDataInBytes is write-only
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverSpDcsrqrBufferInfoBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, batchSize_native, info_native, internalDataInBytes_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrqrBufferInfoBatched", "m, n, nnz, batchSize");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
+    CallTrace callTrace(traceId, m, n, nnz, batchSize);
+    cusolverStatus_t jniResult_native = cusolverSpDcsrqrBufferInfoBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, batchSize_native, info_native, &internalDataInBytes_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7120,8 +7185,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrqrBufferIn
     // csrColInd is a native pointer
     // batchSize is primitive
     // info is read-only
-    // internalDataInBytes is a native pointer
-    // workspaceInBytes is a native pointer
+    if (!set(env, internalDataInBytes, 0, (jlong)internalDataInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, internalDataInBytes_native + workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -7176,10 +7244,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrqrBufferIn
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrqrBufferInfoBatched(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, batchSize=%d, info=%p, internalDataInBytes=%p, workspaceInBytes=%p)\n",
-        handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -7191,8 +7255,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrqrBufferIn
     int * csrColInd_native = NULL;
     int batchSize_native = 0;
     csrqrInfo_t info_native;
-    size_t * internalDataInBytes_native = NULL;
-    size_t * workspaceInBytes_native = NULL;
+    size_t internalDataInBytes_native;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverSpHandle_t)getNativePointerValue(env, handle);
@@ -7205,11 +7269,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrqrBufferIn
     csrColInd_native = (int *)getPointer(env, csrColInd);
     batchSize_native = (int)batchSize;
     info_native = (csrqrInfo_t)getNativePointerValue(env, info);
-    internalDataInBytes_native = (size_t *)getPointer(env, internalDataInBytes);
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // internalDataInBytes is write-only
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverSpCcsrqrBufferInfoBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, batchSize_native, info_native, internalDataInBytes_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrqrBufferInfoBatched", "m, n, nnz, batchSize");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
+    CallTrace callTrace(traceId, m, n, nnz, batchSize);
+    cusolverStatus_t jniResult_native = cusolverSpCcsrqrBufferInfoBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, batchSize_native, info_native, &internalDataInBytes_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7222,8 +7291,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrqrBufferIn
     // csrColInd is a native pointer
     // batchSize is primitive
     // info is read-only
-    // internalDataInBytes is a native pointer
-    // workspaceInBytes is a native pointer
+    if (!set(env, internalDataInBytes, 0, (jlong)internalDataInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, internalDataInBytes_native + workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -7278,10 +7350,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrqrBufferIn
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrqrBufferInfoBatched(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrVal=%p, csrRowPtr=%p, csrColInd=%p, batchSize=%d, info=%p, internalDataInBytes=%p, workspaceInBytes=%p)\n",
-        handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -7293,8 +7361,8 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrqrBufferIn
     int * csrColInd_native = NULL;
     int batchSize_native = 0;
     csrqrInfo_t info_native;
-    size_t * internalDataInBytes_native = NULL;
-    size_t * workspaceInBytes_native = NULL;
+    size_t internalDataInBytes_native;
+    size_t workspaceInBytes_native;
 
     // Obtain native variable values
     handle_native = (cusolverSpHandle_t)getNativePointerValue(env, handle);
@@ -7307,11 +7375,16 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrqrBufferIn
     csrColInd_native = (int *)getPointer(env, csrColInd);
     batchSize_native = (int)batchSize;
     info_native = (csrqrInfo_t)getNativePointerValue(env, info);
-    internalDataInBytes_native = (size_t *)getPointer(env, internalDataInBytes);
-    workspaceInBytes_native = (size_t *)getPointer(env, workspaceInBytes);
+    // internalDataInBytes is write-only
+    // workspaceInBytes is write-only
 
     // Native function call
-    cusolverStatus_t jniResult_native = cusolverSpZcsrqrBufferInfoBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, batchSize_native, info_native, internalDataInBytes_native, workspaceInBytes_native);
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrqrBufferInfoBatched", "m, n, nnz, batchSize");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
+    CallTrace callTrace(traceId, m, n, nnz, batchSize);
+    cusolverStatus_t jniResult_native = cusolverSpZcsrqrBufferInfoBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrVal_native, csrRowPtr_native, csrColInd_native, batchSize_native, info_native, &internalDataInBytes_native, &workspaceInBytes_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7324,8 +7397,11 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrqrBufferIn
     // csrColInd is a native pointer
     // batchSize is primitive
     // info is read-only
-    // internalDataInBytes is a native pointer
-    // workspaceInBytes is a native pointer
+    if (!set(env, internalDataInBytes, 0, (jlong)internalDataInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!set(env, workspaceInBytes, 0, (jlong)workspaceInBytes_native)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Workspace accounting
+    if (!WorkspaceAccounting::account(env, traceId, jniResult_native, handle_native, internalDataInBytes_native + workspaceInBytes_native, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
 
     // Return the result
     jint jniResult = (jint)jniResult_native;
@@ -7385,10 +7461,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrqrsvBatche
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpScsrqrsvBatched(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, x=%p, batchSize=%d, info=%p, pBuffer=%p)\n",
-        handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, x, batchSize, info, pBuffer);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -7420,7 +7492,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpScsrqrsvBatche
     pBuffer_native = (void *)getPointer(env, pBuffer);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpScsrqrsvBatched", "m, n, nnz, batchSize");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, x, batchSize, info, pBuffer);
+    CallTrace callTrace(traceId, m, n, nnz, batchSize);
     cusolverStatus_t jniResult_native = cusolverSpScsrqrsvBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, x_native, batchSize_native, info_native, pBuffer_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7495,10 +7572,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrqrsvBatche
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpDcsrqrsvBatched(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, x=%p, batchSize=%d, info=%p, pBuffer=%p)\n",
-        handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, x, batchSize, info, pBuffer);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -7530,7 +7603,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpDcsrqrsvBatche
     pBuffer_native = (void *)getPointer(env, pBuffer);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpDcsrqrsvBatched", "m, n, nnz, batchSize");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, x, batchSize, info, pBuffer);
+    CallTrace callTrace(traceId, m, n, nnz, batchSize);
     cusolverStatus_t jniResult_native = cusolverSpDcsrqrsvBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, x_native, batchSize_native, info_native, pBuffer_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7605,10 +7683,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrqrsvBatche
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpCcsrqrsvBatched(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, x=%p, batchSize=%d, info=%p, pBuffer=%p)\n",
-        handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, x, batchSize, info, pBuffer);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -7640,7 +7714,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpCcsrqrsvBatche
     pBuffer_native = (void *)getPointer(env, pBuffer);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpCcsrqrsvBatched", "m, n, nnz, batchSize");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, x, batchSize, info, pBuffer);
+    CallTrace callTrace(traceId, m, n, nnz, batchSize);
     cusolverStatus_t jniResult_native = cusolverSpCcsrqrsvBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, x_native, batchSize_native, info_native, pBuffer_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -7715,10 +7794,6 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrqrsvBatche
         return JCUSOLVER_STATUS_INTERNAL_ERROR;
     }
 
-    // Log message
-    Logger::log(LOG_TRACE, "Executing cusolverSpZcsrqrsvBatched(handle=%p, m=%d, n=%d, nnz=%d, descrA=%p, csrValA=%p, csrRowPtrA=%p, csrColIndA=%p, b=%p, x=%p, batchSize=%d, info=%p, pBuffer=%p)\n",
-        handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, x, batchSize, info, pBuffer);
-
     // Native variable declarations
     cusolverSpHandle_t handle_native;
     int m_native = 0;
@@ -7750,7 +7825,12 @@ JNIEXPORT jint JNICALL Java_jcuda_jcusolver_JCusolverSp_cusolverSpZcsrqrsvBatche
     pBuffer_native = (void *)getPointer(env, pBuffer);
 
     // Native function call
+    static const int traceId = CallTracer::registerFunction("cusolverSpZcsrqrsvBatched", "m, n, nnz, batchSize");
+    CallCapture callCapture(env, traceId, handle, m, n, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, b, x, batchSize, info, pBuffer);
+    CallTrace callTrace(traceId, m, n, nnz, batchSize);
     cusolverStatus_t jniResult_native = cusolverSpZcsrqrsvBatched(handle_native, m_native, n_native, nnz_native, descrA_native, csrValA_native, csrRowPtrA_native, csrColIndA_native, b_native, x_native, batchSize_native, info_native, pBuffer_native);
+    callTrace.end(jniResult_native);
+    callCapture.end(jniResult_native);
 
     // Write back native variable values
     // handle is read-only
@@ -41,6 +41,9 @@
 #include "Logger.hpp"
 #include "JNIUtils.hpp"
 #include "PointerUtils.hpp"
+#include "CallTracer.hpp"
+#include "CallRecorder.hpp"
+#include "WorkspaceAccounting.hpp"
 
 extern jfieldID cuComplex_x; // float
 extern jfieldID cuComplex_y; // float
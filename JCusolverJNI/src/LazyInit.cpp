@@ -0,0 +1,261 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "LazyInit.hpp"
+#include "JCusolver_common.hpp"
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <dlfcn.h>
+#include <link.h>
+#endif
+
+namespace
+{
+    /**
+     * The mutex for the initialization
+     */
+    std::mutex mutex;
+
+    /**
+     * The components that have been initialized
+     */
+    std::atomic<int> initializedComponents(0);
+
+    /**
+     * The durations of JNI_OnLoad and the initializations, in nanoseconds
+     */
+    std::atomic<int64_t> onLoadNs(0);
+    std::atomic<int64_t> pointerFieldsNs(0);
+    std::atomic<int64_t> complexFieldsNs(0);
+
+    /**
+     * Initialize the field IDs of cuComplex and cuDoubleComplex
+     */
+    bool initComplexFields(JNIEnv *env)
+    {
+        jclass cls = NULL;
+        if (!init(env, cls, "jcuda/cuComplex")) return false;
+        if (!init(env, cls, cuComplex_x, "x", "F")) return false;
+        if (!init(env, cls, cuComplex_y, "y", "F")) return false;
+        if (!init(env, cls, "jcuda/cuDoubleComplex")) return false;
+        if (!init(env, cls, cuDoubleComplex_x, "x", "D")) return false;
+        if (!init(env, cls, cuDoubleComplex_y, "y", "D")) return false;
+        return true;
+    }
+
+#if defined(__linux__)
+    /**
+     * The names of the functions that are imported by the JCusolver
+     * libraries, and the paths of these libraries
+     */
+    struct Imports
+    {
+        std::vector<std::string> libraryPaths;
+        std::vector<std::string> cusolverNames;
+        std::vector<std::string> cudartNames;
+    };
+
+    /**
+     * Callback for dl_iterate_phdr: Collects the names of the cuSOLVER and
+     * CUDA runtime functions that are referenced by the PLT relocations 
+     * of each loaded JCusolver library
+     */
+    int collectImports(struct dl_phdr_info *info, size_t size, void *data)
+    {
+        Imports *imports = static_cast<Imports*>(data);
+        if (info->dlpi_name == NULL || strstr(info->dlpi_name, "JCusolver") == NULL)
+        {
+            return 0;
+        }
+        const ElfW(Dyn) *dynamic = NULL;
+        for (int i = 0; i < info->dlpi_phnum; i++)
+        {
+            if (info->dlpi_phdr[i].p_type == PT_DYNAMIC)
+            {
+                dynamic = reinterpret_cast<const ElfW(Dyn)*>(
+                    info->dlpi_addr + info->dlpi_phdr[i].p_vaddr);
+            }
+        }
+        if (dynamic == NULL)
+        {
+            return 0;
+        }
+        // The glibc dynamic linker relocates the d_ptr entries of the 
+        // dynamic section when it loads a library, so they already are
+        // absolute addresses. This is not done on targets where the 
+        // dynamic section is read-only, like MIPS and RISC-V, and not 
+        // by other C libraries like musl. There, the entries are still 
+        // relative to the load address.
+#if defined(__GLIBC__) && !defined(__mips__) && !defined(__riscv)
+        const ElfW(Addr) base = 0;
+#else
+        const ElfW(Addr) base = info->dlpi_addr;
+#endif
+        auto address = [base](ElfW(Addr) a) { return a + base; };
+        const ElfW(Sym) *symbols = NULL;
+        const char *strings = NULL;
+        const char *relocations = NULL;
+        size_t relocationsSize = 0;
+        bool rela = true;
+        for (const ElfW(Dyn) *d = dynamic; d->d_tag != DT_NULL; d++)
+        {
+            switch (d->d_tag)
+            {
+                case DT_SYMTAB: symbols = reinterpret_cast<const ElfW(Sym)*>(address(d->d_un.d_ptr)); break;
+                case DT_STRTAB: strings = reinterpret_cast<const char*>(address(d->d_un.d_ptr)); break;
+                case DT_JMPREL: relocations = reinterpret_cast<const char*>(address(d->d_un.d_ptr)); break;
+                case DT_PLTRELSZ: relocationsSize = d->d_un.d_val; break;
+                case DT_PLTREL: rela = (d->d_un.d_val == DT_RELA); break;
+                default: break;
+            }
+        }
+        if (symbols == NULL || strings == NULL || relocations == NULL)
+        {
+            return 0;
+        }
+        imports->libraryPaths.push_back(info->dlpi_name);
+        size_t entrySize = rela ? sizeof(ElfW(Rela)) : sizeof(ElfW(Rel));
+        for (size_t offset = 0; offset + entrySize <= relocationsSize; offset += entrySize)
+        {
+            // The r_info member is at the same offset in Rel and Rela
+            const ElfW(Rel) *relocation = reinterpret_cast<const ElfW(Rel)*>(relocations + offset);
+#if defined(__LP64__)
+            size_t symbolIndex = ELF64_R_SYM(relocation->r_info);
+#else
+            size_t symbolIndex = ELF32_R_SYM(relocation->r_info);
+#endif
+            const char *name = strings + symbols[symbolIndex].st_name;
+            if (strncmp(name, "cusolver", 8) == 0)
+            {
+                imports->cusolverNames.push_back(name);
+            }
+            else if (strncmp(name, "cuda", 4) == 0)
+            {
+                imports->cudartNames.push_back(name);
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Look up the given symbols in the given libraries and their 
+     * dependencies, and return the time that this took
+     */
+    int64_t resolve(const std::vector<std::string> &libraryPaths, const std::vector<std::string> &names)
+    {
+        std::vector<void*> handles;
+        for (const std::string &path : libraryPaths)
+        {
+            void *handle = dlopen(path.c_str(), RTLD_LAZY | RTLD_NOLOAD);
+            if (handle != NULL)
+            {
+                handles.push_back(handle);
+            }
+        }
+        int64_t startNs = CallTracer::now();
+        for (const std::string &name : names)
+        {
+            for (void *handle : handles)
+            {
+                if (dlsym(handle, name.c_str()) != NULL)
+                {
+                    break;
+                }
+            }
+        }
+        int64_t durationNs = CallTracer::now() - startNs;
+        for (void *handle : handles)
+        {
+            dlclose(handle);
+        }
+        return durationNs;
+    }
+#endif
+}
+
+namespace LazyInit
+{
+    bool ensure(JNIEnv *env, int components)
+    {
+        if ((initializedComponents.load(std::memory_order_acquire) & components) == components)
+        {
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        int initialized = initializedComponents.load(std::memory_order_relaxed);
+        if ((components & POINTER_FIELDS) != 0 && (initialized & POINTER_FIELDS) == 0)
+        {
+            Logger::log(LOG_TRACE, "Initializing JNIUtils and PointerUtils\n");
+            int64_t startNs = CallTracer::now();
+            if (initJNIUtils(env) == JNI_ERR) return false;
+            if (initPointerUtils(env) == JNI_ERR) return false;
+            pointerFieldsNs.store(CallTracer::now() - startNs);
+            initialized |= POINTER_FIELDS;
+            initializedComponents.store(initialized, std::memory_order_release);
+        }
+        if ((components & COMPLEX_FIELDS) != 0 && (initialized & COMPLEX_FIELDS) == 0)
+        {
+            Logger::log(LOG_TRACE, "Initializing cuComplex and cuDoubleComplex\n");
+            int64_t startNs = CallTracer::now();
+            if (!initComplexFields(env)) return false;
+            complexFieldsNs.store(CallTracer::now() - startNs);
+            initialized |= COMPLEX_FIELDS;
+            initializedComponents.store(initialized, std::memory_order_release);
+        }
+        return true;
+    }
+
+    void recordOnLoad(int64_t durationNs)
+    {
+        onLoadNs.store(durationNs);
+    }
+
+    void getStartupTimes(int64_t *values)
+    {
+        values[STARTUP_JNI_ONLOAD_NS] = onLoadNs.load();
+        values[STARTUP_POINTER_FIELDS_NS] = pointerFieldsNs.load();
+        values[STARTUP_COMPLEX_FIELDS_NS] = complexFieldsNs.load();
+        values[STARTUP_CUSOLVER_SYMBOLS] = -1;
+        values[STARTUP_CUSOLVER_SYMBOLS_NS] = 0;
+        values[STARTUP_CUDART_SYMBOLS] = -1;
+        values[STARTUP_CUDART_SYMBOLS_NS] = 0;
+#if defined(__linux__)
+        Imports imports;
+        dl_iterate_phdr(collectImports, &imports);
+        values[STARTUP_CUSOLVER_SYMBOLS] = (int64_t)imports.cusolverNames.size();
+        values[STARTUP_CUSOLVER_SYMBOLS_NS] = resolve(imports.libraryPaths, imports.cusolverNames);
+        values[STARTUP_CUDART_SYMBOLS] = (int64_t)imports.cudartNames.size();
+        values[STARTUP_CUDART_SYMBOLS_NS] = resolve(imports.libraryPaths, imports.cudartNames);
+#endif
+    }
+}
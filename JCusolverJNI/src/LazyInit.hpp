@@ -0,0 +1,114 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCUSOLVER_LAZY_INIT_HPP
+#define JCUSOLVER_LAZY_INIT_HPP
+
+#include <jni.h>
+#include <cstdint>
+
+/**
+ * The one-time initialization of the field IDs that are used by the
+ * native functions. Instead of initializing all of them in JNI_OnLoad,
+ * each Java class initializes the components that it uses, in its 
+ * static initializer. 
+ *
+ * The times that are spent in JNI_OnLoad and in these initializations
+ * are recorded for the startup report of JCusolver.
+ */
+namespace LazyInit
+{
+    /**
+     * The components that can be initialized. These must match the 
+     * INIT_* constants in JCusolver.java
+     */
+    enum Component
+    {
+        /**
+         * The field IDs of JNIUtils and PointerUtils
+         */
+        POINTER_FIELDS = 1,
+
+        /**
+         * The field IDs of cuComplex and cuDoubleComplex
+         */
+        COMPLEX_FIELDS = 2
+    };
+
+    /**
+     * The indices of the values in the array that is filled by 
+     * getStartupTimes. These must match the STARTUP_* constants in 
+     * JCusolver.java
+     */
+    enum StartupValue
+    {
+        STARTUP_JNI_ONLOAD_NS = 0,
+        STARTUP_POINTER_FIELDS_NS = 1,
+        STARTUP_COMPLEX_FIELDS_NS = 2,
+        STARTUP_CUSOLVER_SYMBOLS = 3,
+        STARTUP_CUSOLVER_SYMBOLS_NS = 4,
+        STARTUP_CUDART_SYMBOLS = 5,
+        STARTUP_CUDART_SYMBOLS_NS = 6,
+        STARTUP_VALUE_COUNT = 7
+    };
+
+    /**
+     * Initialize the given components, if they have not been initialized
+     * yet. This is thread-safe, and only takes a single atomic load for 
+     * each component once it is initialized.
+     *
+     * @param env The JNIEnv
+     * @param components The bitwise OR of the Component values
+     * @return Whether the initialization succeeded. If not, then an 
+     * exception may be pending, and the initialization will be attempted
+     * again in the next call.
+     */
+    bool ensure(JNIEnv *env, int components);
+
+    /**
+     * Record the time that was spent in JNI_OnLoad
+     *
+     * @param durationNs The duration, in nanoseconds
+     */
+    void recordOnLoad(int64_t durationNs);
+
+    /**
+     * Fill the given array with the StartupValue values. The symbol 
+     * resolution times are measured in this call: The cuSOLVER and 
+     * CUDA runtime functions that are imported by the JCusolver 
+     * libraries are bound lazily, when each function is called for the
+     * first time. This looks up all of them with dlsym, which only 
+     * estimates the time that the dynamic linker spends on the lazy 
+     * binding. On platforms other than Linux, the symbol counts are -1.
+     *
+     * @param values The array, with STARTUP_VALUE_COUNT elements
+     */
+    void getStartupTimes(int64_t *values);
+}
+
+#endif
@@ -0,0 +1,260 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "SparseLeastSquares.hpp"
+#include "JCusolver_common.hpp"
+#include "HostUtils.hpp"
+#include <cusolverSp_LOWLEVEL_PREVIEW.h>
+#include <cmath>
+#include <vector>
+
+/**
+ * The native state of a SparseLeastSquares$Factorization. It owns a
+ * copy of the matrix, the result of the rank-revealing QR, and, if
+ * the matrix has full column rank, a sparse QR factorization that is
+ * reused for all right hand sides.
+ */
+struct LeastSquaresState
+{
+    int m;
+    int n;
+    int nnz;
+    cusparseMatDescr_t descrA;
+    double tol;
+    std::vector<double> csrValA;
+    std::vector<int> csrRowPtrA;
+    std::vector<int> csrColIndA;
+    int rank;
+    std::vector<int> p;
+
+    // Only created if the matrix has full column rank
+    csrqrInfoHost_t info;
+    std::vector<char> buffer;
+
+    LeastSquaresState() : m(0), n(0), nnz(0), descrA(NULL), tol(0), rank(0), info(NULL)
+    {
+    }
+
+    ~LeastSquaresState()
+    {
+        if (info != NULL)
+        {
+            cusolverSpDestroyCsrqrInfoHost(info);
+        }
+    }
+};
+
+/**
+ * Creates the sparse QR factorization of the matrix in the given state
+ */
+static cusolverStatus_t factorQr(cusolverSpHandle_t handle, LeastSquaresState *state)
+{
+    cusolverStatus_t status = cusolverSpCreateCsrqrInfoHost(&state->info);
+    if (status != CUSOLVER_STATUS_SUCCESS)
+    {
+        state->info = NULL;
+        return status;
+    }
+    status = cusolverSpXcsrqrAnalysisHost(handle, state->m, state->n, state->nnz, state->descrA,
+        state->csrRowPtrA.data(), state->csrColIndA.data(), state->info);
+    if (status != CUSOLVER_STATUS_SUCCESS) return status;
+
+    size_t internalDataInBytes = 0;
+    size_t workspaceInBytes = 0;
+    status = cusolverSpDcsrqrBufferInfoHost(handle, state->m, state->n, state->nnz, state->descrA,
+        state->csrValA.data(), state->csrRowPtrA.data(), state->csrColIndA.data(), state->info,
+        &internalDataInBytes, &workspaceInBytes);
+    if (status != CUSOLVER_STATUS_SUCCESS) return status;
+    state->buffer.resize(workspaceInBytes > 0 ? workspaceInBytes : 1);
+
+    status = cusolverSpDcsrqrSetupHost(handle, state->m, state->n, state->nnz, state->descrA,
+        state->csrValA.data(), state->csrRowPtrA.data(), state->csrColIndA.data(), 0.0, state->info);
+    if (status != CUSOLVER_STATUS_SUCCESS) return status;
+
+    return cusolverSpDcsrqrFactorHost(handle, state->m, state->n, state->nnz,
+        NULL, NULL, state->info, state->buffer.data());
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseLeastSquares_factorNative(JNIEnv *env, jclass cls, jobject handle, jint m, jint n, jint nnz, jobject descrA, jdoubleArray csrValA, jintArray csrRowPtrA, jintArray csrColIndA, jdouble tol, jobject factorization, jintArray rankA, jintArray p)
+{
+    if (handle == NULL || descrA == NULL || csrValA == NULL || csrRowPtrA == NULL ||
+        csrColIndA == NULL || factorization == NULL || rankA == NULL || p == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for SparseLeastSquares factor");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    Logger::log(LOG_TRACE, "Executing SparseLeastSquares factor(m=%d, n=%d, nnz=%d, tol=%lf)\n",
+        m, n, nnz, tol);
+
+    cusolverSpHandle_t handle_native = (cusolverSpHandle_t)getNativePointerValue(env, handle);
+    LeastSquaresState *state = new LeastSquaresState();
+    state->m = m;
+    state->n = n;
+    state->nnz = nnz;
+    state->descrA = (cusparseMatDescr_t)getNativePointerValue(env, descrA);
+    state->tol = tol;
+    state->csrValA.resize(nnz);
+    state->csrRowPtrA.resize(m + 1);
+    state->csrColIndA.resize(nnz);
+    state->p.resize(n);
+    env->GetDoubleArrayRegion(csrValA, 0, nnz, state->csrValA.data());
+    env->GetIntArrayRegion(csrRowPtrA, 0, m + 1, (jint*)state->csrRowPtrA.data());
+    env->GetIntArrayRegion(csrColIndA, 0, nnz, (jint*)state->csrColIndA.data());
+    if (env->ExceptionCheck())
+    {
+        delete state;
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    // Reveal the rank with the column pivoting QR of csrlsqvqrHost
+    std::vector<double> b(m, 0.0);
+    std::vector<double> x(n, 0.0);
+    double minNorm = 0.0;
+    cusolverStatus_t status = cusolverSpDcsrlsqvqrHost(handle_native, m, n, nnz, state->descrA,
+        state->csrValA.data(), state->csrRowPtrA.data(), state->csrColIndA.data(),
+        b.data(), tol, &state->rank, x.data(), state->p.data(), &minNorm);
+    if (status == CUSOLVER_STATUS_SUCCESS && state->rank == n && m >= n)
+    {
+        status = factorQr(handle_native, state);
+    }
+    if (status != CUSOLVER_STATUS_SUCCESS)
+    {
+        delete state;
+        return (jint)status;
+    }
+
+    if (!set(env, rankA, 0, (jint)state->rank))
+    {
+        delete state;
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    env->SetIntArrayRegion(p, 0, n, (const jint*)state->p.data());
+    setNativePointerValue(env, factorization, (jlong)state);
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseLeastSquares_solveNative(JNIEnv *env, jclass cls, jobject handle, jobject factorization, jdoubleArray b, jint ldb, jint nrhs, jdoubleArray x, jint ldx, jdoubleArray residualNorms)
+{
+    if (handle == NULL || factorization == NULL || b == NULL || x == NULL || residualNorms == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for SparseLeastSquares solve");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    LeastSquaresState *state = (LeastSquaresState*)getNativePointerValue(env, factorization);
+    if (state == NULL)
+    {
+        ThrowByName(env, "java/lang/IllegalStateException", "The factorization has been destroyed");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    Logger::log(LOG_TRACE, "Executing SparseLeastSquares solve(nrhs=%d, factored=%d)\n",
+        nrhs, state->info != NULL);
+
+    cusolverSpHandle_t handle_native = (cusolverSpHandle_t)getNativePointerValue(env, handle);
+    int m = state->m;
+    int n = state->n;
+    std::vector<double> bNative((size_t)ldb * nrhs);
+    std::vector<double> xNative((size_t)ldx * nrhs, 0.0);
+    std::vector<double> norms(nrhs, 0.0);
+    env->GetDoubleArrayRegion(b, 0, (jsize)bNative.size(), bNative.data());
+    if (env->ExceptionCheck())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    // The solvers overwrite the right hand side, so each column is
+    // copied into a temporary vector
+    std::vector<double> column(m);
+    std::vector<int> p(n);
+    for (int j = 0; j < nrhs; j++)
+    {
+        std::copy(bNative.begin() + (size_t)j * ldb, bNative.begin() + (size_t)j * ldb + m, column.begin());
+        double *xColumn = xNative.data() + (size_t)j * ldx;
+        cusolverStatus_t status;
+        if (state->info != NULL)
+        {
+            status = cusolverSpDcsrqrSolveHost(handle_native, m, n,
+                column.data(), xColumn, state->info, state->buffer.data());
+        }
+        else
+        {
+            int rank = 0;
+            double minNorm = 0.0;
+            status = cusolverSpDcsrlsqvqrHost(handle_native, m, n, state->nnz, state->descrA,
+                state->csrValA.data(), state->csrRowPtrA.data(), state->csrColIndA.data(),
+                column.data(), state->tol, &rank, xColumn, p.data(), &minNorm);
+        }
+        if (status != CUSOLVER_STATUS_SUCCESS)
+        {
+            return (jint)status;
+        }
+    }
+
+    // Compute the residual norms ||A*x - b|| of all columns
+    int base = cusparseGetMatIndexBase(state->descrA) == CUSPARSE_INDEX_BASE_ONE ? 1 : 0;
+    parallelFor((size_t)nrhs, 1, [&](size_t begin, size_t end)
+    {
+        for (size_t j = begin; j < end; j++)
+        {
+            const double *bColumn = bNative.data() + j * ldb;
+            const double *xColumn = xNative.data() + j * ldx;
+            double sum = 0.0;
+            for (int r = 0; r < m; r++)
+            {
+                double ax = 0.0;
+                for (int i = state->csrRowPtrA[r] - base; i < state->csrRowPtrA[r + 1] - base; i++)
+                {
+                    ax += state->csrValA[i] * xColumn[state->csrColIndA[i] - base];
+                }
+                double d = ax - bColumn[r];
+                sum += d * d;
+            }
+            norms[j] = std::sqrt(sum);
+        }
+    });
+
+    env->SetDoubleArrayRegion(x, 0, (jsize)xNative.size(), xNative.data());
+    env->SetDoubleArrayRegion(residualNorms, 0, nrhs, norms.data());
+    if (env->ExceptionCheck())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_SparseLeastSquares_destroyNative(JNIEnv *env, jclass cls, jobject factorization)
+{
+    if (factorization == NULL)
+    {
+        return;
+    }
+    LeastSquaresState *state = (LeastSquaresState*)getNativePointerValue(env, factorization);
+    delete state;
+    setNativePointerValue(env, factorization, 0);
+}
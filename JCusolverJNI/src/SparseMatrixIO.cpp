@@ -0,0 +1,1106 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "SparseMatrixIO.hpp"
+#include "JCusolver_common.hpp"
+#include "HostUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The magic number and version of the binary CSR format. The format
+// is described in SparseMatrixIO.java
+#define BINARY_MAGIC 0x5253434A
+#define BINARY_VERSION 1
+#define BINARY_HEADER_SIZE 40
+#define BINARY_FLAG_COMPLEX 1
+
+// The indices of the header values that are returned to Java. These 
+// must match the constants in SparseMatrixIO.java
+#define HEADER_M 0
+#define HEADER_N 1
+#define HEADER_NNZ 2
+#define HEADER_COMPLEX 3
+#define HEADER_COUNT 4
+
+// The number of rows that one thread processes at once
+#define ROW_GRAIN 4096
+
+// The number of bytes that one thread copies at once
+#define COPY_GRAIN (1 << 22)
+
+// The number of parse chunks per host thread
+#define CHUNKS_PER_THREAD 8
+
+/**
+ * A read-only memory mapping of a whole file
+ */
+class MappedFile
+{
+public:
+    MappedFile() : data(NULL), size(0)
+#if defined(_WIN32)
+        , file(INVALID_HANDLE_VALUE), mapping(NULL)
+#endif
+    {
+    }
+
+    ~MappedFile()
+    {
+        close();
+    }
+
+    /**
+     * Maps the file with the given path. Returns false and sets the 
+     * error message if this fails.
+     */
+    bool open(const char *path, std::string &error)
+    {
+#if defined(_WIN32)
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, 
+            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            error = std::string("Could not open ") + path;
+            return false;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            error = std::string("Could not read the size of ") + path;
+            return false;
+        }
+        size = (size_t)fileSize.QuadPart;
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping == NULL)
+        {
+            error = std::string("Could not map ") + path;
+            return false;
+        }
+        data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == NULL)
+        {
+            error = std::string("Could not map ") + path;
+            return false;
+        }
+#else
+        int descriptor = ::open(path, O_RDONLY);
+        if (descriptor < 0)
+        {
+            error = std::string("Could not open ") + path;
+            return false;
+        }
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || status.st_size == 0)
+        {
+            ::close(descriptor);
+            error = std::string("Could not read the size of ") + path;
+            return false;
+        }
+        size = (size_t)status.st_size;
+        void *address = mmap(NULL, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);
+        if (address == MAP_FAILED)
+        {
+            error = std::string("Could not map ") + path;
+            return false;
+        }
+        madvise(address, size, MADV_SEQUENTIAL);
+        data = (const char*)address;
+#endif
+        return true;
+    }
+
+    /**
+     * Unmaps the file
+     */
+    void close()
+    {
+#if defined(_WIN32)
+        if (data != NULL)
+        {
+            UnmapViewOfFile(data);
+        }
+        if (mapping != NULL)
+        {
+            CloseHandle(mapping);
+        }
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+        }
+        mapping = NULL;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (data != NULL)
+        {
+            munmap((void*)data, size);
+        }
+#endif
+        data = NULL;
+        size = 0;
+    }
+
+    const char *data;
+    size_t size;
+
+private:
+#if defined(_WIN32)
+    HANDLE file;
+    HANDLE mapping;
+#endif
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+};
+
+/**
+ * The native state of a SparseMatrixIO$Reader. For Matrix Market files, 
+ * it contains the entries in coordinate format, after the symmetric 
+ * expansion. For binary files, it contains the mapped file.
+ */
+struct ReaderState
+{
+    int m;
+    int n;
+    int nnz;
+    bool complex;
+
+    // For Matrix Market files
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<double> values;
+
+    // For binary files
+    bool binary;
+    MappedFile file;
+    size_t colIndOffset;
+    size_t valOffset;
+
+    ReaderState() : m(0), n(0), nnz(0), complex(false), binary(false), colIndOffset(0), valOffset(0)
+    {
+    }
+};
+
+/**
+ * The symmetry of a Matrix Market file
+ */
+enum Symmetry
+{
+    SYMMETRY_GENERAL,
+    SYMMETRY_SYMMETRIC,
+    SYMMETRY_SKEW_SYMMETRIC,
+    SYMMETRY_HERMITIAN
+};
+
+/**
+ * The field of a Matrix Market file
+ */
+enum Field
+{
+    FIELD_REAL,
+    FIELD_COMPLEX,
+    FIELD_PATTERN
+};
+
+/**
+ * Returns the given string in lower case
+ */
+static std::string toLower(std::string s)
+{
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        s[i] = (char)std::tolower((unsigned char)s[i]);
+    }
+    return s;
+}
+
+/**
+ * Returns the end of the line that starts at the given position, which
+ * is the position of the newline or the end of the data
+ */
+static const char* lineEnd(const char *p, const char *end)
+{
+    const char *newline = (const char*)std::memchr(p, '\n', (size_t)(end - p));
+    return newline == NULL ? end : newline;
+}
+
+/**
+ * Returns whether the given line contains data, meaning that it is 
+ * neither empty nor a comment
+ */
+static bool isDataLine(const char *begin, const char *end)
+{
+    while (begin < end && (*begin == ' ' || *begin == '\t' || *begin == '\r'))
+    {
+        begin++;
+    }
+    return begin < end && *begin != '%';
+}
+
+/**
+ * Copies the given line into the given buffer, with a terminating 0, 
+ * so that it may be parsed with the C library functions, which may 
+ * otherwise read beyond the end of the mapped file
+ */
+static const char* terminate(const char *begin, const char *end, std::string &buffer)
+{
+    buffer.assign(begin, end);
+    return buffer.c_str();
+}
+
+/**
+ * Parses an integer from the given null-terminated string. Returns 
+ * false if there is no integer.
+ */
+static bool parseLong(const char *&p, long long &value)
+{
+    char *end = NULL;
+    value = std::strtoll(p, &end, 10);
+    if (end == p)
+    {
+        return false;
+    }
+    p = end;
+    return true;
+}
+
+/**
+ * Parses a floating point value from the given null-terminated string. 
+ * Returns false if there is no value.
+ */
+static bool parseDouble(const char *&p, double &value)
+{
+    char *end = NULL;
+    value = std::strtod(p, &end);
+    if (end == p)
+    {
+        return false;
+    }
+    p = end;
+    return true;
+}
+
+/**
+ * Splits the data in [begin, end) into the given number of chunks that 
+ * start at line boundaries. The result contains chunkCount+1 positions.
+ */
+static std::vector<const char*> splitLines(const char *begin, const char *end, size_t chunkCount)
+{
+    std::vector<const char*> bounds(chunkCount + 1);
+    bounds[0] = begin;
+    bounds[chunkCount] = end;
+    size_t length = (size_t)(end - begin);
+    for (size_t c = 1; c < chunkCount; c++)
+    {
+        const char *p = std::max(begin + length * c / chunkCount, bounds[c - 1]);
+        if (p > begin && p < end && p[-1] != '\n')
+        {
+            p = lineEnd(p, end);
+            if (p < end)
+            {
+                p++;
+            }
+        }
+        bounds[c] = p;
+    }
+    return bounds;
+}
+
+/**
+ * Computes the row and column of the given entry of a dense Matrix 
+ * Market array in column-major order, which contains only the lower 
+ * triangle for symmetric matrices, and only the strict lower triangle 
+ * for skew-symmetric matrices
+ */
+static void arrayPosition(long long k, int m, int n, Symmetry symmetry, int &row, int &col)
+{
+    if (symmetry == SYMMETRY_GENERAL)
+    {
+        row = (int)(k % m);
+        col = (int)(k / m);
+        return;
+    }
+    int offset = symmetry == SYMMETRY_SKEW_SYMMETRIC ? 1 : 0;
+    col = 0;
+    while (col < n)
+    {
+        long long length = (long long)m - col - offset;
+        if (k < length)
+        {
+            break;
+        }
+        k -= length;
+        col++;
+    }
+    row = col + offset + (int)k;
+}
+
+/**
+ * Advances the given array position to the next entry
+ */
+static void nextArrayPosition(int m, Symmetry symmetry, int &row, int &col)
+{
+    row++;
+    if (row == m)
+    {
+        col++;
+        row = symmetry == SYMMETRY_GENERAL ? 0 : (symmetry == SYMMETRY_SKEW_SYMMETRIC ? col + 1 : col);
+    }
+}
+
+/**
+ * Parses the Matrix Market file in the given state. Returns false and 
+ * sets the error message if the file is not valid.
+ */
+static bool parseMatrixMarket(ReaderState *state, std::string &error)
+{
+    const char *p = state->file.data;
+    const char *end = p + state->file.size;
+
+    // Parse the banner
+    const char *bannerEnd = lineEnd(p, end);
+    std::string banner = toLower(std::string(p, bannerEnd));
+    char object[64] = { 0 };
+    char format[64] = { 0 };
+    char field[64] = { 0 };
+    char symmetry[64] = { 0 };
+    if (banner.compare(0, 14, "%%matrixmarket") != 0 ||
+        std::sscanf(banner.c_str() + 14, "%63s %63s %63s %63s", object, format, field, symmetry) != 4 ||
+        std::string(object) != "matrix")
+    {
+        error = "Invalid Matrix Market banner: " + banner;
+        return false;
+    }
+    bool coordinate = std::string(format) == "coordinate";
+    if (!coordinate && std::string(format) != "array")
+    {
+        error = std::string("Unsupported Matrix Market format: ") + format;
+        return false;
+    }
+    Field fieldType;
+    std::string fieldName(field);
+    if (fieldName == "real" || fieldName == "double" || fieldName == "integer")
+    {
+        fieldType = FIELD_REAL;
+    }
+    else if (fieldName == "complex")
+    {
+        fieldType = FIELD_COMPLEX;
+    }
+    else if (fieldName == "pattern" && coordinate)
+    {
+        fieldType = FIELD_PATTERN;
+    }
+    else
+    {
+        error = "Unsupported Matrix Market field: " + fieldName;
+        return false;
+    }
+    Symmetry symmetryType;
+    std::string symmetryName(symmetry);
+    if (symmetryName == "general")
+    {
+        symmetryType = SYMMETRY_GENERAL;
+    }
+    else if (symmetryName == "symmetric")
+    {
+        symmetryType = SYMMETRY_SYMMETRIC;
+    }
+    else if (symmetryName == "skew-symmetric")
+    {
+        symmetryType = SYMMETRY_SKEW_SYMMETRIC;
+    }
+    else if (symmetryName == "hermitian" && fieldType == FIELD_COMPLEX)
+    {
+        symmetryType = SYMMETRY_HERMITIAN;
+    }
+    else
+    {
+        error = "Unsupported Matrix Market symmetry: " + symmetryName;
+        return false;
+    }
+
+    // Skip the comments, and parse the size line
+    p = bannerEnd < end ? bannerEnd + 1 : end;
+    while (p < end && !isDataLine(p, lineEnd(p, end)))
+    {
+        const char *e = lineEnd(p, end);
+        p = e < end ? e + 1 : end;
+    }
+    const char *sizeEnd = lineEnd(p, end);
+    std::string sizeBuffer;
+    const char *s = terminate(p, sizeEnd, sizeBuffer);
+    long long m = 0;
+    long long n = 0;
+    long long entries = 0;
+    if (!parseLong(s, m) || !parseLong(s, n) || (coordinate && !parseLong(s, entries)) || 
+        m < 0 || n < 0 || entries < 0)
+    {
+        error = "Invalid Matrix Market size line: " + sizeBuffer;
+        return false;
+    }
+    if (symmetryType != SYMMETRY_GENERAL && m != n)
+    {
+        error = "A symmetric Matrix Market matrix must be square";
+        return false;
+    }
+    // Check the sizes before computing the number of entries of an
+    // array, so that m * n can not overflow
+    if (m > INT_MAX - 1 || n > INT_MAX)
+    {
+        error = "The matrix is too large for 32 bit indices";
+        return false;
+    }
+    if (!coordinate)
+    {
+        if (symmetryType == SYMMETRY_GENERAL)
+        {
+            entries = m * n;
+        }
+        else if (symmetryType == SYMMETRY_SKEW_SYMMETRIC)
+        {
+            entries = m * (m - 1) / 2;
+        }
+        else
+        {
+            entries = m * (m + 1) / 2;
+        }
+    }
+    if (entries > INT_MAX)
+    {
+        error = "The matrix is too large for 32 bit indices";
+        return false;
+    }
+    p = sizeEnd < end ? sizeEnd + 1 : end;
+
+    // Count the data lines of each chunk, in parallel
+    size_t chunkCount = hostThreadCount() * CHUNKS_PER_THREAD;
+    std::vector<const char*> bounds = splitLines(p, end, chunkCount);
+    std::vector<long long> chunkOffsets(chunkCount + 1, 0);
+    parallelFor(chunkCount, 1, [&](size_t begin, size_t stop)
+    {
+        for (size_t c = begin; c < stop; c++)
+        {
+            long long count = 0;
+            const char *q = bounds[c];
+            while (q < bounds[c + 1])
+            {
+                const char *e = lineEnd(q, bounds[c + 1]);
+                if (isDataLine(q, e))
+                {
+                    count++;
+                }
+                q = e + 1;
+            }
+            chunkOffsets[c + 1] = count;
+        }
+    });
+    for (size_t c = 0; c < chunkCount; c++)
+    {
+        chunkOffsets[c + 1] += chunkOffsets[c];
+    }
+    if (chunkOffsets[chunkCount] != entries)
+    {
+        error = "The file contains " + std::to_string(chunkOffsets[chunkCount]) + 
+            " entries, but the size line declares " + std::to_string(entries);
+        return false;
+    }
+
+    // Parse the entries of each chunk, in parallel
+    bool complex = fieldType == FIELD_COMPLEX;
+    int stride = complex ? 2 : 1;
+    std::vector<int> rows((size_t)entries);
+    std::vector<int> cols((size_t)entries);
+    std::vector<double> values((size_t)entries * stride);
+    std::atomic<long long> invalidEntry(-1);
+    parallelFor(chunkCount, 1, [&](size_t begin, size_t stop)
+    {
+        std::string buffer;
+        for (size_t c = begin; c < stop; c++)
+        {
+            long long k = chunkOffsets[c];
+            int row = 0;
+            int col = 0;
+            if (!coordinate && k < entries)
+            {
+                arrayPosition(k, (int)m, (int)n, symmetryType, row, col);
+            }
+            const char *q = bounds[c];
+            while (q < bounds[c + 1])
+            {
+                const char *e = lineEnd(q, bounds[c + 1]);
+                if (isDataLine(q, e))
+                {
+                    const char *t = terminate(q, e, buffer);
+                    bool valid = true;
+                    if (coordinate)
+                    {
+                        long long i = 0;
+                        long long j = 0;
+                        valid = parseLong(t, i) && parseLong(t, j) && 
+                            i >= 1 && i <= m && j >= 1 && j <= n;
+                        row = (int)(i - 1);
+                        col = (int)(j - 1);
+                    }
+                    rows[k] = row;
+                    cols[k] = col;
+                    if (fieldType == FIELD_PATTERN)
+                    {
+                        values[k] = 1.0;
+                    }
+                    else
+                    {
+                        valid = valid && parseDouble(t, values[k * stride]);
+                        if (complex)
+                        {
+                            valid = valid && parseDouble(t, values[k * stride + 1]);
+                        }
+                    }
+                    if (!valid)
+                    {
+                        long long expected = -1;
+                        invalidEntry.compare_exchange_strong(expected, k);
+                        return;
+                    }
+                    if (!coordinate)
+                    {
+                        nextArrayPosition((int)m, symmetryType, row, col);
+                    }
+                    k++;
+                }
+                q = e + 1;
+            }
+        }
+    });
+    if (invalidEntry.load() >= 0)
+    {
+        error = "Invalid Matrix Market entry " + std::to_string(invalidEntry.load() + 1);
+        return false;
+    }
+
+    // Expand the symmetric entries: For each off-diagonal entry (i,j), 
+    // append the entry (j,i), with the sign or conjugation that is 
+    // implied by the symmetry
+    long long total = entries;
+    if (symmetryType != SYMMETRY_GENERAL)
+    {
+        std::vector<long long> mirrorOffsets(chunkCount + 1, 0);
+        parallelFor(chunkCount, 1, [&](size_t begin, size_t stop)
+        {
+            for (size_t c = begin; c < stop; c++)
+            {
+                long long count = 0;
+                long long first = entries * (long long)c / (long long)chunkCount;
+                long long last = entries * (long long)(c + 1) / (long long)chunkCount;
+                for (long long k = first; k < last; k++)
+                {
+                    if (rows[k] != cols[k])
+                    {
+                        count++;
+                    }
+                }
+                mirrorOffsets[c + 1] = count;
+            }
+        });
+        for (size_t c = 0; c < chunkCount; c++)
+        {
+            mirrorOffsets[c + 1] += mirrorOffsets[c];
+        }
+        total = entries + mirrorOffsets[chunkCount];
+        if (total > INT_MAX)
+        {
+            error = "The expanded matrix has too many nonzeros for 32 bit indices";
+            return false;
+        }
+        rows.resize((size_t)total);
+        cols.resize((size_t)total);
+        values.resize((size_t)total * stride);
+        double sign = symmetryType == SYMMETRY_SKEW_SYMMETRIC ? -1.0 : 1.0;
+        double imaginarySign = symmetryType == SYMMETRY_HERMITIAN ? -sign : sign;
+        parallelFor(chunkCount, 1, [&](size_t begin, size_t stop)
+        {
+            for (size_t c = begin; c < stop; c++)
+            {
+                long long target = entries + mirrorOffsets[c];
+                long long first = entries * (long long)c / (long long)chunkCount;
+                long long last = entries * (long long)(c + 1) / (long long)chunkCount;
+                for (long long k = first; k < last; k++)
+                {
+                    if (rows[k] != cols[k])
+                    {
+                        rows[target] = cols[k];
+                        cols[target] = rows[k];
+                        values[target * stride] = sign * values[k * stride];
+                        if (complex)
+                        {
+                            values[target * stride + 1] = imaginarySign * values[k * stride + 1];
+                        }
+                        target++;
+                    }
+                }
+            }
+        });
+    }
+    state->m = (int)m;
+    state->n = (int)n;
+    state->nnz = (int)total;
+    state->complex = complex;
+    state->rows.swap(rows);
+    state->cols.swap(cols);
+    state->values.swap(values);
+    return true;
+}
+
+/**
+ * Converts the coordinate entries of the given state into the given 
+ * zero-based CSR arrays, in parallel. The column indices of each row
+ * are sorted. Entries with equal positions keep their order in the file.
+ */
+static void convertToCsr(const ReaderState *state, int *rowPtr, int *colInd, double *val)
+{
+    int m = state->m;
+    size_t nnz = (size_t)state->nnz;
+    int stride = state->complex ? 2 : 1;
+    const int *rows = state->rows.data();
+    const int *cols = state->cols.data();
+    const double *values = state->values.data();
+
+    std::vector<std::atomic<int> > counts(m);
+    parallelFor((size_t)m, ROW_GRAIN * 16, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            counts[i].store(0, std::memory_order_relaxed);
+        }
+    });
+    parallelFor(nnz, ROW_GRAIN * 16, [&](size_t begin, size_t end)
+    {
+        for (size_t k = begin; k < end; k++)
+        {
+            counts[rows[k]].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    rowPtr[0] = 0;
+    for (int i = 0; i < m; i++)
+    {
+        rowPtr[i + 1] = rowPtr[i] + counts[i].load(std::memory_order_relaxed);
+        counts[i].store(rowPtr[i], std::memory_order_relaxed);
+    }
+
+    // Scatter the entry indices into their rows, then sort each row by
+    // the column and the entry index, to obtain a deterministic result
+    std::vector<int> order(nnz);
+    parallelFor(nnz, ROW_GRAIN * 16, [&](size_t begin, size_t end)
+    {
+        for (size_t k = begin; k < end; k++)
+        {
+            order[counts[rows[k]].fetch_add(1, std::memory_order_relaxed)] = (int)k;
+        }
+    });
+    parallelFor((size_t)m, ROW_GRAIN, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            int *first = order.data() + rowPtr[i];
+            int *last = order.data() + rowPtr[i + 1];
+            std::sort(first, last, [cols](int a, int b)
+            {
+                return cols[a] < cols[b] || (cols[a] == cols[b] && a < b);
+            });
+            for (int p = rowPtr[i]; p < rowPtr[i + 1]; p++)
+            {
+                int k = order[p];
+                colInd[p] = cols[k];
+                val[(size_t)p * stride] = values[(size_t)k * stride];
+                if (stride == 2)
+                {
+                    val[(size_t)p * 2 + 1] = values[(size_t)k * 2 + 1];
+                }
+            }
+        }
+    });
+}
+
+/**
+ * Copies the given number of bytes in parallel
+ */
+static void parallelCopy(void *dst, const void *src, size_t bytes)
+{
+    parallelFor(bytes, COPY_GRAIN, [&](size_t begin, size_t end)
+    {
+        std::memcpy((char*)dst + begin, (const char*)src + begin, end - begin);
+    });
+}
+
+/**
+ * Returns the offset of the values in a binary file with the given 
+ * number of rows and nonzeros, which is aligned to 8 bytes
+ */
+static size_t binaryValueOffset(long long m, long long nnz)
+{
+    size_t offset = BINARY_HEADER_SIZE + sizeof(int) * (size_t)(m + 1 + nnz);
+    return (offset + 7) & ~(size_t)7;
+}
+
+/**
+ * Validates the zero-based CSR structure in the given binary file data, 
+ * in parallel: The row pointers must start at 0, not decrease, and end
+ * at nnz, and the column indices must be in [0, n).
+ */
+static bool validateBinaryStructure(const char *data, int m, int n, int nnz, size_t colIndOffset, std::string &error)
+{
+    const int32_t *rowPtr = (const int32_t*)(data + BINARY_HEADER_SIZE);
+    const int32_t *colInd = (const int32_t*)(data + colIndOffset);
+    if (rowPtr[0] != 0 || rowPtr[m] != nnz)
+    {
+        error = "The row pointers of the binary CSR file do not start at 0 and end at nnz";
+        return false;
+    }
+    std::atomic<bool> decreasing(false);
+    parallelFor((size_t)m, ROW_GRAIN, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            if (rowPtr[i + 1] < rowPtr[i])
+            {
+                decreasing.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+    if (decreasing.load())
+    {
+        error = "The row pointers of the binary CSR file are decreasing";
+        return false;
+    }
+    std::atomic<bool> outOfRange(false);
+    parallelFor((size_t)nnz, ROW_GRAIN * 16, [&](size_t begin, size_t end)
+    {
+        for (size_t k = begin; k < end; k++)
+        {
+            if (colInd[k] < 0 || colInd[k] >= n)
+            {
+                outOfRange.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+    if (outOfRange.load())
+    {
+        error = "The binary CSR file contains column indices that are out of range";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Validates the header and the structure of the binary file in the 
+ * given state
+ */
+static bool parseBinaryHeader(ReaderState *state, std::string &error)
+{
+    const char *data = state->file.data;
+    if (state->file.size < BINARY_HEADER_SIZE)
+    {
+        error = "The file is too small for a binary CSR header";
+        return false;
+    }
+    int32_t magic = 0;
+    int32_t version = 0;
+    int32_t flags = 0;
+    int64_t m = 0;
+    int64_t n = 0;
+    int64_t nnz = 0;
+    std::memcpy(&magic, data, 4);
+    std::memcpy(&version, data + 4, 4);
+    std::memcpy(&flags, data + 8, 4);
+    std::memcpy(&m, data + 16, 8);
+    std::memcpy(&n, data + 24, 8);
+    std::memcpy(&nnz, data + 32, 8);
+    uint32_t swappedMagic = 
+        (((uint32_t)BINARY_MAGIC & 0xFFu) << 24) | (((uint32_t)BINARY_MAGIC & 0xFF00u) << 8) |
+        (((uint32_t)BINARY_MAGIC >> 8) & 0xFF00u) | ((uint32_t)BINARY_MAGIC >> 24);
+    if ((uint32_t)magic == swappedMagic)
+    {
+        error = "The binary CSR file was written with a different byte order";
+        return false;
+    }
+    if (magic != BINARY_MAGIC || version != BINARY_VERSION)
+    {
+        error = "The file is not a binary CSR file of version " + std::to_string(BINARY_VERSION);
+        return false;
+    }
+    if (m < 0 || n < 0 || nnz < 0 || m > INT_MAX - 1 || n > INT_MAX || nnz > INT_MAX)
+    {
+        error = "Invalid binary CSR sizes";
+        return false;
+    }
+    bool complex = (flags & BINARY_FLAG_COMPLEX) != 0;
+    size_t valOffset = binaryValueOffset(m, nnz);
+    size_t expectedSize = valOffset + sizeof(double) * (size_t)nnz * (complex ? 2 : 1);
+    if (state->file.size < expectedSize)
+    {
+        error = "The binary CSR file is truncated";
+        return false;
+    }
+    size_t colIndOffset = BINARY_HEADER_SIZE + sizeof(int) * (size_t)(m + 1);
+    if (!validateBinaryStructure(data, (int)m, (int)n, (int)nnz, colIndOffset, error))
+    {
+        return false;
+    }
+    state->binary = true;
+    state->m = (int)m;
+    state->n = (int)n;
+    state->nnz = (int)nnz;
+    state->complex = complex;
+    state->colIndOffset = colIndOffset;
+    state->valOffset = valOffset;
+    return true;
+}
+
+/**
+ * Implementation of openMatrixMarketNative and openBinaryNative
+ */
+static jint openFile(JNIEnv *env, jstring path, jobject reader, jlongArray header, bool binary)
+{
+    if (path == NULL || reader == NULL || header == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for SparseMatrixIO open");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    const char *pathNative = env->GetStringUTFChars(path, NULL);
+    if (pathNative == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing SparseMatrixIO open(%s)\n", pathNative);
+
+    ReaderState *state = new ReaderState();
+    std::string error;
+    bool success = state->file.open(pathNative, error);
+    env->ReleaseStringUTFChars(path, pathNative);
+    if (success)
+    {
+        success = binary ? parseBinaryHeader(state, error) : parseMatrixMarket(state, error);
+    }
+    if (!binary)
+    {
+        state->file.close();
+    }
+    if (!success)
+    {
+        delete state;
+        ThrowByName(env, "java/io/IOException", error.c_str());
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    jlong headerNative[HEADER_COUNT];
+    headerNative[HEADER_M] = state->m;
+    headerNative[HEADER_N] = state->n;
+    headerNative[HEADER_NNZ] = state->nnz;
+    headerNative[HEADER_COMPLEX] = state->complex ? 1 : 0;
+    env->SetLongArrayRegion(header, 0, HEADER_COUNT, headerNative);
+    setNativePointerValue(env, reader, (jlong)state);
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseMatrixIO_openMatrixMarketNative(JNIEnv *env, jclass cls, jstring path, jobject reader, jlongArray header)
+{
+    return openFile(env, path, reader, header, false);
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseMatrixIO_openBinaryNative(JNIEnv *env, jclass cls, jstring path, jobject reader, jlongArray header)
+{
+    return openFile(env, path, reader, header, true);
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseMatrixIO_readNative(JNIEnv *env, jclass cls, jobject reader, jobject csrRowPtr, jobject csrColInd, jobject csrVal)
+{
+    if (reader == NULL || csrRowPtr == NULL || csrColInd == NULL || csrVal == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for SparseMatrixIO read");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    ReaderState *state = (ReaderState*)getNativePointerValue(env, reader);
+    if (state == NULL)
+    {
+        ThrowByName(env, "java/lang/IllegalStateException", "The reader has been destroyed");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    Logger::log(LOG_TRACE, "Executing SparseMatrixIO read(m=%d, nnz=%d)\n", state->m, state->nnz);
+
+    PointerData *csrRowPtr_pointerData = initPointerData(env, csrRowPtr);
+    if (csrRowPtr_pointerData == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *csrColInd_pointerData = initPointerData(env, csrColInd);
+    if (csrColInd_pointerData == NULL)
+    {
+        releasePointerData(env, csrRowPtr_pointerData, JNI_ABORT);
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *csrVal_pointerData = initPointerData(env, csrVal);
+    if (csrVal_pointerData == NULL)
+    {
+        releasePointerData(env, csrRowPtr_pointerData, JNI_ABORT);
+        releasePointerData(env, csrColInd_pointerData, JNI_ABORT);
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    int *rowPtr = (int*)csrRowPtr_pointerData->getPointer(env);
+    int *colInd = (int*)csrColInd_pointerData->getPointer(env);
+    double *val = (double*)csrVal_pointerData->getPointer(env);
+    if (state->binary)
+    {
+        const char *data = state->file.data;
+        size_t valueBytes = sizeof(double) * (size_t)state->nnz * (state->complex ? 2 : 1);
+        parallelCopy(rowPtr, data + BINARY_HEADER_SIZE, sizeof(int) * ((size_t)state->m + 1));
+        parallelCopy(colInd, data + state->colIndOffset, sizeof(int) * (size_t)state->nnz);
+        parallelCopy(val, data + state->valOffset, valueBytes);
+    }
+    else
+    {
+        convertToCsr(state, rowPtr, colInd, val);
+    }
+
+    if (!releasePointerData(env, csrRowPtr_pointerData, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, csrColInd_pointerData, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, csrVal_pointerData, 0)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_SparseMatrixIO_destroyNative(JNIEnv *env, jclass cls, jobject reader)
+{
+    if (reader == NULL)
+    {
+        return;
+    }
+    Logger::log(LOG_TRACE, "Executing SparseMatrixIO destroy\n");
+    ReaderState *state = (ReaderState*)getNativePointerValue(env, reader);
+    delete state;
+    setNativePointerValue(env, reader, 0);
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseMatrixIO_writeBinaryNative(JNIEnv *env, jclass cls, jstring path, jint m, jint n, jint nnz, jboolean complex, jobject csrRowPtr, jobject csrColInd, jobject csrVal)
+{
+    if (path == NULL || csrRowPtr == NULL || csrColInd == NULL || csrVal == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for SparseMatrixIO writeBinary");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    if (m < 0 || n < 0 || nnz < 0)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    const char *pathNative = env->GetStringUTFChars(path, NULL);
+    if (pathNative == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    Logger::log(LOG_TRACE, "Executing SparseMatrixIO writeBinary(%s, m=%d, n=%d, nnz=%d)\n", pathNative, m, n, nnz);
+
+    std::string pathString(pathNative);
+    env->ReleaseStringUTFChars(path, pathNative);
+    PointerData *csrRowPtr_pointerData = initPointerData(env, csrRowPtr);
+    if (csrRowPtr_pointerData == NULL)
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *csrColInd_pointerData = initPointerData(env, csrColInd);
+    if (csrColInd_pointerData == NULL)
+    {
+        releasePointerData(env, csrRowPtr_pointerData, JNI_ABORT);
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    PointerData *csrVal_pointerData = initPointerData(env, csrVal);
+    if (csrVal_pointerData == NULL)
+    {
+        releasePointerData(env, csrRowPtr_pointerData, JNI_ABORT);
+        releasePointerData(env, csrColInd_pointerData, JNI_ABORT);
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    char header[BINARY_HEADER_SIZE] = { 0 };
+    int32_t magic = BINARY_MAGIC;
+    int32_t version = BINARY_VERSION;
+    int32_t flags = complex ? BINARY_FLAG_COMPLEX : 0;
+    int64_t m64 = m;
+    int64_t n64 = n;
+    int64_t nnz64 = nnz;
+    std::memcpy(header, &magic, 4);
+    std::memcpy(header + 4, &version, 4);
+    std::memcpy(header + 8, &flags, 4);
+    std::memcpy(header + 16, &m64, 8);
+    std::memcpy(header + 24, &n64, 8);
+    std::memcpy(header + 32, &nnz64, 8);
+    size_t indexBytes = sizeof(int) * ((size_t)m + 1 + (size_t)nnz);
+    size_t padding = binaryValueOffset(m, nnz) - BINARY_HEADER_SIZE - indexBytes;
+    char zeros[8] = { 0 };
+    size_t valueCount = (size_t)nnz * (complex ? 2 : 1);
+
+    bool success = false;
+    FILE *file = std::fopen(pathString.c_str(), "wb");
+    if (file != NULL)
+    {
+        success = 
+            std::fwrite(header, 1, BINARY_HEADER_SIZE, file) == BINARY_HEADER_SIZE &&
+            std::fwrite(csrRowPtr_pointerData->getPointer(env), sizeof(int), (size_t)m + 1, file) == (size_t)m + 1 &&
+            std::fwrite(csrColInd_pointerData->getPointer(env), sizeof(int), (size_t)nnz, file) == (size_t)nnz &&
+            std::fwrite(zeros, 1, padding, file) == padding &&
+            std::fwrite(csrVal_pointerData->getPointer(env), sizeof(double), valueCount, file) == valueCount;
+        success = (std::fclose(file) == 0) && success;
+    }
+
+    if (!releasePointerData(env, csrRowPtr_pointerData, JNI_ABORT)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, csrColInd_pointerData, JNI_ABORT)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!releasePointerData(env, csrVal_pointerData, JNI_ABORT)) return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    if (!success)
+    {
+        std::string error = "Could not write " + pathString;
+        ThrowByName(env, "java/io/IOException", error.c_str());
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    return CUSOLVER_STATUS_SUCCESS;
+}
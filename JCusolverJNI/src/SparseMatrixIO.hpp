@@ -0,0 +1,81 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+ /* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class jcuda_jcusolver_SparseMatrixIO */
+
+#ifndef _Included_jcuda_jcusolver_SparseMatrixIO
+#define _Included_jcuda_jcusolver_SparseMatrixIO
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*
+     * Class:     jcuda_jcusolver_SparseMatrixIO
+     * Method:    openMatrixMarketNative
+     * Signature: (Ljava/lang/String;Ljcuda/jcusolver/SparseMatrixIO$Reader;[J)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseMatrixIO_openMatrixMarketNative
+        (JNIEnv *, jclass, jstring, jobject, jlongArray);
+
+    /*
+     * Class:     jcuda_jcusolver_SparseMatrixIO
+     * Method:    openBinaryNative
+     * Signature: (Ljava/lang/String;Ljcuda/jcusolver/SparseMatrixIO$Reader;[J)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseMatrixIO_openBinaryNative
+        (JNIEnv *, jclass, jstring, jobject, jlongArray);
+
+    /*
+     * Class:     jcuda_jcusolver_SparseMatrixIO
+     * Method:    readNative
+     * Signature: (Ljcuda/jcusolver/SparseMatrixIO$Reader;Ljcuda/Pointer;Ljcuda/Pointer;Ljcuda/Pointer;)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseMatrixIO_readNative
+        (JNIEnv *, jclass, jobject, jobject, jobject, jobject);
+
+    /*
+     * Class:     jcuda_jcusolver_SparseMatrixIO
+     * Method:    destroyNative
+     * Signature: (Ljcuda/jcusolver/SparseMatrixIO$Reader;)V
+     */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_SparseMatrixIO_destroyNative
+        (JNIEnv *, jclass, jobject);
+
+    /*
+     * Class:     jcuda_jcusolver_SparseMatrixIO
+     * Method:    writeBinaryNative
+     * Signature: (Ljava/lang/String;IIIZLjcuda/Pointer;Ljcuda/Pointer;Ljcuda/Pointer;)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseMatrixIO_writeBinaryNative
+        (JNIEnv *, jclass, jstring, jint, jint, jint, jboolean, jobject, jobject, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,402 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "SparseScaling.hpp"
+#include "JCusolver_common.hpp"
+#include "HostUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// The number of rows that one thread processes at once
+#define ROW_GRAIN 4096
+
+// The number of vector elements that one thread processes at once
+#define VECTOR_GRAIN (1 << 16)
+
+/**
+ * Returns the power of two that scales the given maximum absolute
+ * value into [0.5, 1), or 1.0 if the maximum is zero or not finite.
+ * Powers of two do not introduce rounding errors.
+ */
+static double powerOfTwoScale(double maximum)
+{
+    if (!(maximum > 0.0) || !std::isfinite(maximum))
+    {
+        return 1.0;
+    }
+    int exponent = 0;
+    std::frexp(maximum, &exponent);
+    return std::ldexp(1.0, -exponent);
+}
+
+/**
+ * Atomically sets the given value to the maximum of its current value 
+ * and the given candidate. The values are the bit patterns of 
+ * non-negative doubles, which are ordered like the doubles.
+ */
+static void atomicMax(std::atomic<unsigned long long> &value, double candidate)
+{
+    unsigned long long bits = 0;
+    std::memcpy(&bits, &candidate, sizeof(double));
+    unsigned long long current = value.load(std::memory_order_relaxed);
+    while (bits > current && 
+        !value.compare_exchange_weak(current, bits, std::memory_order_relaxed))
+    {
+        // Retry with the updated current value
+    }
+}
+
+/**
+ * Returns whether the given array contains a permutation of [0, n)
+ */
+static bool isPermutation(const int *p, int n)
+{
+    std::vector<char> seen(n, 0);
+    for (int i = 0; i < n; i++)
+    {
+        if (p[i] < 0 || p[i] >= n || seen[p[i]])
+        {
+            return false;
+        }
+        seen[p[i]] = 1;
+    }
+    return true;
+}
+
+/**
+ * Returns whether the given array is not NULL and too small to store
+ * a rows-by-columns matrix with the given leading dimension
+ */
+static bool isTooSmall(JNIEnv *env, jarray array, jint rows, jint columns, jint ld)
+{
+    if (array == NULL || columns == 0)
+    {
+        return false;
+    }
+    jlong required = (jlong)ld * (columns - 1) + rows;
+    return env->GetArrayLength(array) < required;
+}
+
+/**
+ * Computes dst[k] = scale[k] * src[p[k]] for k in [begin, end). 
+ * The scale may be NULL, meaning 1.0. The permutation may be NULL, 
+ * meaning the identity.
+ */
+static void scaledGather(const double *src, const int *p, const double *scale, double *dst, size_t begin, size_t end)
+{
+    size_t k = begin;
+    if (p == NULL)
+    {
+        if (scale == NULL)
+        {
+            std::memcpy(dst + begin, src + begin, (end - begin) * sizeof(double));
+            return;
+        }
+        for (; k < end; k++)
+        {
+            dst[k] = scale[k] * src[k];
+        }
+        return;
+    }
+#if defined(__AVX2__)
+    for (; k + 4 <= end; k += 4)
+    {
+        __m128i index = _mm_loadu_si128((const __m128i*)(p + k));
+        __m256d gathered = _mm256_i32gather_pd(src, index, 8);
+        if (scale != NULL)
+        {
+            gathered = _mm256_mul_pd(gathered, _mm256_loadu_pd(scale + k));
+        }
+        _mm256_storeu_pd(dst + k, gathered);
+    }
+#endif
+    for (; k < end; k++)
+    {
+        double value = src[p[k]];
+        dst[k] = scale == NULL ? value : scale[k] * value;
+    }
+}
+
+/**
+ * Computes dst[p[k]] = scale[k] * src[k] for k in [begin, end). 
+ * The scale may be NULL, meaning 1.0. The permutation may be NULL, 
+ * meaning the identity.
+ */
+static void scaledScatter(const double *src, const int *p, const double *scale, double *dst, size_t begin, size_t end)
+{
+    if (p == NULL)
+    {
+        scaledGather(src, NULL, scale, dst, begin, end);
+        return;
+    }
+    for (size_t k = begin; k < end; k++)
+    {
+        dst[p[k]] = scale == NULL ? src[k] : scale[k] * src[k];
+    }
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseScaling_equilibrateNative(JNIEnv *env, jclass cls, jint m, jint n, jint nnz, jint indexBase, jintArray csrRowPtrA, jintArray csrColIndA, jdoubleArray csrValA, jdoubleArray rowScale, jdoubleArray colScale)
+{
+    if (csrRowPtrA == NULL || csrColIndA == NULL || csrValA == NULL || rowScale == NULL || colScale == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for SparseScaling equilibrate");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    Logger::log(LOG_TRACE, "Executing SparseScaling equilibrate(m=%d, n=%d, nnz=%d)\n", m, n, nnz);
+
+    if (m < 0 || n < 0 || nnz < 0 ||
+        env->GetArrayLength(csrRowPtrA) < m + 1 ||
+        env->GetArrayLength(csrColIndA) < nnz ||
+        env->GetArrayLength(csrValA) < nnz ||
+        env->GetArrayLength(rowScale) < m ||
+        env->GetArrayLength(colScale) < n)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<std::atomic<unsigned long long> > columnMaxima(n);
+    for (int j = 0; j < n; j++)
+    {
+        columnMaxima[j].store(0, std::memory_order_relaxed);
+    }
+    std::atomic<bool> invalid(false);
+    {
+        CriticalArray<jint> rowPtr(env, csrRowPtrA, false);
+        CriticalArray<jint> colInd(env, csrColIndA, false);
+        CriticalArray<jdouble> val(env, csrValA, false);
+        CriticalArray<jdouble> r(env, rowScale, true);
+        CriticalArray<jdouble> c(env, colScale, true);
+        if (rowPtr.isFailed() || colInd.isFailed() || val.isFailed() || r.isFailed() || c.isFailed())
+        {
+            return JCUSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        const jint *rp = rowPtr.data();
+        const jint *ci = colInd.data();
+        const jdouble *v = val.data();
+        jdouble *rs = r.data();
+        jdouble *cs = c.data();
+
+        // Scale the rows, and compute the maxima of the scaled columns
+        parallelFor((size_t)m, ROW_GRAIN, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                int start = rp[i] - indexBase;
+                int stop = rp[i + 1] - indexBase;
+                if (start < 0 || stop > nnz || start > stop)
+                {
+                    invalid.store(true);
+                    return;
+                }
+                double maximum = 0.0;
+                for (int k = start; k < stop; k++)
+                {
+                    maximum = std::max(maximum, std::fabs(v[k]));
+                }
+                double scale = powerOfTwoScale(maximum);
+                rs[i] = scale;
+                for (int k = start; k < stop; k++)
+                {
+                    int j = ci[k] - indexBase;
+                    if (j < 0 || j >= n)
+                    {
+                        invalid.store(true);
+                        return;
+                    }
+                    atomicMax(columnMaxima[j], scale * std::fabs(v[k]));
+                }
+            }
+        });
+        if (!invalid.load())
+        {
+            parallelFor((size_t)n, VECTOR_GRAIN, [&](size_t begin, size_t end)
+            {
+                for (size_t j = begin; j < end; j++)
+                {
+                    unsigned long long bits = columnMaxima[j].load(std::memory_order_relaxed);
+                    double maximum = 0.0;
+                    std::memcpy(&maximum, &bits, sizeof(double));
+                    cs[j] = powerOfTwoScale(maximum);
+                }
+            });
+        }
+    }
+    return invalid.load() ? CUSOLVER_STATUS_INVALID_VALUE : CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseScaling_scaleValuesNative(JNIEnv *env, jclass cls, jint m, jint nnz, jint indexBase, jintArray csrRowPtrA, jintArray csrColIndA, jdoubleArray csrValA, jintArray map, jdoubleArray rowScale, jdoubleArray colScale, jdoubleArray csrValB)
+{
+    if (csrRowPtrA == NULL || csrColIndA == NULL || csrValA == NULL || rowScale == NULL || colScale == NULL || csrValB == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for SparseScaling scaleValues");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    // map may be null
+
+    Logger::log(LOG_TRACE, "Executing SparseScaling scaleValues(m=%d, nnz=%d)\n", m, nnz);
+
+    // The number of columns is only given by the column scaling factors
+    jint n = env->GetArrayLength(colScale);
+    jint nnzA = env->GetArrayLength(csrValA);
+    if (m < 0 || nnz < 0 ||
+        env->GetArrayLength(csrRowPtrA) < m + 1 ||
+        env->GetArrayLength(csrColIndA) < nnz ||
+        (map == NULL && nnzA < nnz) ||
+        (map != NULL && env->GetArrayLength(map) < nnz) ||
+        env->GetArrayLength(rowScale) < m ||
+        env->GetArrayLength(csrValB) < nnz)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    std::atomic<bool> invalid(false);
+    CriticalArray<jint> rowPtr(env, csrRowPtrA, false);
+    CriticalArray<jint> colInd(env, csrColIndA, false);
+    CriticalArray<jdouble> valA(env, csrValA, false);
+    CriticalArray<jint> mapArray(env, map, false);
+    CriticalArray<jdouble> r(env, rowScale, false);
+    CriticalArray<jdouble> c(env, colScale, false);
+    CriticalArray<jdouble> valB(env, csrValB, true);
+    if (rowPtr.isFailed() || colInd.isFailed() || valA.isFailed() || mapArray.isFailed() ||
+        r.isFailed() || c.isFailed() || valB.isFailed())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    const jint *rp = rowPtr.data();
+    const jint *ci = colInd.data();
+    const jint *mp = mapArray.data();
+    const jdouble *src = valA.data();
+    const jdouble *rs = r.data();
+    const jdouble *cs = c.data();
+    jdouble *dst = valB.data();
+    parallelFor((size_t)m, ROW_GRAIN, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            int start = rp[i] - indexBase;
+            int stop = rp[i + 1] - indexBase;
+            if (start < 0 || stop > nnz || start > stop)
+            {
+                invalid.store(true);
+                return;
+            }
+            double scale = rs[i];
+            for (int k = start; k < stop; k++)
+            {
+                int source = mp == NULL ? k : mp[k];
+                int j = ci[k] - indexBase;
+                if (source < 0 || source >= nnzA || j < 0 || j >= n)
+                {
+                    invalid.store(true);
+                    return;
+                }
+                dst[k] = scale * src[source] * cs[j];
+            }
+        }
+    });
+    return invalid.load() ? CUSOLVER_STATUS_INVALID_VALUE : CUSOLVER_STATUS_SUCCESS;
+}
+
+/**
+ * Implementation of gatherNative and scatterNative
+ */
+static jint transformVectors(JNIEnv *env, bool scatter, jint n, jint nrhs, jdoubleArray src, jint ldSrc, jintArray p, jdoubleArray scale, jdoubleArray dst, jint ldDst)
+{
+    if (src == NULL || dst == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for SparseScaling vector transform");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    // p and scale may be null
+
+    Logger::log(LOG_TRACE, "Executing SparseScaling %s(n=%d, nrhs=%d)\n", scatter ? "scatter" : "gather", n, nrhs);
+
+    if (n < 0 || nrhs < 0 || ldSrc < n || ldDst < n ||
+        isTooSmall(env, src, n, nrhs, ldSrc) ||
+        isTooSmall(env, dst, n, nrhs, ldDst) ||
+        (p != NULL && env->GetArrayLength(p) < n) ||
+        (scale != NULL && env->GetArrayLength(scale) < n))
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    CriticalArray<jdouble> srcArray(env, src, false);
+    CriticalArray<jint> pArray(env, p, false);
+    CriticalArray<jdouble> scaleArray(env, scale, false);
+    CriticalArray<jdouble> dstArray(env, dst, true);
+    if (srcArray.isFailed() || pArray.isFailed() || scaleArray.isFailed() || dstArray.isFailed())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    // The permutation is validated on each call, because this function
+    // may be called with any array, and an invalid permutation would
+    // cause out-of-bounds accesses in the gather and the scatter
+    const jint *permutation = pArray.data();
+    if (permutation != NULL && !isPermutation(permutation, n))
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    const jdouble *s = srcArray.data();
+    const jdouble *f = scaleArray.data();
+    jdouble *d = dstArray.data();
+    for (int j = 0; j < nrhs; j++)
+    {
+        const double *column = s + (size_t)j * ldSrc;
+        double *result = d + (size_t)j * ldDst;
+        parallelFor((size_t)n, VECTOR_GRAIN, [&](size_t begin, size_t end)
+        {
+            if (scatter)
+            {
+                scaledScatter(column, permutation, f, result, begin, end);
+            }
+            else
+            {
+                scaledGather(column, permutation, f, result, begin, end);
+            }
+        });
+    }
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseScaling_gatherNative(JNIEnv *env, jclass cls, jint n, jint nrhs, jdoubleArray src, jint ldSrc, jintArray p, jdoubleArray scale, jdoubleArray dst, jint ldDst)
+{
+    return transformVectors(env, false, n, nrhs, src, ldSrc, p, scale, dst, ldDst);
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseScaling_scatterNative(JNIEnv *env, jclass cls, jint n, jint nrhs, jdoubleArray src, jint ldSrc, jintArray p, jdoubleArray scale, jdoubleArray dst, jint ldDst)
+{
+    return transformVectors(env, true, n, nrhs, src, ldSrc, p, scale, dst, ldDst);
+}
@@ -0,0 +1,73 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+ /* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class jcuda_jcusolver_SparseScaling */
+
+#ifndef _Included_jcuda_jcusolver_SparseScaling
+#define _Included_jcuda_jcusolver_SparseScaling
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*
+     * Class:     jcuda_jcusolver_SparseScaling
+     * Method:    equilibrateNative
+     * Signature: (IIII[I[I[D[D[D)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseScaling_equilibrateNative
+        (JNIEnv *, jclass, jint, jint, jint, jint, jintArray, jintArray, jdoubleArray, jdoubleArray, jdoubleArray);
+
+    /*
+     * Class:     jcuda_jcusolver_SparseScaling
+     * Method:    scaleValuesNative
+     * Signature: (III[I[I[D[I[D[D[D)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseScaling_scaleValuesNative
+        (JNIEnv *, jclass, jint, jint, jint, jintArray, jintArray, jdoubleArray, jintArray, jdoubleArray, jdoubleArray, jdoubleArray);
+
+    /*
+     * Class:     jcuda_jcusolver_SparseScaling
+     * Method:    gatherNative
+     * Signature: (II[DI[I[D[DI)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseScaling_gatherNative
+        (JNIEnv *, jclass, jint, jint, jdoubleArray, jint, jintArray, jdoubleArray, jdoubleArray, jint);
+
+    /*
+     * Class:     jcuda_jcusolver_SparseScaling
+     * Method:    scatterNative
+     * Signature: (II[DI[I[D[DI)I
+     */
+    JNIEXPORT jint JNICALL Java_jcuda_jcusolver_SparseScaling_scatterNative
+        (JNIEnv *, jclass, jint, jint, jdoubleArray, jint, jintArray, jdoubleArray, jdoubleArray, jint);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
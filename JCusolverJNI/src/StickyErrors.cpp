@@ -0,0 +1,107 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "StickyErrors.hpp"
+
+namespace
+{
+    /**
+     * The sticky error slot of a thread
+     */
+    struct StickyErrorSlot
+    {
+        bool enabled = false;
+        int functionId = -1;
+        int status = 0;
+        int64_t args[4] = { 0, 0, 0, 0 };
+        int64_t failedCount = 0;
+    };
+
+    thread_local StickyErrorSlot slot;
+}
+
+namespace StickyErrors
+{
+    void record(int functionId, int status, const int64_t *args)
+    {
+        StickyErrorSlot &s = slot;
+        if (!s.enabled)
+        {
+            return;
+        }
+        s.failedCount++;
+        if (s.functionId < 0)
+        {
+            s.functionId = functionId;
+            s.status = status;
+            for (int i = 0; i < 4; i++)
+            {
+                s.args[i] = args[i];
+            }
+        }
+    }
+
+    void setEnabled(bool enabled)
+    {
+        if (enabled)
+        {
+            clear();
+        }
+        slot.enabled = enabled;
+    }
+
+    bool isEnabled()
+    {
+        return slot.enabled;
+    }
+
+    bool get(int *functionId, int *status, int64_t *args, int64_t *failedCount)
+    {
+        const StickyErrorSlot &s = slot;
+        if (s.functionId < 0)
+        {
+            return false;
+        }
+        *functionId = s.functionId;
+        *status = s.status;
+        for (int i = 0; i < 4; i++)
+        {
+            args[i] = s.args[i];
+        }
+        *failedCount = s.failedCount;
+        return true;
+    }
+
+    void clear()
+    {
+        StickyErrorSlot &s = slot;
+        s.functionId = -1;
+        s.status = 0;
+        s.failedCount = 0;
+    }
+}
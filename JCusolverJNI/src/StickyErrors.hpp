@@ -0,0 +1,69 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCUSOLVER_STICKY_ERRORS_HPP
+#define JCUSOLVER_STICKY_ERRORS_HPP
+
+#include <cstdint>
+
+namespace StickyErrors
+{
+    /**
+     * Records the failed call of the function with the given ID and 
+     * the given recorded arguments in the sticky error slot of the 
+     * calling thread, if sticky errors are enabled for the thread. 
+     * Only the first failed call is stored. Later ones are only counted.
+     */
+    void record(int functionId, int status, const int64_t *args);
+
+    /**
+     * Enables or disables sticky errors for the calling thread. Enabling
+     * them clears the slot.
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * Returns whether sticky errors are enabled for the calling thread
+     */
+    bool isEnabled();
+
+    /**
+     * Obtains the sticky error of the calling thread. Returns false if 
+     * no call failed since the slot was cleared. Otherwise, the 
+     * function ID, the status and the 4 recorded arguments of the first 
+     * failed call, and the number of failed calls are stored.
+     */
+    bool get(int *functionId, int *status, int64_t *args, int64_t *failedCount);
+
+    /**
+     * Clears the sticky error slot of the calling thread
+     */
+    void clear();
+}
+
+#endif
@@ -0,0 +1,347 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "StructureAnalyzer.hpp"
+#include "JCusolver_common.hpp"
+#include "HostUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+// The number of rows that one thread processes at once
+#define ROW_GRAIN 2048
+
+// The indices of the results. These must match the constants in
+// StructureAnalyzer.java
+#define RESULT_STRUCTURALLY_SYMMETRIC 0
+#define RESULT_NUMERICALLY_SYMMETRIC 1
+#define RESULT_POSITIVE_DIAGONAL 2
+#define RESULT_DIAGONALLY_DOMINANT 3
+#define RESULT_LOWER_BANDWIDTH 4
+#define RESULT_UPPER_BANDWIDTH 5
+#define RESULT_PROFILE 6
+#define RESULT_EMPTY_ROWS 7
+#define RESULT_DUPLICATE_ENTRIES 8
+#define RESULT_UNSORTED_ROWS 9
+#define RESULT_MISSING_DIAGONAL 10
+#define RESULT_COUNT 11
+
+/**
+ * The per-row properties, accumulated over a block of rows
+ */
+struct RowSummary
+{
+    long long lowerBandwidth;
+    long long upperBandwidth;
+    long long profile;
+    long long emptyRows;
+    long long duplicateEntries;
+    long long unsortedRows;
+    long long missingDiagonal;
+    bool positiveDiagonal;
+    bool diagonallyDominant;
+    bool invalid;
+
+    RowSummary() : lowerBandwidth(0), upperBandwidth(0), profile(0), emptyRows(0),
+        duplicateEntries(0), unsortedRows(0), missingDiagonal(0),
+        positiveDiagonal(true), diagonallyDominant(true), invalid(false)
+    {
+    }
+
+    void merge(const RowSummary &other)
+    {
+        lowerBandwidth = std::max(lowerBandwidth, other.lowerBandwidth);
+        upperBandwidth = std::max(upperBandwidth, other.upperBandwidth);
+        profile += other.profile;
+        emptyRows += other.emptyRows;
+        duplicateEntries += other.duplicateEntries;
+        unsortedRows += other.unsortedRows;
+        missingDiagonal += other.missingDiagonal;
+        positiveDiagonal = positiveDiagonal && other.positiveDiagonal;
+        diagonallyDominant = diagonallyDominant && other.diagonallyDominant;
+        invalid = invalid || other.invalid;
+    }
+};
+
+/**
+ * Analyzes the rows in [begin, end). The column indices of each row
+ * are written, sorted and zero-based, into the sorted arrays, together
+ * with the corresponding values if they are present. The summary is
+ * marked as invalid if a row range is not in [0, nnz], or a column 
+ * index is out of range.
+ */
+static RowSummary analyzeRows(size_t begin, size_t end, int n, int nnz, int base,
+    const int *rowPtr, const int *colInd, const double *val,
+    int *sortedColInd, double *sortedVal)
+{
+    RowSummary summary;
+    std::vector<std::pair<int, double> > row;
+    for (size_t r = begin; r < end; r++)
+    {
+        int start = rowPtr[r] - base;
+        int stop = rowPtr[r + 1] - base;
+        if (start < 0 || stop > nnz || start > stop)
+        {
+            summary.invalid = true;
+            return summary;
+        }
+        int length = stop - start;
+        if (length == 0)
+        {
+            summary.emptyRows++;
+            summary.missingDiagonal++;
+            summary.positiveDiagonal = false;
+            summary.diagonallyDominant = false;
+            continue;
+        }
+        row.resize(length);
+        bool sorted = true;
+        for (int i = 0; i < length; i++)
+        {
+            row[i].first = colInd[start + i] - base;
+            row[i].second = val == NULL ? 0.0 : val[start + i];
+            if (row[i].first < 0 || row[i].first >= n)
+            {
+                summary.invalid = true;
+                return summary;
+            }
+            if (i > 0 && row[i].first < row[i - 1].first)
+            {
+                sorted = false;
+            }
+        }
+        if (!sorted)
+        {
+            summary.unsortedRows++;
+            std::stable_sort(row.begin(), row.end(),
+                [](const std::pair<int, double> &a, const std::pair<int, double> &b)
+                {
+                    return a.first < b.first;
+                });
+        }
+
+        int rowIndex = (int)r;
+        double diagonal = 0.0;
+        double offDiagonal = 0.0;
+        bool hasDiagonal = false;
+        for (int i = 0; i < length; i++)
+        {
+            int c = row[i].first;
+            sortedColInd[start + i] = c;
+            if (sortedVal != NULL)
+            {
+                sortedVal[start + i] = row[i].second;
+            }
+            if (i > 0 && c == row[i - 1].first)
+            {
+                summary.duplicateEntries++;
+            }
+            if (c == rowIndex)
+            {
+                hasDiagonal = true;
+                diagonal += row[i].second;
+            }
+            else
+            {
+                offDiagonal += std::fabs(row[i].second);
+            }
+        }
+        int first = row[0].first;
+        int last = row[length - 1].first;
+        summary.lowerBandwidth = std::max(summary.lowerBandwidth, (long long)(rowIndex - first));
+        summary.upperBandwidth = std::max(summary.upperBandwidth, (long long)(last - rowIndex));
+        if (first < rowIndex)
+        {
+            summary.profile += rowIndex - first;
+        }
+        if (!hasDiagonal)
+        {
+            summary.missingDiagonal++;
+        }
+        if (val != NULL)
+        {
+            if (!(diagonal > 0.0))
+            {
+                summary.positiveDiagonal = false;
+            }
+            if (!(std::fabs(diagonal) >= offDiagonal))
+            {
+                summary.diagonallyDominant = false;
+            }
+        }
+    }
+    return summary;
+}
+
+/**
+ * Returns the sum of the values of the run of entries with the given 
+ * column index that starts at the given position
+ */
+static double sumRun(const int *colInd, const double *val, int position, int stop, int column)
+{
+    double sum = 0.0;
+    for (int i = position; i < stop && colInd[i] == column; i++)
+    {
+        sum += val[i];
+    }
+    return sum;
+}
+
+/**
+ * Analyzes the symmetry of the sorted, zero-based structure, in parallel.
+ * Duplicates are ignored for the structural symmetry, and summed up for
+ * the numeric symmetry.
+ */
+static void analyzeSymmetry(int n, const int *rowPtr, int base,
+    const int *colInd, const double *val, double tol,
+    bool &structurallySymmetric, bool &numericallySymmetric)
+{
+    std::atomic<bool> structural(true);
+    std::atomic<bool> numeric(val != NULL);
+    parallelFor((size_t)n, ROW_GRAIN, [&](size_t begin, size_t end)
+    {
+        for (size_t r = begin; r < end && structural.load(std::memory_order_relaxed); r++)
+        {
+            int start = rowPtr[r] - base;
+            int stop = rowPtr[r + 1] - base;
+            for (int i = start; i < stop; i++)
+            {
+                int c = colInd[i];
+                if (c == (int)r || (i > start && c == colInd[i - 1]))
+                {
+                    // The diagonal, or a duplicate, which was summed 
+                    // with the first entry of its run
+                    continue;
+                }
+                const int *otherBegin = colInd + (rowPtr[c] - base);
+                const int *otherEnd = colInd + (rowPtr[c + 1] - base);
+                const int *found = std::lower_bound(otherBegin, otherEnd, (int)r);
+                if (found == otherEnd || *found != (int)r)
+                {
+                    structural.store(false, std::memory_order_relaxed);
+                    break;
+                }
+                if (val != NULL && numeric.load(std::memory_order_relaxed))
+                {
+                    int otherStop = rowPtr[c + 1] - base;
+                    double a = sumRun(colInd, val, i, stop, c);
+                    double b = sumRun(colInd, val, (int)(found - colInd), otherStop, (int)r);
+                    double scale = std::max(std::fabs(a), std::fabs(b));
+                    if (std::fabs(a - b) > tol * scale)
+                    {
+                        numeric.store(false, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+    });
+    structurallySymmetric = structural.load();
+    numericallySymmetric = structurallySymmetric && numeric.load();
+}
+
+JNIEXPORT jint JNICALL Java_jcuda_jcusolver_StructureAnalyzer_analyzeNative(JNIEnv *env, jclass cls, jint m, jint n, jint nnz, jint indexBase, jintArray csrRowPtrA, jintArray csrColIndA, jdoubleArray csrValA, jdouble tol, jlongArray results)
+{
+    if (csrRowPtrA == NULL || csrColIndA == NULL || results == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter is null for StructureAnalyzer analyze");
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    // csrValA may be null
+
+    Logger::log(LOG_TRACE, "Executing StructureAnalyzer analyze(m=%d, n=%d, nnz=%d, indexBase=%d)\n",
+        m, n, nnz, indexBase);
+
+    if (m < 0 || n < 0 || nnz < 0 ||
+        env->GetArrayLength(csrRowPtrA) < m + 1 ||
+        env->GetArrayLength(csrColIndA) < nnz ||
+        (csrValA != NULL && env->GetArrayLength(csrValA) < nnz))
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<int> sortedColInd(nnz);
+    std::vector<double> sortedVal(csrValA == NULL ? 0 : nnz);
+    jlong output[RESULT_COUNT];
+    {
+        CriticalArray<jint> rowPtr(env, csrRowPtrA, false);
+        CriticalArray<jint> colInd(env, csrColIndA, false);
+        CriticalArray<jdouble> val(env, csrValA, false);
+        if (rowPtr.isFailed() || colInd.isFailed() || val.isFailed())
+        {
+            return JCUSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        const int *rowPtrNative = (const int*)rowPtr.data();
+        if (rowPtrNative[0] != indexBase || rowPtrNative[m] - indexBase != nnz)
+        {
+            return CUSOLVER_STATUS_INVALID_VALUE;
+        }
+        double *sortedValPointer = csrValA == NULL ? NULL : sortedVal.data();
+
+        RowSummary summary;
+        std::mutex mutex;
+        parallelFor((size_t)m, ROW_GRAIN, [&](size_t begin, size_t end)
+        {
+            RowSummary local = analyzeRows(begin, end, n, nnz, indexBase, rowPtrNative,
+                (const int*)colInd.data(), val.data(), sortedColInd.data(), sortedValPointer);
+            std::lock_guard<std::mutex> lock(mutex);
+            summary.merge(local);
+        });
+        if (summary.invalid)
+        {
+            return CUSOLVER_STATUS_INVALID_VALUE;
+        }
+
+        bool structurallySymmetric = false;
+        bool numericallySymmetric = false;
+        if (m == n)
+        {
+            analyzeSymmetry(n, rowPtrNative, indexBase, sortedColInd.data(),
+                sortedValPointer, tol, structurallySymmetric, numericallySymmetric);
+        }
+        bool hasValues = csrValA != NULL;
+        output[RESULT_STRUCTURALLY_SYMMETRIC] = structurallySymmetric ? 1 : 0;
+        output[RESULT_NUMERICALLY_SYMMETRIC] = numericallySymmetric ? 1 : 0;
+        output[RESULT_POSITIVE_DIAGONAL] = hasValues && summary.positiveDiagonal ? 1 : 0;
+        output[RESULT_DIAGONALLY_DOMINANT] = hasValues && summary.diagonallyDominant ? 1 : 0;
+        output[RESULT_LOWER_BANDWIDTH] = summary.lowerBandwidth;
+        output[RESULT_UPPER_BANDWIDTH] = summary.upperBandwidth;
+        output[RESULT_PROFILE] = summary.profile;
+        output[RESULT_EMPTY_ROWS] = summary.emptyRows;
+        output[RESULT_DUPLICATE_ENTRIES] = summary.duplicateEntries;
+        output[RESULT_UNSORTED_ROWS] = summary.unsortedRows;
+        output[RESULT_MISSING_DIAGONAL] = m == n ? summary.missingDiagonal : 0;
+    }
+    env->SetLongArrayRegion(results, 0, RESULT_COUNT, output);
+    if (env->ExceptionCheck())
+    {
+        return JCUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    return CUSOLVER_STATUS_SUCCESS;
+}
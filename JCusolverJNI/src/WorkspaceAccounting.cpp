@@ -0,0 +1,520 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "WorkspaceAccounting.hpp"
+#include "JCusolver_common.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// The indices of the totals. These must match the constants in
+// WorkspaceAccounting.java
+#define WORKSPACE_TOTAL_DEVICE_BYTES 0
+#define WORKSPACE_TOTAL_HOST_BYTES 1
+#define WORKSPACE_PEAK_DEVICE_BYTES 2
+#define WORKSPACE_PEAK_HOST_BYTES 3
+#define WORKSPACE_REJECTED 4
+#define WORKSPACE_DEVICE_BUDGET 5
+#define WORKSPACE_HOST_BUDGET 6
+#define WORKSPACE_TOTALS 7
+
+// The indices of the statistics of one function. These must match the 
+// constants in WorkspaceAccounting.java
+#define WORKSPACE_FUNCTION_CALLS 0
+#define WORKSPACE_FUNCTION_LAST_DEVICE_BYTES 1
+#define WORKSPACE_FUNCTION_LAST_HOST_BYTES 2
+#define WORKSPACE_FUNCTION_MAX_DEVICE_BYTES 3
+#define WORKSPACE_FUNCTION_MAX_HOST_BYTES 4
+#define WORKSPACE_FUNCTION_STATS 5
+
+// The indices of the statistics of one handle. These must match the 
+// constants in WorkspaceAccounting.java
+#define WORKSPACE_HANDLE_ADDRESS 0
+#define WORKSPACE_HANDLE_FUNCTION_ID 1
+#define WORKSPACE_HANDLE_THREAD_INDEX 2
+#define WORKSPACE_HANDLE_DEVICE_BYTES 3
+#define WORKSPACE_HANDLE_HOST_BYTES 4
+#define WORKSPACE_HANDLE_MAX_DEVICE_BYTES 5
+#define WORKSPACE_HANDLE_MAX_HOST_BYTES 6
+#define WORKSPACE_HANDLE_DEVICE_COUNT 7
+#define WORKSPACE_HANDLE_STATS 8
+
+// The indices of the statistics of one thread. These must match the 
+// constants in WorkspaceAccounting.java
+#define WORKSPACE_THREAD_CALLS 0
+#define WORKSPACE_THREAD_MAX_DEVICE_BYTES 1
+#define WORKSPACE_THREAD_MAX_HOST_BYTES 2
+#define WORKSPACE_THREAD_STATS 3
+
+namespace
+{
+    /**
+     * The workspace sizes that have been requested for one function
+     */
+    struct FunctionWorkspaces
+    {
+        uint64_t stats[WORKSPACE_FUNCTION_STATS] = {};
+    };
+
+    /**
+     * The workspace sizes that have most recently been requested for 
+     * one handle. The function ID is -1 if only the device count of a 
+     * cusolverMg handle is known.
+     */
+    struct HandleWorkspaces
+    {
+        int functionId = -1;
+        int threadIndex = -1;
+        int deviceCount = 1;
+        uint64_t deviceBytes = 0;
+        uint64_t hostBytes = 0;
+        uint64_t maxDeviceBytes = 0;
+        uint64_t maxHostBytes = 0;
+    };
+
+    /**
+     * The workspace sizes that have been requested by one thread
+     */
+    struct ThreadWorkspaces
+    {
+        std::string name;
+        uint64_t stats[WORKSPACE_THREAD_STATS] = {};
+    };
+
+    /**
+     * The global state, protected by the mutex. The bufferSize functions
+     * are called once before the workspace is allocated, so they are 
+     * not on the hot path, and a single lock is sufficient.
+     */
+    std::mutex mutex;
+    std::vector<FunctionWorkspaces> functions;
+    std::unordered_map<const void*, HandleWorkspaces> handles;
+    std::vector<ThreadWorkspaces> threads;
+    uint64_t totalDeviceBytes = 0;
+    uint64_t totalHostBytes = 0;
+    uint64_t peakDeviceBytes = 0;
+    uint64_t peakHostBytes = 0;
+    uint64_t rejected = 0;
+    uint64_t deviceBudget = 0;
+    uint64_t hostBudget = 0;
+
+    /**
+     * The index of the calling thread in the 'threads', or -1 if the 
+     * thread did not request a workspace yet
+     */
+    thread_local int threadIndex = -1;
+
+    /**
+     * Returns the name of the current Java thread. Any exception that
+     * is caused by this is cleared, because the native function call 
+     * itself has already succeeded.
+     */
+    std::string currentThreadName(JNIEnv *env)
+    {
+        std::string result = "unknown";
+        jclass threadClass = env->FindClass("java/lang/Thread");
+        if (threadClass == NULL)
+        {
+            env->ExceptionClear();
+            return result;
+        }
+        jmethodID currentThread = env->GetStaticMethodID(threadClass, "currentThread", "()Ljava/lang/Thread;");
+        jmethodID getName = env->GetMethodID(threadClass, "getName", "()Ljava/lang/String;");
+        if (currentThread == NULL || getName == NULL)
+        {
+            env->ExceptionClear();
+            env->DeleteLocalRef(threadClass);
+            return result;
+        }
+        jobject thread = env->CallStaticObjectMethod(threadClass, currentThread);
+        jstring name = thread == NULL ? NULL : (jstring)env->CallObjectMethod(thread, getName);
+        if (name != NULL)
+        {
+            const char *chars = env->GetStringUTFChars(name, NULL);
+            if (chars != NULL)
+            {
+                result = chars;
+                env->ReleaseStringUTFChars(name, chars);
+            }
+            env->DeleteLocalRef(name);
+        }
+        if (env->ExceptionCheck())
+        {
+            env->ExceptionClear();
+        }
+        env->DeleteLocalRef(thread);
+        env->DeleteLocalRef(threadClass);
+        return result;
+    }
+
+    /**
+     * Computes the sum of the given values, saturating at the maximum
+     */
+    inline uint64_t add(uint64_t a, uint64_t b)
+    {
+        return (a > UINT64_MAX - b) ? UINT64_MAX : a + b;
+    }
+
+    /**
+     * Throws the CudaException for a workspace request that exceeds 
+     * the given budget. The mutex must be held.
+     */
+    void throwBudgetExceeded(JNIEnv *env, int functionId, const void *handle, 
+        const char *kind, uint64_t requested, uint64_t others, uint64_t budget)
+    {
+        std::string functionName = CallTracer::getFunctionName(functionId);
+        const char *threadName = threads[threadIndex].name.c_str();
+        char message[1024];
+        snprintf(message, sizeof(message),
+            "Workspace budget exceeded: %s for handle %p in thread '%s' requires "
+            "%llu bytes of %s workspace, and %llu bytes are already accounted to "
+            "other handles, but the %s workspace budget is %llu bytes",
+            functionName.c_str(), handle, threadName, 
+            (unsigned long long)requested, kind, (unsigned long long)others,
+            kind, (unsigned long long)budget);
+        ThrowByName(env, "jcuda/CudaException", message);
+    }
+}
+
+namespace WorkspaceAccounting
+{
+    std::atomic<bool> enabled(false);
+
+    bool record(JNIEnv *env, int functionId, const void *handle, uint64_t deviceBytes, uint64_t hostBytes, bool perDevice)
+    {
+        if (functionId < 0)
+        {
+            return true;
+        }
+        std::string threadName;
+        if (threadIndex == -1)
+        {
+            threadName = currentThreadName(env);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (threadIndex == -1)
+        {
+            threadIndex = (int)threads.size();
+            threads.emplace_back();
+            threads.back().name = threadName;
+        }
+        HandleWorkspaces &h = handles[handle];
+        if (perDevice && deviceBytes > 0)
+        {
+            deviceBytes = (deviceBytes > UINT64_MAX / (uint64_t)h.deviceCount) ? UINT64_MAX : deviceBytes * (uint64_t)h.deviceCount;
+        }
+
+        // The workspace that was previously requested for this handle
+        // is replaced, because a handle is used for one call at a time
+        uint64_t otherDeviceBytes = totalDeviceBytes - h.deviceBytes;
+        uint64_t otherHostBytes = totalHostBytes - h.hostBytes;
+        if (deviceBudget > 0 && add(otherDeviceBytes, deviceBytes) > deviceBudget)
+        {
+            rejected++;
+            throwBudgetExceeded(env, functionId, handle, "device", deviceBytes, otherDeviceBytes, deviceBudget);
+            return false;
+        }
+        if (hostBudget > 0 && add(otherHostBytes, hostBytes) > hostBudget)
+        {
+            rejected++;
+            throwBudgetExceeded(env, functionId, handle, "host", hostBytes, otherHostBytes, hostBudget);
+            return false;
+        }
+
+        h.functionId = functionId;
+        h.threadIndex = threadIndex;
+        h.deviceBytes = deviceBytes;
+        h.hostBytes = hostBytes;
+        h.maxDeviceBytes = std::max(h.maxDeviceBytes, deviceBytes);
+        h.maxHostBytes = std::max(h.maxHostBytes, hostBytes);
+        totalDeviceBytes = add(otherDeviceBytes, deviceBytes);
+        totalHostBytes = add(otherHostBytes, hostBytes);
+        peakDeviceBytes = std::max(peakDeviceBytes, totalDeviceBytes);
+        peakHostBytes = std::max(peakHostBytes, totalHostBytes);
+
+        if ((int)functions.size() <= functionId)
+        {
+            functions.resize(functionId + 1);
+        }
+        uint64_t *f = functions[functionId].stats;
+        f[WORKSPACE_FUNCTION_CALLS]++;
+        f[WORKSPACE_FUNCTION_LAST_DEVICE_BYTES] = deviceBytes;
+        f[WORKSPACE_FUNCTION_LAST_HOST_BYTES] = hostBytes;
+        f[WORKSPACE_FUNCTION_MAX_DEVICE_BYTES] = std::max(f[WORKSPACE_FUNCTION_MAX_DEVICE_BYTES], deviceBytes);
+        f[WORKSPACE_FUNCTION_MAX_HOST_BYTES] = std::max(f[WORKSPACE_FUNCTION_MAX_HOST_BYTES], hostBytes);
+
+        uint64_t *t = threads[threadIndex].stats;
+        t[WORKSPACE_THREAD_CALLS]++;
+        t[WORKSPACE_THREAD_MAX_DEVICE_BYTES] = std::max(t[WORKSPACE_THREAD_MAX_DEVICE_BYTES], deviceBytes);
+        t[WORKSPACE_THREAD_MAX_HOST_BYTES] = std::max(t[WORKSPACE_THREAD_MAX_HOST_BYTES], hostBytes);
+        return true;
+    }
+
+    size_t elementSize(int dataType)
+    {
+        switch (dataType)
+        {
+            case CUDA_R_16F: return 2;
+            case CUDA_C_16F: return 4;
+            case CUDA_R_16BF: return 2;
+            case CUDA_C_16BF: return 4;
+            case CUDA_R_32F: return sizeof(float);
+            case CUDA_C_32F: return sizeof(cuComplex);
+            case CUDA_R_64F: return sizeof(double);
+            case CUDA_C_64F: return sizeof(cuDoubleComplex);
+        }
+        return 0;
+    }
+
+    void setDeviceCount(const void *handle, int deviceCount)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        handles[handle].deviceCount = std::max(1, deviceCount);
+    }
+
+    void release(const void *handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = handles.find(handle);
+        if (it == handles.end())
+        {
+            return;
+        }
+        totalDeviceBytes -= it->second.deviceBytes;
+        totalHostBytes -= it->second.hostBytes;
+        handles.erase(it);
+    }
+}
+
+/**
+ * Creates a long array with the given values
+ */
+static jlongArray createLongArray(JNIEnv *env, const std::vector<jlong> &values)
+{
+    jlongArray result = env->NewLongArray((jsize)values.size());
+    if (result == NULL)
+    {
+        return NULL;
+    }
+    env->SetLongArrayRegion(result, 0, (jsize)values.size(), values.data());
+    return result;
+}
+
+/**
+ * Creates a string array with the given values
+ */
+static jobjectArray createStringArray(JNIEnv *env, const std::vector<std::string> &values)
+{
+    jclass stringClass = env->FindClass("java/lang/String");
+    if (stringClass == NULL)
+    {
+        return NULL;
+    }
+    jobjectArray result = env->NewObjectArray((jsize)values.size(), stringClass, NULL);
+    if (result == NULL)
+    {
+        return NULL;
+    }
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        jstring value = env->NewStringUTF(values[i].c_str());
+        if (value == NULL)
+        {
+            return NULL;
+        }
+        env->SetObjectArrayElement(result, (jsize)i, value);
+        env->DeleteLocalRef(value);
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_setEnabledNative
+  (JNIEnv *env, jclass cls, jboolean enabled)
+{
+    WorkspaceAccounting::enabled.store(enabled == JNI_TRUE, std::memory_order_relaxed);
+}
+
+JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_isEnabledNative
+  (JNIEnv *env, jclass cls)
+{
+    return WorkspaceAccounting::enabled.load(std::memory_order_relaxed) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_setBudgetNative
+  (JNIEnv *env, jclass cls, jlong deviceBytes, jlong hostBytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    deviceBudget = (uint64_t)std::max((jlong)0, deviceBytes);
+    hostBudget = (uint64_t)std::max((jlong)0, hostBytes);
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getTotalsNative
+  (JNIEnv *env, jclass cls, jlongArray totals)
+{
+    if (totals == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'totals' is null for getTotals");
+        return;
+    }
+    if (env->GetArrayLength(totals) < WORKSPACE_TOTALS)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException", "Invalid array length for getTotals");
+        return;
+    }
+    jlong values[WORKSPACE_TOTALS];
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        values[WORKSPACE_TOTAL_DEVICE_BYTES] = (jlong)totalDeviceBytes;
+        values[WORKSPACE_TOTAL_HOST_BYTES] = (jlong)totalHostBytes;
+        values[WORKSPACE_PEAK_DEVICE_BYTES] = (jlong)peakDeviceBytes;
+        values[WORKSPACE_PEAK_HOST_BYTES] = (jlong)peakHostBytes;
+        values[WORKSPACE_REJECTED] = (jlong)rejected;
+        values[WORKSPACE_DEVICE_BUDGET] = (jlong)deviceBudget;
+        values[WORKSPACE_HOST_BUDGET] = (jlong)hostBudget;
+    }
+    env->SetLongArrayRegion(totals, 0, WORKSPACE_TOTALS, values);
+}
+
+JNIEXPORT jobjectArray JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getFunctionNamesNative
+  (JNIEnv *env, jclass cls)
+{
+    std::vector<std::string> names(CallTracer::getFunctionCount());
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        names[i] = CallTracer::getFunctionName((int)i);
+    }
+    return createStringArray(env, names);
+}
+
+JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getFunctionStatsNative
+  (JNIEnv *env, jclass cls, jint functionId, jlongArray stats)
+{
+    if (stats == NULL)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'stats' is null for getFunctionStats");
+        return JNI_FALSE;
+    }
+    if (env->GetArrayLength(stats) < WORKSPACE_FUNCTION_STATS)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException", "Invalid array length for getFunctionStats");
+        return JNI_FALSE;
+    }
+    FunctionWorkspaces f;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (functionId >= 0 && functionId < (jint)functions.size())
+        {
+            f = functions[functionId];
+        }
+    }
+    env->SetLongArrayRegion(stats, 0, WORKSPACE_FUNCTION_STATS, (const jlong*)f.stats);
+    return f.stats[WORKSPACE_FUNCTION_CALLS] > 0 ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jlongArray JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getHandleStatsNative
+  (JNIEnv *env, jclass cls)
+{
+    std::vector<jlong> values;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto &entry : handles)
+        {
+            const HandleWorkspaces &h = entry.second;
+            if (h.functionId == -1)
+            {
+                continue;
+            }
+            jlong stats[WORKSPACE_HANDLE_STATS];
+            stats[WORKSPACE_HANDLE_ADDRESS] = (jlong)(uintptr_t)entry.first;
+            stats[WORKSPACE_HANDLE_FUNCTION_ID] = h.functionId;
+            stats[WORKSPACE_HANDLE_THREAD_INDEX] = h.threadIndex;
+            stats[WORKSPACE_HANDLE_DEVICE_BYTES] = (jlong)h.deviceBytes;
+            stats[WORKSPACE_HANDLE_HOST_BYTES] = (jlong)h.hostBytes;
+            stats[WORKSPACE_HANDLE_MAX_DEVICE_BYTES] = (jlong)h.maxDeviceBytes;
+            stats[WORKSPACE_HANDLE_MAX_HOST_BYTES] = (jlong)h.maxHostBytes;
+            stats[WORKSPACE_HANDLE_DEVICE_COUNT] = h.deviceCount;
+            values.insert(values.end(), stats, stats + WORKSPACE_HANDLE_STATS);
+        }
+    }
+    return createLongArray(env, values);
+}
+
+JNIEXPORT jobjectArray JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getThreadNamesNative
+  (JNIEnv *env, jclass cls)
+{
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const ThreadWorkspaces &t : threads)
+        {
+            names.push_back(t.name);
+        }
+    }
+    return createStringArray(env, names);
+}
+
+JNIEXPORT jlongArray JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getThreadStatsNative
+  (JNIEnv *env, jclass cls)
+{
+    std::vector<jlong> values;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const ThreadWorkspaces &t : threads)
+        {
+            values.insert(values.end(), t.stats, t.stats + WORKSPACE_THREAD_STATS);
+        }
+    }
+    return createLongArray(env, values);
+}
+
+JNIEXPORT void JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_resetNative
+  (JNIEnv *env, jclass cls)
+{
+    // The workspaces of the handles are still in use, so they remain
+    // accounted, and only the statistics and high-water marks are reset
+    std::lock_guard<std::mutex> lock(mutex);
+    for (FunctionWorkspaces &f : functions)
+    {
+        f = FunctionWorkspaces();
+    }
+    for (ThreadWorkspaces &t : threads)
+    {
+        std::fill(t.stats, t.stats + WORKSPACE_THREAD_STATS, 0);
+    }
+    for (auto &entry : handles)
+    {
+        entry.second.maxDeviceBytes = entry.second.deviceBytes;
+        entry.second.maxHostBytes = entry.second.hostBytes;
+    }
+    peakDeviceBytes = totalDeviceBytes;
+    peakHostBytes = totalHostBytes;
+    rejected = 0;
+}
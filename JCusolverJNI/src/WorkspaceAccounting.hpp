@@ -0,0 +1,196 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+ /* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class jcuda_jcusolver_WorkspaceAccounting */
+
+#ifndef _Included_jcuda_jcusolver_WorkspaceAccounting
+#define _Included_jcuda_jcusolver_WorkspaceAccounting
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    setEnabledNative
+     * Signature: (Z)V
+     */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_setEnabledNative
+        (JNIEnv *, jclass, jboolean);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    isEnabledNative
+     * Signature: ()Z
+     */
+    JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_isEnabledNative
+        (JNIEnv *, jclass);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    setBudgetNative
+     * Signature: (JJ)V
+     */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_setBudgetNative
+        (JNIEnv *, jclass, jlong, jlong);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    getTotalsNative
+     * Signature: ([J)V
+     */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getTotalsNative
+        (JNIEnv *, jclass, jlongArray);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    getFunctionNamesNative
+     * Signature: ()[Ljava/lang/String;
+     */
+    JNIEXPORT jobjectArray JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getFunctionNamesNative
+        (JNIEnv *, jclass);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    getFunctionStatsNative
+     * Signature: (I[J)Z
+     */
+    JNIEXPORT jboolean JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getFunctionStatsNative
+        (JNIEnv *, jclass, jint, jlongArray);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    getHandleStatsNative
+     * Signature: ()[J
+     */
+    JNIEXPORT jlongArray JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getHandleStatsNative
+        (JNIEnv *, jclass);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    getThreadNamesNative
+     * Signature: ()[Ljava/lang/String;
+     */
+    JNIEXPORT jobjectArray JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getThreadNamesNative
+        (JNIEnv *, jclass);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    getThreadStatsNative
+     * Signature: ()[J
+     */
+    JNIEXPORT jlongArray JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_getThreadStatsNative
+        (JNIEnv *, jclass);
+
+    /*
+     * Class:     jcuda_jcusolver_WorkspaceAccounting
+     * Method:    resetNative
+     * Signature: ()V
+     */
+    JNIEXPORT void JNICALL Java_jcuda_jcusolver_WorkspaceAccounting_resetNative
+        (JNIEnv *, jclass);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+
+#ifndef JCUSOLVER_WORKSPACE_ACCOUNTING_HPP
+#define JCUSOLVER_WORKSPACE_ACCOUNTING_HPP
+
+#include <jni.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace WorkspaceAccounting
+{
+    /**
+     * Whether the workspace accounting is currently enabled
+     */
+    extern std::atomic<bool> enabled;
+
+    /**
+     * Records the workspace sizes that have been returned by the 
+     * bufferSize function with the given ID for the given handle. The
+     * sizes replace the sizes that have previously been recorded for
+     * the handle. If this would exceed the budget, then nothing is
+     * recorded, a CudaException is thrown, and false is returned.
+     * If the device count is true, then the device size is multiplied
+     * with the number of devices that have been selected for the 
+     * (cusolverMg) handle.
+     */
+    bool record(JNIEnv *env, int functionId, const void *handle, uint64_t deviceBytes, uint64_t hostBytes, bool perDevice);
+
+    /**
+     * Records the workspace sizes if the accounting is enabled and the
+     * given status is CUSOLVER_STATUS_SUCCESS (0). Returns false if 
+     * this exceeded the budget.
+     */
+    inline bool account(JNIEnv *env, int functionId, int status, const void *handle, uint64_t deviceBytes, uint64_t hostBytes)
+    {
+        if (status != 0 || !enabled.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+        return record(env, functionId, handle, deviceBytes, hostBytes, false);
+    }
+
+    /**
+     * Records the workspace size per device of a cusolverMg function.
+     * Returns false if this exceeded the budget.
+     */
+    inline bool accountPerDevice(JNIEnv *env, int functionId, int status, const void *handle, uint64_t deviceBytes)
+    {
+        if (status != 0 || !enabled.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+        return record(env, functionId, handle, deviceBytes, 0, true);
+    }
+
+    /**
+     * Returns the size of one element of the given cudaDataType, or 0
+     * if the type is not known
+     */
+    size_t elementSize(int dataType);
+
+    /**
+     * Stores the number of devices that have been selected for the
+     * given cusolverMg handle. This is also stored when the accounting
+     * is disabled, so that it is known when it is enabled later.
+     */
+    void setDeviceCount(const void *handle, int deviceCount);
+
+    /**
+     * Removes the workspaces of the given handle, when it is destroyed
+     */
+    void release(const void *handle);
+}
+
+#endif
@@ -0,0 +1,329 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cuda_runtime_api.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+// Host implementations of the CUDA runtime functions that are used by
+// JCusolver and by the utility classes of the Java layer. All memory
+// is host memory, and all operations are synchronous.
+
+namespace
+{
+    /**
+     * A stub stream or event. Events store the time when they were 
+     * recorded.
+     */
+    struct StubObject
+    {
+        std::chrono::steady_clock::time_point time;
+    };
+
+    /**
+     * The last error, per thread
+     */
+    thread_local cudaError_t lastError = cudaSuccess;
+
+    /**
+     * The sizes of the device allocations, by their address, for
+     * cuMemGetAddressRange_v2
+     */
+    std::mutex allocationsMutex;
+    std::map<uintptr_t, size_t> allocations;
+
+    /**
+     * Stores and returns the given error
+     */
+    cudaError_t result(cudaError_t error)
+    {
+        if (error != cudaSuccess)
+        {
+            lastError = error;
+        }
+        return error;
+    }
+}
+
+extern "C"
+{
+
+cudaError_t CUDARTAPI cudaMalloc(void **devPtr, size_t size)
+{
+    if (devPtr == NULL)
+    {
+        return result(cudaErrorInvalidValue);
+    }
+    *devPtr = std::malloc(size == 0 ? 1 : size);
+    if (*devPtr == NULL)
+    {
+        return result(cudaErrorMemoryAllocation);
+    }
+    std::lock_guard<std::mutex> lock(allocationsMutex);
+    allocations[(uintptr_t)*devPtr] = size == 0 ? 1 : size;
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaFree(void *devPtr)
+{
+    {
+        std::lock_guard<std::mutex> lock(allocationsMutex);
+        allocations.erase((uintptr_t)devPtr);
+    }
+    std::free(devPtr);
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaMallocHost(void **ptr, size_t size)
+{
+    if (ptr == NULL)
+    {
+        return result(cudaErrorInvalidValue);
+    }
+    *ptr = std::malloc(size == 0 ? 1 : size);
+    return result(*ptr == NULL ? cudaErrorMemoryAllocation : cudaSuccess);
+}
+
+cudaError_t CUDARTAPI cudaHostAlloc(void **pHost, size_t size, unsigned int flags)
+{
+    return cudaMallocHost(pHost, size);
+}
+
+cudaError_t CUDARTAPI cudaFreeHost(void *ptr)
+{
+    std::free(ptr);
+    return cudaSuccess;
+}
+
+// The driver API function that the CallRecorder uses for finding the
+// device allocation that contains a pointer. Returns 1 
+// (CUDA_ERROR_INVALID_VALUE) for addresses that are not allocated 
+// with cudaMalloc.
+int cuMemGetAddressRange_v2(unsigned long long *base, size_t *size, unsigned long long address)
+{
+    std::lock_guard<std::mutex> lock(allocationsMutex);
+    auto it = allocations.upper_bound((uintptr_t)address);
+    if (it == allocations.begin())
+    {
+        return 1;
+    }
+    --it;
+    if ((uintptr_t)address >= it->first + it->second)
+    {
+        return 1;
+    }
+    if (base != NULL) *base = it->first;
+    if (size != NULL) *size = it->second;
+    return 0;
+}
+
+cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t count, enum cudaMemcpyKind kind)
+{
+    if (count > 0 && (dst == NULL || src == NULL))
+    {
+        return result(cudaErrorInvalidValue);
+    }
+    std::memmove(dst, src, count);
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaMemcpyAsync(void *dst, const void *src, size_t count, enum cudaMemcpyKind kind, cudaStream_t stream)
+{
+    return cudaMemcpy(dst, src, count, kind);
+}
+
+cudaError_t CUDARTAPI cudaMemset(void *devPtr, int value, size_t count)
+{
+    if (count > 0 && devPtr == NULL)
+    {
+        return result(cudaErrorInvalidValue);
+    }
+    std::memset(devPtr, value, count);
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaMemsetAsync(void *devPtr, int value, size_t count, cudaStream_t stream)
+{
+    return cudaMemset(devPtr, value, count);
+}
+
+cudaError_t CUDARTAPI cudaMemGetInfo(size_t *free, size_t *total)
+{
+    // Report 16 GB, so that memory budgets behave like on a device
+    if (free != NULL)
+    {
+        *free = (size_t)16 << 30;
+    }
+    if (total != NULL)
+    {
+        *total = (size_t)16 << 30;
+    }
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaStreamCreate(cudaStream_t *pStream)
+{
+    if (pStream == NULL)
+    {
+        return result(cudaErrorInvalidValue);
+    }
+    *pStream = (cudaStream_t)new StubObject();
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaStreamCreateWithFlags(cudaStream_t *pStream, unsigned int flags)
+{
+    return cudaStreamCreate(pStream);
+}
+
+cudaError_t CUDARTAPI cudaStreamDestroy(cudaStream_t stream)
+{
+    delete (StubObject*)stream;
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaStreamSynchronize(cudaStream_t stream)
+{
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaStreamWaitEvent(cudaStream_t stream, cudaEvent_t event, unsigned int flags)
+{
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaEventCreate(cudaEvent_t *event)
+{
+    if (event == NULL)
+    {
+        return result(cudaErrorInvalidValue);
+    }
+    StubObject *object = new StubObject();
+    object->time = std::chrono::steady_clock::now();
+    *event = (cudaEvent_t)object;
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaEventCreateWithFlags(cudaEvent_t *event, unsigned int flags)
+{
+    return cudaEventCreate(event);
+}
+
+cudaError_t CUDARTAPI cudaEventDestroy(cudaEvent_t event)
+{
+    delete (StubObject*)event;
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaEventRecord(cudaEvent_t event, cudaStream_t stream)
+{
+    if (event == NULL)
+    {
+        return result(cudaErrorInvalidResourceHandle);
+    }
+    ((StubObject*)event)->time = std::chrono::steady_clock::now();
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaEventSynchronize(cudaEvent_t event)
+{
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaEventQuery(cudaEvent_t event)
+{
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaEventElapsedTime(float *ms, cudaEvent_t start, cudaEvent_t end)
+{
+    if (ms == NULL || start == NULL || end == NULL)
+    {
+        return result(cudaErrorInvalidValue);
+    }
+    std::chrono::duration<float, std::milli> duration = 
+        ((StubObject*)end)->time - ((StubObject*)start)->time;
+    *ms = duration.count();
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaDeviceSynchronize(void)
+{
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaGetDeviceCount(int *count)
+{
+    if (count != NULL)
+    {
+        *count = 1;
+    }
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaGetDevice(int *device)
+{
+    if (device != NULL)
+    {
+        *device = 0;
+    }
+    return cudaSuccess;
+}
+
+cudaError_t CUDARTAPI cudaSetDevice(int device)
+{
+    return device == 0 ? cudaSuccess : result(cudaErrorInvalidDevice);
+}
+
+cudaError_t CUDARTAPI cudaGetLastError(void)
+{
+    cudaError_t error = lastError;
+    lastError = cudaSuccess;
+    return error;
+}
+
+cudaError_t CUDARTAPI cudaPeekAtLastError(void)
+{
+    return lastError;
+}
+
+const char* CUDARTAPI cudaGetErrorName(cudaError_t error)
+{
+    return error == cudaSuccess ? "cudaSuccess" : "cudaErrorStub";
+}
+
+const char* CUDARTAPI cudaGetErrorString(cudaError_t error)
+{
+    return error == cudaSuccess ? "no error" : "error in the JCusolver stub runtime";
+}
+
+}
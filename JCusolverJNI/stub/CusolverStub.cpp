@@ -0,0 +1,476 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "JCusolverStub.hpp"
+#include <cusolverDn.h>
+#include <cusolverSp.h>
+#include <cusolverRf.h>
+#include <cusolverMg.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// Host reference implementations of the cuSOLVER functions that are 
+// needed for creating handles and for the simple dense and sparse 
+// solves. They are plain, unblocked implementations: They are meant 
+// for checking the results of the JNI layer and of the Java utility 
+// classes, and not for being fast. All other cuSOLVER functions are
+// provided by the generated fallbacks.
+
+struct cusolverDnContext
+{
+    cudaStream_t stream;
+};
+struct cusolverSpContext
+{
+    cudaStream_t stream;
+};
+struct cusolverRfCommon
+{
+};
+struct cusolverMgContext
+{
+};
+
+namespace
+{
+    /**
+     * Returns the element (i, j) of the given column-major matrix
+     */
+    inline double& at(double *A, int lda, int i, int j)
+    {
+        return A[i + (size_t)j * lda];
+    }
+
+    /**
+     * Computes the Cholesky factorization of the given matrix in-place,
+     * and returns 0 or the 1-based index of the first non-positive 
+     * pivot.
+     */
+    int potrf(bool lower, int n, double *A, int lda)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            double d = at(A, lda, j, j);
+            for (int k = 0; k < j; k++)
+            {
+                double l = lower ? at(A, lda, j, k) : at(A, lda, k, j);
+                d -= l * l;
+            }
+            if (!(d > 0.0))
+            {
+                return j + 1;
+            }
+            d = std::sqrt(d);
+            at(A, lda, j, j) = d;
+            for (int i = j + 1; i < n; i++)
+            {
+                double s = lower ? at(A, lda, i, j) : at(A, lda, j, i);
+                for (int k = 0; k < j; k++)
+                {
+                    s -= lower ? 
+                        at(A, lda, i, k) * at(A, lda, j, k) : 
+                        at(A, lda, k, i) * at(A, lda, k, j);
+                }
+                if (lower)
+                {
+                    at(A, lda, i, j) = s / d;
+                }
+                else
+                {
+                    at(A, lda, j, i) = s / d;
+                }
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Computes the LU factorization with partial pivoting of the given
+     * matrix in-place, and returns 0 or the 1-based index of the first
+     * zero pivot. The pivot indices are 1-based, as in LAPACK.
+     */
+    int getrf(int m, int n, double *A, int lda, int *ipiv)
+    {
+        int info = 0;
+        int k = m < n ? m : n;
+        for (int j = 0; j < k; j++)
+        {
+            int p = j;
+            for (int i = j + 1; i < m; i++)
+            {
+                if (std::fabs(at(A, lda, i, j)) > std::fabs(at(A, lda, p, j)))
+                {
+                    p = i;
+                }
+            }
+            if (ipiv != NULL)
+            {
+                ipiv[j] = p + 1;
+            }
+            if (at(A, lda, p, j) == 0.0)
+            {
+                if (info == 0)
+                {
+                    info = j + 1;
+                }
+                continue;
+            }
+            if (p != j)
+            {
+                for (int c = 0; c < n; c++)
+                {
+                    std::swap(at(A, lda, p, c), at(A, lda, j, c));
+                }
+            }
+            double d = at(A, lda, j, j);
+            for (int i = j + 1; i < m; i++)
+            {
+                at(A, lda, i, j) /= d;
+            }
+            for (int c = j + 1; c < n; c++)
+            {
+                double f = at(A, lda, j, c);
+                for (int i = j + 1; i < m; i++)
+                {
+                    at(A, lda, i, c) -= at(A, lda, i, j) * f;
+                }
+            }
+        }
+        return info;
+    }
+
+    /**
+     * Solves L*U*x = b for one column, where the factors are stored
+     * in the given matrix.
+     */
+    void getrs(int n, const double *A, int lda, double *b)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            for (int k = 0; k < i; k++)
+            {
+                b[i] -= A[i + (size_t)k * lda] * b[k];
+            }
+        }
+        for (int i = n - 1; i >= 0; i--)
+        {
+            for (int k = i + 1; k < n; k++)
+            {
+                b[i] -= A[i + (size_t)k * lda] * b[k];
+            }
+            b[i] /= A[i + (size_t)i * lda];
+        }
+    }
+}
+
+extern "C"
+{
+
+//============================================================================
+// Dense
+
+cusolverStatus_t CUSOLVERAPI cusolverDnCreate(cusolverDnHandle_t *handle)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    *handle = new cusolverDnContext();
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnDestroy(cusolverDnHandle_t handle)
+{
+    delete handle;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnSetStream(cusolverDnHandle_t handle, cudaStream_t streamId)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    handle->stream = streamId;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnGetStream(cusolverDnHandle_t handle, cudaStream_t *streamId)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    *streamId = handle->stream;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnDpotrf_bufferSize(cusolverDnHandle_t handle, cublasFillMode_t uplo, int n, double *A, int lda, int *Lwork)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    if (n < 0 || lda < (n > 1 ? n : 1) || Lwork == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    *Lwork = 1;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnDpotrf(cusolverDnHandle_t handle, cublasFillMode_t uplo, int n, double *A, int lda, double *Workspace, int Lwork, int *devInfo)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    if (n < 0 || lda < (n > 1 ? n : 1) || devInfo == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    *devInfo = potrf(uplo == CUBLAS_FILL_MODE_LOWER, n, A, lda);
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnDpotrs(cusolverDnHandle_t handle, cublasFillMode_t uplo, int n, int nrhs, const double *A, int lda, double *B, int ldb, int *devInfo)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    if (n < 0 || nrhs < 0 || lda < (n > 1 ? n : 1) || ldb < (n > 1 ? n : 1) || devInfo == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    bool lower = uplo == CUBLAS_FILL_MODE_LOWER;
+    for (int c = 0; c < nrhs; c++)
+    {
+        double *b = B + (size_t)c * ldb;
+
+        // Solve L*y = b, where L = U^T for the upper case
+        for (int i = 0; i < n; i++)
+        {
+            for (int k = 0; k < i; k++)
+            {
+                b[i] -= (lower ? A[i + (size_t)k * lda] : A[k + (size_t)i * lda]) * b[k];
+            }
+            b[i] /= A[i + (size_t)i * lda];
+        }
+
+        // Solve L^T*x = y
+        for (int i = n - 1; i >= 0; i--)
+        {
+            for (int k = i + 1; k < n; k++)
+            {
+                b[i] -= (lower ? A[k + (size_t)i * lda] : A[i + (size_t)k * lda]) * b[k];
+            }
+            b[i] /= A[i + (size_t)i * lda];
+        }
+    }
+    *devInfo = 0;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnDgetrf_bufferSize(cusolverDnHandle_t handle, int m, int n, double *A, int lda, int *Lwork)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    if (m < 0 || n < 0 || lda < (m > 1 ? m : 1) || Lwork == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    *Lwork = 1;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnDgetrf(cusolverDnHandle_t handle, int m, int n, double *A, int lda, double *Workspace, int *devIpiv, int *devInfo)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    if (m < 0 || n < 0 || lda < (m > 1 ? m : 1) || devInfo == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    *devInfo = getrf(m, n, A, lda, devIpiv);
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverDnDgetrs(cusolverDnHandle_t handle, cublasOperation_t trans, int n, int nrhs, const double *A, int lda, const int *devIpiv, double *B, int ldb, int *devInfo)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    if (n < 0 || nrhs < 0 || lda < (n > 1 ? n : 1) || ldb < (n > 1 ? n : 1) || devInfo == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    if (trans != CUBLAS_OP_N)
+    {
+        return CUSOLVER_STATUS_NOT_SUPPORTED;
+    }
+    for (int c = 0; c < nrhs; c++)
+    {
+        double *b = B + (size_t)c * ldb;
+        if (devIpiv != NULL)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                std::swap(b[i], b[devIpiv[i] - 1]);
+            }
+        }
+        getrs(n, A, lda, b);
+    }
+    *devInfo = 0;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+//============================================================================
+// Sparse
+
+cusolverStatus_t CUSOLVERAPI cusolverSpCreate(cusolverSpHandle_t *handle)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    *handle = new cusolverSpContext();
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverSpDestroy(cusolverSpHandle_t handle)
+{
+    delete handle;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverSpSetStream(cusolverSpHandle_t handle, cudaStream_t streamId)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    handle->stream = streamId;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+/**
+ * Solves the system with a dense LU factorization. The index base is 
+ * taken from the first row pointer, so that the descriptor does not 
+ * have to be inspected.
+ */
+cusolverStatus_t CUSOLVERAPI cusolverSpDcsrlsvluHost(cusolverSpHandle_t handle, int n, int nnzA, const cusparseMatDescr_t descrA, const double *csrValA, const int *csrRowPtrA, const int *csrColIndA, const double *b, double tol, int reorder, double *x, int *singularity)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    }
+    if (n < 0 || nnzA < 0 || csrRowPtrA == NULL || b == NULL || x == NULL || singularity == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    int base = n > 0 ? csrRowPtrA[0] : 0;
+    if (base != 0 && base != 1)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    std::vector<double> A((size_t)n * n, 0.0);
+    for (int r = 0; r < n; r++)
+    {
+        for (int k = csrRowPtrA[r] - base; k < csrRowPtrA[r + 1] - base; k++)
+        {
+            int c = csrColIndA[k] - base;
+            if (c < 0 || c >= n)
+            {
+                return CUSOLVER_STATUS_INVALID_VALUE;
+            }
+            A[r + (size_t)c * n] += csrValA[k];
+        }
+    }
+    std::vector<int> ipiv(n);
+    getrf(n, n, A.data(), n, ipiv.data());
+    *singularity = -1;
+    for (int i = 0; i < n; i++)
+    {
+        if (std::fabs(A[i + (size_t)i * n]) <= tol)
+        {
+            *singularity = i;
+            return CUSOLVER_STATUS_SUCCESS;
+        }
+    }
+    std::memcpy(x, b, (size_t)n * sizeof(double));
+    for (int i = 0; i < n; i++)
+    {
+        std::swap(x[i], x[ipiv[i] - 1]);
+    }
+    getrs(n, A.data(), n, x);
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+//============================================================================
+// Refactorization and multi-GPU
+
+cusolverStatus_t CUSOLVERAPI cusolverRfCreate(cusolverRfHandle_t *handle)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    *handle = new cusolverRfCommon();
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverRfDestroy(cusolverRfHandle_t handle)
+{
+    delete handle;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverMgCreate(cusolverMgHandle_t *handle)
+{
+    if (handle == NULL)
+    {
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    }
+    *handle = new cusolverMgContext();
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+cusolverStatus_t CUSOLVERAPI cusolverMgDestroy(cusolverMgHandle_t handle)
+{
+    delete handle;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+}
@@ -0,0 +1,50 @@
+# Generates the fallbacks of the CPU-only stub backend: For each cuSOLVER 
+# function that is called in the given sources, a weak definition is 
+# written that only calls jcusolverStubFallback. The reference 
+# implementations in CusolverStub.cpp are strong definitions, and 
+# override these fallbacks at link time.
+#
+# The generated file does not include the cuSOLVER headers, so that the 
+# fallbacks do not have to match the declared signatures. They leave all 
+# output parameters unchanged, and therefore return 
+# CUSOLVER_STATUS_NOT_SUPPORTED by default. Weak symbols require GCC or 
+# Clang.
+#
+# The sources are added to the CMAKE_CONFIGURE_DEPENDS, so that the 
+# fallbacks are generated again when a source calls a new function.
+
+function(jcusolver_generate_stub_fallbacks OUTPUT_FILE)
+    set(NAMES "")
+    foreach(SOURCE ${ARGN})
+        set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${SOURCE})
+        file(READ ${SOURCE} CONTENT)
+        string(REGEX MATCHALL "[^A-Za-z0-9_]cusolver[A-Z][A-Za-z0-9_]*[ ]*\\(" 
+            CALLS "${CONTENT}")
+        foreach(CALL ${CALLS})
+            string(REGEX REPLACE "^[^A-Za-z0-9_](cusolver[A-Za-z0-9_]*).*$" "\\1" 
+                NAME "${CALL}")
+            list(APPEND NAMES ${NAME})
+        endforeach()
+    endforeach()
+    list(REMOVE_DUPLICATES NAMES)
+    list(SORT NAMES)
+
+    set(CONTENT "// Generated by GenerateFallbacks.cmake - DO NOT EDIT\n\n")
+    set(CONTENT "${CONTENT}#include \"JCusolverStub.hpp\"\n\n")
+    set(CONTENT "${CONTENT}#define JCUSOLVER_STUB_FALLBACK(name) \\\n")
+    set(CONTENT "${CONTENT}    extern \"C\" __attribute__((weak)) int name(...) \\\n")
+    set(CONTENT "${CONTENT}    { \\\n")
+    set(CONTENT "${CONTENT}        return jcusolverStubFallback(#name); \\\n")
+    set(CONTENT "${CONTENT}    }\n\n")
+    foreach(NAME ${NAMES})
+        set(CONTENT "${CONTENT}JCUSOLVER_STUB_FALLBACK(${NAME})\n")
+    endforeach()
+
+    # Only write the file when it changed, to avoid needless rebuilds
+    if (EXISTS ${OUTPUT_FILE})
+        file(READ ${OUTPUT_FILE} OLD_CONTENT)
+    endif()
+    if (NOT "${CONTENT}" STREQUAL "${OLD_CONTENT}")
+        file(WRITE ${OUTPUT_FILE} "${CONTENT}")
+    endif()
+endfunction()
@@ -0,0 +1,78 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "JCusolverStub.hpp"
+#include <cusolver_common.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+/**
+ * Returns the value of the given environment variable as a number, 
+ * or the given default value if it is not set
+ */
+static long long environmentValue(const char *name, long long defaultValue)
+{
+    const char *value = std::getenv(name);
+    if (value == NULL || *value == 0)
+    {
+        return defaultValue;
+    }
+    return std::strtoll(value, NULL, 10);
+}
+
+/**
+ * The configured latency and status, read once
+ */
+static const long long fallbackLatencyNs = environmentValue("JCUSOLVER_STUB_LATENCY_NS", 0);
+static const int fallbackStatus = (int)environmentValue("JCUSOLVER_STUB_STATUS", CUSOLVER_STATUS_NOT_SUPPORTED);
+static const bool fallbackTrace = environmentValue("JCUSOLVER_STUB_TRACE", 0) != 0;
+
+int jcusolverStubFallback(const char *name)
+{
+    if (fallbackTrace)
+    {
+        std::fprintf(stderr, "JCusolverStub: %s\n", name);
+    }
+    if (fallbackLatencyNs > 0)
+    {
+        // Spin for short latencies, because sleeping is too coarse
+        std::chrono::steady_clock::time_point deadline = 
+            std::chrono::steady_clock::now() + std::chrono::nanoseconds(fallbackLatencyNs);
+        if (fallbackLatencyNs > 1000000)
+        {
+            std::this_thread::sleep_until(deadline);
+        }
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            // Spin
+        }
+    }
+    return fallbackStatus;
+}
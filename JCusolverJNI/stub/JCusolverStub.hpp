@@ -0,0 +1,67 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef JCUSOLVER_STUB_HPP
+#define JCUSOLVER_STUB_HPP
+
+/**
+ * Common functions of the CPU-only stub backend, which implements the
+ * cuSOLVER and CUDA runtime entry points on the host. "Device" memory
+ * is ordinary host memory, all operations are synchronous, and 
+ * streams and events are dummy objects.
+ *
+ * The behavior can be configured with environment variables:
+ *
+ * JCUSOLVER_STUB_LATENCY_NS: A latency in nanoseconds that is added 
+ *     to each call of a cuSOLVER function that has no reference 
+ *     implementation. The default is 0.
+ * JCUSOLVER_STUB_STATUS: The cusolverStatus_t that is returned by 
+ *     these functions. The default is CUSOLVER_STATUS_NOT_SUPPORTED,
+ *     because they do not write their output parameters. It may be 
+ *     set to 0, CUSOLVER_STATUS_SUCCESS, for measuring the overhead 
+ *     of the JNI layer, where the outputs are not used.
+ * JCUSOLVER_STUB_TRACE: If this is 1, then the name of each of these
+ *     functions is printed to stderr when it is called.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Waits for the configured fake latency, and returns the configured 
+ * status. Called by all cuSOLVER functions that have no reference 
+ * implementation. The name is only used for tracing.
+ */
+int jcusolverStubFallback(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Checks the CPU-only stub backend without a JVM: The reference 
+// implementations must compute correct results, and the generated 
+// fallbacks must report that they are not supported, without writing 
+// their outputs. Returns a nonzero exit code if a check fails.
+
+#include <cusolverDn.h>
+#include <cmath>
+#include <cstdio>
+
+namespace
+{
+    /**
+     * The number of failed checks
+     */
+    int failures = 0;
+
+    /**
+     * Prints the given message and counts a failure if the given 
+     * condition is false
+     */
+    void check(bool condition, const char *message)
+    {
+        if (!condition)
+        {
+            std::fprintf(stderr, "JCusolverStubTest: FAILED: %s\n", message);
+            failures++;
+        }
+    }
+
+    /**
+     * Solves a small SPD system with the reference implementations of
+     * the Cholesky factorization and solve
+     */
+    void testReferencePotrs(cusolverDnHandle_t handle)
+    {
+        // A = [4 2; 2 3], b = A * [1 2]^T
+        double A[] = { 4.0, 2.0, 2.0, 3.0 };
+        double b[] = { 8.0, 8.0 };
+        int lwork = 0;
+        check(cusolverDnDpotrf_bufferSize(handle, CUBLAS_FILL_MODE_LOWER, 
+            2, A, 2, &lwork) == CUSOLVER_STATUS_SUCCESS, "potrf_bufferSize");
+
+        double workspace[1];
+        int info = -1;
+        check(cusolverDnDpotrf(handle, CUBLAS_FILL_MODE_LOWER, 2, A, 2,
+            workspace, lwork, &info) == CUSOLVER_STATUS_SUCCESS, "potrf");
+        check(info == 0, "potrf info");
+
+        info = -1;
+        check(cusolverDnDpotrs(handle, CUBLAS_FILL_MODE_LOWER, 2, 1, A, 2, 
+            b, 2, &info) == CUSOLVER_STATUS_SUCCESS, "potrs");
+        check(info == 0, "potrs info");
+        check(std::fabs(b[0] - 1.0) < 1e-12 && std::fabs(b[1] - 2.0) < 1e-12,
+            "potrs solution");
+    }
+
+    /**
+     * Calls a function that has no reference implementation, which 
+     * must fail with the default status and leave the output unchanged
+     */
+    void testFallback(cusolverDnHandle_t handle)
+    {
+        int lwork = -1;
+        cusolverStatus_t status = 
+            cusolverDnDgesvd_bufferSize(handle, 4, 4, &lwork);
+        check(status == CUSOLVER_STATUS_NOT_SUPPORTED, "fallback status");
+        check(lwork == -1, "fallback output");
+    }
+}
+
+int main()
+{
+    cusolverDnHandle_t handle = NULL;
+    check(cusolverDnCreate(&handle) == CUSOLVER_STATUS_SUCCESS, "create");
+    if (handle != NULL)
+    {
+        testReferencePotrs(handle);
+        testFallback(handle);
+        check(cusolverDnDestroy(handle) == CUSOLVER_STATUS_SUCCESS, "destroy");
+    }
+    if (failures > 0)
+    {
+        return 1;
+    }
+    std::printf("JCusolverStubTest: passed\n");
+    return 0;
+}
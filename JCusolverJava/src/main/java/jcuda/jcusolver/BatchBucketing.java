@@ -0,0 +1,453 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * The policy for grouping matrices of different sizes into buckets of 
+ * uniformly sized matrices, so that each bucket can be processed with 
+ * a single batched call, like cusolverDnDsyevjBatched or 
+ * cusolverDnDgesvdjBatched. <br>
+ * <br>
+ * A matrix with m rows and n columns is padded with k additional rows
+ * and k additional columns, to a size of (m+k) x (n+k). The padding 
+ * is a diagonal block with a value that is larger than the largest 
+ * eigenvalue or singular value of the original matrix. This way, the
+ * eigenvalues (singular values) of the padded matrix are the ones of 
+ * the original matrix plus the padding value, and the eigenvectors 
+ * (singular vectors) of the original matrix are the leading parts of 
+ * the corresponding vectors of the padded matrix. <br>
+ * <br>
+ * This class does not require the native library, and may be used 
+ * on the host only.
+ */
+public final class BatchBucketing
+{
+    /**
+     * The maximum matrix size that is supported by the batched 
+     * Jacobi methods of CUSOLVER
+     */
+    public static final int MAX_BATCHED_JACOBI_SIZE = 32;
+    
+    /**
+     * A bucket of matrices that share the same padded size
+     */
+    public static final class Bucket
+    {
+        /**
+         * The number of rows of the padded matrices
+         */
+        private final int rows;
+        
+        /**
+         * The number of columns of the padded matrices
+         */
+        private final int cols;
+        
+        /**
+         * Whether the bucket may be processed with a batched call
+         */
+        private final boolean batched;
+        
+        /**
+         * The indices of the matrices in this bucket
+         */
+        private final int[] indices;
+        
+        /**
+         * Creates a new bucket
+         * 
+         * @param rows The number of rows
+         * @param cols The number of columns
+         * @param batched Whether the bucket is batched
+         * @param indices The indices of the matrices
+         */
+        Bucket(int rows, int cols, boolean batched, int[] indices)
+        {
+            this.rows = rows;
+            this.cols = cols;
+            this.batched = batched;
+            this.indices = indices;
+        }
+        
+        /**
+         * Returns the number of rows of the padded matrices in this
+         * bucket. For buckets that are not batched, this is the
+         * number of rows of the original matrices.
+         * 
+         * @return The number of rows
+         */
+        public int getRows()
+        {
+            return rows;
+        }
+        
+        /**
+         * Returns the number of columns of the padded matrices in this
+         * bucket. For buckets that are not batched, this is the
+         * number of columns of the original matrices.
+         * 
+         * @return The number of columns
+         */
+        public int getCols()
+        {
+            return cols;
+        }
+        
+        /**
+         * Returns whether this bucket can be processed with a single
+         * batched call. If this is <code>false</code>, then the 
+         * matrices are too large for the batched functions, and 
+         * have to be processed individually.
+         * 
+         * @return Whether the bucket is batched
+         */
+        public boolean isBatched()
+        {
+            return batched;
+        }
+        
+        /**
+         * Returns the indices of the matrices in this bucket, referring 
+         * to the order in which they have been passed to the 
+         * {@link BatchBucketing#assign(int[], int[])} method.
+         * 
+         * @return The indices
+         */
+        public int[] getIndices()
+        {
+            return indices.clone();
+        }
+        
+        /**
+         * Returns the number of matrices in this bucket
+         * 
+         * @return The number of matrices
+         */
+        public int getBatchSize()
+        {
+            return indices.length;
+        }
+        
+        /**
+         * Returns the index of the i-th matrix in this bucket
+         * 
+         * @param i The index inside this bucket
+         * @return The index of the matrix
+         */
+        public int getIndex(int i)
+        {
+            return indices[i];
+        }
+        
+        /**
+         * Returns a String representation of this object.
+         *
+         * @return A String representation of this object.
+         */
+        @Override
+        public String toString()
+        {
+            return "Bucket["+
+                "rows="+rows+","+
+                "cols="+cols+","+
+                "batched="+batched+","+
+                "indices="+Arrays.toString(indices)+"]";
+        }
+    }
+    
+    /**
+     * The granularity of the size classes
+     */
+    private final int granularity;
+    
+    /**
+     * The maximum size of the padded matrices
+     */
+    private final int maxBatchedSize;
+    
+    /**
+     * Creates a new bucketing with a granularity of 8 and the
+     * {@link #MAX_BATCHED_JACOBI_SIZE}
+     */
+    public BatchBucketing()
+    {
+        this(8, MAX_BATCHED_JACOBI_SIZE);
+    }
+    
+    /**
+     * Creates a new bucketing. <br>
+     * <br>
+     * The larger dimension of each matrix will be rounded up to the next 
+     * multiple of the given granularity. Matrices that are larger than 
+     * the given maximum size will be placed into buckets that are not 
+     * batched, one bucket for each distinct size.
+     * 
+     * @param granularity The granularity of the size classes
+     * @param maxBatchedSize The maximum size of padded matrices
+     * @throws IllegalArgumentException If any argument is not positive
+     */
+    public BatchBucketing(int granularity, int maxBatchedSize)
+    {
+        if (granularity <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The granularity must be positive, but is " + granularity);
+        }
+        if (maxBatchedSize <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The maximum size must be positive, but is " 
+                + maxBatchedSize);
+        }
+        this.granularity = granularity;
+        this.maxBatchedSize = maxBatchedSize;
+    }
+    
+    /**
+     * Assign the square matrices with the given sizes to buckets
+     * 
+     * @param sizes The sizes of the matrices
+     * @return The buckets
+     * @throws IllegalArgumentException If any size is not positive
+     */
+    public List<Bucket> assign(int[] sizes)
+    {
+        return assign(sizes, sizes);
+    }
+    
+    /**
+     * Assign the matrices with the given numbers of rows and columns 
+     * to buckets. <br>
+     * <br>
+     * Since the padding adds the same number of rows and columns, 
+     * only matrices where the difference between the number of rows 
+     * and columns is equal may share a bucket. The buckets are 
+     * returned in the order in which their first matrix appeared.
+     * 
+     * @param rows The numbers of rows of the matrices
+     * @param cols The numbers of columns of the matrices
+     * @return The buckets
+     * @throws IllegalArgumentException If the arrays have different 
+     * lengths, or any size is not positive
+     */
+    public List<Bucket> assign(int[] rows, int[] cols)
+    {
+        if (rows.length != cols.length)
+        {
+            throw new IllegalArgumentException(
+                "Got " + rows.length + " row counts and " + 
+                cols.length + " column counts");
+        }
+        Map<List<Integer>, List<Integer>> groups = 
+            new LinkedHashMap<List<Integer>, List<Integer>>();
+        for (int i = 0; i < rows.length; i++)
+        {
+            int m = rows[i];
+            int n = cols[i];
+            if (m <= 0 || n <= 0)
+            {
+                throw new IllegalArgumentException(
+                    "Invalid size for matrix " + i + ": " + m + "x" + n);
+            }
+            int size = Math.max(m, n);
+            int paddedSize = roundUp(size);
+            List<Integer> key = null;
+            if (paddedSize > maxBatchedSize)
+            {
+                // Try to use the largest possible size class, 
+                // otherwise process the matrix individually
+                if (size <= maxBatchedSize)
+                {
+                    paddedSize = maxBatchedSize;
+                    key = Arrays.asList(1, m - n, paddedSize);
+                }
+                else
+                {
+                    key = Arrays.asList(0, m, n);
+                }
+            }
+            else
+            {
+                key = Arrays.asList(1, m - n, paddedSize);
+            }
+            List<Integer> indices = groups.get(key);
+            if (indices == null)
+            {
+                indices = new ArrayList<Integer>();
+                groups.put(key, indices);
+            }
+            indices.add(i);
+        }
+        
+        List<Bucket> buckets = new ArrayList<Bucket>();
+        for (Map.Entry<List<Integer>, List<Integer>> entry : 
+            groups.entrySet())
+        {
+            List<Integer> key = entry.getKey();
+            int[] indices = toArray(entry.getValue());
+            if (key.get(0) == 0)
+            {
+                buckets.add(new Bucket(
+                    key.get(1), key.get(2), false, indices));
+            }
+            else
+            {
+                int difference = key.get(1);
+                int paddedSize = key.get(2);
+                int paddedRows = paddedSize;
+                int paddedCols = paddedSize;
+                if (difference > 0)
+                {
+                    paddedCols = paddedSize - difference;
+                }
+                else
+                {
+                    paddedRows = paddedSize + difference;
+                }
+                buckets.add(new Bucket(
+                    paddedRows, paddedCols, true, indices));
+            }
+        }
+        return buckets;
+    }
+    
+    /**
+     * Round the given size up to the next multiple of the granularity
+     * 
+     * @param size The size
+     * @return The rounded size
+     */
+    private int roundUp(int size)
+    {
+        return ((size + granularity - 1) / granularity) * granularity;
+    }
+    
+    /**
+     * Returns an array containing the given values
+     * 
+     * @param list The values
+     * @return The array
+     */
+    private static int[] toArray(List<Integer> list)
+    {
+        int result[] = new int[list.size()];
+        for (int i = 0; i < result.length; i++)
+        {
+            result[i] = list.get(i);
+        }
+        return result;
+    }
+    
+    /**
+     * Computes a value that is strictly larger than the absolute value 
+     * of all eigenvalues and singular values of the given matrix, which 
+     * is given in column-major order with a leading dimension of m. <br>
+     * <br>
+     * This uses the bound sqrt(||A||_1 * ||A||_inf) for the spectral 
+     * norm. 
+     * 
+     * @param a The matrix
+     * @param m The number of rows
+     * @param n The number of columns
+     * @return The padding value
+     */
+    public static double computePaddingValue(double a[], int m, int n)
+    {
+        double rowSums[] = new double[m];
+        double maxColSum = 0.0;
+        for (int c = 0; c < n; c++)
+        {
+            double colSum = 0.0;
+            for (int r = 0; r < m; r++)
+            {
+                double v = Math.abs(a[r + c * m]);
+                colSum += v;
+                rowSums[r] += v;
+            }
+            maxColSum = Math.max(maxColSum, colSum);
+        }
+        double maxRowSum = 0.0;
+        for (int r = 0; r < m; r++)
+        {
+            maxRowSum = Math.max(maxRowSum, rowSums[r]);
+        }
+        double bound = Math.sqrt(maxColSum * maxRowSum);
+        return 1.0 + 2.0 * bound;
+    }
+    
+    /**
+     * Write the given matrix, padded to the given size, into the given 
+     * target array. <br>
+     * <br>
+     * The matrix is given in column-major order with a leading dimension
+     * of m. The padded matrix will be written in column-major order with
+     * a leading dimension of paddedRows, starting at the given offset.
+     * The padding consists of zeros, except for the diagonal of the 
+     * lower right block, which is filled with the given padding value.
+     * 
+     * @param a The matrix
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param target The target array
+     * @param offset The offset in the target array
+     * @param paddedRows The number of rows of the padded matrix
+     * @param paddedCols The number of columns of the padded matrix
+     * @param paddingValue The padding value
+     * @throws IllegalArgumentException If the padding does not add 
+     * the same number of rows and columns
+     */
+    public static void pad(double a[], int m, int n, 
+        double target[], int offset, int paddedRows, int paddedCols, 
+        double paddingValue)
+    {
+        int k = paddedRows - m;
+        if (k < 0 || paddedCols - n != k)
+        {
+            throw new IllegalArgumentException(
+                "Cannot pad a " + m + "x" + n + " matrix to " + 
+                paddedRows + "x" + paddedCols);
+        }
+        Arrays.fill(target, offset, offset + paddedRows * paddedCols, 0.0);
+        for (int c = 0; c < n; c++)
+        {
+            System.arraycopy(a, c * m, target, offset + c * paddedRows, m);
+        }
+        for (int i = 0; i < k; i++)
+        {
+            int r = m + i;
+            int c = n + i;
+            target[offset + r + c * paddedRows] = paddingValue;
+        }
+    }
+}
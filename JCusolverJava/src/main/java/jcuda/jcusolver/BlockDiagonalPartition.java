@@ -0,0 +1,414 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+import java.util.concurrent.locks.ReadWriteLock;
+import java.util.concurrent.locks.ReentrantReadWriteLock;
+
+import jcuda.CudaException;
+import jcuda.NativePointerObject;
+import jcuda.Pointer;
+
+/**
+ * A partition of a {@link CsrMatrix64} into pieces that can be indexed
+ * with 32 bit, and solved independently. <br>
+ * <br>
+ * The partition is computed from the connected components of the graph
+ * of the matrix, which are found with a native, multithreaded 
+ * union-find. Each piece consists of one or more whole components, so 
+ * that the matrix is block-diagonal with respect to the pieces. The 
+ * components are assigned to pieces in the order of their first rows, 
+ * and a new piece is started when the number of nonzeros of a piece 
+ * would exceed the given limit. <br>
+ * <br>
+ * The rows of each piece are in ascending order, so the matrix of a
+ * piece is the principal submatrix of these rows, with the same 
+ * relative ordering. <br>
+ * <br>
+ * If a single component has more than 2<sup>31</sup>-1 rows or 
+ * nonzeros, then the matrix can not be partitioned, and the 
+ * constructor throws a CudaException. <br>
+ * <br>
+ * Instances of this class are thread-safe. The pieces may be extracted,
+ * gathered and scattered concurrently, and {@link #close()} waits until
+ * these calls are finished.
+ */
+public class BlockDiagonalPartition
+{
+    /**
+     * The native partition
+     */
+    private static class State extends NativePointerObject
+    {
+        // Only used for storing the native pointer
+    }
+    
+    /**
+     * The indices of the native results. These must match the 
+     * definitions in BlockDiagonalPartition.cpp
+     */
+    private static final int PIECE_COUNT = 0;
+    private static final int COMPONENT_COUNT = 1;
+    private static final int LARGEST_COMPONENT_ROWS = 2;
+    private static final int LARGEST_COMPONENT_NNZ = 3;
+    private static final int RESULT_COUNT = 4;
+    
+    static
+    {
+        JCusolver.initialize(JCusolver.INIT_POINTER_FIELDS);
+    }
+    
+    /**
+     * The matrix
+     */
+    private final CsrMatrix64 matrix;
+    
+    /**
+     * The native state
+     */
+    private final State state;
+    
+    /**
+     * The number of components
+     */
+    private final long componentCount;
+    
+    /**
+     * The number of rows of each piece
+     */
+    private final int pieceRows[];
+    
+    /**
+     * The number of nonzeros of each piece
+     */
+    private final int pieceNnz[];
+    
+    /**
+     * The number of components of each piece
+     */
+    private final int pieceComponents[];
+    
+    /**
+     * Whether this partition was closed
+     */
+    private boolean closed;
+    
+    /**
+     * The lock that is held for reading while the native state is used,
+     * and for writing while it is destroyed
+     */
+    private final ReadWriteLock lock;
+    
+    /**
+     * Creates a new partition of the given matrix. The pointers of the
+     * matrix must remain valid while the partition is used.
+     * 
+     * @param matrix The matrix
+     * @param maxPieceNnz The maximum number of nonzeros of a piece. 
+     * A single component that has more nonzeros is put into its own 
+     * piece. Values larger than 2<sup>31</sup>-1 are clamped.
+     * @throws IllegalArgumentException If the maximum is not positive
+     * @throws CudaException If the row pointers are not nondecreasing 
+     * from the index base to nnz plus the index base, a column index is 
+     * out of range, or a component does not fit into 32 bit
+     */
+    public BlockDiagonalPartition(CsrMatrix64 matrix, long maxPieceNnz)
+    {
+        if (maxPieceNnz <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The maximum number of nonzeros must be positive, but is "
+                + maxPieceNnz);
+        }
+        this.matrix = matrix;
+        this.state = new State();
+        this.lock = new ReentrantReadWriteLock();
+        long results[] = new long[RESULT_COUNT];
+        int status = createNative(matrix.getSize(), matrix.getNnz(), 
+            matrix.getIndexBase(), matrix.getCsrRowPtr(), 
+            matrix.getCsrColInd(), maxPieceNnz, state, results);
+        if (status == cusolverStatus.CUSOLVER_STATUS_NOT_SUPPORTED)
+        {
+            throw new CudaException("The matrix contains a connected "
+                + "component with " + results[LARGEST_COMPONENT_ROWS] 
+                + " rows and " + results[LARGEST_COMPONENT_NNZ] 
+                + " nonzeros, which can not be indexed with 32 bit");
+        }
+        checkSuccess(status, "BlockDiagonalPartition create");
+        this.componentCount = results[COMPONENT_COUNT];
+        int pieceCount = (int)results[PIECE_COUNT];
+        this.pieceRows = new int[pieceCount];
+        this.pieceNnz = new int[pieceCount];
+        this.pieceComponents = new int[pieceCount];
+        checkSuccess(getPieceSizesNative(state, 
+            pieceRows, pieceNnz, pieceComponents), 
+            "BlockDiagonalPartition getPieceSizes");
+    }
+    private static native int createNative(long n, long nnz, 
+        int indexBase, Pointer csrRowPtrA, Pointer csrColIndA, 
+        long maxPieceNnz, State state, long results[]);
+    private static native int getPieceSizesNative(State state, 
+        int rows[], int nnz[], int components[]);
+    
+    /**
+     * Returns the matrix that this partition was computed for
+     * 
+     * @return The matrix
+     */
+    public CsrMatrix64 getMatrix()
+    {
+        return matrix;
+    }
+    
+    /**
+     * Returns the number of connected components of the matrix
+     * 
+     * @return The number of components
+     */
+    public long getComponentCount()
+    {
+        return componentCount;
+    }
+    
+    /**
+     * Returns the number of pieces
+     * 
+     * @return The number of pieces
+     */
+    public int getPieceCount()
+    {
+        return pieceRows.length;
+    }
+    
+    /**
+     * Returns the number of rows of the given piece
+     * 
+     * @param piece The piece
+     * @return The number of rows
+     */
+    public int getPieceRows(int piece)
+    {
+        return pieceRows[piece];
+    }
+    
+    /**
+     * Returns the number of nonzeros of the given piece
+     * 
+     * @param piece The piece
+     * @return The number of nonzeros
+     */
+    public int getPieceNnz(int piece)
+    {
+        return pieceNnz[piece];
+    }
+    
+    /**
+     * Returns the number of components of the given piece
+     * 
+     * @param piece The piece
+     * @return The number of components
+     */
+    public int getPieceComponents(int piece)
+    {
+        return pieceComponents[piece];
+    }
+    
+    /**
+     * Extract the matrix of the given piece, with zero-based 32 bit 
+     * indices
+     * 
+     * @param piece The piece
+     * @param csrRowPtr Will store the row pointers, with
+     * {@link #getPieceRows(int)}+1 elements
+     * @param csrColInd Will store the column indices, with 
+     * {@link #getPieceNnz(int)} elements
+     * @param csrVal Will store the values, with 
+     * {@link #getPieceNnz(int)} elements. May be <code>null</code>, 
+     * in which case only the structure is extracted.
+     * @throws IllegalArgumentException If an array is too small
+     * @throws IllegalStateException If this partition was closed
+     */
+    public void extract(int piece, 
+        int csrRowPtr[], int csrColInd[], double csrVal[])
+    {
+        if (csrRowPtr.length < pieceRows[piece] + 1 || 
+            csrColInd.length < pieceNnz[piece] ||
+            (csrVal != null && csrVal.length < pieceNnz[piece]))
+        {
+            throw new IllegalArgumentException(
+                "The arrays are too small for " + pieceRows[piece] 
+                + " rows and " + pieceNnz[piece] + " nonzeros");
+        }
+        lock.readLock().lock();
+        try
+        {
+            checkOpen();
+            checkSuccess(extractNative(state, piece, 
+                matrix.getCsrRowPtr(), matrix.getCsrColInd(), 
+                matrix.getCsrVal(), csrRowPtr, csrColInd, csrVal), 
+                "BlockDiagonalPartition extract");
+        }
+        finally
+        {
+            lock.readLock().unlock();
+        }
+    }
+    private static native int extractNative(State state, int piece, 
+        Pointer csrRowPtrA, Pointer csrColIndA, 
+        Pointer csrValA, int csrRowPtrB[], int csrColIndB[], 
+        double csrValB[]);
+    
+    /**
+     * Copy the elements of the given vector with n elements that belong 
+     * to the given piece into the given vector of the piece. <br>
+     * <br>
+     * If the vector is a Java array or a buffer, then its size is 
+     * checked, and the native call fails if it has less than n elements.
+     * If it is a pointer to host memory, then its size can not be 
+     * checked, and the caller must make sure that it has n elements. 
+     * 
+     * @param piece The piece
+     * @param b The vector of the whole matrix
+     * @param bPiece The vector of the piece
+     * @throws IllegalArgumentException If the piece vector is too small
+     * @throws IllegalStateException If this partition was closed
+     * @throws CudaException If the vector of the whole matrix is too small
+     */
+    public void gather(int piece, Pointer b, double bPiece[])
+    {
+        checkPieceVector(piece, bPiece);
+        lock.readLock().lock();
+        try
+        {
+            checkOpen();
+            checkSuccess(gatherNative(state, piece, b, bPiece), 
+                "BlockDiagonalPartition gather");
+        }
+        finally
+        {
+            lock.readLock().unlock();
+        }
+    }
+    private static native int gatherNative(
+        State state, int piece, Pointer b, double bPiece[]);
+    
+    /**
+     * Copy the given vector of the given piece into the elements of 
+     * the given vector with n elements that belong to the piece. <br>
+     * <br>
+     * Different pieces may be scattered concurrently if the vector is
+     * stored in host memory. If it is a Java array, then the calls must
+     * be synchronized by the caller. The size of the vector is checked 
+     * as described in {@link #gather(int, Pointer, double[])}.
+     * 
+     * @param piece The piece
+     * @param xPiece The vector of the piece
+     * @param x The vector of the whole matrix
+     * @throws IllegalArgumentException If the piece vector is too small
+     * @throws IllegalStateException If this partition was closed
+     * @throws CudaException If the vector of the whole matrix is too small
+     */
+    public void scatter(int piece, double xPiece[], Pointer x)
+    {
+        checkPieceVector(piece, xPiece);
+        lock.readLock().lock();
+        try
+        {
+            checkOpen();
+            checkSuccess(scatterNative(state, piece, xPiece, x), 
+                "BlockDiagonalPartition scatter");
+        }
+        finally
+        {
+            lock.readLock().unlock();
+        }
+    }
+    private static native int scatterNative(
+        State state, int piece, double xPiece[], Pointer x);
+    
+    /**
+     * Make sure that the given vector can store the elements of the 
+     * given piece
+     */
+    private void checkPieceVector(int piece, double vector[])
+    {
+        if (vector.length < pieceRows[piece])
+        {
+            throw new IllegalArgumentException(
+                "The vector has a length of " + vector.length 
+                + ", but piece " + piece + " has " + pieceRows[piece] 
+                + " rows");
+        }
+    }
+    
+    /**
+     * Make sure that this partition was not closed. The lock must be 
+     * held.
+     */
+    private void checkOpen()
+    {
+        if (closed)
+        {
+            throw new IllegalStateException("The partition was closed");
+        }
+    }
+    
+    /**
+     * Release the native partition, after all pending calls that use it
+     * are finished
+     */
+    public void close()
+    {
+        lock.writeLock().lock();
+        try
+        {
+            if (!closed)
+            {
+                closed = true;
+                destroyNative(state);
+            }
+        }
+        finally
+        {
+            lock.writeLock().unlock();
+        }
+    }
+    private static native void destroyNative(State state);
+    
+    @Override
+    public String toString()
+    {
+        return "BlockDiagonalPartition["+
+            "n="+matrix.getSize()+","+
+            "nnz="+matrix.getNnz()+","+
+            "components="+componentCount+","+
+            "pieces="+pieceRows.length+"]";
+    }
+}
@@ -0,0 +1,358 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.lang.management.ManagementFactory;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.List;
+
+import javax.management.JMException;
+import javax.management.MBeanServer;
+import javax.management.ObjectName;
+
+/**
+ * Metrics of the native function calls. When the metrics are 
+ * {@link #setEnabled(boolean) enabled}, each call of a cuSOLVER function
+ * updates the call count, the counts of the returned statuses, and a 
+ * latency histogram of the host-side time of the function. The metrics 
+ * are stored per thread without synchronization, and merged when they 
+ * are read, so that they can be left enabled in production.<br>
+ * <br>
+ * The metrics can be published as JMX beans with 
+ * {@link #registerMBeans()}: There is one {@link CallMetricsMXBean} 
+ * for each family of functions (Dn, Sp, Rf, Mg, and Common for the 
+ * remaining ones).
+ */
+public final class CallMetrics
+{
+    /**
+     * The indices of the counters. These must match the definitions
+     * in CallMetrics.cpp
+     */
+    static final int CALLS = 0;
+    static final int ERRORS = 1;
+    static final int TOTAL_NS = 2;
+    private static final int COUNTERS = 3;
+    
+    /**
+     * The number of status slots. The last slot counts all statuses 
+     * that are not known. This must match the definition in 
+     * CallMetrics.cpp
+     */
+    static final int STATUS_SLOTS = 33;
+    
+    /**
+     * The layout of the log-linear latency histogram. These must match
+     * the definitions in CallMetrics.cpp
+     */
+    private static final int SUB_BUCKET_BITS = 4;
+    private static final int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static final int BUCKETS = 
+        SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+    
+    /**
+     * The function name prefixes and the names of the families
+     */
+    private static final String PREFIXES[] = 
+        { "cusolverDn", "cusolverSp", "cusolverRf", "cusolverMg", "" };
+    private static final String FAMILIES[] = 
+        { "Dn", "Sp", "Rf", "Mg", "Common" };
+    
+    /**
+     * The names of the registered beans
+     */
+    private static final List<ObjectName> registeredNames = 
+        new ArrayList<ObjectName>();
+    
+    static
+    {
+        JCusolver.initialize();
+    }
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private CallMetrics()
+    {
+        // Private constructor to prevent instantiation
+    }
+    
+    /**
+     * Set whether the metrics are recorded. By default, they are not
+     * recorded.
+     * 
+     * @param enabled Whether the metrics are enabled
+     */
+    public static void setEnabled(boolean enabled)
+    {
+        setEnabledNative(enabled);
+    }
+    private static native void setEnabledNative(boolean enabled);
+    
+    /**
+     * Returns whether the metrics are recorded
+     * 
+     * @return Whether the metrics are enabled
+     */
+    public static boolean isEnabled()
+    {
+        return isEnabledNative();
+    }
+    private static native boolean isEnabledNative();
+    
+    /**
+     * Returns the metrics of all functions that have been called since
+     * the metrics have been enabled or {@link #reset()}, sorted by the
+     * function name
+     * 
+     * @return The function metrics
+     */
+    public static List<FunctionCallMetrics> getMetrics()
+    {
+        return getMetrics("");
+    }
+    
+    /**
+     * Returns the metrics of all functions whose name starts with the
+     * given prefix, and that have been called
+     * 
+     * @param prefix The prefix
+     * @param exclude The prefixes of names that should be excluded
+     * @return The function metrics
+     */
+    private static List<FunctionCallMetrics> getMetrics(
+        String prefix, String ... exclude)
+    {
+        String names[] = getFunctionNamesNative();
+        List<FunctionCallMetrics> result = 
+            new ArrayList<FunctionCallMetrics>();
+        for (int i = 0; i < names.length; i++)
+        {
+            if (!names[i].startsWith(prefix) || startsWith(names[i], exclude))
+            {
+                continue;
+            }
+            long counters[] = new long[COUNTERS];
+            long statuses[] = new long[STATUS_SLOTS];
+            long buckets[] = new long[BUCKETS];
+            if (getMetricsNative(i, counters, statuses, buckets))
+            {
+                result.add(new FunctionCallMetrics(
+                    names[i], counters, statuses, buckets));
+            }
+        }
+        result.sort(Comparator.comparing(
+            FunctionCallMetrics::getFunctionName));
+        return Collections.unmodifiableList(result);
+    }
+    private static native String[] getFunctionNamesNative();
+    private static native boolean getMetricsNative(int functionId, 
+        long counters[], long statuses[], long buckets[]);
+    
+    /**
+     * Returns whether the given string starts with any of the given 
+     * prefixes
+     * 
+     * @param s The string
+     * @param prefixes The prefixes
+     * @return Whether the string starts with any prefix
+     */
+    private static boolean startsWith(String s, String ... prefixes)
+    {
+        for (String prefix : prefixes)
+        {
+            if (s.startsWith(prefix))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * Reset all metrics. Calls that are running while this method is
+     * called may or may not be counted afterwards.
+     */
+    public static void reset()
+    {
+        resetNative();
+    }
+    private static native void resetNative();
+    
+    /**
+     * Returns the largest value that falls into the given bucket of the
+     * latency histogram
+     * 
+     * @param bucket The bucket index
+     * @return The value
+     */
+    static long bucketUpperBound(int bucket)
+    {
+        if (bucket < SUB_BUCKETS)
+        {
+            return bucket;
+        }
+        int shift = (bucket - SUB_BUCKETS) / SUB_BUCKETS;
+        if (shift >= 64 - SUB_BUCKET_BITS - 1)
+        {
+            return Long.MAX_VALUE;
+        }
+        long subBucket = (bucket - SUB_BUCKETS) % SUB_BUCKETS;
+        long lower = (SUB_BUCKETS + subBucket) << shift;
+        return lower + (1L << shift) - 1;
+    }
+    
+    /**
+     * Register one {@link CallMetricsMXBean} for each family of functions
+     * at the platform MBean server. If the beans are already registered, 
+     * then this method has no effect.
+     * 
+     * @throws JMException If the beans can not be registered
+     */
+    public static synchronized void registerMBeans() throws JMException
+    {
+        if (!registeredNames.isEmpty())
+        {
+            return;
+        }
+        MBeanServer server = ManagementFactory.getPlatformMBeanServer();
+        try
+        {
+            for (int i = 0; i < FAMILIES.length; i++)
+            {
+                ObjectName name = new ObjectName(
+                    "jcuda.jcusolver:type=CallMetrics,family=" + FAMILIES[i]);
+                server.registerMBean(new FamilyMetrics(PREFIXES[i]), name);
+                registeredNames.add(name);
+            }
+        }
+        catch (JMException e)
+        {
+            unregisterMBeans();
+            throw e;
+        }
+    }
+    
+    /**
+     * Unregister the beans that have been registered with 
+     * {@link #registerMBeans()}
+     */
+    public static synchronized void unregisterMBeans()
+    {
+        MBeanServer server = ManagementFactory.getPlatformMBeanServer();
+        for (ObjectName name : registeredNames)
+        {
+            try
+            {
+                server.unregisterMBean(name);
+            }
+            catch (JMException e)
+            {
+                // Already unregistered by someone else
+            }
+        }
+        registeredNames.clear();
+    }
+    
+    /**
+     * Implementation of the {@link CallMetricsMXBean} for one family
+     */
+    private static class FamilyMetrics implements CallMetricsMXBean
+    {
+        /**
+         * The prefix of the function names
+         */
+        private final String prefix;
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param prefix The prefix of the function names. If this is
+         * empty, then the bean covers all functions that do not belong
+         * to another family.
+         */
+        FamilyMetrics(String prefix)
+        {
+            this.prefix = prefix;
+        }
+        
+        @Override
+        public boolean isEnabled()
+        {
+            return CallMetrics.isEnabled();
+        }
+        
+        @Override
+        public void setEnabled(boolean enabled)
+        {
+            CallMetrics.setEnabled(enabled);
+        }
+        
+        @Override
+        public long getCalls()
+        {
+            long calls = 0;
+            for (FunctionCallMetrics m : getFunctionMetrics())
+            {
+                calls += m.getCalls();
+            }
+            return calls;
+        }
+        
+        @Override
+        public long getErrors()
+        {
+            long errors = 0;
+            for (FunctionCallMetrics m : getFunctionMetrics())
+            {
+                errors += m.getErrors();
+            }
+            return errors;
+        }
+        
+        @Override
+        public List<FunctionCallMetrics> getFunctionMetrics()
+        {
+            if (prefix.isEmpty())
+            {
+                return getMetrics("", 
+                    PREFIXES[0], PREFIXES[1], PREFIXES[2], PREFIXES[3]);
+            }
+            return getMetrics(prefix);
+        }
+        
+        @Override
+        public void reset()
+        {
+            CallMetrics.reset();
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.util.List;
+
+/**
+ * The JMX interface for the {@link CallMetrics} of one family of 
+ * functions. The beans are registered with 
+ * {@link CallMetrics#registerMBeans()}, with names like
+ * <code>jcuda.jcusolver:type=CallMetrics,family=Dn</code>.
+ */
+public interface CallMetricsMXBean
+{
+    /**
+     * Returns whether the metrics are recorded
+     * 
+     * @return Whether the metrics are enabled
+     */
+    boolean isEnabled();
+    
+    /**
+     * Set whether the metrics are recorded. This affects all families.
+     * 
+     * @param enabled Whether the metrics are enabled
+     */
+    void setEnabled(boolean enabled);
+    
+    /**
+     * Returns the total number of calls of the functions of this family
+     * 
+     * @return The number of calls
+     */
+    long getCalls();
+    
+    /**
+     * Returns the total number of failed calls of the functions of 
+     * this family
+     * 
+     * @return The number of failed calls
+     */
+    long getErrors();
+    
+    /**
+     * Returns the metrics of all functions of this family that have
+     * been called
+     * 
+     * @return The function metrics
+     */
+    List<FunctionCallMetrics> getFunctionMetrics();
+    
+    /**
+     * Reset the metrics. This affects all families.
+     */
+    void reset();
+}
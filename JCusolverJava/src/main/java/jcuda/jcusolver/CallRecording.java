@@ -0,0 +1,768 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.io.EOFException;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Paths;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * The contents of a call recording file that was written after
+ * {@link JCusolver#startCallRecording(String, boolean)} was called. 
+ * It contains the {@link Call} objects in the order in which the calls 
+ * ended, and the recorded memory contents. It can be replayed with the 
+ * {@link CallReplay}.<br>
+ * <br>
+ * The file format is described in CallRecorder.hpp. It can only be
+ * read on a machine with the byte order of the machine that wrote it.
+ */
+public final class CallRecording
+{
+    /**
+     * The magic number, version and flags of the file. These must match
+     * the definitions in CallRecorder.cpp
+     */
+    private static final int MAGIC = 0x5243534A;
+    private static final int VERSION = 1;
+    private static final int FLAG_CONTENTS = 1;
+    
+    /**
+     * The chunk types. These must match the definitions in 
+     * CallRecorder.cpp
+     */
+    private static final int CHUNK_FUNCTION = 1;
+    private static final int CHUNK_BLOB = 2;
+    private static final int CHUNK_CALL = 3;
+    
+    /**
+     * The size of a chunk header, in bytes
+     */
+    private static final int CHUNK_HEADER_SIZE = 16;
+    
+    /**
+     * The kinds of recorded arguments. The ordinals must match the
+     * definitions in CallRecorder.cpp
+     */
+    public enum Kind
+    {
+        /**
+         * A null object, or a pointer with the address 0
+         */
+        NULL,
+        
+        /**
+         * An int value
+         */
+        INT,
+        
+        /**
+         * A char value
+         */
+        CHAR,
+        
+        /**
+         * A long value
+         */
+        LONG,
+        
+        /**
+         * A float value
+         */
+        FLOAT,
+        
+        /**
+         * A double value
+         */
+        DOUBLE,
+        
+        /**
+         * A cuComplex or cuDoubleComplex value
+         */
+        COMPLEX,
+        
+        /**
+         * A handle or another native object that is not a pointer
+         */
+        HANDLE,
+        
+        /**
+         * A pointer into a device memory allocation
+         */
+        DEVICE_POINTER,
+        
+        /**
+         * A pointer to native memory that is not a device allocation,
+         * for example, pinned host memory
+         */
+        NATIVE_POINTER,
+        
+        /**
+         * A pointer to a Java array or buffer
+         */
+        HOST_BUFFER,
+        
+        /**
+         * A primitive Java array
+         */
+        ARRAY,
+        
+        /**
+         * An array of pointers
+         */
+        POINTER_ARRAY,
+        
+        /**
+         * An argument that could not be recorded
+         */
+        UNSUPPORTED
+    }
+    
+    /**
+     * A recorded argument
+     */
+    public static final class Argument
+    {
+        /**
+         * The kind of the argument
+         */
+        private final Kind kind;
+        
+        /**
+         * The integral values. For INT, CHAR and LONG arguments, this is
+         * the value. For HANDLE arguments, these are the native pointer 
+         * before and after the call. For DEVICE_POINTER arguments, 
+         * these are the address, the allocation base and the allocation
+         * size. For NATIVE_POINTER arguments, this is the address.
+         */
+        private final long values[];
+        
+        /**
+         * The floating point values. For FLOAT and DOUBLE arguments, 
+         * this is the value. For COMPLEX arguments, these are the real
+         * and imaginary part.
+         */
+        private final double doubleValues[];
+        
+        /**
+         * The ID of the blob that contains the memory contents, or -1
+         */
+        private final int blobId;
+        
+        /**
+         * The array, for ARRAY arguments, or whether a COMPLEX argument
+         * is a cuDoubleComplex
+         */
+        private final Object value;
+        
+        /**
+         * The elements, for POINTER_ARRAY arguments
+         */
+        private final List<Argument> elements;
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param kind The kind
+         * @param values The integral values
+         * @param doubleValues The floating point values
+         * @param blobId The blob ID
+         * @param value The array or flag
+         * @param elements The elements
+         */
+        Argument(Kind kind, long values[], double doubleValues[], 
+            int blobId, Object value, List<Argument> elements)
+        {
+            this.kind = kind;
+            this.values = values;
+            this.doubleValues = doubleValues;
+            this.blobId = blobId;
+            this.value = value;
+            this.elements = elements;
+        }
+        
+        /**
+         * Returns the kind of this argument
+         * 
+         * @return The kind
+         */
+        public Kind getKind()
+        {
+            return kind;
+        }
+        
+        /**
+         * Returns the integral value with the given index. See 
+         * {@link Kind} for the meaning of the values.
+         * 
+         * @param index The index
+         * @return The value
+         * @throws IndexOutOfBoundsException If the argument does not 
+         * have such a value
+         */
+        public long getValue(int index)
+        {
+            return values[index];
+        }
+        
+        /**
+         * Returns the floating point value with the given index. For 
+         * FLOAT and DOUBLE arguments, this is the value. For COMPLEX 
+         * arguments, these are the real and imaginary part.
+         * 
+         * @param index The index
+         * @return The value
+         * @throws IndexOutOfBoundsException If the argument does not 
+         * have such a value
+         */
+        public double getDoubleValue(int index)
+        {
+            return doubleValues[index];
+        }
+        
+        /**
+         * Returns whether this is a cuDoubleComplex argument
+         * 
+         * @return Whether this is a double precision complex argument
+         */
+        public boolean isDoubleComplex()
+        {
+            return Boolean.TRUE.equals(value);
+        }
+        
+        /**
+         * Returns the ID of the {@link CallRecording#getBlob(int) blob}
+         * with the memory contents, or -1 if they have not been recorded
+         * 
+         * @return The blob ID
+         */
+        public int getBlobId()
+        {
+            return blobId;
+        }
+        
+        /**
+         * Returns the array of an ARRAY argument. This is an 
+         * <code>int[]</code>, <code>long[]</code>, <code>float[]</code>
+         * or <code>double[]</code>.
+         * 
+         * @return The array, or null for other arguments
+         */
+        public Object getArray()
+        {
+            return kind == Kind.ARRAY ? value : null;
+        }
+        
+        /**
+         * Returns the elements of a POINTER_ARRAY argument
+         * 
+         * @return The elements, or an empty list for other arguments
+         */
+        public List<Argument> getElements()
+        {
+            return elements;
+        }
+        
+        @Override
+        public String toString()
+        {
+            switch (kind)
+            {
+                case INT:
+                case LONG:
+                    return String.valueOf(values[0]);
+                case CHAR:
+                    return "'" + (char)values[0] + "'";
+                case FLOAT:
+                case DOUBLE:
+                    return String.valueOf(doubleValues[0]);
+                case COMPLEX:
+                    return "(" + doubleValues[0] + "," + doubleValues[1] + ")";
+                case HANDLE:
+                    return "0x" + Long.toHexString(values[0]);
+                case DEVICE_POINTER:
+                    return "0x" + Long.toHexString(values[1]) + "+" + 
+                        (values[0] - values[1]) + "[" + values[2] + "]";
+                case NATIVE_POINTER:
+                    return "0x" + Long.toHexString(values[0]);
+                case HOST_BUFFER:
+                    return "host#" + blobId;
+                case ARRAY:
+                    return value.getClass().getComponentType() + 
+                        "[" + java.lang.reflect.Array.getLength(value) + "]";
+                case POINTER_ARRAY:
+                    return elements.toString();
+                default:
+                    return kind.toString();
+            }
+        }
+    }
+    
+    /**
+     * A recorded call
+     */
+    public static final class Call
+    {
+        /**
+         * The function name
+         */
+        private final String functionName;
+        
+        /**
+         * The arguments
+         */
+        private final List<Argument> arguments;
+        
+        /**
+         * The index of the calling thread
+         */
+        private final int threadIndex;
+        
+        /**
+         * The start time, in nanoseconds
+         */
+        private final long startNs;
+        
+        /**
+         * The duration, in nanoseconds
+         */
+        private final long durationNs;
+        
+        /**
+         * The returned status
+         */
+        private final int status;
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param functionName The function name
+         * @param arguments The arguments
+         * @param threadIndex The thread index
+         * @param startNs The start time
+         * @param durationNs The duration
+         * @param status The status
+         */
+        Call(String functionName, List<Argument> arguments, 
+            int threadIndex, long startNs, long durationNs, int status)
+        {
+            this.functionName = functionName;
+            this.arguments = Collections.unmodifiableList(arguments);
+            this.threadIndex = threadIndex;
+            this.startNs = startNs;
+            this.durationNs = durationNs;
+            this.status = status;
+        }
+        
+        /**
+         * Returns the name of the function, for example,
+         * <code>"cusolverDnDpotrf"</code>
+         * 
+         * @return The function name
+         */
+        public String getFunctionName()
+        {
+            return functionName;
+        }
+        
+        /**
+         * Returns the arguments, in the order of the parameters of the
+         * function
+         * 
+         * @return The arguments
+         */
+        public List<Argument> getArguments()
+        {
+            return arguments;
+        }
+        
+        /**
+         * Returns the index of the thread that made the call. This is 
+         * an index that is assigned by the recorder.
+         * 
+         * @return The thread index
+         */
+        public int getThreadIndex()
+        {
+            return threadIndex;
+        }
+        
+        /**
+         * Returns the start time, in nanoseconds, relative to the first
+         * recorded call
+         * 
+         * @return The start time
+         */
+        public long getStartNs()
+        {
+            return startNs;
+        }
+        
+        /**
+         * Returns the host-side duration of the native function, in 
+         * nanoseconds
+         * 
+         * @return The duration
+         */
+        public long getDurationNs()
+        {
+            return durationNs;
+        }
+        
+        /**
+         * Returns the status that was returned by the function
+         * 
+         * @return The status
+         */
+        public int getStatus()
+        {
+            return status;
+        }
+        
+        @Override
+        public String toString()
+        {
+            return functionName + arguments;
+        }
+    }
+    
+    /**
+     * The calls
+     */
+    private final List<Call> calls;
+    
+    /**
+     * The blobs
+     */
+    private final Map<Integer, byte[]> blobs;
+    
+    /**
+     * Whether the contents of device memory have been recorded
+     */
+    private final boolean contentsRecorded;
+    
+    /**
+     * Creates a new instance
+     * 
+     * @param calls The calls
+     * @param blobs The blobs
+     * @param contentsRecorded Whether device contents have been recorded
+     */
+    private CallRecording(List<Call> calls, Map<Integer, byte[]> blobs, 
+        boolean contentsRecorded)
+    {
+        this.calls = Collections.unmodifiableList(calls);
+        this.blobs = blobs;
+        this.contentsRecorded = contentsRecorded;
+    }
+    
+    /**
+     * Returns an unmodifiable list of all calls, in the order in which 
+     * they ended
+     * 
+     * @return The calls
+     */
+    public List<Call> getCalls()
+    {
+        return calls;
+    }
+    
+    /**
+     * Returns the memory contents with the given ID. The returned array 
+     * must not be modified.
+     * 
+     * @param blobId The blob ID
+     * @return The contents, or null if there is no blob with this ID
+     */
+    public byte[] getBlob(int blobId)
+    {
+        return blobs.get(blobId);
+    }
+    
+    /**
+     * Returns whether the contents of device memory have been recorded
+     * 
+     * @return Whether the contents have been recorded
+     */
+    public boolean isContentsRecorded()
+    {
+        return contentsRecorded;
+    }
+    
+    /**
+     * Read the given call recording file. All recorded memory contents 
+     * are kept in memory.
+     * 
+     * @param fileName The file name
+     * @return The recording
+     * @throws IOException If the file can not be read, or is not a 
+     * valid call recording file
+     */
+    public static CallRecording read(String fileName) throws IOException
+    {
+        List<String> functionNames = new ArrayList<String>();
+        Map<Integer, byte[]> blobs = new HashMap<Integer, byte[]>();
+        List<Call> calls = new ArrayList<Call>();
+        boolean contentsRecorded = false;
+        try (FileChannel channel = FileChannel.open(
+            Paths.get(fileName), StandardOpenOption.READ))
+        {
+            ByteBuffer header = readFully(channel, 12);
+            if (header.getInt() != MAGIC)
+            {
+                throw new IOException(
+                    "Not a call recording file: " + fileName);
+            }
+            int version = header.getInt();
+            if (version != VERSION)
+            {
+                throw new IOException(
+                    "Unsupported call recording version: " + version);
+            }
+            contentsRecorded = (header.getInt() & FLAG_CONTENTS) != 0;
+            while (channel.position() < channel.size())
+            {
+                ByteBuffer chunk = readFully(channel, CHUNK_HEADER_SIZE);
+                int type = chunk.getInt();
+                int a = chunk.getInt();
+                int b = chunk.getInt();
+                int c = chunk.getInt();
+                if (type == CHUNK_FUNCTION)
+                {
+                    ByteBuffer name = readFully(channel, b);
+                    while (functionNames.size() <= a)
+                    {
+                        functionNames.add(null);
+                    }
+                    functionNames.set(a, new String(name.array(), 
+                        StandardCharsets.US_ASCII));
+                }
+                else if (type == CHUNK_BLOB)
+                {
+                    long size = (b & 0xFFFFFFFFL) | ((long)c << 32);
+                    blobs.put(a, readFully(channel, size).array());
+                }
+                else if (type == CHUNK_CALL)
+                {
+                    if (a < 0 || a >= functionNames.size() || 
+                        functionNames.get(a) == null)
+                    {
+                        throw new IOException("Invalid function ID: " + a);
+                    }
+                    ByteBuffer data = readFully(channel, c);
+                    int threadIndex = data.getInt();
+                    int status = data.getInt();
+                    long startNs = data.getLong();
+                    long durationNs = data.getLong();
+                    List<Argument> arguments = new ArrayList<Argument>(b);
+                    for (int i = 0; i < b; i++)
+                    {
+                        arguments.add(readArgument(data));
+                    }
+                    calls.add(new Call(functionNames.get(a), arguments, 
+                        threadIndex, startNs, durationNs, status));
+                }
+                else
+                {
+                    throw new IOException("Invalid chunk type: " + type);
+                }
+            }
+        }
+        long minStart = Long.MAX_VALUE;
+        for (Call call : calls)
+        {
+            minStart = Math.min(minStart, call.getStartNs());
+        }
+        List<Call> result = new ArrayList<Call>(calls.size());
+        for (Call call : calls)
+        {
+            result.add(new Call(call.getFunctionName(), call.getArguments(),
+                call.getThreadIndex(), call.getStartNs() - minStart, 
+                call.getDurationNs(), call.getStatus()));
+        }
+        return new CallRecording(result, blobs, contentsRecorded);
+    }
+    
+    /**
+     * Read a single argument from the given buffer
+     * 
+     * @param data The buffer
+     * @return The argument
+     * @throws IOException If the argument is invalid
+     */
+    private static Argument readArgument(ByteBuffer data) throws IOException
+    {
+        int kindIndex = data.get();
+        if (kindIndex < 0 || kindIndex >= Kind.values().length)
+        {
+            throw new IOException("Invalid argument kind: " + kindIndex);
+        }
+        Kind kind = Kind.values()[kindIndex];
+        long values[] = new long[0];
+        double doubleValues[] = new double[0];
+        int blobId = -1;
+        Object value = null;
+        List<Argument> elements = Collections.emptyList();
+        switch (kind)
+        {
+            case INT:
+            case CHAR:
+                values = new long[] { data.getInt() };
+                break;
+            case LONG:
+                values = new long[] { data.getLong() };
+                break;
+            case FLOAT:
+                doubleValues = new double[] { data.getFloat() };
+                break;
+            case DOUBLE:
+                doubleValues = new double[] { data.getDouble() };
+                break;
+            case COMPLEX:
+                doubleValues = new double[] { data.getDouble(), data.getDouble() };
+                value = data.get() != 0;
+                break;
+            case HANDLE:
+                values = new long[] { data.getLong(), data.getLong() };
+                break;
+            case DEVICE_POINTER:
+                values = new long[] { data.getLong(), data.getLong(), data.getLong() };
+                blobId = data.getInt();
+                break;
+            case NATIVE_POINTER:
+                values = new long[] { data.getLong() };
+                break;
+            case HOST_BUFFER:
+                blobId = data.getInt();
+                break;
+            case ARRAY:
+                value = readArray(data);
+                break;
+            case POINTER_ARRAY:
+            {
+                int length = data.getInt();
+                elements = new ArrayList<Argument>(length);
+                for (int i = 0; i < length; i++)
+                {
+                    elements.add(readArgument(data));
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        return new Argument(
+            kind, values, doubleValues, blobId, value, elements);
+    }
+    
+    /**
+     * Read a primitive array from the given buffer
+     * 
+     * @param data The buffer
+     * @return The array
+     * @throws IOException If the element type is invalid
+     */
+    private static Object readArray(ByteBuffer data) throws IOException
+    {
+        char type = (char)data.get();
+        int length = data.getInt();
+        switch (type)
+        {
+            case 'I':
+            {
+                int array[] = new int[length];
+                data.asIntBuffer().get(array);
+                data.position(data.position() + length * 4);
+                return array;
+            }
+            case 'J':
+            {
+                long array[] = new long[length];
+                data.asLongBuffer().get(array);
+                data.position(data.position() + length * 8);
+                return array;
+            }
+            case 'F':
+            {
+                float array[] = new float[length];
+                data.asFloatBuffer().get(array);
+                data.position(data.position() + length * 4);
+                return array;
+            }
+            case 'D':
+            {
+                double array[] = new double[length];
+                data.asDoubleBuffer().get(array);
+                data.position(data.position() + length * 8);
+                return array;
+            }
+            default:
+                throw new IOException("Invalid array type: " + type);
+        }
+    }
+    
+    /**
+     * Read the given number of bytes from the given channel, and return 
+     * them in a buffer with the native byte order
+     * 
+     * @param channel The channel
+     * @param size The number of bytes
+     * @return The buffer
+     * @throws IOException If the bytes can not be read
+     */
+    private static ByteBuffer readFully(FileChannel channel, long size) 
+        throws IOException
+    {
+        if (size < 0 || size > Integer.MAX_VALUE)
+        {
+            throw new IOException("Invalid chunk size: " + size);
+        }
+        ByteBuffer buffer = ByteBuffer.allocate((int)size);
+        while (buffer.hasRemaining())
+        {
+            if (channel.read(buffer) < 0)
+            {
+                throw new EOFException(
+                    "Unexpected end of call recording file");
+            }
+        }
+        buffer.flip();
+        buffer.order(ByteOrder.nativeOrder());
+        return buffer;
+    }
+}
@@ -0,0 +1,742 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.io.IOException;
+import java.io.PrintStream;
+import java.lang.reflect.InvocationTargetException;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+
+import jcuda.NativePointerObject;
+import jcuda.Pointer;
+import jcuda.cuComplex;
+import jcuda.cuDoubleComplex;
+import jcuda.jcusolver.CallRecording.Argument;
+import jcuda.jcusolver.CallRecording.Call;
+import jcuda.jcusolver.CallRecording.Kind;
+import jcuda.runtime.JCuda;
+import jcuda.runtime.cudaMemcpyKind;
+
+/**
+ * Replays the calls of a {@link CallRecording} against the native 
+ * library, and compares the replayed durations with the recorded ones.
+ * This allows reproducing a performance problem without the 
+ * application that caused it.<br>
+ * <br>
+ * Handles are mapped from the recorded values to the ones that are 
+ * created during the replay. Each recorded device memory allocation is 
+ * replaced by an allocation of the same size. If the contents have been
+ * recorded, they are copied into the allocation before the call, unless
+ * they did not change since the previous call. This copy is not part of
+ * the measured duration. Pointers to native memory that was not 
+ * allocated with cudaMalloc, for example, page-locked host memory, are 
+ * replaced by page-locked host memory of a fixed size, because the 
+ * size of these allocations is not recorded.<br>
+ * <br>
+ * The calls are replayed in the order in which they ended, in a single
+ * thread. Calls that contain arguments that could not be recorded are 
+ * skipped. Exceptions are disabled during the replay.<br>
+ * <br>
+ * Usage:
+ * <pre><code>
+ * java jcuda.jcusolver.CallReplay &lt;file&gt; [-sync] [-summary]
+ * </code></pre>
+ * With <code>-sync</code>, the device is synchronized after each call, 
+ * and the synchronization is part of the measured duration.
+ */
+public final class CallReplay
+{
+    /**
+     * The default size of the page-locked host memory that replaces 
+     * pointers to native memory, in bytes
+     */
+    public static final long DEFAULT_NATIVE_MEMORY_SIZE = 64L << 20;
+    
+    /**
+     * The result of replaying a single call
+     */
+    public static final class Result
+    {
+        /**
+         * The recorded call
+         */
+        private final Call call;
+        
+        /**
+         * The replayed duration, in nanoseconds
+         */
+        private final long durationNs;
+        
+        /**
+         * The replayed status
+         */
+        private final int status;
+        
+        /**
+         * The reason why the call was skipped, or null
+         */
+        private final String skipReason;
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param call The call
+         * @param durationNs The duration
+         * @param status The status
+         * @param skipReason The skip reason
+         */
+        Result(Call call, long durationNs, int status, String skipReason)
+        {
+            this.call = call;
+            this.durationNs = durationNs;
+            this.status = status;
+            this.skipReason = skipReason;
+        }
+        
+        /**
+         * Returns the recorded call
+         * 
+         * @return The call
+         */
+        public Call getCall()
+        {
+            return call;
+        }
+        
+        /**
+         * Returns the replayed duration, in nanoseconds
+         * 
+         * @return The duration
+         */
+        public long getDurationNs()
+        {
+            return durationNs;
+        }
+        
+        /**
+         * Returns the status that was returned by the replayed call
+         * 
+         * @return The status
+         */
+        public int getStatus()
+        {
+            return status;
+        }
+        
+        /**
+         * Returns whether the call was skipped
+         * 
+         * @return Whether the call was skipped
+         */
+        public boolean isSkipped()
+        {
+            return skipReason != null;
+        }
+        
+        /**
+         * Returns the reason why the call was skipped
+         * 
+         * @return The reason, or null if the call was not skipped
+         */
+        public String getSkipReason()
+        {
+            return skipReason;
+        }
+        
+        @Override
+        public String toString()
+        {
+            return "Result["+
+                "call="+call.getFunctionName()+","+
+                "durationNs="+durationNs+","+
+                "status="+cusolverStatus.stringFor(status)+","+
+                "skipReason="+skipReason+"]";
+        }
+    }
+    
+    /**
+     * The classes that contain the public methods that may be replayed
+     */
+    private static final Class<?> CLASSES[] = 
+    {
+        JCusolverDn.class,
+        JCusolverSp.class,
+        JCusolverRf.class,
+        JCusolverMg.class,
+        JCusolver.class
+    };
+    
+    /**
+     * The recording
+     */
+    private final CallRecording recording;
+    
+    /**
+     * The size of the page-locked host memory that replaces pointers to
+     * native memory
+     */
+    private final long nativeMemorySize;
+    
+    /**
+     * The handles that have been created, for the recorded values
+     */
+    private final Map<Long, NativePointerObject> handles;
+    
+    /**
+     * The device memory, for the recorded allocation base addresses
+     */
+    private final Map<Long, Pointer> deviceMemory;
+    
+    /**
+     * The ID of the blob that was last copied into the device memory 
+     * with the recorded allocation base address
+     */
+    private final Map<Long, Integer> uploadedBlobs;
+    
+    /**
+     * The page-locked host memory, for the recorded addresses
+     */
+    private final Map<Long, Pointer> nativeMemory;
+    
+    /**
+     * The methods, for the function names
+     */
+    private final Map<String, Method> methods;
+    
+    /**
+     * Creates a new replay for the given recording
+     * 
+     * @param recording The recording
+     * @param nativeMemorySize The size of the page-locked host memory 
+     * that replaces each recorded pointer to native memory, in bytes
+     */
+    public CallReplay(CallRecording recording, long nativeMemorySize)
+    {
+        this.recording = recording;
+        this.nativeMemorySize = nativeMemorySize;
+        this.handles = new HashMap<Long, NativePointerObject>();
+        this.deviceMemory = new HashMap<Long, Pointer>();
+        this.uploadedBlobs = new HashMap<Long, Integer>();
+        this.nativeMemory = new HashMap<Long, Pointer>();
+        this.methods = new HashMap<String, Method>();
+        for (Class<?> c : CLASSES)
+        {
+            for (Method method : c.getMethods())
+            {
+                if (Modifier.isStatic(method.getModifiers()) && 
+                    method.getName().startsWith("cusolver"))
+                {
+                    methods.putIfAbsent(method.getName(), method);
+                }
+            }
+        }
+    }
+    
+    /**
+     * Replay all calls of the recording, and free all memory that was
+     * allocated for the replay. The handles are not destroyed, unless
+     * the recording contains the calls that destroyed them.
+     * 
+     * @param synchronize Whether the device should be synchronized 
+     * after each call, as part of the measured duration
+     * @return The results, one for each call
+     */
+    public List<Result> replay(boolean synchronize)
+    {
+        boolean exceptionsEnabled = JCusolver.isExceptionsEnabled();
+        JCusolver.setExceptionsEnabled(false);
+        List<Result> results = new ArrayList<Result>();
+        try
+        {
+            for (Call call : recording.getCalls())
+            {
+                results.add(replay(call, synchronize));
+            }
+        }
+        finally
+        {
+            JCusolver.setExceptionsEnabled(exceptionsEnabled);
+            for (Pointer pointer : deviceMemory.values())
+            {
+                DeviceMemory.free(pointer);
+            }
+            for (Pointer pointer : nativeMemory.values())
+            {
+                DeviceMemory.freeHost(pointer);
+            }
+            deviceMemory.clear();
+            uploadedBlobs.clear();
+            nativeMemory.clear();
+            handles.clear();
+        }
+        return results;
+    }
+    
+    /**
+     * Replay the given call
+     * 
+     * @param call The call
+     * @param synchronize Whether the device should be synchronized
+     * @return The result
+     */
+    private Result replay(Call call, boolean synchronize)
+    {
+        Method method = methods.get(call.getFunctionName());
+        if (method == null)
+        {
+            return skipped(call, "Unknown function");
+        }
+        Class<?> types[] = method.getParameterTypes();
+        List<Argument> arguments = call.getArguments();
+        if (types.length != arguments.size())
+        {
+            return skipped(call, "Expected " + types.length + 
+                " arguments, but found " + arguments.size());
+        }
+        Object values[] = new Object[types.length];
+        try
+        {
+            for (int i = 0; i < types.length; i++)
+            {
+                values[i] = createValue(types[i], arguments.get(i));
+            }
+        }
+        catch (IllegalArgumentException e)
+        {
+            return skipped(call, e.getMessage());
+        }
+        int status;
+        long durationNs;
+        try
+        {
+            long startNs = System.nanoTime();
+            status = (Integer)method.invoke(null, values);
+            if (synchronize)
+            {
+                JCuda.cudaDeviceSynchronize();
+            }
+            durationNs = System.nanoTime() - startNs;
+        }
+        catch (IllegalAccessException e)
+        {
+            return skipped(call, e.toString());
+        }
+        catch (InvocationTargetException e)
+        {
+            return skipped(call, e.getCause().toString());
+        }
+        for (int i = 0; i < types.length; i++)
+        {
+            Argument argument = arguments.get(i);
+            if (argument.getKind() == Kind.HANDLE)
+            {
+                long after = argument.getValue(1);
+                if (after != 0)
+                {
+                    handles.put(after, (NativePointerObject)values[i]);
+                }
+            }
+        }
+        return new Result(call, durationNs, status, null);
+    }
+    
+    /**
+     * Create the result for a call that was skipped
+     * 
+     * @param call The call
+     * @param reason The reason
+     * @return The result
+     */
+    private static Result skipped(Call call, String reason)
+    {
+        return new Result(call, 0, -1, reason);
+    }
+    
+    /**
+     * Create the value for the given argument, to be passed to a 
+     * parameter with the given type
+     * 
+     * @param type The parameter type
+     * @param argument The argument
+     * @return The value
+     * @throws IllegalArgumentException If the argument can not be 
+     * passed to the parameter
+     */
+    private Object createValue(Class<?> type, Argument argument)
+    {
+        switch (argument.getKind())
+        {
+            case NULL:
+                if (type.isPrimitive())
+                {
+                    break;
+                }
+                return null;
+            case INT:
+                if (type == int.class)
+                {
+                    return (int)argument.getValue(0);
+                }
+                break;
+            case CHAR:
+                if (type == char.class)
+                {
+                    return (char)argument.getValue(0);
+                }
+                break;
+            case LONG:
+                if (type == long.class)
+                {
+                    return argument.getValue(0);
+                }
+                break;
+            case FLOAT:
+                if (type == float.class)
+                {
+                    return (float)argument.getDoubleValue(0);
+                }
+                break;
+            case DOUBLE:
+                if (type == double.class)
+                {
+                    return argument.getDoubleValue(0);
+                }
+                break;
+            case COMPLEX:
+                if (type == cuComplex.class)
+                {
+                    return cuComplex.cuCmplx(
+                        (float)argument.getDoubleValue(0), 
+                        (float)argument.getDoubleValue(1));
+                }
+                if (type == cuDoubleComplex.class)
+                {
+                    return cuDoubleComplex.cuCmplx(
+                        argument.getDoubleValue(0), 
+                        argument.getDoubleValue(1));
+                }
+                break;
+            case HANDLE:
+                if (NativePointerObject.class.isAssignableFrom(type) && 
+                    type != Pointer.class)
+                {
+                    return createHandle(type, argument.getValue(0));
+                }
+                break;
+            case DEVICE_POINTER:
+                if (type == Pointer.class)
+                {
+                    return createDevicePointer(argument);
+                }
+                break;
+            case NATIVE_POINTER:
+                if (type == Pointer.class)
+                {
+                    return nativeMemory.computeIfAbsent(
+                        argument.getValue(0), 
+                        a -> DeviceMemory.allocateHost(nativeMemorySize));
+                }
+                break;
+            case HOST_BUFFER:
+                if (type == Pointer.class)
+                {
+                    byte blob[] = recording.getBlob(argument.getBlobId());
+                    if (blob == null)
+                    {
+                        throw new IllegalArgumentException(
+                            "Missing contents of a host buffer");
+                    }
+                    return Pointer.to(blob.clone());
+                }
+                break;
+            case ARRAY:
+            {
+                Object array = argument.getArray();
+                if (type == array.getClass())
+                {
+                    return copyOf(array);
+                }
+                break;
+            }
+            case POINTER_ARRAY:
+                if (type == Pointer[].class)
+                {
+                    List<Argument> elements = argument.getElements();
+                    Pointer pointers[] = new Pointer[elements.size()];
+                    for (int i = 0; i < pointers.length; i++)
+                    {
+                        pointers[i] = 
+                            (Pointer)createValue(Pointer.class, elements.get(i));
+                    }
+                    return pointers;
+                }
+                break;
+            default:
+                throw new IllegalArgumentException(
+                    "Argument could not be recorded");
+        }
+        throw new IllegalArgumentException("Can not pass " + 
+            argument.getKind() + " argument as " + type.getSimpleName());
+    }
+    
+    /**
+     * Returns the handle of the given type that was created during the 
+     * replay for the given recorded value. If the recorded value is 0,
+     * then a new handle is returned, which will be initialized by the
+     * call.
+     * 
+     * @param type The handle type
+     * @param value The recorded value
+     * @return The handle
+     * @throws IllegalArgumentException If the handle is not known, or
+     * can not be created
+     */
+    private NativePointerObject createHandle(Class<?> type, long value)
+    {
+        if (value != 0)
+        {
+            NativePointerObject handle = handles.get(value);
+            if (handle == null || !type.isInstance(handle))
+            {
+                throw new IllegalArgumentException(
+                    "Unknown " + type.getSimpleName() + 
+                    " 0x" + Long.toHexString(value));
+            }
+            return handle;
+        }
+        try
+        {
+            return (NativePointerObject)type.getConstructor().newInstance();
+        }
+        catch (ReflectiveOperationException e)
+        {
+            throw new IllegalArgumentException(
+                "Can not create " + type.getSimpleName(), e);
+        }
+    }
+    
+    /**
+     * Returns a pointer into the device memory that replaces the
+     * recorded allocation of the given argument. If the contents of
+     * the allocation have been recorded and changed since the previous
+     * call, they are copied into the device memory.
+     * 
+     * @param argument The DEVICE_POINTER argument
+     * @return The pointer
+     */
+    private Pointer createDevicePointer(Argument argument)
+    {
+        long address = argument.getValue(0);
+        long base = argument.getValue(1);
+        long size = argument.getValue(2);
+        Pointer pointer = deviceMemory.computeIfAbsent(base, b -> 
+        {
+            Pointer p = DeviceMemory.allocate(size);
+            JCuda.cudaMemset(p, 0, size);
+            return p;
+        });
+        int blobId = argument.getBlobId();
+        byte blob[] = recording.getBlob(blobId);
+        if (blob != null && !Integer.valueOf(blobId).equals(
+            uploadedBlobs.get(base)))
+        {
+            DeviceMemory.copy(pointer, Pointer.to(blob), 
+                Math.min(size, blob.length), 
+                cudaMemcpyKind.cudaMemcpyHostToDevice);
+            uploadedBlobs.put(base, blobId);
+        }
+        return pointer.withByteOffset(address - base);
+    }
+    
+    /**
+     * Returns a copy of the given primitive array
+     * 
+     * @param array The array
+     * @return The copy
+     */
+    private static Object copyOf(Object array)
+    {
+        if (array instanceof int[])
+        {
+            return ((int[])array).clone();
+        }
+        if (array instanceof long[])
+        {
+            return ((long[])array).clone();
+        }
+        if (array instanceof float[])
+        {
+            return ((float[])array).clone();
+        }
+        return ((double[])array).clone();
+    }
+    
+    /**
+     * Print one line for each of the given results, with the recorded 
+     * and replayed duration and status
+     * 
+     * @param results The results
+     * @param out The target stream
+     */
+    public static void printTimeline(List<Result> results, PrintStream out)
+    {
+        out.println(String.format(Locale.ENGLISH, 
+            "%-4s %-40s %14s %14s  %s", 
+            "T", "function", "recorded us", "replayed us", "status"));
+        for (Result result : results)
+        {
+            Call call = result.getCall();
+            if (result.isSkipped())
+            {
+                out.println(String.format(Locale.ENGLISH, 
+                    "T%-3d %-40s %14.3f %14s  skipped: %s", 
+                    call.getThreadIndex(), call.getFunctionName(), 
+                    call.getDurationNs() / 1e3, "-", 
+                    result.getSkipReason()));
+                continue;
+            }
+            String status = cusolverStatus.stringFor(call.getStatus());
+            if (result.getStatus() != call.getStatus())
+            {
+                status += " -> " + cusolverStatus.stringFor(result.getStatus());
+            }
+            out.println(String.format(Locale.ENGLISH, 
+                "T%-3d %-40s %14.3f %14.3f  %s", 
+                call.getThreadIndex(), call.getFunctionName(), 
+                call.getDurationNs() / 1e3, result.getDurationNs() / 1e3, 
+                status));
+        }
+    }
+    
+    /**
+     * Print a summary of the given results, with the number of calls, 
+     * the total recorded and replayed duration, and the number of 
+     * skipped calls and calls with a different status for each 
+     * function, sorted by the total recorded duration
+     * 
+     * @param results The results
+     * @param out The target stream
+     */
+    public static void printSummary(List<Result> results, PrintStream out)
+    {
+        Map<String, long[]> statistics = new LinkedHashMap<String, long[]>();
+        for (Result result : results)
+        {
+            Call call = result.getCall();
+            long s[] = statistics.computeIfAbsent(
+                call.getFunctionName(), k -> new long[5]);
+            s[0]++;
+            if (result.isSkipped())
+            {
+                s[3]++;
+                continue;
+            }
+            s[1] += call.getDurationNs();
+            s[2] += result.getDurationNs();
+            if (result.getStatus() != call.getStatus())
+            {
+                s[4]++;
+            }
+        }
+        List<Map.Entry<String, long[]>> entries = 
+            new ArrayList<Map.Entry<String, long[]>>(statistics.entrySet());
+        entries.sort((e0, e1) -> Long.compare(e1.getValue()[1], e0.getValue()[1]));
+        out.println(String.format(Locale.ENGLISH, 
+            "%-40s %10s %14s %14s %8s %8s %8s", "function", "calls", 
+            "recorded us", "replayed us", "ratio", "skipped", "changed"));
+        for (Map.Entry<String, long[]> entry : entries)
+        {
+            long s[] = entry.getValue();
+            double ratio = s[1] == 0 ? 0.0 : (double)s[2] / s[1];
+            out.println(String.format(Locale.ENGLISH, 
+                "%-40s %10d %14.3f %14.3f %8.3f %8d %8d", 
+                entry.getKey(), s[0], s[1] / 1e3, s[2] / 1e3, ratio, 
+                s[3], s[4]));
+        }
+    }
+    
+    /**
+     * Replay a call recording file, and print the timeline or the 
+     * summary of the results
+     * 
+     * @param args The file name, and optionally "-sync" and "-summary"
+     * @throws IOException If the file can not be read
+     */
+    public static void main(String[] args) throws IOException
+    {
+        String fileName = null;
+        boolean synchronize = false;
+        boolean summary = false;
+        for (String arg : args)
+        {
+            if (arg.equals("-sync"))
+            {
+                synchronize = true;
+            }
+            else if (arg.equals("-summary"))
+            {
+                summary = true;
+            }
+            else if (fileName == null && !arg.startsWith("-"))
+            {
+                fileName = arg;
+            }
+            else
+            {
+                fileName = null;
+                break;
+            }
+        }
+        if (fileName == null)
+        {
+            System.err.println(
+                "Usage: CallReplay <file> [-sync] [-summary]");
+            System.exit(1);
+        }
+        CallRecording recording = CallRecording.read(fileName);
+        CallReplay replay = 
+            new CallReplay(recording, DEFAULT_NATIVE_MEMORY_SIZE);
+        List<Result> results = replay.replay(synchronize);
+        if (summary)
+        {
+            printSummary(results, System.out);
+        }
+        else
+        {
+            printTimeline(results, System.out);
+        }
+    }
+}
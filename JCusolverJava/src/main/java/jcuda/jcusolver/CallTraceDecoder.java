@@ -0,0 +1,402 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.io.EOFException;
+import java.io.IOException;
+import java.io.PrintStream;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Paths;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+
+/**
+ * A decoder for the binary call traces that are written after 
+ * {@link JCusolver#startCallTrace(String)} was called. It reads the
+ * {@link CallTraceRecord} objects, and prints them as a timeline or
+ * as a summary for each function.<br>
+ * <br>
+ * The file format is described in CallTracer.hpp. It can only be
+ * read on a machine with the byte order of the machine that wrote it.
+ * <br>
+ * <br>
+ * Usage:
+ * <pre><code>
+ * java jcuda.jcusolver.CallTraceDecoder &lt;file&gt; [-summary]
+ * </code></pre>
+ */
+public final class CallTraceDecoder
+{
+    /**
+     * The magic number and version of the file. These must match the 
+     * definitions in CallTracer.cpp
+     */
+    private static final int MAGIC = 0x5443534A;
+    private static final int VERSION = 1;
+    
+    /**
+     * The chunk types. These must match the definitions in CallTracer.cpp
+     */
+    private static final int CHUNK_FUNCTION = 1;
+    private static final int CHUNK_RECORDS = 2;
+    
+    /**
+     * The size of a chunk header and of a record, in bytes
+     */
+    private static final int CHUNK_HEADER_SIZE = 16;
+    private static final int RECORD_SIZE = 56;
+    
+    /**
+     * The number of recorded arguments
+     */
+    private static final int MAX_ARGUMENTS = 4;
+    
+    /**
+     * The contents of a call trace file
+     */
+    public static final class Trace
+    {
+        /**
+         * The records
+         */
+        private final List<CallTraceRecord> records;
+        
+        /**
+         * The number of dropped records
+         */
+        private final long droppedCount;
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param records The records
+         * @param droppedCount The number of dropped records
+         */
+        Trace(List<CallTraceRecord> records, long droppedCount)
+        {
+            this.records = Collections.unmodifiableList(records);
+            this.droppedCount = droppedCount;
+        }
+        
+        /**
+         * Returns an unmodifiable list of all records, sorted by their
+         * start time
+         * 
+         * @return The records
+         */
+        public List<CallTraceRecord> getRecords()
+        {
+            return records;
+        }
+        
+        /**
+         * Returns the number of records that have been dropped because 
+         * the buffer of a thread was full. If this is not zero, the 
+         * trace is incomplete.
+         * 
+         * @return The number of dropped records
+         */
+        public long getDroppedCount()
+        {
+            return droppedCount;
+        }
+        
+        @Override
+        public String toString()
+        {
+            return "Trace["
+                + "records=" + records.size() + ","
+                + "droppedCount=" + droppedCount + "]";
+        }
+    }
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private CallTraceDecoder()
+    {
+        // Private constructor to prevent instantiation
+    }
+    
+    /**
+     * Read the given call trace file
+     * 
+     * @param fileName The file name
+     * @return The trace
+     * @throws IOException If the file can not be read, or is not a 
+     * valid call trace file
+     */
+    public static Trace read(String fileName) throws IOException
+    {
+        List<String> functionNames = new ArrayList<String>();
+        List<String[]> argumentNames = new ArrayList<String[]>();
+        List<long[]> rawRecords = new ArrayList<long[]>();
+        long droppedCount = 0;
+        try (FileChannel channel = FileChannel.open(
+            Paths.get(fileName), StandardOpenOption.READ))
+        {
+            ByteBuffer header = readFully(channel, 8);
+            if (header.getInt() != MAGIC)
+            {
+                throw new IOException("Not a call trace file: " + fileName);
+            }
+            int version = header.getInt();
+            if (version != VERSION)
+            {
+                throw new IOException(
+                    "Unsupported call trace version: " + version);
+            }
+            while (channel.position() < channel.size())
+            {
+                ByteBuffer chunk = readFully(channel, CHUNK_HEADER_SIZE);
+                int type = chunk.getInt();
+                int a = chunk.getInt();
+                int b = chunk.getInt();
+                int c = chunk.getInt();
+                if (type == CHUNK_FUNCTION)
+                {
+                    ByteBuffer name = readFully(channel, b);
+                    String s = new String(name.array(), 
+                        StandardCharsets.US_ASCII);
+                    while (functionNames.size() <= a)
+                    {
+                        functionNames.add(null);
+                        argumentNames.add(null);
+                    }
+                    int open = s.indexOf('(');
+                    functionNames.set(a, s.substring(0, open));
+                    String arguments = 
+                        s.substring(open + 1, s.length() - 1).trim();
+                    argumentNames.set(a, arguments.isEmpty() ? 
+                        new String[0] : arguments.split(",\\s*"));
+                }
+                else if (type == CHUNK_RECORDS)
+                {
+                    ByteBuffer data = 
+                        readFully(channel, (long)b * RECORD_SIZE);
+                    for (int i = 0; i < b; i++)
+                    {
+                        // The thread index, function ID, status, start,
+                        // duration, and the arguments
+                        long raw[] = new long[5 + MAX_ARGUMENTS];
+                        raw[0] = a;
+                        raw[1] = data.getInt();
+                        raw[2] = data.getInt();
+                        raw[3] = data.getLong();
+                        raw[4] = data.getLong();
+                        for (int j = 0; j < MAX_ARGUMENTS; j++)
+                        {
+                            raw[5 + j] = data.getLong();
+                        }
+                        rawRecords.add(raw);
+                    }
+                    droppedCount += c;
+                }
+                else
+                {
+                    throw new IOException("Invalid chunk type: " + type);
+                }
+            }
+        }
+        long minStart = Long.MAX_VALUE;
+        for (long raw[] : rawRecords)
+        {
+            minStart = Math.min(minStart, raw[3]);
+        }
+        List<CallTraceRecord> records = 
+            new ArrayList<CallTraceRecord>(rawRecords.size());
+        for (long raw[] : rawRecords)
+        {
+            int functionId = (int)raw[1];
+            if (functionId < 0 || functionId >= functionNames.size() ||
+                functionNames.get(functionId) == null)
+            {
+                throw new IOException("Invalid function ID: " + functionId);
+            }
+            String names[] = argumentNames.get(functionId);
+            long arguments[] = new long[names.length];
+            System.arraycopy(raw, 5, arguments, 0, names.length);
+            records.add(new CallTraceRecord(functionNames.get(functionId), 
+                names, arguments, (int)raw[0], raw[3] - minStart, raw[4], 
+                (int)raw[2]));
+        }
+        records.sort(Comparator.comparingLong(CallTraceRecord::getStartNs));
+        return new Trace(records, droppedCount);
+    }
+    
+    /**
+     * Read the given number of bytes from the given channel, and return 
+     * them in a buffer with the native byte order
+     * 
+     * @param channel The channel
+     * @param size The number of bytes
+     * @return The buffer
+     * @throws IOException If the bytes can not be read
+     */
+    private static ByteBuffer readFully(FileChannel channel, long size) 
+        throws IOException
+    {
+        if (size > Integer.MAX_VALUE)
+        {
+            throw new IOException("Invalid chunk size: " + size);
+        }
+        ByteBuffer buffer = ByteBuffer.allocate((int)size);
+        while (buffer.hasRemaining())
+        {
+            if (channel.read(buffer) < 0)
+            {
+                throw new EOFException("Unexpected end of call trace file");
+            }
+        }
+        buffer.flip();
+        buffer.order(ByteOrder.nativeOrder());
+        return buffer;
+    }
+    
+    /**
+     * Print the given trace as a timeline, with one line for each call
+     * 
+     * @param trace The trace
+     * @param out The target stream
+     */
+    public static void printTimeline(Trace trace, PrintStream out)
+    {
+        for (CallTraceRecord record : trace.getRecords())
+        {
+            StringBuilder sb = new StringBuilder();
+            String names[] = record.getArgumentNames();
+            long arguments[] = record.getArguments();
+            for (int i = 0; i < names.length; i++)
+            {
+                if (i > 0)
+                {
+                    sb.append(", ");
+                }
+                sb.append(names[i]).append("=").append(arguments[i]);
+            }
+            String call = record.getFunctionName() + "(" + sb + ")";
+            out.println(String.format(Locale.ENGLISH, 
+                "%14.3f us  T%-3d %-60s %12.3f us  %s", 
+                record.getStartNs() / 1e3, record.getThreadIndex(), call, 
+                record.getDurationNs() / 1e3, 
+                cusolverStatus.stringFor(record.getStatus())));
+        }
+        printDropped(trace, out);
+    }
+    
+    /**
+     * Print a summary of the given trace, with the number of calls, 
+     * the total, mean and maximum duration, and the number of failed
+     * calls of each function, sorted by the total duration
+     * 
+     * @param trace The trace
+     * @param out The target stream
+     */
+    public static void printSummary(Trace trace, PrintStream out)
+    {
+        Map<String, long[]> statistics = new LinkedHashMap<String, long[]>();
+        for (CallTraceRecord record : trace.getRecords())
+        {
+            long s[] = statistics.computeIfAbsent(
+                record.getFunctionName(), k -> new long[4]);
+            s[0]++;
+            s[1] += record.getDurationNs();
+            s[2] = Math.max(s[2], record.getDurationNs());
+            if (record.getStatus() != cusolverStatus.CUSOLVER_STATUS_SUCCESS)
+            {
+                s[3]++;
+            }
+        }
+        List<Map.Entry<String, long[]>> entries = 
+            new ArrayList<Map.Entry<String, long[]>>(statistics.entrySet());
+        entries.sort((e0, e1) -> Long.compare(e1.getValue()[1], e0.getValue()[1]));
+        out.println(String.format(Locale.ENGLISH, 
+            "%-40s %10s %14s %12s %12s %8s", 
+            "function", "calls", "total us", "mean us", "max us", "failed"));
+        for (Map.Entry<String, long[]> entry : entries)
+        {
+            long s[] = entry.getValue();
+            out.println(String.format(Locale.ENGLISH, 
+                "%-40s %10d %14.3f %12.3f %12.3f %8d", 
+                entry.getKey(), s[0], s[1] / 1e3, s[1] / 1e3 / s[0], 
+                s[2] / 1e3, s[3]));
+        }
+        printDropped(trace, out);
+    }
+    
+    /**
+     * Print a warning if the given trace contains dropped records
+     * 
+     * @param trace The trace
+     * @param out The target stream
+     */
+    private static void printDropped(Trace trace, PrintStream out)
+    {
+        if (trace.getDroppedCount() > 0)
+        {
+            out.println("Warning: " + trace.getDroppedCount() + 
+                " records have been dropped");
+        }
+    }
+    
+    /**
+     * Print the timeline or the summary of a call trace file
+     * 
+     * @param args The file name, and optionally "-summary"
+     * @throws IOException If the file can not be read
+     */
+    public static void main(String[] args) throws IOException
+    {
+        if (args.length < 1 || args.length > 2 || 
+            (args.length == 2 && !args[1].equals("-summary")))
+        {
+            System.err.println(
+                "Usage: CallTraceDecoder <file> [-summary]");
+            System.exit(1);
+        }
+        Trace trace = read(args[0]);
+        if (args.length == 2)
+        {
+            printSummary(trace, System.out);
+        }
+        else
+        {
+            printTimeline(trace, System.out);
+        }
+    }
+}
@@ -0,0 +1,187 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.util.Arrays;
+
+/**
+ * A single native function call in a call trace that was written after
+ * {@link JCusolver#startCallTrace(String)} was called, and read with 
+ * the {@link CallTraceDecoder}
+ */
+public final class CallTraceRecord
+{
+    /**
+     * The function name
+     */
+    private final String functionName;
+    
+    /**
+     * The names of the recorded arguments
+     */
+    private final String argumentNames[];
+    
+    /**
+     * The values of the recorded arguments
+     */
+    private final long arguments[];
+    
+    /**
+     * The index of the calling thread
+     */
+    private final int threadIndex;
+    
+    /**
+     * The start time, in nanoseconds
+     */
+    private final long startNs;
+    
+    /**
+     * The duration, in nanoseconds
+     */
+    private final long durationNs;
+    
+    /**
+     * The returned status
+     */
+    private final int status;
+    
+    /**
+     * Creates a new instance
+     * 
+     * @param functionName The function name
+     * @param argumentNames The argument names
+     * @param arguments The argument values
+     * @param threadIndex The thread index
+     * @param startNs The start time
+     * @param durationNs The duration
+     * @param status The status
+     */
+    CallTraceRecord(String functionName, String argumentNames[], 
+        long arguments[], int threadIndex, long startNs, long durationNs, 
+        int status)
+    {
+        this.functionName = functionName;
+        this.argumentNames = argumentNames;
+        this.arguments = arguments;
+        this.threadIndex = threadIndex;
+        this.startNs = startNs;
+        this.durationNs = durationNs;
+        this.status = status;
+    }
+    
+    /**
+     * Returns the name of the cuSOLVER function, for example, 
+     * <code>"cusolverDnDpotrf"</code>
+     * 
+     * @return The function name
+     */
+    public String getFunctionName()
+    {
+        return functionName;
+    }
+    
+    /**
+     * Returns the names of the recorded arguments. These are the first
+     * (at most four) integer arguments of the function.
+     * 
+     * @return The argument names
+     */
+    public String[] getArgumentNames()
+    {
+        return argumentNames.clone();
+    }
+    
+    /**
+     * Returns the values of the recorded arguments, in the same order 
+     * as the {@link #getArgumentNames() argument names}
+     * 
+     * @return The argument values
+     */
+    public long[] getArguments()
+    {
+        return arguments.clone();
+    }
+    
+    /**
+     * Returns the index of the thread that made the call. The threads 
+     * are numbered in the order in which they made their first traced
+     * call.
+     * 
+     * @return The thread index
+     */
+    public int getThreadIndex()
+    {
+        return threadIndex;
+    }
+    
+    /**
+     * Returns the start time of the call, in nanoseconds, relative to 
+     * the earliest call in the trace
+     * 
+     * @return The start time
+     */
+    public long getStartNs()
+    {
+        return startNs;
+    }
+    
+    /**
+     * Returns the duration of the call, in nanoseconds
+     * 
+     * @return The duration
+     */
+    public long getDurationNs()
+    {
+        return durationNs;
+    }
+    
+    /**
+     * Returns the {@link cusolverStatus} that was returned by the call
+     * 
+     * @return The status
+     */
+    public int getStatus()
+    {
+        return status;
+    }
+    
+    @Override
+    public String toString()
+    {
+        return "CallTraceRecord["
+            + "functionName=" + functionName + ","
+            + "argumentNames=" + Arrays.toString(argumentNames) + ","
+            + "arguments=" + Arrays.toString(arguments) + ","
+            + "threadIndex=" + threadIndex + ","
+            + "startNs=" + startNs + ","
+            + "durationNs=" + durationNs + ","
+            + "status=" + cusolverStatus.stringFor(status) + "]";
+    }
+}
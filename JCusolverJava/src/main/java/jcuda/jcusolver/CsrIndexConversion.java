@@ -0,0 +1,95 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import jcuda.Pointer;
+
+/**
+ * Native host functions for converting between 64 bit and 32 bit 
+ * index arrays of sparse matrices. <br>
+ * <br>
+ * The conversions use multiple host threads, and AVX2 when the native
+ * library was built with JCUSOLVER_HOST_AVX2. The pointers may point 
+ * to Java arrays or to host memory. Host memory is required for arrays 
+ * with more than 2<sup>31</sup>-1 elements. <br>
+ * <br>
+ * Like the functions of {@link JCusolverSp}, these functions return 
+ * a {@link cusolverStatus}, which is checked according to 
+ * {@link JCusolver#setExceptionsEnabled(boolean)}.
+ */
+public final class CsrIndexConversion
+{
+    static
+    {
+        JCusolver.initialize(JCusolver.INIT_POINTER_FIELDS);
+    }
+    
+    /**
+     * Compute dst[i] = (int)(src[i] - offset) for all i in [0, count).
+     * The offset may, for example, be the first row pointer of a row 
+     * block, to obtain zero-based 32 bit row pointers for the block.
+     * 
+     * @param count The number of elements
+     * @param src The 64 bit source indices
+     * @param offset The offset to subtract
+     * @param dst The 32 bit destination indices
+     * @return The {@link cusolverStatus}. This is 
+     * CUSOLVER_STATUS_INVALID_VALUE if any result does not fit into 
+     * 32 bit. The contents of dst are unspecified in this case.
+     */
+    public static int narrow(long count, Pointer src, long offset, Pointer dst)
+    {
+        return JCusolver.checkResult(narrowNative(count, src, offset, dst));
+    }
+    private static native int narrowNative(
+        long count, Pointer src, long offset, Pointer dst);
+    
+    /**
+     * Compute dst[i] = (long)src[i] + offset for all i in [0, count)
+     * 
+     * @param count The number of elements
+     * @param src The 32 bit source indices
+     * @param offset The offset to add
+     * @param dst The 64 bit destination indices
+     * @return The {@link cusolverStatus}
+     */
+    public static int widen(long count, Pointer src, long offset, Pointer dst)
+    {
+        return JCusolver.checkResult(widenNative(count, src, offset, dst));
+    }
+    private static native int widenNative(
+        long count, Pointer src, long offset, Pointer dst);
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private CsrIndexConversion()
+    {
+        // Private constructor to prevent instantiation
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import jcuda.Pointer;
+
+/**
+ * A square sparse matrix in CSR format with 64 bit indices, whose 
+ * arrays are stored in host memory. <br>
+ * <br>
+ * The row pointers and column indices are 64 bit integers, so that 
+ * the number of nonzeros may exceed 2<sup>31</sup>-1. Since Java 
+ * arrays are limited to 2<sup>31</sup>-1 elements, the arrays of such
+ * matrices must be allocated as host memory, for example with 
+ * cudaMallocHost. The matrix does not own the memory.
+ */
+public final class CsrMatrix64
+{
+    /**
+     * The size of the matrix
+     */
+    private final long n;
+    
+    /**
+     * The number of nonzeros
+     */
+    private final long nnz;
+    
+    /**
+     * The index base
+     */
+    private final int indexBase;
+    
+    /**
+     * The row pointers
+     */
+    private final Pointer csrRowPtr;
+    
+    /**
+     * The column indices
+     */
+    private final Pointer csrColInd;
+    
+    /**
+     * The values
+     */
+    private final Pointer csrVal;
+    
+    /**
+     * Creates a new matrix
+     * 
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param indexBase The index base, 0 or 1
+     * @param csrRowPtr The n+1 64 bit row pointers
+     * @param csrColInd The nnz 64 bit column indices
+     * @param csrVal The nnz double values
+     * @throws IllegalArgumentException If the size or the number of 
+     * nonzeros is negative, or the index base is not 0 or 1
+     * @throws NullPointerException If any pointer is <code>null</code>
+     */
+    public CsrMatrix64(long n, long nnz, int indexBase, 
+        Pointer csrRowPtr, Pointer csrColInd, Pointer csrVal)
+    {
+        if (n < 0 || nnz < 0)
+        {
+            throw new IllegalArgumentException(
+                "Invalid size " + n + " or number of nonzeros " + nnz);
+        }
+        if (indexBase != 0 && indexBase != 1)
+        {
+            throw new IllegalArgumentException(
+                "The index base must be 0 or 1, but is " + indexBase);
+        }
+        if (csrRowPtr == null || csrColInd == null || csrVal == null)
+        {
+            throw new NullPointerException("The arrays may not be null");
+        }
+        this.n = n;
+        this.nnz = nnz;
+        this.indexBase = indexBase;
+        this.csrRowPtr = csrRowPtr;
+        this.csrColInd = csrColInd;
+        this.csrVal = csrVal;
+    }
+    
+    /**
+     * Returns the size of the matrix
+     * 
+     * @return The size
+     */
+    public long getSize()
+    {
+        return n;
+    }
+    
+    /**
+     * Returns the number of nonzeros
+     * 
+     * @return The number of nonzeros
+     */
+    public long getNnz()
+    {
+        return nnz;
+    }
+    
+    /**
+     * Returns the index base
+     * 
+     * @return The index base
+     */
+    public int getIndexBase()
+    {
+        return indexBase;
+    }
+    
+    /**
+     * Returns the pointer to the 64 bit row pointers
+     * 
+     * @return The row pointers
+     */
+    public Pointer getCsrRowPtr()
+    {
+        return csrRowPtr;
+    }
+    
+    /**
+     * Returns the pointer to the 64 bit column indices
+     * 
+     * @return The column indices
+     */
+    public Pointer getCsrColInd()
+    {
+        return csrColInd;
+    }
+    
+    /**
+     * Returns the pointer to the values
+     * 
+     * @return The values
+     */
+    public Pointer getCsrVal()
+    {
+        return csrVal;
+    }
+    
+    @Override
+    public String toString()
+    {
+        return "CsrMatrix64["+
+            "n="+n+","+
+            "nnz="+nnz+","+
+            "indexBase="+indexBase+"]";
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+/**
+ * A reordered CSR matrix structure, together with the map that 
+ * describes how the values of the original matrix are reordered.
+ * The map may be applied to any number of value arrays that share
+ * the original sparsity pattern.
+ */
+public final class CsrPermutation
+{
+    /**
+     * The row pointers of the reordered matrix
+     */
+    private final int csrRowPtr[];
+    
+    /**
+     * The column indices of the reordered matrix
+     */
+    private final int csrColInd[];
+    
+    /**
+     * The value map: Value i of the reordered matrix is value map[i] 
+     * of the original matrix
+     */
+    private final int map[];
+    
+    /**
+     * Creates a new instance. The map must have been computed by 
+     * {@link CsrPermuter#permuteStructure}, which validated the input
+     * and ensures that the map is a permutation, so that it does not 
+     * have to be validated again for each call to permuteValues.
+     * 
+     * @param csrRowPtr The row pointers
+     * @param csrColInd The column indices
+     * @param map The value map
+     */
+    CsrPermutation(int csrRowPtr[], int csrColInd[], int map[])
+    {
+        this.csrRowPtr = csrRowPtr;
+        this.csrColInd = csrColInd;
+        this.map = map;
+    }
+    
+    /**
+     * Returns a copy of the row pointers of the reordered matrix
+     * 
+     * @return The row pointers
+     */
+    public int[] getCsrRowPtr()
+    {
+        return csrRowPtr.clone();
+    }
+    
+    /**
+     * Returns a copy of the column indices of the reordered matrix
+     * 
+     * @return The column indices
+     */
+    public int[] getCsrColInd()
+    {
+        return csrColInd.clone();
+    }
+    
+    /**
+     * Returns a copy of the value map: Value i of the reordered matrix 
+     * is value map[i] of the original matrix
+     * 
+     * @return The value map
+     */
+    public int[] getMap()
+    {
+        return map.clone();
+    }
+    
+    /**
+     * Reorder the given values of the original matrix, with
+     * {@link CsrPermuter#permuteValues}
+     * 
+     * @param values The values of the original matrix
+     * @param result The values of the reordered matrix
+     * @throws jcuda.CudaException If the native call failed
+     */
+    public void permuteValues(double values[], double result[])
+    {
+        checkSuccess(CsrPermuter.permuteValuesWithValidatedMap(
+            map.length, values, map, result), "permuteValues");
+    }
+    
+    /**
+     * Reorder the given values of the original matrix, with
+     * {@link CsrPermuter#permuteValues}
+     * 
+     * @param values The values of the original matrix
+     * @param result The values of the reordered matrix
+     * @throws jcuda.CudaException If the native call failed
+     */
+    public void permuteValues(float values[], float result[])
+    {
+        checkSuccess(CsrPermuter.permuteValuesWithValidatedMap(
+            map.length, values, map, result), "permuteValues");
+    }
+}
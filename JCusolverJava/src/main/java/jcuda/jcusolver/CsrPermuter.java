@@ -0,0 +1,300 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * Native host functions for permuting sparse matrices in CSR format. <br>
+ * <br>
+ * These functions compute B = A(p,q), with the same semantics as 
+ * cusolverSpXcsrpermHost: Row k of B is row p[k] of A, and column k 
+ * of B is column q[k] of A. The column indices of each row of B are 
+ * sorted. The permutations and the value map are always zero-based, 
+ * independent of the index base of the matrix. <br>
+ * <br>
+ * In contrast to cusolverSpXcsrpermHost, these functions do not require
+ * a handle or a buffer, do not modify their input, and use multiple 
+ * host threads. The value map that is computed by 
+ * {@link #permuteStructure permuteStructure} may be applied to any 
+ * number of value arrays with {@link #permuteValues(int, double[], 
+ * int[], double[]) permuteValues}, which is a single parallel gather.
+ * <br>
+ * <br>
+ * Like the functions of {@link JCusolverSp}, these functions return 
+ * a {@link cusolverStatus}, which is checked according to 
+ * {@link JCusolver#setExceptionsEnabled(boolean)}. If p or q are not 
+ * valid permutations, if the row pointers of A are not nondecreasing 
+ * from the index base to nnz plus the index base, if a column index of
+ * A is out of range, or if a value map is not a permutation of 
+ * [0, nnz), then CUSOLVER_STATUS_INVALID_VALUE is returned.
+ */
+public final class CsrPermuter
+{
+    static
+    {
+        JCusolver.initialize();
+    }
+    
+    /**
+     * Compute the permuted structure and values B = A(p,q) in a single 
+     * pass.
+     * 
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param indexBase The index base of the row pointers and column 
+     * indices, 0 or 1
+     * @param csrRowPtrA The row pointers of A, with m+1 elements
+     * @param csrColIndA The column indices of A, with nnz elements
+     * @param csrValA The values of A, with nnz elements
+     * @param p The row permutation, with m elements
+     * @param q The column permutation, with n elements
+     * @param csrRowPtrB The row pointers of B, with m+1 elements
+     * @param csrColIndB The column indices of B, with nnz elements
+     * @param csrValB The values of B, with nnz elements
+     * @param map Will store the value map, with nnz elements. 
+     * May be <code>null</code>.
+     * @return The {@link cusolverStatus}
+     * @throws IllegalArgumentException If any array is too small
+     */
+    public static int permute(int m, int n, int nnz, int indexBase, 
+        int csrRowPtrA[], int csrColIndA[], double csrValA[], 
+        int p[], int q[], 
+        int csrRowPtrB[], int csrColIndB[], double csrValB[], int map[])
+    {
+        checkStructure(m, n, nnz, csrRowPtrA, csrColIndA, p, q, 
+            csrRowPtrB, csrColIndB);
+        checkLength(csrValA, nnz, "csrValA");
+        checkLength(csrValB, nnz, "csrValB");
+        if (map != null)
+        {
+            checkLength(map, nnz, "map");
+        }
+        return JCusolver.checkResult(permuteNative(m, n, nnz, indexBase, 
+            csrRowPtrA, csrColIndA, csrValA, p, q, 
+            csrRowPtrB, csrColIndB, csrValB, map));
+    }
+    private static native int permuteNative(int m, int n, int nnz, 
+        int indexBase, int csrRowPtrA[], int csrColIndA[], 
+        double csrValA[], int p[], int q[], int csrRowPtrB[], 
+        int csrColIndB[], double csrValB[], int map[]);
+    
+    /**
+     * Compute the permuted structure of B = A(p,q), and the value map, 
+     * with value i of B being value map[i] of A.
+     * 
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param indexBase The index base of the row pointers and column 
+     * indices, 0 or 1
+     * @param csrRowPtrA The row pointers of A, with m+1 elements
+     * @param csrColIndA The column indices of A, with nnz elements
+     * @param p The row permutation, with m elements
+     * @param q The column permutation, with n elements
+     * @param csrRowPtrB The row pointers of B, with m+1 elements
+     * @param csrColIndB The column indices of B, with nnz elements
+     * @param map Will store the value map, with nnz elements
+     * @return The {@link cusolverStatus}
+     * @throws IllegalArgumentException If any array is too small
+     */
+    public static int permuteStructure(int m, int n, int nnz, 
+        int indexBase, int csrRowPtrA[], int csrColIndA[], int p[], int q[], 
+        int csrRowPtrB[], int csrColIndB[], int map[])
+    {
+        checkStructure(m, n, nnz, csrRowPtrA, csrColIndA, p, q, 
+            csrRowPtrB, csrColIndB);
+        checkLength(map, nnz, "map");
+        return JCusolver.checkResult(permuteStructureNative(m, n, nnz, 
+            indexBase, csrRowPtrA, csrColIndA, p, q, 
+            csrRowPtrB, csrColIndB, map));
+    }
+    private static native int permuteStructureNative(int m, int n, 
+        int nnz, int indexBase, int csrRowPtrA[], int csrColIndA[], 
+        int p[], int q[], int csrRowPtrB[], int csrColIndB[], int map[]);
+    
+    /**
+     * Permute the given values with the given value map, computing 
+     * csrValB[i] = csrValA[map[i]]. If the map is not a permutation of
+     * [0, nnz), then CUSOLVER_STATUS_INVALID_VALUE is returned.
+     * 
+     * @param nnz The number of nonzeros
+     * @param csrValA The values of A
+     * @param map The value map
+     * @param csrValB The values of B
+     * @return The {@link cusolverStatus}
+     * @throws IllegalArgumentException If any array is too small
+     */
+    public static int permuteValues(int nnz, 
+        double csrValA[], int map[], double csrValB[])
+    {
+        checkLength(csrValA, nnz, "csrValA");
+        checkLength(map, nnz, "map");
+        checkLength(csrValB, nnz, "csrValB");
+        return JCusolver.checkResult(
+            permuteValuesDoubleNative(nnz, csrValA, map, csrValB, false));
+    }
+    
+    /**
+     * Permute the given values with a value map that was computed by 
+     * {@link #permuteStructure permuteStructure}, and therefore is 
+     * known to be a permutation. In contrast to 
+     * {@link #permuteValues(int, double[], int[], double[])}, the map 
+     * is only checked for indices that are out of range, which does not
+     * require an allocation.
+     * 
+     * @param nnz The number of nonzeros
+     * @param csrValA The values of A
+     * @param map The value map
+     * @param csrValB The values of B
+     * @return The {@link cusolverStatus}
+     * @throws IllegalArgumentException If any array is too small
+     */
+    static int permuteValuesWithValidatedMap(int nnz, 
+        double csrValA[], int map[], double csrValB[])
+    {
+        checkLength(csrValA, nnz, "csrValA");
+        checkLength(map, nnz, "map");
+        checkLength(csrValB, nnz, "csrValB");
+        return JCusolver.checkResult(
+            permuteValuesDoubleNative(nnz, csrValA, map, csrValB, true));
+    }
+    private static native int permuteValuesDoubleNative(int nnz, 
+        double csrValA[], int map[], double csrValB[], 
+        boolean mapValidated);
+    
+    /**
+     * Permute the given values with the given value map, computing 
+     * csrValB[i] = csrValA[map[i]]. If the map is not a permutation of
+     * [0, nnz), then CUSOLVER_STATUS_INVALID_VALUE is returned.
+     * 
+     * @param nnz The number of nonzeros
+     * @param csrValA The values of A
+     * @param map The value map
+     * @param csrValB The values of B
+     * @return The {@link cusolverStatus}
+     * @throws IllegalArgumentException If any array is too small
+     */
+    public static int permuteValues(int nnz, 
+        float csrValA[], int map[], float csrValB[])
+    {
+        checkLength(csrValA.length, nnz, "csrValA");
+        checkLength(map, nnz, "map");
+        checkLength(csrValB.length, nnz, "csrValB");
+        return JCusolver.checkResult(
+            permuteValuesFloatNative(nnz, csrValA, map, csrValB, false));
+    }
+    
+    /**
+     * Permute the given values with a value map that was computed by 
+     * {@link #permuteStructure permuteStructure}, and therefore is 
+     * known to be a permutation. In contrast to 
+     * {@link #permuteValues(int, float[], int[], float[])}, the map 
+     * is only checked for indices that are out of range, which does not
+     * require an allocation.
+     * 
+     * @param nnz The number of nonzeros
+     * @param csrValA The values of A
+     * @param map The value map
+     * @param csrValB The values of B
+     * @return The {@link cusolverStatus}
+     * @throws IllegalArgumentException If any array is too small
+     */
+    static int permuteValuesWithValidatedMap(int nnz, 
+        float csrValA[], int map[], float csrValB[])
+    {
+        checkLength(csrValA.length, nnz, "csrValA");
+        checkLength(map, nnz, "map");
+        checkLength(csrValB.length, nnz, "csrValB");
+        return JCusolver.checkResult(
+            permuteValuesFloatNative(nnz, csrValA, map, csrValB, true));
+    }
+    private static native int permuteValuesFloatNative(int nnz, 
+        float csrValA[], int map[], float csrValB[], 
+        boolean mapValidated);
+    
+    /**
+     * Validate the array lengths of the structure arguments. The native 
+     * functions validate the permutations and the contents of the 
+     * structure.
+     */
+    private static void checkStructure(int m, int n, int nnz, 
+        int csrRowPtrA[], int csrColIndA[], int p[], int q[], 
+        int csrRowPtrB[], int csrColIndB[])
+    {
+        checkLength(csrRowPtrA, m + 1, "csrRowPtrA");
+        checkLength(csrColIndA, nnz, "csrColIndA");
+        checkLength(p, m, "p");
+        checkLength(q, n, "q");
+        checkLength(csrRowPtrB, m + 1, "csrRowPtrB");
+        checkLength(csrColIndB, nnz, "csrColIndB");
+        if (csrRowPtrA[m] - csrRowPtrA[0] != nnz)
+        {
+            throw new IllegalArgumentException(
+                "The row pointers describe " 
+                + (csrRowPtrA[m] - csrRowPtrA[0]) 
+                + " nonzeros, but nnz is " + nnz);
+        }
+    }
+    
+    /**
+     * Make sure that the given array has at least the given length
+     */
+    private static void checkLength(int array[], int length, String name)
+    {
+        checkLength(array.length, length, name);
+    }
+    
+    /**
+     * Make sure that the given array has at least the given length
+     */
+    private static void checkLength(double array[], int length, String name)
+    {
+        checkLength(array.length, length, name);
+    }
+    
+    /**
+     * Make sure that the given actual length is at least the given length
+     */
+    private static void checkLength(int actual, int length, String name)
+    {
+        if (actual < length)
+        {
+            throw new IllegalArgumentException(
+                "The array " + name + " has a length of " + actual 
+                + ", but at least " + length + " elements are required");
+        }
+    }
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private CsrPermuter()
+    {
+        // Private constructor to prevent instantiation
+    }
+}
@@ -0,0 +1,642 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.DeviceMemory.allocate;
+import static jcuda.jcusolver.DeviceMemory.allocateHost;
+import static jcuda.jcusolver.DeviceMemory.copy;
+import static jcuda.jcusolver.DeviceMemory.copyAsync;
+import static jcuda.jcusolver.DeviceMemory.createEvent;
+import static jcuda.jcusolver.DeviceMemory.createStream;
+import static jcuda.jcusolver.DeviceMemory.free;
+import static jcuda.jcusolver.DeviceMemory.freeHost;
+import static jcuda.jcusolver.DeviceMemory.record;
+import static jcuda.jcusolver.DeviceMemory.synchronize;
+import static jcuda.jcusolver.DeviceMemory.waitFor;
+import static jcuda.jcusolver.JCusolver.checkCudaSuccess;
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyDeviceToHost;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyHostToDevice;
+
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+
+import jcuda.CudaException;
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.jcusparse.cusparseMatDescr;
+import jcuda.runtime.JCuda;
+import jcuda.runtime.cudaError;
+import jcuda.runtime.cudaEvent_t;
+import jcuda.runtime.cudaStream_t;
+
+/**
+ * A driver for cusolverSpDcsrqrsvBatched that solves batches of 
+ * arbitrary size within a given device memory budget. <br>
+ * <br>
+ * All systems of a batch share the same sparsity pattern. The symbolic 
+ * analysis with cusolverSpXcsrqrAnalysisBatched is done once, when the 
+ * solver is created, and the resulting csrqrInfo is reused for all 
+ * chunks of all batches. <br>
+ * <br>
+ * The largest chunk size that fits into the memory budget is determined
+ * with a binary search over cusolverSpDcsrqrBufferInfoBatched. The 
+ * budget covers the internal data and the workspace of cuSOLVER, and 
+ * the device buffers for the values, right hand sides and solutions of 
+ * two chunks. A chunk size for which cuSOLVER can not allocate its 
+ * internal data is treated as not fitting into the budget. While one 
+ * chunk is solved, the values and right hand sides of the next chunk 
+ * are uploaded on a second stream. <br>
+ * <br>
+ * The device buffers, the page-locked staging buffers and the events 
+ * are kept between the calls to {@link #solve}, and are only allocated 
+ * again when a larger chunk size or workspace is required. They are 
+ * released in {@link #close()}. <br>
+ * <br>
+ * Instances of this class are not thread-safe.
+ */
+public class CsrqrBatchSolver
+{
+    /**
+     * The handle. Its stream is replaced with the solve stream while a
+     * batch is solved, and restored afterwards.
+     */
+    private final cusolverSpHandle handle;
+    
+    /**
+     * The number of rows
+     */
+    private final int m;
+    
+    /**
+     * The number of columns
+     */
+    private final int n;
+    
+    /**
+     * The number of nonzeros of each system
+     */
+    private final int nnz;
+    
+    /**
+     * The matrix descriptor
+     */
+    private final cusparseMatDescr descrA;
+    
+    /**
+     * The memory budget, in bytes
+     */
+    private final long memoryBudget;
+    
+    /**
+     * The device memory for the row pointers
+     */
+    private final Pointer dCsrRowPtrA;
+    
+    /**
+     * The device memory for the column indices
+     */
+    private final Pointer dCsrColIndA;
+    
+    /**
+     * Device memory for the values of a single system, which is passed
+     * to cusolverSpDcsrqrBufferInfoBatched
+     */
+    private final Pointer dProbeValues;
+    
+    /**
+     * The info that stores the result of the analysis
+     */
+    private final csrqrInfo info;
+    
+    /**
+     * The stream that the uploads are done on
+     */
+    private final cudaStream_t uploadStream;
+    
+    /**
+     * The stream that the solves and downloads are done on
+     */
+    private final cudaStream_t solveStream;
+    
+    /**
+     * The maximum chunk size that was requested so far, or 0
+     */
+    private int requestedSize;
+    
+    /**
+     * The chunk size that fits into the memory budget, or 0 if it 
+     * was not computed yet
+     */
+    private int chunkSize;
+    
+    /**
+     * The workspace size for the chunk size, in bytes
+     */
+    private long workspaceBytes;
+    
+    /**
+     * The batch size for which cusolverSpDcsrqrBufferInfoBatched was
+     * called most recently
+     */
+    private int infoBatchSize;
+    
+    /**
+     * The chunk size for which the buffers have been allocated, or 0
+     */
+    private int bufferSize;
+    
+    /**
+     * The size of the workspace that has been allocated, in bytes
+     */
+    private long workspaceCapacity;
+    
+    /**
+     * The page-locked staging buffers for the values of two chunks
+     */
+    private final Pointer hostValues[] = new Pointer[2];
+    
+    /**
+     * The page-locked staging buffers for the right hand sides
+     */
+    private final Pointer hostRhs[] = new Pointer[2];
+    
+    /**
+     * The page-locked staging buffers for the solutions
+     */
+    private final Pointer hostSolutions[] = new Pointer[2];
+    
+    /**
+     * The device buffers for the values of two chunks
+     */
+    private final Pointer dValues[] = new Pointer[2];
+    
+    /**
+     * The device buffers for the right hand sides
+     */
+    private final Pointer dRhs[] = new Pointer[2];
+    
+    /**
+     * The device buffers for the solutions
+     */
+    private final Pointer dSolutions[] = new Pointer[2];
+    
+    /**
+     * The workspace, or null
+     */
+    private Pointer workspace;
+    
+    /**
+     * The events that are recorded when a chunk has been uploaded
+     */
+    private final cudaEvent_t uploaded[] = new cudaEvent_t[2];
+    
+    /**
+     * The events that are recorded when a chunk has been solved
+     */
+    private final cudaEvent_t solved[] = new cudaEvent_t[2];
+    
+    /**
+     * Creates a new solver for systems with the given sparsity pattern,
+     * and performs the symbolic analysis.
+     * 
+     * @param handle The handle
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros of each system
+     * @param descrA The matrix descriptor
+     * @param csrRowPtrA The row pointers, with m+1 elements
+     * @param csrColIndA The column indices, with nnz elements
+     * @param memoryBudget The device memory budget, in bytes. 
+     * Callers may derive this from the free memory that is reported 
+     * by cudaMemGetInfo.
+     * @throws IllegalArgumentException If the memory budget is not 
+     * positive
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public CsrqrBatchSolver(cusolverSpHandle handle, int m, int n, int nnz, 
+        cusparseMatDescr descrA, int csrRowPtrA[], int csrColIndA[], 
+        long memoryBudget)
+    {
+        if (memoryBudget <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The memory budget must be positive, but is " + memoryBudget);
+        }
+        this.handle = handle;
+        this.m = m;
+        this.n = n;
+        this.nnz = nnz;
+        this.descrA = descrA;
+        this.memoryBudget = memoryBudget;
+        
+        this.dCsrRowPtrA = allocate((long)(m + 1) * Sizeof.INT);
+        this.dCsrColIndA = allocate((long)nnz * Sizeof.INT);
+        this.dProbeValues = allocate((long)nnz * Sizeof.DOUBLE);
+        copy(dCsrRowPtrA, Pointer.to(csrRowPtrA), 
+            (long)(m + 1) * Sizeof.INT, cudaMemcpyHostToDevice);
+        copy(dCsrColIndA, Pointer.to(csrColIndA), 
+            (long)nnz * Sizeof.INT, cudaMemcpyHostToDevice);
+        
+        this.info = new csrqrInfo();
+        checkSuccess(JCusolverSp.cusolverSpCreateCsrqrInfo(info), 
+            "cusolverSpCreateCsrqrInfo");
+        checkSuccess(JCusolverSp.cusolverSpXcsrqrAnalysisBatched(
+            handle, m, n, nnz, descrA, dCsrRowPtrA, dCsrColIndA, info), 
+            "cusolverSpXcsrqrAnalysisBatched");
+        
+        this.uploadStream = createStream();
+        this.solveStream = createStream();
+        for (int s = 0; s < 2; s++)
+        {
+            uploaded[s] = createEvent();
+            solved[s] = createEvent();
+        }
+    }
+    
+    /**
+     * Returns the number of bytes of device memory that are required 
+     * for solving chunks of the given size, and stores the workspace 
+     * size in the given array. If cuSOLVER can not allocate the 
+     * internal data for this size, then Long.MAX_VALUE is returned.
+     * 
+     * @param size The chunk size
+     * @param workspaceInBytes Will store the workspace size
+     * @return The number of bytes
+     * @throws jcuda.CudaException If the native call failed for any
+     * other reason
+     */
+    private long requiredBytes(int size, long workspaceInBytes[])
+    {
+        long internalDataInBytes[] = { 0 };
+        
+        // The status is checked here, so that an allocation failure 
+        // does not cause an exception when exceptions are enabled
+        int status = JCusolverSp.cusolverSpDcsrqrBufferInfoBatchedUnchecked(
+            handle, m, n, nnz, descrA, dProbeValues, dCsrRowPtrA, 
+            dCsrColIndA, size, info, internalDataInBytes, workspaceInBytes);
+        if (status != cusolverStatus.CUSOLVER_STATUS_SUCCESS)
+        {
+            // The info is not set up for any size after a failure
+            infoBatchSize = 0;
+            if (isOutOfResources(status))
+            {
+                return Long.MAX_VALUE;
+            }
+            checkSuccess(status, "cusolverSpDcsrqrBufferInfoBatched");
+        }
+        infoBatchSize = size;
+        long chunkBytes = (long)size * (nnz + m + n) * Sizeof.DOUBLE;
+        return internalDataInBytes[0] + workspaceInBytes[0] + 2 * chunkBytes;
+    }
+    
+    /**
+     * Returns whether the given status of a failed call indicates that
+     * the device did not have enough resources. This also clears the 
+     * last error of the runtime, so that it is not reported by a later 
+     * call.
+     * 
+     * @param status The status
+     * @return Whether the device ran out of resources
+     */
+    private static boolean isOutOfResources(int status)
+    {
+        int error = JCuda.cudaGetLastError();
+        if (status == cusolverStatus.CUSOLVER_STATUS_ALLOC_FAILED)
+        {
+            return true;
+        }
+        return status == cusolverStatus.CUSOLVER_STATUS_EXECUTION_FAILED &&
+            (error == cudaError.cudaErrorMemoryAllocation ||
+             error == cudaError.cudaErrorLaunchOutOfResources);
+    }
+    
+    /**
+     * Returns the largest chunk size, up to the given maximum, that fits 
+     * into the memory budget. The result is computed with a binary 
+     * search over cusolverSpDcsrqrBufferInfoBatched, and cached for
+     * subsequent calls with a maximum that is not larger. Sizes for
+     * which cuSOLVER reports CUSOLVER_STATUS_ALLOC_FAILED, or that 
+     * can not be launched due to insufficient resources, are treated 
+     * as not fitting into the budget.
+     * 
+     * @param maxSize The maximum chunk size
+     * @return The chunk size
+     * @throws jcuda.CudaException If not even a single system fits 
+     * into the memory budget, or any of the native calls failed
+     */
+    public int getChunkSize(int maxSize)
+    {
+        if (chunkSize > 0 && 
+            (maxSize <= requestedSize || chunkSize < requestedSize))
+        {
+            return Math.min(chunkSize, maxSize);
+        }
+        long workspaceInBytes[] = { 0 };
+        int low = 0;
+        int high = maxSize;
+        while (low < high)
+        {
+            int mid = low + (high - low + 1) / 2;
+            if (requiredBytes(mid, workspaceInBytes) <= memoryBudget)
+            {
+                low = mid;
+            }
+            else
+            {
+                high = mid - 1;
+            }
+        }
+        if (low == 0)
+        {
+            throw new CudaException(
+                "A single system requires more than the memory budget of "
+                + memoryBudget + " bytes");
+        }
+        
+        // Query the workspace size for the result again. This also 
+        // makes sure that the info is set up for this chunk size.
+        setUpInfo(low, workspaceInBytes);
+        requestedSize = maxSize;
+        chunkSize = low;
+        workspaceBytes = workspaceInBytes[0];
+        return low;
+    }
+    
+    /**
+     * Solve the given batch of systems. <br>
+     * <br>
+     * The values of system i are stored at index i*nnz of the values 
+     * array, its right hand side at index i*m of the right hand side 
+     * array, and its solution will be written to index i*n of the 
+     * solution array. 
+     * 
+     * @param csrValA The values
+     * @param b The right hand sides
+     * @param x The solutions
+     * @param batchSize The number of systems
+     * @throws IllegalArgumentException If any array is too small
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public void solve(double csrValA[], double b[], double x[], 
+        int batchSize)
+    {
+        checkLength(csrValA, (long)batchSize * nnz, "values");
+        checkLength(b, (long)batchSize * m, "right hand side");
+        checkLength(x, (long)batchSize * n, "solution");
+        if (batchSize == 0)
+        {
+            return;
+        }
+        int size = getChunkSize(batchSize);
+        ensureBuffers(size, workspaceBytes);
+        setUpInfo(size);
+        long valueBytes = (long)size * nnz * Sizeof.DOUBLE;
+        long rhsBytes = (long)size * m * Sizeof.DOUBLE;
+        long solutionBytes = (long)size * n * Sizeof.DOUBLE;
+        
+        cudaStream_t previousStream = new cudaStream_t();
+        checkSuccess(JCusolverSp.cusolverSpGetStream(handle, previousStream),
+            "cusolverSpGetStream");
+        try
+        {
+            checkSuccess(JCusolverSp.cusolverSpSetStream(handle, solveStream),
+                "cusolverSpSetStream");
+            
+            int chunks = (batchSize + size - 1) / size;
+            for (int c = 0; c <= chunks; c++)
+            {
+                if (c < chunks)
+                {
+                    int s = c % 2;
+                    int first = c * size;
+                    int count = Math.min(size, batchSize - first);
+                    
+                    // The staging buffers of this slot have been consumed
+                    // when the chunk c-2 was solved and copied out
+                    asDoubleBuffer(hostValues[s], valueBytes).put(
+                        csrValA, first * nnz, count * nnz);
+                    asDoubleBuffer(hostRhs[s], rhsBytes).put(
+                        b, first * m, count * m);
+                    waitFor(uploadStream, solved[s]);
+                    copyAsync(dValues[s], hostValues[s], 
+                        (long)count * nnz * Sizeof.DOUBLE, 
+                        cudaMemcpyHostToDevice, uploadStream);
+                    copyAsync(dRhs[s], hostRhs[s], 
+                        (long)count * m * Sizeof.DOUBLE, 
+                        cudaMemcpyHostToDevice, uploadStream);
+                    record(uploaded[s], uploadStream);
+                    
+                    if (count != size)
+                    {
+                        // Set up the info for the smaller last chunk
+                        synchronize(solveStream);
+                        setUpInfo(count);
+                    }
+                    waitFor(solveStream, uploaded[s]);
+                    checkSuccess(JCusolverSp.cusolverSpDcsrqrsvBatched(
+                        handle, m, n, nnz, descrA, dValues[s], 
+                        dCsrRowPtrA, dCsrColIndA, dRhs[s], dSolutions[s], 
+                        count, info, workspace), 
+                        "cusolverSpDcsrqrsvBatched");
+                    copyAsync(hostSolutions[s], dSolutions[s], 
+                        (long)count * n * Sizeof.DOUBLE, 
+                        cudaMemcpyDeviceToHost, solveStream);
+                    record(solved[s], solveStream);
+                }
+                
+                // Copy out the solutions of the previous chunk, while 
+                // the current one is being solved
+                if (c > 0)
+                {
+                    int p = (c - 1) % 2;
+                    int first = (c - 1) * size;
+                    int count = Math.min(size, batchSize - first);
+                    checkCudaSuccess(JCuda.cudaEventSynchronize(solved[p]), 
+                        "cudaEventSynchronize");
+                    asDoubleBuffer(hostSolutions[p], solutionBytes).get(
+                        x, first * n, count * n);
+                }
+            }
+        }
+        finally
+        {
+            JCuda.cudaStreamSynchronize(uploadStream);
+            JCuda.cudaStreamSynchronize(solveStream);
+            JCusolverSp.cusolverSpSetStream(handle, previousStream);
+        }
+    }
+    
+    /**
+     * Set up the info for solving chunks of the given size, unless it 
+     * already is set up for this size
+     * 
+     * @param size The chunk size
+     * @throws jcuda.CudaException If the native call failed
+     */
+    private void setUpInfo(int size)
+    {
+        if (infoBatchSize != size)
+        {
+            setUpInfo(size, new long[1]);
+        }
+    }
+    
+    /**
+     * Set up the info for solving chunks of the given size, and store
+     * the workspace size in the given array
+     * 
+     * @param size The chunk size
+     * @param workspaceInBytes Will store the workspace size
+     * @throws jcuda.CudaException If the native call failed, even if 
+     * this was caused by an allocation failure
+     */
+    private void setUpInfo(int size, long workspaceInBytes[])
+    {
+        if (requiredBytes(size, workspaceInBytes) == Long.MAX_VALUE)
+        {
+            throw new CudaException(
+                "cusolverSpDcsrqrBufferInfoBatched failed for a chunk size "
+                + "of " + size + ": " + cusolverStatus.stringFor(
+                    cusolverStatus.CUSOLVER_STATUS_ALLOC_FAILED));
+        }
+    }
+    
+    /**
+     * Make sure that the buffers are large enough for chunks of the 
+     * given size, and that the workspace has at least the given size.
+     * Buffers that are too small are released and allocated again.
+     * 
+     * @param size The chunk size
+     * @param workspaceInBytes The workspace size, in bytes
+     * @throws jcuda.CudaException If the memory could not be allocated
+     */
+    private void ensureBuffers(int size, long workspaceInBytes)
+    {
+        if (size > bufferSize)
+        {
+            releaseBuffers();
+            long valueBytes = (long)size * nnz * Sizeof.DOUBLE;
+            long rhsBytes = (long)size * m * Sizeof.DOUBLE;
+            long solutionBytes = (long)size * n * Sizeof.DOUBLE;
+            for (int s = 0; s < 2; s++)
+            {
+                hostValues[s] = allocateHost(valueBytes);
+                hostRhs[s] = allocateHost(rhsBytes);
+                hostSolutions[s] = allocateHost(solutionBytes);
+                dValues[s] = allocate(valueBytes);
+                dRhs[s] = allocate(rhsBytes);
+                dSolutions[s] = allocate(solutionBytes);
+            }
+            bufferSize = size;
+        }
+        if (workspace == null || workspaceInBytes > workspaceCapacity)
+        {
+            free(workspace);
+            workspace = null;
+            workspaceCapacity = 0;
+            workspace = allocate(workspaceInBytes);
+            workspaceCapacity = workspaceInBytes;
+        }
+    }
+    
+    /**
+     * Release the staging buffers and the device buffers of the chunks
+     */
+    private void releaseBuffers()
+    {
+        bufferSize = 0;
+        freeHost(hostValues);
+        freeHost(hostRhs);
+        freeHost(hostSolutions);
+        free(dValues);
+        free(dRhs);
+        free(dSolutions);
+        for (int s = 0; s < 2; s++)
+        {
+            hostValues[s] = null;
+            hostRhs[s] = null;
+            hostSolutions[s] = null;
+            dValues[s] = null;
+            dRhs[s] = null;
+            dSolutions[s] = null;
+        }
+    }
+    
+    /**
+     * Release all resources of this solver. The handle is not destroyed.
+     */
+    public void close()
+    {
+        JCusolverSp.cusolverSpDestroyCsrqrInfo(info);
+        JCuda.cudaStreamDestroy(uploadStream);
+        JCuda.cudaStreamDestroy(solveStream);
+        for (int s = 0; s < 2; s++)
+        {
+            JCuda.cudaEventDestroy(uploaded[s]);
+            JCuda.cudaEventDestroy(solved[s]);
+        }
+        releaseBuffers();
+        free(workspace);
+        workspace = null;
+        workspaceCapacity = 0;
+        free(dCsrRowPtrA, dCsrColIndA, dProbeValues);
+    }
+    
+    /**
+     * Returns a native-ordered DoubleBuffer for the given page-locked 
+     * host memory
+     * 
+     * @param pointer The pointer
+     * @param bytes The size, in bytes
+     * @return The buffer
+     */
+    private static DoubleBuffer asDoubleBuffer(Pointer pointer, long bytes)
+    {
+        return pointer.getByteBuffer(0, bytes)
+            .order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    }
+    
+    /**
+     * Make sure that the given array has at least the given length
+     * 
+     * @param array The array
+     * @param length The minimum length
+     * @param name The name of the array
+     * @throws IllegalArgumentException If the array is too small
+     */
+    private static void checkLength(double array[], long length, String name)
+    {
+        if (array.length < length)
+        {
+            throw new IllegalArgumentException(
+                "The " + name + " array has a length of " + array.length 
+                + ", but at least " + length + " elements are required");
+        }
+    }
+}
@@ -0,0 +1,204 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkCudaSuccess;
+
+import jcuda.Pointer;
+import jcuda.runtime.JCuda;
+import jcuda.runtime.cudaEvent_t;
+import jcuda.runtime.cudaStream_t;
+
+/**
+ * Package-private utility methods for the device- and page-locked host 
+ * memory, streams and events that are managed by the utility classes 
+ * of this package. All 
+ * methods throw a CudaException if the underlying runtime call fails.
+ */
+final class DeviceMemory
+{
+    /**
+     * Allocate the given number of bytes of device memory
+     * 
+     * @param bytes The number of bytes
+     * @return The pointer
+     */
+    static Pointer allocate(long bytes)
+    {
+        Pointer pointer = new Pointer();
+        checkCudaSuccess(JCuda.cudaMalloc(pointer, Math.max(1, bytes)), 
+            "cudaMalloc");
+        return pointer;
+    }
+    
+    /**
+     * Allocate the given number of bytes of page-locked host memory
+     * 
+     * @param bytes The number of bytes
+     * @return The pointer
+     */
+    static Pointer allocateHost(long bytes)
+    {
+        Pointer pointer = new Pointer();
+        checkCudaSuccess(JCuda.cudaMallocHost(pointer, Math.max(1, bytes)), 
+            "cudaMallocHost");
+        return pointer;
+    }
+    
+    /**
+     * Copy the given number of bytes
+     * 
+     * @param dst The destination
+     * @param src The source
+     * @param bytes The number of bytes
+     * @param kind The cudaMemcpyKind
+     */
+    static void copy(Pointer dst, Pointer src, long bytes, int kind)
+    {
+        checkCudaSuccess(JCuda.cudaMemcpy(dst, src, bytes, kind), 
+            "cudaMemcpy");
+    }
+    
+    /**
+     * Asynchronously copy the given number of bytes
+     * 
+     * @param dst The destination
+     * @param src The source
+     * @param bytes The number of bytes
+     * @param kind The cudaMemcpyKind
+     * @param stream The stream
+     */
+    static void copyAsync(Pointer dst, Pointer src, long bytes, int kind, 
+        cudaStream_t stream)
+    {
+        checkCudaSuccess(JCuda.cudaMemcpyAsync(dst, src, bytes, kind, 
+            stream), "cudaMemcpyAsync");
+    }
+    
+    /**
+     * Wait until all work in the given stream is complete
+     * 
+     * @param stream The stream
+     */
+    static void synchronize(cudaStream_t stream)
+    {
+        checkCudaSuccess(JCuda.cudaStreamSynchronize(stream), 
+            "cudaStreamSynchronize");
+    }
+    
+    /**
+     * Free the given device pointers, ignoring <code>null</code> ones
+     * 
+     * @param pointers The pointers
+     */
+    static void free(Pointer ... pointers)
+    {
+        for (Pointer pointer : pointers)
+        {
+            if (pointer != null)
+            {
+                JCuda.cudaFree(pointer);
+            }
+        }
+    }
+
+    /**
+     * Free the given page-locked host pointers, ignoring 
+     * <code>null</code> ones
+     * 
+     * @param pointers The pointers
+     */
+    static void freeHost(Pointer ... pointers)
+    {
+        for (Pointer pointer : pointers)
+        {
+            if (pointer != null)
+            {
+                JCuda.cudaFreeHost(pointer);
+            }
+        }
+    }
+    
+    /**
+     * Let the given stream wait for the given event
+     * 
+     * @param stream The stream
+     * @param event The event
+     */
+    static void waitFor(cudaStream_t stream, cudaEvent_t event)
+    {
+        checkCudaSuccess(JCuda.cudaStreamWaitEvent(stream, event, 0), 
+            "cudaStreamWaitEvent");
+    }
+    
+    /**
+     * Record the given event in the given stream
+     * 
+     * @param event The event
+     * @param stream The stream
+     */
+    static void record(cudaEvent_t event, cudaStream_t stream)
+    {
+        checkCudaSuccess(JCuda.cudaEventRecord(event, stream), 
+            "cudaEventRecord");
+    }
+    
+    /**
+     * Create an event without timing
+     * 
+     * @return The event
+     */
+    static cudaEvent_t createEvent()
+    {
+        cudaEvent_t event = new cudaEvent_t();
+        checkCudaSuccess(JCuda.cudaEventCreateWithFlags(event, 
+            JCuda.cudaEventDisableTiming), 
+            "cudaEventCreateWithFlags");
+        return event;
+    }
+    
+    /**
+     * Create a stream
+     * 
+     * @return The stream
+     */
+    static cudaStream_t createStream()
+    {
+        cudaStream_t stream = new cudaStream_t();
+        checkCudaSuccess(JCuda.cudaStreamCreate(stream), "cudaStreamCreate");
+        return stream;
+    }
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private DeviceMemory()
+    {
+        // Private constructor to prevent instantiation
+    }
+}
@@ -0,0 +1,543 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcublas.cublasDiagType.CUBLAS_DIAG_NON_UNIT;
+import static jcuda.jcublas.cublasFillMode.CUBLAS_FILL_MODE_LOWER;
+import static jcuda.jcublas.cublasOperation.CUBLAS_OP_N;
+import static jcuda.jcublas.cublasOperation.CUBLAS_OP_T;
+import static jcuda.jcublas.cublasSideMode.CUBLAS_SIDE_LEFT;
+import static jcuda.jcublas.cublasSideMode.CUBLAS_SIDE_RIGHT;
+import static jcuda.jcusolver.DeviceMemory.allocate;
+import static jcuda.jcusolver.DeviceMemory.allocateHost;
+import static jcuda.jcusolver.DeviceMemory.copy;
+import static jcuda.jcusolver.DeviceMemory.copyAsync;
+import static jcuda.jcusolver.DeviceMemory.createEvent;
+import static jcuda.jcusolver.DeviceMemory.createStream;
+import static jcuda.jcusolver.DeviceMemory.free;
+import static jcuda.jcusolver.DeviceMemory.freeHost;
+import static jcuda.jcusolver.DeviceMemory.record;
+import static jcuda.jcusolver.DeviceMemory.synchronize;
+import static jcuda.jcusolver.DeviceMemory.waitFor;
+import static jcuda.jcusolver.JCusolver.checkCudaSuccess;
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyDeviceToHost;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyHostToDevice;
+
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+
+import jcuda.CudaException;
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.jcublas.JCublas2;
+import jcuda.jcublas.cublasHandle;
+import jcuda.jcublas.cublasStatus;
+import jcuda.runtime.JCuda;
+import jcuda.runtime.cudaEvent_t;
+import jcuda.runtime.cudaStream_t;
+
+/**
+ * A {@link TileKernel} that keeps the tiles of the matrix in page-locked 
+ * host memory, and performs all computations on the device. <br>
+ * <br>
+ * The diagonal tiles are factored with cusolverDnDpotrf. The updates 
+ * and triangular solves are performed with CUBLAS. Three streams are 
+ * used: One for uploading tiles, one for downloading tiles, and one 
+ * for the computations. Each slot and each host tile has an event that 
+ * is recorded after every operation that accesses it, and every 
+ * operation waits for the events of the slots and tiles that it 
+ * accesses. This way, the operations that are issued by the 
+ * {@link TiledCholesky} scheduler are executed asynchronously, and 
+ * the transfers of tiles overlap with the computations on other tiles.
+ * <br>
+ * <br>
+ * The device memory that is required is the number of slots times 
+ * the size of one tile, plus the right hand side. <br>
+ * <br>
+ * This is the only class of JCusolver that requires JCublas. The 
+ * JCublas dependency is optional, so applications that use this class
+ * have to declare the dependency to JCublas themselves. <br>
+ * <br>
+ * Instances of this class are not thread-safe. 
+ */
+public class DeviceTileKernel implements TileKernel
+{
+    /**
+     * The tile layout
+     */
+    private final TileLayout layout;
+    
+    /**
+     * The number of bytes of one tile
+     */
+    private final long tileBytes;
+    
+    /**
+     * The tiles of the lower triangle of the matrix, in page-locked host
+     * memory, at index tileRow * tileCount + tileCol
+     */
+    private final Pointer hostTiles[];
+    
+    /**
+     * The events for the host tiles
+     */
+    private final cudaEvent_t hostTileEvents[];
+    
+    /**
+     * The slots in device memory
+     */
+    private final Pointer slots[];
+    
+    /**
+     * The events for the slots
+     */
+    private final cudaEvent_t slotEvents[];
+    
+    /**
+     * The stream for uploading tiles
+     */
+    private final cudaStream_t uploadStream;
+    
+    /**
+     * The stream for downloading tiles
+     */
+    private final cudaStream_t downloadStream;
+    
+    /**
+     * The stream for computations
+     */
+    private final cudaStream_t computeStream;
+    
+    /**
+     * The CUSOLVER handle
+     */
+    private final cusolverDnHandle solverHandle;
+    
+    /**
+     * The CUBLAS handle
+     */
+    private final cublasHandle blasHandle;
+    
+    /**
+     * The workspace for potrf
+     */
+    private final Pointer workspace;
+    
+    /**
+     * The size of the workspace for potrf, in elements
+     */
+    private final int lwork;
+    
+    /**
+     * The device memory for the info values of potrf, one for each
+     * diagonal tile
+     */
+    private final Pointer deviceInfo;
+    
+    /**
+     * The constant -1.0 for CUBLAS
+     */
+    private final Pointer minusOne = Pointer.to(new double[] { -1.0 });
+    
+    /**
+     * The constant 1.0 for CUBLAS
+     */
+    private final Pointer one = Pointer.to(new double[] { 1.0 });
+    
+    /**
+     * The right hand side, in device memory
+     */
+    private Pointer rhs;
+    
+    /**
+     * The number of right hand sides
+     */
+    private int nrhs;
+
+    /**
+     * Creates a new kernel. This will allocate the page-locked host 
+     * memory for the lower triangle of the matrix, and the device 
+     * memory for the given number of slots.
+     * 
+     * @param layout The tile layout
+     * @param slotCount The number of slots
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public DeviceTileKernel(TileLayout layout, int slotCount)
+    {
+        int t = layout.getTileCount();
+        int ts = layout.getTileSize();
+        this.layout = layout;
+        this.tileBytes = (long)ts * ts * Sizeof.DOUBLE;
+        
+        this.hostTiles = new Pointer[t * t];
+        this.hostTileEvents = new cudaEvent_t[t * t];
+        for (int i = 0; i < t; i++)
+        {
+            for (int j = 0; j <= i; j++)
+            {
+                hostTiles[i * t + j] = allocateHost(tileBytes);
+                hostTileEvents[i * t + j] = createEvent();
+            }
+        }
+        this.slots = new Pointer[slotCount];
+        this.slotEvents = new cudaEvent_t[slotCount];
+        for (int s = 0; s < slotCount; s++)
+        {
+            slots[s] = allocate(tileBytes);
+            slotEvents[s] = createEvent();
+        }
+        
+        this.uploadStream = createStream();
+        this.downloadStream = createStream();
+        this.computeStream = createStream();
+        
+        this.solverHandle = new cusolverDnHandle();
+        checkSuccess(JCusolverDn.cusolverDnCreate(solverHandle), 
+            "cusolverDnCreate");
+        checkSuccess(JCusolverDn.cusolverDnSetStream(
+            solverHandle, computeStream), "cusolverDnSetStream");
+        this.blasHandle = new cublasHandle();
+        checkBlas(JCublas2.cublasCreate(blasHandle), "cublasCreate");
+        checkBlas(JCublas2.cublasSetStream(blasHandle, computeStream), 
+            "cublasSetStream");
+        
+        int lworkArray[] = { 0 };
+        checkSuccess(JCusolverDn.cusolverDnDpotrf_bufferSize(solverHandle, 
+            CUBLAS_FILL_MODE_LOWER, ts, slots[0], ts, lworkArray), 
+            "cusolverDnDpotrf_bufferSize");
+        this.lwork = lworkArray[0];
+        this.workspace = allocate((long)lwork * Sizeof.DOUBLE);
+        this.deviceInfo = allocate((long)t * Sizeof.INT);
+        checkCudaSuccess(JCuda.cudaMemset(deviceInfo, 0, 
+            (long)t * Sizeof.INT), "cudaMemset");
+    }
+    
+    /**
+     * Write the given tile into the page-locked host memory. This must
+     * not be called while operations are pending.
+     * 
+     * @param tileRow The tile row, which must be greater than or equal 
+     * to the tile column
+     * @param tileCol The tile column
+     * @param tile The tile, in column-major order, with a leading 
+     * dimension of {@link TileLayout#getTileSize()}
+     */
+    public void setTile(int tileRow, int tileCol, double tile[])
+    {
+        getHostTileBuffer(tileRow, tileCol).put(tile);
+    }
+    
+    /**
+     * Read the given tile from the page-locked host memory. This will
+     * wait until all pending operations are complete.
+     * 
+     * @param tileRow The tile row, which must be greater than or equal 
+     * to the tile column
+     * @param tileCol The tile column
+     * @param tile The tile, in column-major order, with a leading 
+     * dimension of {@link TileLayout#getTileSize()}
+     */
+    public void getTile(int tileRow, int tileCol, double tile[])
+    {
+        synchronizeAll();
+        getHostTileBuffer(tileRow, tileCol).get(tile);
+    }
+    
+    /**
+     * Returns a buffer for the given host tile
+     * 
+     * @param tileRow The tile row
+     * @param tileCol The tile column
+     * @return The buffer
+     */
+    private DoubleBuffer getHostTileBuffer(int tileRow, int tileCol)
+    {
+        if (tileCol > tileRow)
+        {
+            throw new IllegalArgumentException(
+                "Only the lower triangle is stored, got tile (" + 
+                tileRow + "," + tileCol + ")");
+        }
+        Pointer tile = hostTiles[tileRow * layout.getTileCount() + tileCol];
+        return tile.getByteBuffer(0, tileBytes)
+            .order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    }
+    
+    /**
+     * Set the right hand side. This will allocate the device memory 
+     * for it, and copy the given data to the device.
+     * 
+     * @param b The right hand side, in column-major order, with a 
+     * leading dimension that is the size of the matrix
+     * @param nrhs The number of right hand sides
+     */
+    public void setRightHandSide(double b[], int nrhs)
+    {
+        synchronizeAll();
+        free(rhs);
+        long bytes = (long)layout.getSize() * nrhs * Sizeof.DOUBLE;
+        this.rhs = allocate(bytes);
+        this.nrhs = nrhs;
+        copy(rhs, Pointer.to(b), bytes, cudaMemcpyHostToDevice);
+    }
+    
+    /**
+     * Write the solution into the given array. This will wait until
+     * all pending operations are complete.
+     * 
+     * @param x The solution, in column-major order, with a leading 
+     * dimension that is the size of the matrix
+     */
+    public void getSolution(double x[])
+    {
+        synchronizeAll();
+        long bytes = (long)layout.getSize() * nrhs * Sizeof.DOUBLE;
+        copy(Pointer.to(x), rhs, bytes, cudaMemcpyDeviceToHost);
+    }
+    
+    /**
+     * Returns the info of the factorization. If this is 0, the 
+     * factorization succeeded. Otherwise, the leading minor of 
+     * this order is not positive definite. This will wait until
+     * all pending operations are complete.
+     * 
+     * @return The info
+     */
+    public int getInfo()
+    {
+        synchronizeAll();
+        int t = layout.getTileCount();
+        int info[] = new int[t];
+        copy(Pointer.to(info), deviceInfo, (long)t * Sizeof.INT, 
+            cudaMemcpyDeviceToHost);
+        for (int j = 0; j < t; j++)
+        {
+            if (info[j] != 0)
+            {
+                return layout.getOffset(j) + info[j];
+            }
+        }
+        return 0;
+    }
+    
+    /**
+     * Wait until all pending operations are complete
+     */
+    public void synchronizeAll()
+    {
+        synchronize(uploadStream);
+        synchronize(computeStream);
+        synchronize(downloadStream);
+    }
+    
+    /**
+     * Release all resources of this kernel
+     */
+    public void close()
+    {
+        synchronizeAll();
+        JCublas2.cublasDestroy(blasHandle);
+        JCusolverDn.cusolverDnDestroy(solverHandle);
+        JCuda.cudaStreamDestroy(uploadStream);
+        JCuda.cudaStreamDestroy(downloadStream);
+        JCuda.cudaStreamDestroy(computeStream);
+        for (int i = 0; i < hostTiles.length; i++)
+        {
+            if (hostTiles[i] != null)
+            {
+                freeHost(hostTiles[i]);
+                JCuda.cudaEventDestroy(hostTileEvents[i]);
+            }
+        }
+        for (int s = 0; s < slots.length; s++)
+        {
+            free(slots[s]);
+            JCuda.cudaEventDestroy(slotEvents[s]);
+        }
+        free(workspace, deviceInfo, rhs);
+    }
+
+    @Override
+    public void load(int slot, int tileRow, int tileCol)
+    {
+        int index = tileRow * layout.getTileCount() + tileCol;
+        waitFor(uploadStream, slotEvents[slot]);
+        waitFor(uploadStream, hostTileEvents[index]);
+        copyAsync(slots[slot], hostTiles[index], tileBytes, 
+            cudaMemcpyHostToDevice, uploadStream);
+        record(slotEvents[slot], uploadStream);
+        record(hostTileEvents[index], uploadStream);
+    }
+
+    @Override
+    public void store(int slot, int tileRow, int tileCol)
+    {
+        int index = tileRow * layout.getTileCount() + tileCol;
+        waitFor(downloadStream, slotEvents[slot]);
+        waitFor(downloadStream, hostTileEvents[index]);
+        copyAsync(hostTiles[index], slots[slot], tileBytes, 
+            cudaMemcpyDeviceToHost, downloadStream);
+        record(slotEvents[slot], downloadStream);
+        record(hostTileEvents[index], downloadStream);
+    }
+
+    @Override
+    public void potrf(int slot, int tileIndex)
+    {
+        int ts = layout.getTileSize();
+        beginCompute(slot);
+        checkSuccess(JCusolverDn.cusolverDnDpotrf(solverHandle, 
+            CUBLAS_FILL_MODE_LOWER, layout.getSize(tileIndex), 
+            slots[slot], ts, workspace, lwork, 
+            deviceInfo.withByteOffset((long)tileIndex * Sizeof.INT)), 
+            "cusolverDnDpotrf");
+        endCompute(slot);
+    }
+
+    @Override
+    public void trsm(int slot, int tileRow, int diagonalSlot, int tileIndex)
+    {
+        int ts = layout.getTileSize();
+        beginCompute(slot, diagonalSlot);
+        checkBlas(JCublas2.cublasDtrsm(blasHandle, CUBLAS_SIDE_RIGHT, 
+            CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_T, CUBLAS_DIAG_NON_UNIT, 
+            layout.getSize(tileRow), layout.getSize(tileIndex), one, 
+            slots[diagonalSlot], ts, slots[slot], ts), "cublasDtrsm");
+        endCompute(slot, diagonalSlot);
+    }
+
+    @Override
+    public void syrk(int slot, int tileIndex, int panelSlot, int panelCol)
+    {
+        int ts = layout.getTileSize();
+        beginCompute(slot, panelSlot);
+        checkBlas(JCublas2.cublasDsyrk(blasHandle, CUBLAS_FILL_MODE_LOWER, 
+            CUBLAS_OP_N, layout.getSize(tileIndex), layout.getSize(panelCol), 
+            minusOne, slots[panelSlot], ts, one, slots[slot], ts), 
+            "cublasDsyrk");
+        endCompute(slot, panelSlot);
+    }
+
+    @Override
+    public void gemm(int slot, int leftSlot, int leftRow, 
+        int rightSlot, int rightRow, int innerCol)
+    {
+        int ts = layout.getTileSize();
+        beginCompute(slot, leftSlot, rightSlot);
+        checkBlas(JCublas2.cublasDgemm(blasHandle, CUBLAS_OP_N, CUBLAS_OP_T, 
+            layout.getSize(leftRow), layout.getSize(rightRow), 
+            layout.getSize(innerCol), minusOne, slots[leftSlot], ts, 
+            slots[rightSlot], ts, one, slots[slot], ts), "cublasDgemm");
+        endCompute(slot, leftSlot, rightSlot);
+    }
+
+    @Override
+    public void solveRhs(int rhsBlock, int diagonalSlot, boolean transposed)
+    {
+        int ts = layout.getTileSize();
+        int n = layout.getSize();
+        beginCompute(diagonalSlot);
+        checkBlas(JCublas2.cublasDtrsm(blasHandle, CUBLAS_SIDE_LEFT, 
+            CUBLAS_FILL_MODE_LOWER, transposed ? CUBLAS_OP_T : CUBLAS_OP_N, 
+            CUBLAS_DIAG_NON_UNIT, layout.getSize(rhsBlock), nrhs, one, 
+            slots[diagonalSlot], ts, rhsBlock(rhsBlock), n), "cublasDtrsm");
+        endCompute(diagonalSlot);
+    }
+
+    @Override
+    public void updateRhs(int rhsBlock, int tileSlot, int tileRow, 
+        int tileCol, int sourceRhsBlock, boolean transposed)
+    {
+        int ts = layout.getTileSize();
+        int n = layout.getSize();
+        int rows = layout.getSize(tileRow);
+        int cols = layout.getSize(tileCol);
+        beginCompute(tileSlot);
+        checkBlas(JCublas2.cublasDgemm(blasHandle, 
+            transposed ? CUBLAS_OP_T : CUBLAS_OP_N, CUBLAS_OP_N, 
+            transposed ? cols : rows, nrhs, transposed ? rows : cols, 
+            minusOne, slots[tileSlot], ts, rhsBlock(sourceRhsBlock), n, 
+            one, rhsBlock(rhsBlock), n), "cublasDgemm");
+        endCompute(tileSlot);
+    }
+    
+    /**
+     * Returns the pointer to the given block of the right hand side
+     * 
+     * @param block The block index
+     * @return The pointer
+     */
+    private Pointer rhsBlock(int block)
+    {
+        return rhs.withByteOffset((long)layout.getOffset(block) * Sizeof.DOUBLE);
+    }
+    
+    /**
+     * Let the compute stream wait for the events of the given slots
+     * 
+     * @param slotIndices The slots
+     */
+    private void beginCompute(int ... slotIndices)
+    {
+        for (int s : slotIndices)
+        {
+            waitFor(computeStream, slotEvents[s]);
+        }
+    }
+
+    /**
+     * Record the events of the given slots in the compute stream
+     * 
+     * @param slotIndices The slots
+     */
+    private void endCompute(int ... slotIndices)
+    {
+        for (int s : slotIndices)
+        {
+            record(slotEvents[s], computeStream);
+        }
+    }
+    
+    /**
+     * Throws a CudaException if the given CUBLAS status is not 
+     * CUBLAS_STATUS_SUCCESS
+     * 
+     * @param result The result
+     * @param functionName The function name
+     */
+    private static void checkBlas(int result, String functionName)
+    {
+        if (result != cublasStatus.CUBLAS_STATUS_SUCCESS)
+        {
+            throw new CudaException(functionName + " failed: " + 
+                cublasStatus.stringFor(result));
+        }
+    }
+}
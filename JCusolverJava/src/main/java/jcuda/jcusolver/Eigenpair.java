@@ -0,0 +1,141 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.util.Arrays;
+
+/**
+ * An approximate eigenpair that was computed by the 
+ * {@link ShiftedInverseIteration}
+ */
+public final class Eigenpair
+{
+    /**
+     * The shift that the eigenpair was computed from
+     */
+    private final double shift;
+    
+    /**
+     * The eigenvalue
+     */
+    private final double eigenvalue;
+    
+    /**
+     * The eigenvector
+     */
+    private final double eigenvector[];
+    
+    /**
+     * The residual norm ||A*x - lambda*x|| / ||x||
+     */
+    private final double residual;
+    
+    /**
+     * Creates a new instance
+     * 
+     * @param shift The shift
+     * @param eigenvalue The eigenvalue
+     * @param eigenvector The eigenvector. This is not copied.
+     * @param residual The residual norm
+     */
+    Eigenpair(double shift, double eigenvalue, double eigenvector[], 
+        double residual)
+    {
+        this.shift = shift;
+        this.eigenvalue = eigenvalue;
+        this.eigenvector = eigenvector;
+        this.residual = residual;
+    }
+    
+    /**
+     * Returns the shift that the eigenpair was computed from
+     * 
+     * @return The shift
+     */
+    public double getShift()
+    {
+        return shift;
+    }
+    
+    /**
+     * Returns the eigenvalue
+     * 
+     * @return The eigenvalue
+     */
+    public double getEigenvalue()
+    {
+        return eigenvalue;
+    }
+    
+    /**
+     * Returns a copy of the eigenvector
+     * 
+     * @return The eigenvector
+     */
+    public double[] getEigenvector()
+    {
+        return eigenvector.clone();
+    }
+    
+    /**
+     * Returns the eigenvector without copying it
+     * 
+     * @return The eigenvector
+     */
+    double[] eigenvector()
+    {
+        return eigenvector;
+    }
+    
+    /**
+     * Returns the residual norm ||A*x - lambda*x|| / ||x||
+     * 
+     * @return The residual norm
+     */
+    public double getResidual()
+    {
+        return residual;
+    }
+    
+    /**
+     * Returns a String representation of this object.
+     *
+     * @return A String representation of this object.
+     */
+    @Override
+    public String toString()
+    {
+        return "Eigenpair["+
+            "shift="+shift+","+
+            "eigenvalue="+eigenvalue+","+
+            "residual="+residual+","+
+            "eigenvector="+(eigenvector.length <= 8 ? 
+                Arrays.toString(eigenvector) : 
+                "(" + eigenvector.length + " elements)")+"]";
+    }
+}
@@ -0,0 +1,263 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.util.Collections;
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+/**
+ * The metrics of the calls of one native function, as returned by 
+ * {@link CallMetrics#getMetrics()}. The latencies are the host-side 
+ * times of the calls, in nanoseconds. They are taken from a log-linear 
+ * histogram, so they are exact up to 16 ns, and have a relative error 
+ * of at most 1/16 above that.
+ */
+public final class FunctionCallMetrics
+{
+    /**
+     * The function name
+     */
+    private final String functionName;
+    
+    /**
+     * The number of calls
+     */
+    private final long calls;
+    
+    /**
+     * The number of calls that did not return CUSOLVER_STATUS_SUCCESS
+     */
+    private final long errors;
+    
+    /**
+     * The total duration of all calls, in nanoseconds
+     */
+    private final long totalNs;
+    
+    /**
+     * The number of calls for each status
+     */
+    private final long statusCounts[];
+    
+    /**
+     * The latency histogram
+     */
+    private final long buckets[];
+    
+    /**
+     * Creates a new instance
+     * 
+     * @param functionName The function name
+     * @param counters The counters
+     * @param statusCounts The number of calls for each status
+     * @param buckets The latency histogram
+     */
+    FunctionCallMetrics(String functionName, long counters[], 
+        long statusCounts[], long buckets[])
+    {
+        this.functionName = functionName;
+        this.calls = counters[CallMetrics.CALLS];
+        this.errors = counters[CallMetrics.ERRORS];
+        this.totalNs = counters[CallMetrics.TOTAL_NS];
+        this.statusCounts = statusCounts;
+        this.buckets = buckets;
+    }
+    
+    /**
+     * Returns the name of the function, for example, 
+     * <code>"cusolverDnDpotrf"</code>
+     * 
+     * @return The function name
+     */
+    public String getFunctionName()
+    {
+        return functionName;
+    }
+    
+    /**
+     * Returns the number of calls
+     * 
+     * @return The number of calls
+     */
+    public long getCalls()
+    {
+        return calls;
+    }
+    
+    /**
+     * Returns the number of calls that did not return 
+     * CUSOLVER_STATUS_SUCCESS
+     * 
+     * @return The number of failed calls
+     */
+    public long getErrors()
+    {
+        return errors;
+    }
+    
+    /**
+     * Returns the number of failed calls for each status, where the 
+     * keys are the {@link cusolverStatus#stringFor(int) status names}.
+     * Statuses that are not in the range of the known statuses are 
+     * counted as <code>"OTHER"</code>.
+     * 
+     * @return The error counts
+     */
+    public Map<String, Long> getErrorCounts()
+    {
+        Map<String, Long> result = new LinkedHashMap<String, Long>();
+        for (int i = 1; i < statusCounts.length; i++)
+        {
+            if (statusCounts[i] > 0)
+            {
+                String name = i == statusCounts.length - 1 ? 
+                    "OTHER" : cusolverStatus.stringFor(i);
+                result.put(name, statusCounts[i]);
+            }
+        }
+        return Collections.unmodifiableMap(result);
+    }
+    
+    /**
+     * Returns the total duration of all calls, in nanoseconds
+     * 
+     * @return The total duration
+     */
+    public long getTotalNs()
+    {
+        return totalNs;
+    }
+    
+    /**
+     * Returns the mean duration of the calls, in nanoseconds
+     * 
+     * @return The mean duration
+     */
+    public double getMeanNs()
+    {
+        return calls == 0 ? 0.0 : (double)totalNs / calls;
+    }
+    
+    /**
+     * Returns the median duration of the calls, in nanoseconds
+     * 
+     * @return The median duration
+     */
+    public long getMedianNs()
+    {
+        return getPercentileNs(50.0);
+    }
+    
+    /**
+     * Returns the 90th percentile of the durations, in nanoseconds
+     * 
+     * @return The percentile
+     */
+    public long getP90Ns()
+    {
+        return getPercentileNs(90.0);
+    }
+    
+    /**
+     * Returns the 99th percentile of the durations, in nanoseconds
+     * 
+     * @return The percentile
+     */
+    public long getP99Ns()
+    {
+        return getPercentileNs(99.0);
+    }
+    
+    /**
+     * Returns the 99.9th percentile of the durations, in nanoseconds
+     * 
+     * @return The percentile
+     */
+    public long getP999Ns()
+    {
+        return getPercentileNs(99.9);
+    }
+    
+    /**
+     * Returns the maximum duration, in nanoseconds
+     * 
+     * @return The maximum duration
+     */
+    public long getMaxNs()
+    {
+        return getPercentileNs(100.0);
+    }
+    
+    /**
+     * Returns the given percentile of the durations, in nanoseconds. 
+     * This is the largest value that falls into the same histogram 
+     * bucket as the actual percentile.
+     * 
+     * @param percentile The percentile, between 0 and 100
+     * @return The percentile
+     */
+    public long getPercentileNs(double percentile)
+    {
+        long total = 0;
+        for (long count : buckets)
+        {
+            total += count;
+        }
+        if (total == 0)
+        {
+            return 0;
+        }
+        double p = Math.min(100.0, Math.max(0.0, percentile));
+        long target = Math.max(1, (long)Math.ceil(p / 100.0 * total));
+        long sum = 0;
+        for (int i = 0; i < buckets.length; i++)
+        {
+            sum += buckets[i];
+            if (sum >= target)
+            {
+                return CallMetrics.bucketUpperBound(i);
+            }
+        }
+        return CallMetrics.bucketUpperBound(buckets.length - 1);
+    }
+    
+    @Override
+    public String toString()
+    {
+        return "FunctionCallMetrics["
+            + "functionName=" + functionName + ","
+            + "calls=" + calls + ","
+            + "errors=" + errors + ","
+            + "meanNs=" + getMeanNs() + ","
+            + "medianNs=" + getMedianNs() + ","
+            + "p99Ns=" + getP99Ns() + ","
+            + "maxNs=" + getMaxNs() + "]";
+    }
+}
@@ -0,0 +1,223 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import jcuda.Pointer;
+
+/**
+ * A sparse matrix in CSR format with zero-based 32 bit indices, whose 
+ * arrays are stored in page-locked host memory, so that they may be
+ * uploaded to the device asynchronously. <br>
+ * <br>
+ * Complex values are stored as interleaved real and imaginary parts,
+ * matching the layout of cuDoubleComplex. <br>
+ * <br>
+ * Instances of this class are created by the {@link SparseMatrixIO},
+ * and own their memory, which is freed by {@link #close()}.
+ */
+public final class HostCsrMatrix
+{
+    /**
+     * The number of rows
+     */
+    private final int m;
+    
+    /**
+     * The number of columns
+     */
+    private final int n;
+    
+    /**
+     * The number of nonzeros
+     */
+    private final int nnz;
+    
+    /**
+     * Whether the values are complex
+     */
+    private final boolean complex;
+    
+    /**
+     * The row pointers
+     */
+    private final Pointer csrRowPtr;
+    
+    /**
+     * The column indices
+     */
+    private final Pointer csrColInd;
+    
+    /**
+     * The values
+     */
+    private final Pointer csrVal;
+    
+    /**
+     * Whether the memory was freed
+     */
+    private boolean closed;
+    
+    /**
+     * Creates a new matrix, allocating page-locked host memory for the 
+     * given sizes. If an allocation fails, then the memory that was 
+     * already allocated is freed.
+     * 
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param complex Whether the values are complex
+     * @throws jcuda.CudaException If the memory can not be allocated
+     */
+    HostCsrMatrix(int m, int n, int nnz, boolean complex)
+    {
+        this.m = m;
+        this.n = n;
+        this.nnz = nnz;
+        this.complex = complex;
+        Pointer rowPtr = DeviceMemory.allocateHost((long)(m + 1) * 4);
+        Pointer colInd = null;
+        Pointer val = null;
+        try
+        {
+            colInd = DeviceMemory.allocateHost((long)nnz * 4);
+            val = DeviceMemory.allocateHost(
+                (long)nnz * 8 * (complex ? 2 : 1));
+        }
+        catch (RuntimeException e)
+        {
+            DeviceMemory.freeHost(rowPtr, colInd);
+            throw e;
+        }
+        this.csrRowPtr = rowPtr;
+        this.csrColInd = colInd;
+        this.csrVal = val;
+    }
+    
+    /**
+     * Returns the number of rows
+     * 
+     * @return The number of rows
+     */
+    public int getRows()
+    {
+        return m;
+    }
+    
+    /**
+     * Returns the number of columns
+     * 
+     * @return The number of columns
+     */
+    public int getColumns()
+    {
+        return n;
+    }
+    
+    /**
+     * Returns the number of nonzeros
+     * 
+     * @return The number of nonzeros
+     */
+    public int getNnz()
+    {
+        return nnz;
+    }
+    
+    /**
+     * Returns whether the values are complex
+     * 
+     * @return Whether the values are complex
+     */
+    public boolean isComplex()
+    {
+        return complex;
+    }
+    
+    /**
+     * Returns the pointer to the m+1 row pointers
+     * 
+     * @return The row pointers
+     */
+    public Pointer getCsrRowPtr()
+    {
+        return csrRowPtr;
+    }
+    
+    /**
+     * Returns the pointer to the nnz column indices
+     * 
+     * @return The column indices
+     */
+    public Pointer getCsrColInd()
+    {
+        return csrColInd;
+    }
+    
+    /**
+     * Returns the pointer to the values, which are nnz doubles for 
+     * real matrices, and nnz cuDoubleComplex values for complex matrices
+     * 
+     * @return The values
+     */
+    public Pointer getCsrVal()
+    {
+        return csrVal;
+    }
+    
+    /**
+     * Returns the number of bytes of the values
+     * 
+     * @return The number of bytes of the values
+     */
+    public long getCsrValBytes()
+    {
+        return (long)nnz * 8 * (complex ? 2 : 1);
+    }
+    
+    /**
+     * Free the page-locked host memory of this matrix
+     */
+    public synchronized void close()
+    {
+        if (!closed)
+        {
+            closed = true;
+            DeviceMemory.freeHost(csrRowPtr, csrColInd, csrVal);
+        }
+    }
+    
+    @Override
+    public String toString()
+    {
+        return "HostCsrMatrix["+
+            "m="+m+","+
+            "n="+n+","+
+            "nnz="+nnz+","+
+            "complex="+complex+"]";
+    }
+}
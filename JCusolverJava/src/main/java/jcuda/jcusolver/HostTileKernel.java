@@ -0,0 +1,387 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * A {@link TileKernel} that performs all operations on the host. <br>
+ * <br>
+ * This is a reference implementation that does not require the native 
+ * library. It may be used for testing the {@link TiledCholesky} 
+ * scheduler, or for small matrices. The tiles of the matrix and the 
+ * slots are stored in Java arrays, in column-major order with a leading 
+ * dimension of {@link TileLayout#getTileSize()}.
+ */
+public class HostTileKernel implements TileKernel
+{
+    /**
+     * The tile layout
+     */
+    private final TileLayout layout;
+    
+    /**
+     * The tiles of the lower triangle of the matrix, at index 
+     * tileRow * tileCount + tileCol
+     */
+    private final double tiles[][];
+    
+    /**
+     * The slots
+     */
+    private final double slots[][];
+    
+    /**
+     * The right hand side, column-major, with a leading dimension that
+     * is the size of the matrix
+     */
+    private double rhs[];
+    
+    /**
+     * The number of right hand sides
+     */
+    private int nrhs;
+    
+    /**
+     * The info of the factorization
+     */
+    private int info;
+    
+    /**
+     * Creates a new kernel
+     * 
+     * @param layout The tile layout
+     * @param slotCount The number of slots
+     */
+    public HostTileKernel(TileLayout layout, int slotCount)
+    {
+        int t = layout.getTileCount();
+        int ts = layout.getTileSize();
+        this.layout = layout;
+        this.tiles = new double[t * t][];
+        for (int i = 0; i < t; i++)
+        {
+            for (int j = 0; j <= i; j++)
+            {
+                tiles[i * t + j] = new double[ts * ts];
+            }
+        }
+        this.slots = new double[slotCount][ts * ts];
+    }
+    
+    /**
+     * Set the lower triangle of the matrix from the given array, which 
+     * contains the matrix in column-major order
+     * 
+     * @param a The matrix
+     */
+    public void setMatrix(double a[])
+    {
+        transferMatrix(a, false);
+    }
+    
+    /**
+     * Write the lower triangle of the matrix into the given array, which
+     * will contain the matrix in column-major order. Only the elements 
+     * of the tiles of the lower triangle are written.
+     * 
+     * @param a The matrix
+     */
+    public void getMatrix(double a[])
+    {
+        transferMatrix(a, true);
+    }
+    
+    /**
+     * Copy the lower tiles between the given array and the tiles
+     * 
+     * @param a The matrix
+     * @param toArray Whether the tiles should be copied into the array
+     */
+    private void transferMatrix(double a[], boolean toArray)
+    {
+        int n = layout.getSize();
+        int t = layout.getTileCount();
+        int ts = layout.getTileSize();
+        for (int i = 0; i < t; i++)
+        {
+            for (int j = 0; j <= i; j++)
+            {
+                double tile[] = tiles[i * t + j];
+                int rows = layout.getSize(i);
+                int cols = layout.getSize(j);
+                for (int c = 0; c < cols; c++)
+                {
+                    int offset = layout.getOffset(i) + 
+                        (layout.getOffset(j) + c) * n;
+                    if (toArray)
+                    {
+                        System.arraycopy(tile, c * ts, a, offset, rows);
+                    }
+                    else
+                    {
+                        System.arraycopy(a, offset, tile, c * ts, rows);
+                    }
+                }
+            }
+        }
+    }
+    
+    /**
+     * Set the right hand side
+     * 
+     * @param b The right hand side, in column-major order, with a 
+     * leading dimension that is the size of the matrix
+     * @param nrhs The number of right hand sides
+     */
+    public void setRightHandSide(double b[], int nrhs)
+    {
+        this.rhs = b.clone();
+        this.nrhs = nrhs;
+    }
+    
+    /**
+     * Write the solution into the given array
+     * 
+     * @param x The solution, in column-major order, with a leading 
+     * dimension that is the size of the matrix
+     */
+    public void getSolution(double x[])
+    {
+        System.arraycopy(rhs, 0, x, 0, rhs.length);
+    }
+    
+    /**
+     * Returns the info of the factorization. If this is 0, the 
+     * factorization succeeded. Otherwise, the leading minor of 
+     * this order is not positive definite.
+     * 
+     * @return The info
+     */
+    public int getInfo()
+    {
+        return info;
+    }
+
+    @Override
+    public void load(int slot, int tileRow, int tileCol)
+    {
+        double tile[] = tiles[tileRow * layout.getTileCount() + tileCol];
+        System.arraycopy(tile, 0, slots[slot], 0, tile.length);
+    }
+
+    @Override
+    public void store(int slot, int tileRow, int tileCol)
+    {
+        double tile[] = tiles[tileRow * layout.getTileCount() + tileCol];
+        System.arraycopy(slots[slot], 0, tile, 0, tile.length);
+    }
+
+    @Override
+    public void potrf(int slot, int tileIndex)
+    {
+        if (info != 0)
+        {
+            return;
+        }
+        double a[] = slots[slot];
+        int ts = layout.getTileSize();
+        int n = layout.getSize(tileIndex);
+        for (int c = 0; c < n; c++)
+        {
+            double d = a[c + c * ts];
+            for (int k = 0; k < c; k++)
+            {
+                d -= a[c + k * ts] * a[c + k * ts];
+            }
+            if (!(d > 0.0))
+            {
+                info = layout.getOffset(tileIndex) + c + 1;
+                return;
+            }
+            double l = Math.sqrt(d);
+            a[c + c * ts] = l;
+            for (int r = c + 1; r < n; r++)
+            {
+                double v = a[r + c * ts];
+                for (int k = 0; k < c; k++)
+                {
+                    v -= a[r + k * ts] * a[c + k * ts];
+                }
+                a[r + c * ts] = v / l;
+            }
+        }
+    }
+
+    @Override
+    public void trsm(int slot, int tileRow, int diagonalSlot, int tileIndex)
+    {
+        double a[] = slots[slot];
+        double l[] = slots[diagonalSlot];
+        int ts = layout.getTileSize();
+        int rows = layout.getSize(tileRow);
+        int n = layout.getSize(tileIndex);
+        for (int r = 0; r < rows; r++)
+        {
+            for (int c = 0; c < n; c++)
+            {
+                double v = a[r + c * ts];
+                for (int k = 0; k < c; k++)
+                {
+                    v -= l[c + k * ts] * a[r + k * ts];
+                }
+                a[r + c * ts] = v / l[c + c * ts];
+            }
+        }
+    }
+
+    @Override
+    public void syrk(int slot, int tileIndex, int panelSlot, int panelCol)
+    {
+        double a[] = slots[slot];
+        double p[] = slots[panelSlot];
+        int ts = layout.getTileSize();
+        int n = layout.getSize(tileIndex);
+        int inner = layout.getSize(panelCol);
+        for (int c = 0; c < n; c++)
+        {
+            for (int r = c; r < n; r++)
+            {
+                double v = 0.0;
+                for (int k = 0; k < inner; k++)
+                {
+                    v += p[r + k * ts] * p[c + k * ts];
+                }
+                a[r + c * ts] -= v;
+            }
+        }
+    }
+
+    @Override
+    public void gemm(int slot, int leftSlot, int leftRow, 
+        int rightSlot, int rightRow, int innerCol)
+    {
+        double a[] = slots[slot];
+        double left[] = slots[leftSlot];
+        double right[] = slots[rightSlot];
+        int ts = layout.getTileSize();
+        int rows = layout.getSize(leftRow);
+        int cols = layout.getSize(rightRow);
+        int inner = layout.getSize(innerCol);
+        for (int c = 0; c < cols; c++)
+        {
+            for (int r = 0; r < rows; r++)
+            {
+                double v = 0.0;
+                for (int k = 0; k < inner; k++)
+                {
+                    v += left[r + k * ts] * right[c + k * ts];
+                }
+                a[r + c * ts] -= v;
+            }
+        }
+    }
+
+    @Override
+    public void solveRhs(int rhsBlock, int diagonalSlot, boolean transposed)
+    {
+        double l[] = slots[diagonalSlot];
+        int n = layout.getSize();
+        int ts = layout.getTileSize();
+        int size = layout.getSize(rhsBlock);
+        int offset = layout.getOffset(rhsBlock);
+        for (int col = 0; col < nrhs; col++)
+        {
+            int b = offset + col * n;
+            if (!transposed)
+            {
+                for (int r = 0; r < size; r++)
+                {
+                    double v = rhs[b + r];
+                    for (int k = 0; k < r; k++)
+                    {
+                        v -= l[r + k * ts] * rhs[b + k];
+                    }
+                    rhs[b + r] = v / l[r + r * ts];
+                }
+            }
+            else
+            {
+                for (int r = size - 1; r >= 0; r--)
+                {
+                    double v = rhs[b + r];
+                    for (int k = r + 1; k < size; k++)
+                    {
+                        v -= l[k + r * ts] * rhs[b + k];
+                    }
+                    rhs[b + r] = v / l[r + r * ts];
+                }
+            }
+        }
+    }
+
+    @Override
+    public void updateRhs(int rhsBlock, int tileSlot, int tileRow, 
+        int tileCol, int sourceRhsBlock, boolean transposed)
+    {
+        double l[] = slots[tileSlot];
+        int n = layout.getSize();
+        int ts = layout.getTileSize();
+        int rows = layout.getSize(tileRow);
+        int cols = layout.getSize(tileCol);
+        int offset = layout.getOffset(rhsBlock);
+        int sourceOffset = layout.getOffset(sourceRhsBlock);
+        for (int col = 0; col < nrhs; col++)
+        {
+            int b = offset + col * n;
+            int s = sourceOffset + col * n;
+            if (!transposed)
+            {
+                for (int r = 0; r < rows; r++)
+                {
+                    double v = 0.0;
+                    for (int k = 0; k < cols; k++)
+                    {
+                        v += l[r + k * ts] * rhs[s + k];
+                    }
+                    rhs[b + r] -= v;
+                }
+            }
+            else
+            {
+                for (int c = 0; c < cols; c++)
+                {
+                    double v = 0.0;
+                    for (int k = 0; k < rows; k++)
+                    {
+                        v += l[k + c * ts] * rhs[s + k];
+                    }
+                    rhs[b + c] -= v;
+                }
+            }
+        }
+    }
+}
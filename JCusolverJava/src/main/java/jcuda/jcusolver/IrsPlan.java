@@ -0,0 +1,210 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.cusolverIRSRefinement.*;
+import static jcuda.jcusolver.cusolverPrecType.*;
+
+/**
+ * A combination of a lowest (inner) precision and a refinement solver 
+ * for the iterative refinement solvers cusolverDnIRSXgesv and 
+ * cusolverDnIRSXgels, as chosen by the {@link IrsPlanner}. <br>
+ * <br>
+ * The precisions are always given as the real variants of the 
+ * {@link cusolverPrecType}. They are converted to the complex 
+ * variants when the main precision of the problem is complex.
+ */
+public final class IrsPlan
+{
+    /**
+     * The plan that solves in double precision, without refinement
+     */
+    public static final IrsPlan DOUBLE = 
+        new IrsPlan(CUSOLVER_R_64F, CUSOLVER_IRS_REFINE_NONE);
+    
+    /**
+     * The default candidates, in the order of decreasing speed: Half, 
+     * bfloat16 and TF32 inner precisions with classical refinement, 
+     * then with GMRES refinement, then single precision, and finally
+     * double precision.
+     */
+    static final IrsPlan DEFAULT_CANDIDATES[] = 
+    {
+        new IrsPlan(CUSOLVER_R_16F, CUSOLVER_IRS_REFINE_CLASSICAL),
+        new IrsPlan(CUSOLVER_R_16BF, CUSOLVER_IRS_REFINE_CLASSICAL),
+        new IrsPlan(CUSOLVER_R_TF32, CUSOLVER_IRS_REFINE_CLASSICAL),
+        new IrsPlan(CUSOLVER_R_16F, CUSOLVER_IRS_REFINE_GMRES),
+        new IrsPlan(CUSOLVER_R_16BF, CUSOLVER_IRS_REFINE_GMRES),
+        new IrsPlan(CUSOLVER_R_TF32, CUSOLVER_IRS_REFINE_GMRES),
+        new IrsPlan(CUSOLVER_R_32F, CUSOLVER_IRS_REFINE_CLASSICAL),
+        new IrsPlan(CUSOLVER_R_32F, CUSOLVER_IRS_REFINE_GMRES),
+        DOUBLE,
+    };
+    
+    /**
+     * The lowest precision, as a real cusolverPrecType
+     */
+    private final int lowestPrecision;
+    
+    /**
+     * The cusolverIRSRefinement
+     */
+    private final int refinementSolver;
+    
+    /**
+     * Creates a new plan
+     * 
+     * @param lowestPrecision The lowest precision, as a real 
+     * {@link cusolverPrecType}
+     * @param refinementSolver The {@link cusolverIRSRefinement}
+     */
+    public IrsPlan(int lowestPrecision, int refinementSolver)
+    {
+        this.lowestPrecision = lowestPrecision;
+        this.refinementSolver = refinementSolver;
+    }
+    
+    /**
+     * Returns the lowest precision, as a real {@link cusolverPrecType}
+     * 
+     * @return The lowest precision
+     */
+    public int getLowestPrecision()
+    {
+        return lowestPrecision;
+    }
+    
+    /**
+     * Returns the lowest precision for the given main precision. If the 
+     * main precision is complex, then the complex variant of the lowest 
+     * precision is returned.
+     * 
+     * @param mainPrecision The main {@link cusolverPrecType}
+     * @return The lowest precision
+     */
+    public int getLowestPrecision(int mainPrecision)
+    {
+        if (mainPrecision >= CUSOLVER_C_8I)
+        {
+            return lowestPrecision + (CUSOLVER_C_8I - CUSOLVER_R_8I);
+        }
+        return lowestPrecision;
+    }
+    
+    /**
+     * Returns the refinement solver
+     * 
+     * @return The {@link cusolverIRSRefinement}
+     */
+    public int getRefinementSolver()
+    {
+        return refinementSolver;
+    }
+    
+    /**
+     * Returns the unit roundoff of the lowest precision
+     * 
+     * @return The unit roundoff
+     */
+    double getUnitRoundoff()
+    {
+        switch (lowestPrecision)
+        {
+            case CUSOLVER_R_16F: return 0x1.0p-11;
+            case CUSOLVER_R_16BF: return 0x1.0p-8;
+            case CUSOLVER_R_TF32: return 0x1.0p-11;
+            case CUSOLVER_R_32F: return 0x1.0p-24;
+        }
+        return 0x1.0p-53;
+    }
+    
+    /**
+     * Returns the largest condition number for which this plan is 
+     * expected to converge. <br>
+     * <br>
+     * Classical refinement converges when the condition number times 
+     * the unit roundoff u of the factorization is well below 1. GMRES
+     * based refinement is preconditioned by the low precision factors,
+     * and tolerates condition numbers up to about u^-2, limited by the
+     * working precision. These are conservative rules of thumb. The 
+     * {@link IrsPlanner} verifies them with the observed iteration 
+     * counts.
+     * 
+     * @return The largest condition number
+     */
+    public double getMaxConditionNumber()
+    {
+        if (refinementSolver == CUSOLVER_IRS_REFINE_NONE ||
+            lowestPrecision == CUSOLVER_R_64F)
+        {
+            return Double.POSITIVE_INFINITY;
+        }
+        double u = getUnitRoundoff();
+        if (refinementSolver == CUSOLVER_IRS_REFINE_CLASSICAL)
+        {
+            return 0.1 / u;
+        }
+        return Math.min(0.01 / (u * u), 1e12);
+    }
+
+    @Override
+    public int hashCode()
+    {
+        return 31 * lowestPrecision + refinementSolver;
+    }
+
+    @Override
+    public boolean equals(Object object)
+    {
+        if (this == object)
+        {
+            return true;
+        }
+        if (!(object instanceof IrsPlan))
+        {
+            return false;
+        }
+        IrsPlan other = (IrsPlan)object;
+        return lowestPrecision == other.lowestPrecision &&
+            refinementSolver == other.refinementSolver;
+    }
+    
+    /**
+     * Returns a String representation of this object.
+     *
+     * @return A String representation of this object.
+     */
+    @Override
+    public String toString()
+    {
+        return "IrsPlan["+
+            "lowestPrecision="+cusolverPrecType.stringFor(lowestPrecision)+","+
+            "refinementSolver="+
+            cusolverIRSRefinement.stringFor(refinementSolver)+"]";
+    }
+}
@@ -0,0 +1,808 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcublas.cublasOperation.CUBLAS_OP_N;
+import static jcuda.jcublas.cublasOperation.CUBLAS_OP_T;
+import static jcuda.jcusolver.DeviceMemory.allocate;
+import static jcuda.jcusolver.DeviceMemory.copy;
+import static jcuda.jcusolver.DeviceMemory.free;
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+import static jcuda.jcusolver.cusolverPrecType.CUSOLVER_R_64F;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyDeviceToDevice;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyDeviceToHost;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyHostToDevice;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.runtime.JCuda;
+
+/**
+ * A planner for the mixed precision iterative refinement solvers 
+ * cusolverDnIRSXgesv and cusolverDnIRSXgels. <br>
+ * <br>
+ * For each problem, the planner chooses the fastest {@link IrsPlan} 
+ * that is expected to converge. The choice is based on an optional 
+ * estimate of the condition number, and on the iteration counts that 
+ * have been observed for earlier problems of the same <i>problem 
+ * class</i>. 
+ * The problem class is an arbitrary key that is provided by the caller, 
+ * and that should identify problems with similar numerical properties. 
+ * <br>
+ * <br>
+ * The fallback of CUSOLVER is always enabled, so that each solve 
+ * returns a solution in the main precision even when the chosen plan 
+ * did not converge. Such a failure is remembered, and the plan will 
+ * not be chosen again for the same problem class, unless it succeeded 
+ * more often than it failed. A plan that repeatedly converged only 
+ * after a number of iterations close to the maximum is treated as 
+ * failed as well. <br>
+ * <br>
+ * All methods of this class are thread-safe.
+ */
+public class IrsPlanner
+{
+    /**
+     * The outcome of a solve
+     */
+    public static final class Outcome
+    {
+        /**
+         * The plan that was used
+         */
+        private final IrsPlan plan;
+        
+        /**
+         * The number of iterations, as returned by the solver
+         */
+        private final int niters;
+        
+        /**
+         * The number of outer iterations
+         */
+        private final int outerNiters;
+        
+        /**
+         * The info that was returned by the solver
+         */
+        private final int info;
+        
+        Outcome(IrsPlan plan, int niters, int outerNiters, int info)
+        {
+            this.plan = plan;
+            this.niters = niters;
+            this.outerNiters = outerNiters;
+            this.info = info;
+        }
+        
+        /**
+         * Returns the plan that was used
+         * 
+         * @return The plan
+         */
+        public IrsPlan getPlan()
+        {
+            return plan;
+        }
+        
+        /**
+         * Returns the number of iterations. A negative value indicates
+         * that the refinement did not converge, and the solver fell 
+         * back to the main precision.
+         * 
+         * @return The number of iterations
+         */
+        public int getNiters()
+        {
+            return niters;
+        }
+        
+        /**
+         * Returns the number of outer iterations
+         * 
+         * @return The number of outer iterations
+         */
+        public int getOuterNiters()
+        {
+            return outerNiters;
+        }
+        
+        /**
+         * Returns the info that was returned by the solver. If this is 
+         * not 0, then the matrix was singular, or a parameter was invalid
+         * 
+         * @return The info
+         */
+        public int getInfo()
+        {
+            return info;
+        }
+        
+        /**
+         * Returns whether the solver fell back to the main precision
+         * 
+         * @return Whether the solver fell back
+         */
+        public boolean isFallback()
+        {
+            return niters < 0;
+        }
+        
+        /**
+         * Returns a String representation of this object.
+         *
+         * @return A String representation of this object.
+         */
+        @Override
+        public String toString()
+        {
+            return "Outcome["+
+                "plan="+plan+","+
+                "niters="+niters+","+
+                "outerNiters="+outerNiters+","+
+                "info="+info+"]";
+        }
+    }
+    
+    /**
+     * The statistics for one plan in one problem class
+     */
+    private static class PlanStatistics
+    {
+        /**
+         * The number of solves that converged
+         */
+        int successes;
+        
+        /**
+         * The number of solves that did not converge, including those
+         * that have been marginal too often
+         */
+        int failures;
+        
+        /**
+         * The number of consecutive marginal solves
+         */
+        int marginal;
+        
+        /**
+         * Returns whether the plan should not be chosen any more
+         * 
+         * @return Whether the plan is rejected
+         */
+        boolean isRejected()
+        {
+            return failures > 0 && failures >= successes;
+        }
+    }
+    
+    /**
+     * The record of one problem class
+     */
+    private static class ClassRecord
+    {
+        /**
+         * The estimated condition number, or NaN if it is not known
+         */
+        double conditionEstimate = Double.NaN;
+        
+        /**
+         * The statistics for each plan
+         */
+        final Map<IrsPlan, PlanStatistics> statistics = 
+            new HashMap<IrsPlan, PlanStatistics>();
+    }
+    
+    /**
+     * The number of consecutive marginal solves after which a plan 
+     * is treated as failed
+     */
+    private static final int MAX_MARGINAL = 3;
+    
+    /**
+     * The fraction of the maximum number of iterations above which 
+     * a solve is considered to be marginal
+     */
+    private static final double MARGINAL_FRACTION = 0.75;
+    
+    /**
+     * The approximate number of elements of the host buffer that is 
+     * used for computing the norm of a matrix
+     */
+    private static final int NORM_BLOCK_ELEMENTS = 1 << 16;
+    
+    /**
+     * The main precision, as a {@link cusolverPrecType}
+     */
+    private final int mainPrecision;
+    
+    /**
+     * The candidate plans, in the order of preference
+     */
+    private final List<IrsPlan> candidates;
+    
+    /**
+     * The maximum number of iterations
+     */
+    private final int maxIters;
+    
+    /**
+     * The records for the problem classes
+     */
+    private final Map<Object, ClassRecord> records;
+    
+    /**
+     * The IRS parameters for each plan. They are created once, and 
+     * never modified afterwards.
+     */
+    private final Map<IrsPlan, cusolverDnIRSParams> params;
+    
+    /**
+     * Whether the condition number should be estimated for problem 
+     * classes that do not have an estimate yet
+     */
+    private boolean conditionEstimationEnabled;
+    
+    /**
+     * Creates a new planner with the default candidate plans
+     * 
+     * @param mainPrecision The main precision, as a 
+     * {@link cusolverPrecType}, e.g. CUSOLVER_R_64F for double 
+     * precision problems
+     * @param maxIters The maximum number of iterations
+     */
+    public IrsPlanner(int mainPrecision, int maxIters)
+    {
+        this(mainPrecision, maxIters, 
+            Arrays.asList(IrsPlan.DEFAULT_CANDIDATES));
+    }
+    
+    /**
+     * Creates a new planner
+     * 
+     * @param mainPrecision The main precision, as a 
+     * {@link cusolverPrecType}, e.g. CUSOLVER_R_64F for double 
+     * precision problems
+     * @param maxIters The maximum number of iterations
+     * @param candidates The candidate plans, in the order of preference. 
+     * Plans with a lowest precision that is higher than the main 
+     * precision will be ignored.
+     * @throws IllegalArgumentException If the maximum number of 
+     * iterations is not positive
+     */
+    public IrsPlanner(int mainPrecision, int maxIters, 
+        List<IrsPlan> candidates)
+    {
+        if (maxIters <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The maximum number of iterations must be positive, but is "
+                + maxIters);
+        }
+        this.mainPrecision = mainPrecision;
+        this.maxIters = maxIters;
+        this.candidates = candidates;
+        this.records = new HashMap<Object, ClassRecord>();
+        this.params = new LinkedHashMap<IrsPlan, cusolverDnIRSParams>();
+    }
+    
+    /**
+     * Set whether the condition number of the matrix should be estimated
+     * with {@link #estimateConditionNumber(cusolverDnHandle, int, 
+     * Pointer, int)} when {@link #gesv(cusolverDnHandle, Object, int, 
+     * int, Pointer, int, Pointer, int, Pointer, int) gesv} is called 
+     * for a problem class that does not have a condition estimate yet.
+     * <br>
+     * <br>
+     * This is disabled by default: The estimate requires a double 
+     * precision LU factorization, which costs about as much as solving 
+     * the problem in double precision, and thus offsets the gain of 
+     * the mixed precision solver for the first problem of each class. 
+     * Without an estimate, the plans are only chosen based on the 
+     * observed iteration counts. Estimates that are computed elsewhere 
+     * can be provided with {@link #setConditionEstimate(Object, double)}.
+     * 
+     * @param enabled Whether the condition number should be estimated
+     */
+    public synchronized void setConditionEstimationEnabled(boolean enabled)
+    {
+        this.conditionEstimationEnabled = enabled;
+    }
+    
+    /**
+     * Returns whether the condition number is estimated for problem 
+     * classes that do not have a condition estimate yet
+     * 
+     * @return Whether the condition number is estimated
+     * @see #setConditionEstimationEnabled(boolean)
+     */
+    public synchronized boolean isConditionEstimationEnabled()
+    {
+        return conditionEstimationEnabled;
+    }
+    
+    /**
+     * Set the estimated condition number for the given problem class
+     * 
+     * @param problemClass The problem class
+     * @param conditionEstimate The estimated condition number
+     */
+    public synchronized void setConditionEstimate(
+        Object problemClass, double conditionEstimate)
+    {
+        getRecord(problemClass).conditionEstimate = conditionEstimate;
+    }
+    
+    /**
+     * Returns the estimated condition number for the given problem 
+     * class, or NaN if it is not known
+     * 
+     * @param problemClass The problem class
+     * @return The estimated condition number
+     */
+    public synchronized double getConditionEstimate(Object problemClass)
+    {
+        return getRecord(problemClass).conditionEstimate;
+    }
+    
+    /**
+     * Choose the plan for the given problem class. This does not 
+     * require the native library.
+     * 
+     * @param problemClass The problem class
+     * @return The plan
+     */
+    public synchronized IrsPlan choose(Object problemClass)
+    {
+        ClassRecord record = getRecord(problemClass);
+        double kappa = record.conditionEstimate;
+        double mainRoundoff = 
+            new IrsPlan(realPrecision(mainPrecision), 0).getUnitRoundoff();
+        for (IrsPlan plan : candidates)
+        {
+            if (plan.getUnitRoundoff() < mainRoundoff)
+            {
+                continue;
+            }
+            if (!Double.isNaN(kappa) && kappa > plan.getMaxConditionNumber())
+            {
+                continue;
+            }
+            PlanStatistics statistics = record.statistics.get(plan);
+            if (statistics != null && statistics.isRejected())
+            {
+                continue;
+            }
+            return plan;
+        }
+        return new IrsPlan(realPrecision(mainPrecision), 
+            cusolverIRSRefinement.CUSOLVER_IRS_REFINE_NONE);
+    }
+    
+    /**
+     * Record the result of a solve with the given plan for the given
+     * problem class. This does not require the native library.
+     * 
+     * @param problemClass The problem class
+     * @param plan The plan
+     * @param niters The number of iterations. A negative value 
+     * indicates that the solver did not converge.
+     */
+    public synchronized void record(
+        Object problemClass, IrsPlan plan, int niters)
+    {
+        ClassRecord record = getRecord(problemClass);
+        PlanStatistics statistics = record.statistics.get(plan);
+        if (statistics == null)
+        {
+            statistics = new PlanStatistics();
+            record.statistics.put(plan, statistics);
+        }
+        if (niters < 0)
+        {
+            statistics.failures++;
+            statistics.marginal = 0;
+            return;
+        }
+        statistics.successes++;
+        if (niters >= MARGINAL_FRACTION * maxIters)
+        {
+            statistics.marginal++;
+            if (statistics.marginal >= MAX_MARGINAL)
+            {
+                statistics.failures += statistics.successes;
+                statistics.marginal = 0;
+            }
+        }
+        else
+        {
+            statistics.marginal = 0;
+        }
+    }
+    
+    /**
+     * Solve A * X = B with cusolverDnIRSXgesv, using the plan that is 
+     * chosen for the given problem class, and record the outcome. <br>
+     * <br>
+     * If {@link #setConditionEstimationEnabled(boolean) condition 
+     * estimation is enabled}, no condition estimate is known for the 
+     * problem class, and the main precision is CUSOLVER_R_64F, then the 
+     * condition number will be estimated with 
+     * {@link #estimateConditionNumber(cusolverDnHandle, int, Pointer, 
+     * int)} first. This is done only once per problem class. <br>
+     * <br>
+     * All pointers are device pointers. The matrix A may be overwritten
+     * when the solver falls back to the main precision.
+     * 
+     * @param handle The handle
+     * @param problemClass The problem class
+     * @param n The size of the matrix
+     * @param nrhs The number of right hand sides
+     * @param dA The matrix
+     * @param ldda The leading dimension of the matrix
+     * @param dB The right hand sides
+     * @param lddb The leading dimension of the right hand sides
+     * @param dX The solution
+     * @param lddx The leading dimension of the solution
+     * @return The outcome
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public Outcome gesv(cusolverDnHandle handle, Object problemClass, 
+        int n, int nrhs, Pointer dA, int ldda, Pointer dB, int lddb, 
+        Pointer dX, int lddx)
+    {
+        return solve(handle, problemClass, false, 
+            n, n, nrhs, dA, ldda, dB, lddb, dX, lddx);
+    }
+    
+    /**
+     * Solve the least squares problem min ||A * X - B|| with 
+     * cusolverDnIRSXgels, using the plan that is chosen for the given 
+     * problem class, and record the outcome. See 
+     * {@link #gesv(cusolverDnHandle, Object, int, int, Pointer, int, 
+     * Pointer, int, Pointer, int)} for details.
+     * 
+     * @param handle The handle
+     * @param problemClass The problem class
+     * @param m The number of rows of the matrix
+     * @param n The number of columns of the matrix
+     * @param nrhs The number of right hand sides
+     * @param dA The matrix
+     * @param ldda The leading dimension of the matrix
+     * @param dB The right hand sides
+     * @param lddb The leading dimension of the right hand sides
+     * @param dX The solution
+     * @param lddx The leading dimension of the solution
+     * @return The outcome
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public Outcome gels(cusolverDnHandle handle, Object problemClass, 
+        int m, int n, int nrhs, Pointer dA, int ldda, Pointer dB, int lddb, 
+        Pointer dX, int lddx)
+    {
+        return solve(handle, problemClass, true, 
+            m, n, nrhs, dA, ldda, dB, lddb, dX, lddx);
+    }
+    
+    /**
+     * Implementation of gesv and gels
+     */
+    private Outcome solve(cusolverDnHandle handle, Object problemClass, 
+        boolean leastSquares, int m, int n, int nrhs, Pointer dA, int ldda, 
+        Pointer dB, int lddb, Pointer dX, int lddx)
+    {
+        if (!leastSquares && 
+            mainPrecision == CUSOLVER_R_64F && 
+            isConditionEstimationEnabled() &&
+            Double.isNaN(getConditionEstimate(problemClass)))
+        {
+            double kappa = estimateConditionNumber(handle, n, dA, ldda);
+            setConditionEstimate(problemClass, kappa);
+        }
+        IrsPlan plan = choose(problemClass);
+        cusolverDnIRSParams irsParams = getParams(plan);
+        cusolverDnIRSInfos infos = new cusolverDnIRSInfos();
+        checkSuccess(JCusolverDn.cusolverDnIRSInfosCreate(infos), 
+            "cusolverDnIRSInfosCreate");
+        Pointer dWorkspace = null;
+        Pointer dInfo = null;
+        try
+        {
+            long lworkBytes[] = { 0 };
+            int niters[] = { 0 };
+            dInfo = allocate(Sizeof.INT);
+            if (leastSquares)
+            {
+                checkSuccess(JCusolverDn.cusolverDnIRSXgels_bufferSize(
+                    handle, irsParams, m, n, nrhs, lworkBytes), 
+                    "cusolverDnIRSXgels_bufferSize");
+                dWorkspace = allocate(lworkBytes[0]);
+                checkSuccess(JCusolverDn.cusolverDnIRSXgels(handle, 
+                    irsParams, infos, m, n, nrhs, dA, ldda, dB, lddb, 
+                    dX, lddx, dWorkspace, lworkBytes[0], niters, dInfo), 
+                    "cusolverDnIRSXgels");
+            }
+            else
+            {
+                checkSuccess(JCusolverDn.cusolverDnIRSXgesv_bufferSize(
+                    handle, irsParams, n, nrhs, lworkBytes), 
+                    "cusolverDnIRSXgesv_bufferSize");
+                dWorkspace = allocate(lworkBytes[0]);
+                checkSuccess(JCusolverDn.cusolverDnIRSXgesv(handle, 
+                    irsParams, infos, n, nrhs, dA, ldda, dB, lddb, 
+                    dX, lddx, dWorkspace, lworkBytes[0], niters, dInfo), 
+                    "cusolverDnIRSXgesv");
+            }
+            int info[] = { 0 };
+            copy(Pointer.to(info), dInfo, Sizeof.INT, cudaMemcpyDeviceToHost);
+            int outerNiters[] = { 0 };
+            checkSuccess(JCusolverDn.cusolverDnIRSInfosGetOuterNiters(
+                infos, outerNiters), "cusolverDnIRSInfosGetOuterNiters");
+            
+            // A nonzero info means that the matrix is singular, which 
+            // says nothing about the plan
+            if (info[0] == 0)
+            {
+                record(problemClass, plan, niters[0]);
+            }
+            return new Outcome(plan, niters[0], outerNiters[0], info[0]);
+        }
+        finally
+        {
+            JCusolverDn.cusolverDnIRSInfosDestroy(infos);
+            free(dWorkspace, dInfo);
+        }
+    }
+    
+    /**
+     * Estimate the 1-norm condition number of the given double precision
+     * matrix. <br>
+     * <br>
+     * This computes the LU factorization of a copy of the matrix with
+     * cusolverDnDgetrf, and estimates the norm of the inverse with 
+     * the method of Hager and Higham, which requires a few solves with 
+     * cusolverDnDgetrs. The matrix itself is not modified. <br>
+     * <br>
+     * The factorization dominates the cost, which is about the same as 
+     * that of solving the system in double precision. The estimate 
+     * also requires device memory for a copy of the matrix, and the 
+     * matrix is transferred to the host once, in blocks of columns, 
+     * to compute its 1-norm.
+     * 
+     * @param handle The handle
+     * @param n The size of the matrix
+     * @param dA The matrix, in device memory
+     * @param ldda The leading dimension of the matrix
+     * @return The estimated condition number. This is positive infinity
+     * if the matrix is singular.
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public static double estimateConditionNumber(
+        cusolverDnHandle handle, int n, Pointer dA, int ldda)
+    {
+        long matrixBytes = (long)n * n * Sizeof.DOUBLE;
+        Pointer dLU = allocate(matrixBytes);
+        Pointer dIpiv = allocate((long)n * Sizeof.INT);
+        Pointer dInfo = allocate(Sizeof.INT);
+        Pointer dX = allocate((long)n * Sizeof.DOUBLE);
+        Pointer dWork = null;
+        try
+        {
+            JCusolver.checkCudaSuccess(JCuda.cudaMemcpy2D(
+                dLU, (long)n * Sizeof.DOUBLE, dA, (long)ldda * Sizeof.DOUBLE,
+                (long)n * Sizeof.DOUBLE, n, cudaMemcpyDeviceToDevice), 
+                "cudaMemcpy2D");
+            double normA = norm1(n, dLU);
+            
+            int lwork[] = { 0 };
+            checkSuccess(JCusolverDn.cusolverDnDgetrf_bufferSize(
+                handle, n, n, dLU, n, lwork), "cusolverDnDgetrf_bufferSize");
+            dWork = allocate((long)lwork[0] * Sizeof.DOUBLE);
+            checkSuccess(JCusolverDn.cusolverDnDgetrf(
+                handle, n, n, dLU, n, dWork, dIpiv, dInfo), 
+                "cusolverDnDgetrf");
+            int info[] = { 0 };
+            copy(Pointer.to(info), dInfo, Sizeof.INT, cudaMemcpyDeviceToHost);
+            if (info[0] != 0)
+            {
+                return Double.POSITIVE_INFINITY;
+            }
+            
+            // Hager-Higham estimate of ||A^-1||_1
+            double x[] = new double[n];
+            Arrays.fill(x, 1.0 / n);
+            double estimate = 0.0;
+            for (int iteration = 0; iteration < 5; iteration++)
+            {
+                double y[] = x.clone();
+                getrs(handle, CUBLAS_OP_N, n, dLU, dIpiv, dX, dInfo, y);
+                estimate = 0.0;
+                double z[] = new double[n];
+                for (int i = 0; i < n; i++)
+                {
+                    estimate += Math.abs(y[i]);
+                    z[i] = y[i] >= 0.0 ? 1.0 : -1.0;
+                }
+                getrs(handle, CUBLAS_OP_T, n, dLU, dIpiv, dX, dInfo, z);
+                int maxIndex = 0;
+                double zx = 0.0;
+                for (int i = 0; i < n; i++)
+                {
+                    zx += z[i] * x[i];
+                    if (Math.abs(z[i]) > Math.abs(z[maxIndex]))
+                    {
+                        maxIndex = i;
+                    }
+                }
+                if (Math.abs(z[maxIndex]) <= zx)
+                {
+                    break;
+                }
+                Arrays.fill(x, 0.0);
+                x[maxIndex] = 1.0;
+            }
+            return normA * estimate;
+        }
+        finally
+        {
+            free(dLU, dIpiv, dInfo, dX, dWork);
+        }
+    }
+    
+    /**
+     * Compute the 1-norm of the given n x n matrix in device memory,
+     * with a leading dimension of n. The matrix is copied to the host
+     * in blocks of columns, so that the host memory does not grow 
+     * with the size of the matrix.
+     * 
+     * @param n The size of the matrix
+     * @param dA The matrix
+     * @return The 1-norm
+     */
+    private static double norm1(int n, Pointer dA)
+    {
+        int blockColumns = Math.max(1, NORM_BLOCK_ELEMENTS / n);
+        double block[] = new double[n * Math.min(blockColumns, n)];
+        double normA = 0.0;
+        for (int c0 = 0; c0 < n; c0 += blockColumns)
+        {
+            int columns = Math.min(blockColumns, n - c0);
+            copy(Pointer.to(block), 
+                dA.withByteOffset((long)c0 * n * Sizeof.DOUBLE), 
+                (long)columns * n * Sizeof.DOUBLE, cudaMemcpyDeviceToHost);
+            for (int c = 0; c < columns; c++)
+            {
+                double sum = 0.0;
+                for (int r = 0; r < n; r++)
+                {
+                    sum += Math.abs(block[r + c * n]);
+                }
+                normA = Math.max(normA, sum);
+            }
+        }
+        return normA;
+    }
+    
+    /**
+     * Solve with the given LU factors, for a single right hand side 
+     * that is given and returned in the given host array
+     */
+    private static void getrs(cusolverDnHandle handle, int trans, int n, 
+        Pointer dLU, Pointer dIpiv, Pointer dX, Pointer dInfo, double x[])
+    {
+        copy(dX, Pointer.to(x), (long)n * Sizeof.DOUBLE, 
+            cudaMemcpyHostToDevice);
+        checkSuccess(JCusolverDn.cusolverDnDgetrs(
+            handle, trans, n, 1, dLU, n, dIpiv, dX, n, dInfo), 
+            "cusolverDnDgetrs");
+        copy(Pointer.to(x), dX, (long)n * Sizeof.DOUBLE, 
+            cudaMemcpyDeviceToHost);
+    }
+    
+    /**
+     * Release all IRS parameters that have been created by this planner
+     */
+    public synchronized void close()
+    {
+        for (cusolverDnIRSParams p : params.values())
+        {
+            JCusolverDn.cusolverDnIRSParamsDestroy(p);
+        }
+        params.clear();
+    }
+    
+    /**
+     * Returns the IRS parameters for the given plan, creating them if
+     * necessary
+     * 
+     * @param plan The plan
+     * @return The parameters
+     */
+    private synchronized cusolverDnIRSParams getParams(IrsPlan plan)
+    {
+        cusolverDnIRSParams p = params.get(plan);
+        if (p == null)
+        {
+            p = new cusolverDnIRSParams();
+            checkSuccess(JCusolverDn.cusolverDnIRSParamsCreate(p), 
+                "cusolverDnIRSParamsCreate");
+            checkSuccess(JCusolverDn.cusolverDnIRSParamsSetSolverPrecisions(
+                p, mainPrecision, plan.getLowestPrecision(mainPrecision)), 
+                "cusolverDnIRSParamsSetSolverPrecisions");
+            checkSuccess(JCusolverDn.cusolverDnIRSParamsSetRefinementSolver(
+                p, plan.getRefinementSolver()), 
+                "cusolverDnIRSParamsSetRefinementSolver");
+            checkSuccess(JCusolverDn.cusolverDnIRSParamsSetMaxIters(
+                p, maxIters), "cusolverDnIRSParamsSetMaxIters");
+            checkSuccess(JCusolverDn.cusolverDnIRSParamsEnableFallback(p), 
+                "cusolverDnIRSParamsEnableFallback");
+            params.put(plan, p);
+        }
+        return p;
+    }
+    
+    /**
+     * Returns the record for the given problem class, creating it if
+     * necessary
+     * 
+     * @param problemClass The problem class
+     * @return The record
+     */
+    private ClassRecord getRecord(Object problemClass)
+    {
+        ClassRecord record = records.get(problemClass);
+        if (record == null)
+        {
+            record = new ClassRecord();
+            records.put(problemClass, record);
+        }
+        return record;
+    }
+    
+    /**
+     * Returns the real variant of the given precision
+     * 
+     * @param precision The {@link cusolverPrecType}
+     * @return The real variant
+     */
+    private static int realPrecision(int precision)
+    {
+        if (precision >= cusolverPrecType.CUSOLVER_C_8I)
+        {
+            return precision - 
+                (cusolverPrecType.CUSOLVER_C_8I - cusolverPrecType.CUSOLVER_R_8I);
+        }
+        return precision;
+    }
+}
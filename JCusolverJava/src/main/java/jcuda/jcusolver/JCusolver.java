@@ -27,11 +27,20 @@
  */
 package jcuda.jcusolver;
 
+import java.io.IOException;
+import java.util.Arrays;
+import java.util.HashSet;
+import java.util.LinkedHashMap;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Set;
+
 import jcuda.CudaException;
 import jcuda.JCudaVersion;
 import jcuda.LibUtils;
 import jcuda.LibUtilsCuda;
 import jcuda.LogLevel;
+import jcuda.runtime.cudaError;
 
 /**
  * Java bindings for CUSOLVER, the NVIDIA CUDA solver library. <br />
@@ -51,6 +60,54 @@ public class JCusolver
      */
     private static boolean initialized = false;
     
+    /**
+     * Whether the functions of the other classes are in separate 
+     * libraries. See {@link #loadFamilyLibrary(String)}.
+     */
+    private static boolean familyLibraries = false;
+    
+    /**
+     * The base names of the family libraries that have been loaded
+     */
+    private static final Set<String> loadedFamilyLibraries = 
+        new HashSet<String>();
+    
+    /**
+     * The times that have been spent for loading the libraries, in 
+     * nanoseconds, for the library names
+     */
+    private static final Map<String, Long> libraryLoadTimes = 
+        new LinkedHashMap<String, Long>();
+    
+    /**
+     * The component of the native library that consists of the field IDs
+     * of the JNIUtils and PointerUtils, which are used by all functions 
+     * that receive pointers or handles. This must match the definition 
+     * in LazyInit.hpp
+     */
+    static final int INIT_POINTER_FIELDS = 1;
+    
+    /**
+     * The component of the native library that consists of the field IDs
+     * of cuComplex and cuDoubleComplex. This must match the definition 
+     * in LazyInit.hpp
+     */
+    static final int INIT_COMPLEX_FIELDS = 2;
+    
+    /**
+     * The indices of the values that are obtained with 
+     * {@link #getStartupTimesNative(long[])}. These must match the 
+     * definitions in LazyInit.hpp
+     */
+    private static final int STARTUP_JNI_ONLOAD_NS = 0;
+    private static final int STARTUP_POINTER_FIELDS_NS = 1;
+    private static final int STARTUP_COMPLEX_FIELDS_NS = 2;
+    private static final int STARTUP_CUSOLVER_SYMBOLS = 3;
+    private static final int STARTUP_CUSOLVER_SYMBOLS_NS = 4;
+    private static final int STARTUP_CUDART_SYMBOLS = 5;
+    private static final int STARTUP_CUDART_SYMBOLS_NS = 6;
+    private static final int STARTUP_VALUE_COUNT = 7;
+    
     /**
      * Whether a CudaException should be thrown if a method is about
      * to return a result code that is not 
@@ -72,19 +129,187 @@ public class JCusolver
     /**
      * Initializes the native library. Note that this method
      * does not have to be called explicitly, since it will
-     * be called automatically when this class is loaded.
+     * be called automatically when this class is loaded.<br>
+     * <br>
+     * This only loads the library. The structures that are used by
+     * the native functions are initialized by the classes that use 
+     * them, when they are loaded.
      */
-    public static void initialize()
+    public static synchronized void initialize()
     {
         if (!initialized)
         {
             String libraryBaseName = "JCusolver-" + JCudaVersion.get();
             String libraryName = 
                 LibUtils.createPlatformLibraryName(libraryBaseName);
-            LibUtilsCuda.loadLibrary(libraryName);
+            loadLibrary(libraryName);
+            familyLibraries = hasFamilyLibrariesNative();
             initialized = true;
         }
     }
+    
+    /**
+     * Initializes the native library, and the given components of it. 
+     * Each component is only initialized once, and this method is 
+     * thread-safe. This is called by the static initializers of the 
+     * classes, with the components that their native functions use.
+     * 
+     * @param components The bitwise OR of the INIT_* constants
+     * @throws UnsatisfiedLinkError If the initialization fails
+     */
+    static void initialize(int components)
+    {
+        initialize();
+        initializeNative(components);
+    }
+    
+    private static native void initializeNative(int components);
+    
+    /**
+     * Load the library with the given name, and record the time that
+     * this took
+     * 
+     * @param libraryName The platform specific library name
+     */
+    private static void loadLibrary(String libraryName)
+    {
+        long before = System.nanoTime();
+        LibUtilsCuda.loadLibrary(libraryName);
+        long after = System.nanoTime();
+        libraryLoadTimes.put(libraryName, after - before);
+    }
+    
+    private static native boolean hasFamilyLibrariesNative();
+    
+    /**
+     * Loads the library with the given base name, for example, 
+     * <code>"JCusolverSp"</code>, if the native functions of the 
+     * classes have been built into one library for each family of 
+     * functions. Otherwise, they are all contained in the JCusolver 
+     * library, and this method only initializes it. Each library is 
+     * only loaded once. This is called by the static initializers of
+     * the classes, and when the first function of a family is called
+     * whose library is not loaded with the class.
+     * 
+     * @param libraryBaseName The base name of the library
+     */
+    static synchronized void loadFamilyLibrary(String libraryBaseName)
+    {
+        initialize();
+        if (familyLibraries && loadedFamilyLibraries.add(libraryBaseName))
+        {
+            String libraryName = LibUtils.createPlatformLibraryName(
+                libraryBaseName + "-" + JCudaVersion.get());
+            loadLibrary(libraryName);
+        }
+    }
+    
+    /**
+     * Creates a report of the time that has been spent for the startup
+     * of the native libraries until now:
+     * <ul>
+     *   <li>
+     *     The time for loading each library. This includes extracting
+     *     it, if necessary, loading it and its dependencies, like the 
+     *     cuSOLVER library and the CUDA runtime, and JNI_OnLoad. 
+     *   </li>
+     *   <li>
+     *     The time that was spent in JNI_OnLoad
+     *   </li>
+     *   <li>
+     *     The time for the lookups of the field IDs, which are only done
+     *     when the first class that uses them is loaded 
+     *   </li>
+     *   <li>
+     *     An estimate of the time for resolving the cuSOLVER and CUDA 
+     *     runtime functions that are imported by the libraries. These are 
+     *     bound lazily, when each function is called for the first time, 
+     *     so the time is estimated by looking up all of them with dlsym 
+     *     when the report is created. This does not include the work of 
+     *     the lazy binding itself, like updating the global offset table.
+     *     This is only available on Linux.
+     *   </li>
+     * </ul>
+     * 
+     * @return The report
+     */
+    public static synchronized String createStartupReport()
+    {
+        initialize();
+        long values[] = new long[STARTUP_VALUE_COUNT];
+        getStartupTimesNative(values);
+        StringBuilder sb = new StringBuilder();
+        sb.append("JCusolver startup times:\n");
+        boolean first = true;
+        for (Map.Entry<String, Long> entry : libraryLoadTimes.entrySet())
+        {
+            appendTime(sb, "Load " + entry.getKey(), entry.getValue());
+            if (first)
+            {
+                appendTime(sb, "  JNI_OnLoad", values[STARTUP_JNI_ONLOAD_NS]);
+                first = false;
+            }
+        }
+        appendTime(sb, "JNIUtils and PointerUtils field lookups", 
+            values[STARTUP_POINTER_FIELDS_NS]);
+        appendTime(sb, "cuComplex and cuDoubleComplex field lookups", 
+            values[STARTUP_COMPLEX_FIELDS_NS]);
+        appendSymbols(sb, "cuSOLVER", values[STARTUP_CUSOLVER_SYMBOLS], 
+            values[STARTUP_CUSOLVER_SYMBOLS_NS]);
+        appendSymbols(sb, "CUDA runtime", values[STARTUP_CUDART_SYMBOLS], 
+            values[STARTUP_CUDART_SYMBOLS_NS]);
+        return sb.toString();
+    }
+    
+    private static native void getStartupTimesNative(long times[]);
+    
+    /**
+     * Append a line with the given time to the given builder. A time 
+     * of 0 means that the step was not done.
+     * 
+     * @param sb The builder
+     * @param name The name of the step
+     * @param ns The time, in nanoseconds
+     */
+    private static void appendTime(StringBuilder sb, String name, long ns)
+    {
+        if (ns == 0)
+        {
+            sb.append(String.format(Locale.ENGLISH, 
+                "  %-56s %12s\n", name, "not done"));
+        }
+        else
+        {
+            sb.append(String.format(Locale.ENGLISH, 
+                "  %-56s %12.3f ms\n", name, ns / 1e6));
+        }
+    }
+    
+    /**
+     * Append a line with the estimated time for the symbol resolution to 
+     * the given builder
+     * 
+     * @param sb The builder
+     * @param library The library name
+     * @param count The number of symbols, or -1 if they are not known
+     * @param ns The time, in nanoseconds
+     */
+    private static void appendSymbols(
+        StringBuilder sb, String library, long count, long ns)
+    {
+        if (count < 0)
+        {
+            sb.append(String.format(Locale.ENGLISH, 
+                "  %-56s %12s\n", library + " symbol resolution estimate", 
+                "unknown"));
+        }
+        else
+        {
+            sb.append(String.format(Locale.ENGLISH, 
+                "  %-56s %12.3f ms\n", library + " symbol resolution " + 
+                "estimate (" + count + " dlsym lookups)", ns / 1e6));
+        }
+    }
 
     /**
      * Set the specified log level for the JCusolver library.<br />
@@ -93,7 +318,10 @@ public class JCusolver
      * <br />
      * LOG_QUIET: Never print anything <br />
      * LOG_ERROR: Print error messages <br />
-     * LOG_TRACE: Print a trace of all native function calls <br />
+     * LOG_TRACE: Print trace messages of the library <br />
+     * <br />
+     * The native function calls are not logged. They can be recorded 
+     * with {@link #startCallTrace(String)}.
      *
      * @param logLevel The log level to use.
      */
@@ -104,6 +332,86 @@ public class JCusolver
 
     private static native void setLogLevelNative(int logLevel);
 
+    /**
+     * Start writing a binary trace of all native function calls into 
+     * the given file. Each call is recorded with its start time, 
+     * duration, status, and up to four integer arguments. The records
+     * are written into a buffer of each thread, and written into the 
+     * file by a background thread, so tracing is cheap enough to be 
+     * used in production. When the buffer of a thread is full, records 
+     * are dropped instead of blocking the thread.<br>
+     * <br>
+     * The file can be read with the {@link CallTraceDecoder}.
+     * 
+     * @param fileName The name of the file
+     * @throws NullPointerException If the given file name is null
+     * @throws IOException If tracing is already running, or the file 
+     * can not be opened
+     */
+    public static void startCallTrace(String fileName) throws IOException
+    {
+        startCallTraceNative(fileName);
+    }
+    
+    private static native void startCallTraceNative(String fileName)
+        throws IOException;
+    
+    /**
+     * Stop the call trace that was started with 
+     * {@link #startCallTrace(String)}, write all pending records, 
+     * and close the file. If no trace is running, then this method
+     * has no effect.
+     */
+    public static void stopCallTrace()
+    {
+        stopCallTraceNative();
+    }
+    
+    private static native void stopCallTraceNative();
+
+    /**
+     * Start recording all native function calls with all their
+     * arguments into the given file, so that the sequence of calls can
+     * be replayed with the {@link CallReplay}. This includes the sizes
+     * of the device memory allocations that are passed to the
+     * functions, and the contents of Java arrays and buffers.<br>
+     * <br>
+     * If <code>contents</code> is <code>true</code>, then the contents
+     * of the device memory allocations are recorded before each call.
+     * This synchronizes the device and copies the memory, and may
+     * create large files. Identical contents are only stored once.<br>
+     * <br>
+     * Recording is intended for reproducing performance problems, and
+     * should not be enabled in production: Each call inspects all its
+     * arguments, and is written to the file while holding a lock.
+     *
+     * @param fileName The name of the file
+     * @param contents Whether the contents of device memory are recorded
+     * @throws NullPointerException If the given file name is null
+     * @throws IOException If recording is already running, or the file
+     * can not be opened
+     */
+    public static void startCallRecording(String fileName, boolean contents)
+        throws IOException
+    {
+        startCallRecordingNative(fileName, contents);
+    }
+
+    private static native void startCallRecordingNative(
+        String fileName, boolean contents) throws IOException;
+
+    /**
+     * Stop the call recording that was started with
+     * {@link #startCallRecording(String, boolean)}, and close the file.
+     * If no recording is running, then this method has no effect.
+     */
+    public static void stopCallRecording()
+    {
+        stopCallRecordingNative();
+    }
+
+    private static native void stopCallRecordingNative();
+
 
     /**
      * Enables or disables exceptions. By default, the methods of this class
@@ -118,13 +426,30 @@ public class JCusolver
     {
         exceptionsEnabled = enabled;
     }
-    
+
+    /**
+     * Returns whether exceptions are enabled
+     *
+     * @return Whether exceptions are enabled
+     * @see #setExceptionsEnabled(boolean)
+     */
+    static boolean isExceptionsEnabled()
+    {
+        return exceptionsEnabled;
+    }
+
     /**
      * If the given result is not cusolverStatus.CUSOLVER_STATUS_SUCCESS
      * and exceptions have been enabled, this method will throw a 
      * CudaException with an error message that corresponds to the
-     * given result code. Otherwise, the given result is simply
-     * returned.
+     * given result code, unless sticky errors are enabled for the 
+     * calling thread. Otherwise, the given result is simply
+     * returned.<br>
+     * <br>
+     * Every native function whose result is passed to this method 
+     * must record a failure as the sticky error of the thread, 
+     * because the failure is not reported otherwise while sticky 
+     * errors are enabled.
      * 
      * @param result The result to check
      * @return The result that was given as the parameter
@@ -134,13 +459,164 @@ public class JCusolver
     static int checkResult(int result)
     {
         if (exceptionsEnabled && result != 
-           cusolverStatus.CUSOLVER_STATUS_SUCCESS)
+           cusolverStatus.CUSOLVER_STATUS_SUCCESS &&
+           !isStickyErrorsEnabledNative())
         {
             throw new CudaException(cusolverStatus.stringFor(result));
         }
         return result;
     }
     
+    /**
+     * Enables or disables sticky errors for the calling thread. This 
+     * is intended for long sequences of calls in hot loops, where 
+     * checking each status is too expensive: While sticky errors are
+     * enabled, the first call of the thread that fails is stored 
+     * natively, and all later failed calls are counted.<br>
+     * <br>
+     * Only the function, the status, and up to four integer arguments 
+     * of the failed call are stored. These are the same arguments that 
+     * are recorded in a call trace, for example, the matrix sizes. The 
+     * values of pointer and handle arguments are not stored, so the 
+     * error can not tell which matrix or which handle was involved.<br>
+     * <br>
+     * While sticky errors are enabled, no CudaException is thrown 
+     * for failed calls, even when 
+     * {@link #setExceptionsEnabled(boolean) exceptions are enabled}.
+     * The error can then be checked once for the whole sequence, with
+     * {@link #checkStickyError()} or {@link #getStickyError()}.<br>
+     * <br>
+     * Enabling sticky errors clears the error of the thread. Disabling 
+     * them keeps it, so that it can still be checked. Errors that are 
+     * detected in the Java layer, like null arguments, still cause 
+     * exceptions. The utility classes of this package, which combine 
+     * several calls, always throw exceptions.
+     * 
+     * @param enabled Whether sticky errors are enabled
+     */
+    public static void setStickyErrorsEnabled(boolean enabled)
+    {
+        setStickyErrorsEnabledNative(enabled);
+    }
+    
+    private static native void setStickyErrorsEnabledNative(boolean enabled);
+    
+    /**
+     * Returns whether sticky errors are enabled for the calling thread
+     * 
+     * @return Whether sticky errors are enabled
+     * @see #setStickyErrorsEnabled(boolean)
+     */
+    public static boolean isStickyErrorsEnabled()
+    {
+        return isStickyErrorsEnabledNative();
+    }
+    
+    private static native boolean isStickyErrorsEnabledNative();
+    
+    /**
+     * Returns the first call of the calling thread that failed while 
+     * sticky errors were enabled, since the error was last cleared.
+     * 
+     * @return The error, or <code>null</code> if no call failed
+     * @see #setStickyErrorsEnabled(boolean)
+     */
+    public static StickyError getStickyError()
+    {
+        long values[] = new long[6];
+        String signature = getStickyErrorNative(values);
+        if (signature == null)
+        {
+            return null;
+        }
+        int open = signature.indexOf('(');
+        String functionName = signature.substring(0, open);
+        String names = signature.substring(open + 1, signature.length() - 1);
+        String argumentNames[] = 
+            names.isEmpty() ? new String[0] : names.split(",\\s*");
+        long arguments[] = 
+            Arrays.copyOfRange(values, 2, 2 + argumentNames.length);
+        return new StickyError(functionName, argumentNames, arguments, 
+            (int)values[0], values[1]);
+    }
+    
+    private static native String getStickyErrorNative(long values[]);
+    
+    /**
+     * Clears the sticky error of the calling thread
+     * 
+     * @see #setStickyErrorsEnabled(boolean)
+     */
+    public static void clearStickyError()
+    {
+        clearStickyErrorNative();
+    }
+    
+    private static native void clearStickyErrorNative();
+    
+    /**
+     * Throws a CudaException that describes the sticky error of the 
+     * calling thread, if a call failed while sticky errors were 
+     * enabled, regardless of whether exceptions have been enabled. 
+     * The error is cleared before the exception is thrown.
+     * 
+     * @throws CudaException If a call failed since the error was 
+     * last cleared
+     * @see #setStickyErrorsEnabled(boolean)
+     */
+    public static void checkStickyError()
+    {
+        StickyError stickyError = getStickyError();
+        if (stickyError != null)
+        {
+            clearStickyErrorNative();
+            throw new CudaException(stickyError.createMessage());
+        }
+    }
+    
+    /**
+     * Throws a CudaException if the given result is not 
+     * cusolverStatus.CUSOLVER_STATUS_SUCCESS, regardless of whether 
+     * exceptions have been enabled. This is used by the utility 
+     * classes that combine several calls, and that can not 
+     * sensibly continue after one of them failed.
+     * 
+     * @param result The result to check
+     * @param functionName The name of the function that returned
+     * the result
+     * @throws CudaException If the given result code is not 
+     * cusolverStatus.CUSOLVER_STATUS_SUCCESS
+     */
+    static void checkSuccess(int result, String functionName)
+    {
+        if (result != cusolverStatus.CUSOLVER_STATUS_SUCCESS)
+        {
+            throw new CudaException(
+                functionName + " failed: " + cusolverStatus.stringFor(result));
+        }
+    }
+    
+    /**
+     * Throws a CudaException if the given result is not 
+     * cudaError.cudaSuccess, regardless of whether exceptions have 
+     * been enabled. This is the counterpart of 
+     * {@link #checkSuccess(int, String)} for calls to the runtime API.
+     * 
+     * @param result The result to check
+     * @param functionName The name of the function that returned
+     * the result
+     * @throws CudaException If the given result code is not 
+     * cudaError.cudaSuccess
+     */
+    static void checkCudaSuccess(int result, String functionName)
+    {
+        if (result != cudaError.cudaSuccess)
+        {
+            throw new CudaException(
+                functionName + " failed: " + cudaError.stringFor(result));
+        }
+    }
+    
     public static int cusolverGetProperty(
         int type, 
         int[] value)
@@ -44,7 +44,50 @@ public class JCusolverDn
     
     static
     {
-        JCusolver.initialize();
+        JCusolver.loadFamilyLibrary("JCusolverDn");
+        JCusolver.initialize(JCusolver.INIT_POINTER_FIELDS);
+    }
+    
+    /**
+     * The holder of the library with the iterative refinement (IRS) 
+     * functions, which is loaded when the first of these functions
+     * is called
+     */
+    private static final class IrsLibrary
+    {
+        static
+        {
+            JCusolver.loadFamilyLibrary("JCusolverDnIrs");
+        }
+        
+        /**
+         * Makes sure that the library is loaded
+         */
+        static void load()
+        {
+            // Loaded in the static initializer
+        }
+    }
+    
+    /**
+     * The holder of the library with the eigenvalue and singular value
+     * functions, which is loaded when the first of these functions is 
+     * called
+     */
+    private static final class EigenLibrary
+    {
+        static
+        {
+            JCusolver.loadFamilyLibrary("JCusolverDnEigen");
+        }
+        
+        /**
+         * Makes sure that the library is loaded
+         */
+        static void load()
+        {
+            // Loaded in the static initializer
+        }
     }
     
     /**
@@ -110,6 +153,7 @@ public class JCusolverDn
     public static int cusolverDnIRSParamsCreate(
         cusolverDnIRSParams params_ptr)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsCreateNative(params_ptr));
     }
     private static native int cusolverDnIRSParamsCreateNative(
@@ -119,6 +163,7 @@ public class JCusolverDn
     public static int cusolverDnIRSParamsDestroy(
         cusolverDnIRSParams params)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsDestroyNative(params));
     }
     private static native int cusolverDnIRSParamsDestroyNative(
@@ -129,6 +174,7 @@ public class JCusolverDn
         cusolverDnIRSParams params, 
         int refinement_solver)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsSetRefinementSolverNative(params, refinement_solver));
     }
     private static native int cusolverDnIRSParamsSetRefinementSolverNative(
@@ -140,6 +186,7 @@ public class JCusolverDn
         cusolverDnIRSParams params, 
         int solver_main_precision)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsSetSolverMainPrecisionNative(params, solver_main_precision));
     }
     private static native int cusolverDnIRSParamsSetSolverMainPrecisionNative(
@@ -151,6 +198,7 @@ public class JCusolverDn
         cusolverDnIRSParams params, 
         int solver_lowest_precision)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsSetSolverLowestPrecisionNative(params, solver_lowest_precision));
     }
     private static native int cusolverDnIRSParamsSetSolverLowestPrecisionNative(
@@ -163,6 +211,7 @@ public class JCusolverDn
         int solver_main_precision, 
         int solver_lowest_precision)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsSetSolverPrecisionsNative(params, solver_main_precision, solver_lowest_precision));
     }
     private static native int cusolverDnIRSParamsSetSolverPrecisionsNative(
@@ -175,6 +224,7 @@ public class JCusolverDn
         cusolverDnIRSParams params, 
         double val)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsSetTolNative(params, val));
     }
     private static native int cusolverDnIRSParamsSetTolNative(
@@ -186,6 +236,7 @@ public class JCusolverDn
         cusolverDnIRSParams params, 
         double val)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsSetTolInnerNative(params, val));
     }
     private static native int cusolverDnIRSParamsSetTolInnerNative(
@@ -197,6 +248,7 @@ public class JCusolverDn
         cusolverDnIRSParams params, 
         int maxiters)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsSetMaxItersNative(params, maxiters));
     }
     private static native int cusolverDnIRSParamsSetMaxItersNative(
@@ -208,6 +260,7 @@ public class JCusolverDn
         cusolverDnIRSParams params, 
         int maxiters_inner)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsSetMaxItersInnerNative(params, maxiters_inner));
     }
     private static native int cusolverDnIRSParamsSetMaxItersInnerNative(
@@ -219,6 +272,7 @@ public class JCusolverDn
         cusolverDnIRSParams params, 
         int[] maxiters)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsGetMaxItersNative(params, maxiters));
     }
     private static native int cusolverDnIRSParamsGetMaxItersNative(
@@ -229,6 +283,7 @@ public class JCusolverDn
     public static int cusolverDnIRSParamsEnableFallback(
         cusolverDnIRSParams params)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsEnableFallbackNative(params));
     }
     private static native int cusolverDnIRSParamsEnableFallbackNative(
@@ -238,6 +293,7 @@ public class JCusolverDn
     public static int cusolverDnIRSParamsDisableFallback(
         cusolverDnIRSParams params)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSParamsDisableFallbackNative(params));
     }
     private static native int cusolverDnIRSParamsDisableFallbackNative(
@@ -250,6 +306,7 @@ public class JCusolverDn
     public static int cusolverDnIRSInfosDestroy(
         cusolverDnIRSInfos infos)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSInfosDestroyNative(infos));
     }
     private static native int cusolverDnIRSInfosDestroyNative(
@@ -259,6 +316,7 @@ public class JCusolverDn
     public static int cusolverDnIRSInfosCreate(
         cusolverDnIRSInfos infos_ptr)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSInfosCreateNative(infos_ptr));
     }
     private static native int cusolverDnIRSInfosCreateNative(
@@ -269,6 +327,7 @@ public class JCusolverDn
         cusolverDnIRSInfos infos, 
         int[] niters)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSInfosGetNitersNative(infos, niters));
     }
     private static native int cusolverDnIRSInfosGetNitersNative(
@@ -280,6 +339,7 @@ public class JCusolverDn
         cusolverDnIRSInfos infos, 
         int[] outer_niters)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSInfosGetOuterNitersNative(infos, outer_niters));
     }
     private static native int cusolverDnIRSInfosGetOuterNitersNative(
@@ -290,6 +350,7 @@ public class JCusolverDn
     public static int cusolverDnIRSInfosRequestResidual(
         cusolverDnIRSInfos infos)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSInfosRequestResidualNative(infos));
     }
     private static native int cusolverDnIRSInfosRequestResidualNative(
@@ -300,6 +361,7 @@ public class JCusolverDn
         cusolverDnIRSInfos infos, 
         Pointer residual_history)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSInfosGetResidualHistoryNative(infos, residual_history));
     }
     private static native int cusolverDnIRSInfosGetResidualHistoryNative(
@@ -311,6 +373,7 @@ public class JCusolverDn
         cusolverDnIRSInfos infos, 
         int[] maxiters)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSInfosGetMaxItersNative(infos, maxiters));
     }
     private static native int cusolverDnIRSInfosGetMaxItersNative(
@@ -342,6 +405,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZZgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZZgesvNative(
@@ -377,6 +441,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZCgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZCgesvNative(
@@ -412,6 +477,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZKgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZKgesvNative(
@@ -447,6 +513,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZEgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZEgesvNative(
@@ -482,6 +549,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZYgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZYgesvNative(
@@ -517,6 +585,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCCgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnCCgesvNative(
@@ -552,6 +621,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCEgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnCEgesvNative(
@@ -587,6 +657,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCKgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnCKgesvNative(
@@ -622,6 +693,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCYgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnCYgesvNative(
@@ -657,6 +729,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDDgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDDgesvNative(
@@ -692,6 +765,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDSgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDSgesvNative(
@@ -727,6 +801,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDHgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDHgesvNative(
@@ -762,6 +837,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDBgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDBgesvNative(
@@ -797,6 +873,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDXgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDXgesvNative(
@@ -832,6 +909,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSSgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnSSgesvNative(
@@ -867,6 +945,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSHgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnSHgesvNative(
@@ -902,6 +981,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSBgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnSBgesvNative(
@@ -937,6 +1017,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSXgesvNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnSXgesvNative(
@@ -976,6 +1057,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZZgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZZgesv_bufferSizeNative(
@@ -1007,6 +1089,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZCgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZCgesv_bufferSizeNative(
@@ -1038,6 +1121,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZKgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZKgesv_bufferSizeNative(
@@ -1069,6 +1153,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZEgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZEgesv_bufferSizeNative(
@@ -1100,6 +1185,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZYgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZYgesv_bufferSizeNative(
@@ -1131,6 +1217,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCCgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnCCgesv_bufferSizeNative(
@@ -1162,6 +1249,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCKgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnCKgesv_bufferSizeNative(
@@ -1193,6 +1281,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCEgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnCEgesv_bufferSizeNative(
@@ -1224,6 +1313,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCYgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnCYgesv_bufferSizeNative(
@@ -1255,6 +1345,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDDgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDDgesv_bufferSizeNative(
@@ -1286,6 +1377,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDSgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDSgesv_bufferSizeNative(
@@ -1317,6 +1409,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDHgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDHgesv_bufferSizeNative(
@@ -1348,6 +1441,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDBgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDBgesv_bufferSizeNative(
@@ -1379,6 +1473,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDXgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDXgesv_bufferSizeNative(
@@ -1410,6 +1505,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSSgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnSSgesv_bufferSizeNative(
@@ -1441,6 +1537,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSHgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnSHgesv_bufferSizeNative(
@@ -1472,6 +1569,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSBgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnSBgesv_bufferSizeNative(
@@ -1503,6 +1601,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSXgesv_bufferSizeNative(handle, n, nrhs, dA, ldda, dipiv, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnSXgesv_bufferSizeNative(
@@ -1542,6 +1641,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZZgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZZgelsNative(
@@ -1577,6 +1677,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZCgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZCgelsNative(
@@ -1612,6 +1713,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZKgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZKgelsNative(
@@ -1647,6 +1749,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZEgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZEgelsNative(
@@ -1682,6 +1785,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZYgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnZYgelsNative(
@@ -1717,6 +1821,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCCgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnCCgelsNative(
@@ -1752,6 +1857,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCKgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnCKgelsNative(
@@ -1787,6 +1893,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCEgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnCEgelsNative(
@@ -1822,6 +1929,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCYgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnCYgelsNative(
@@ -1857,6 +1965,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDDgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDDgelsNative(
@@ -1892,6 +2001,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDSgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDSgelsNative(
@@ -1927,6 +2037,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDHgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDHgelsNative(
@@ -1962,6 +2073,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDBgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDBgelsNative(
@@ -1997,6 +2109,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDXgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnDXgelsNative(
@@ -2032,6 +2145,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSSgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnSSgelsNative(
@@ -2067,6 +2181,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSHgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnSHgelsNative(
@@ -2102,6 +2217,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSBgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnSBgelsNative(
@@ -2137,6 +2253,7 @@ public class JCusolverDn
         int[] iter, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSXgelsNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, iter, d_info));
     }
     private static native int cusolverDnSXgelsNative(
@@ -2176,6 +2293,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZZgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZZgels_bufferSizeNative(
@@ -2207,6 +2325,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZCgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZCgels_bufferSizeNative(
@@ -2238,6 +2357,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZKgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZKgels_bufferSizeNative(
@@ -2269,6 +2389,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZEgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZEgels_bufferSizeNative(
@@ -2300,6 +2421,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnZYgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnZYgels_bufferSizeNative(
@@ -2331,6 +2453,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCCgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnCCgels_bufferSizeNative(
@@ -2362,6 +2485,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCKgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnCKgels_bufferSizeNative(
@@ -2393,6 +2517,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCEgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnCEgels_bufferSizeNative(
@@ -2424,6 +2549,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnCYgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnCYgels_bufferSizeNative(
@@ -2455,6 +2581,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDDgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDDgels_bufferSizeNative(
@@ -2486,6 +2613,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDSgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDSgels_bufferSizeNative(
@@ -2517,6 +2645,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDHgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDHgels_bufferSizeNative(
@@ -2548,6 +2677,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDBgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDBgels_bufferSizeNative(
@@ -2579,6 +2709,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnDXgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnDXgels_bufferSizeNative(
@@ -2610,6 +2741,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSSgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnSSgels_bufferSizeNative(
@@ -2641,6 +2773,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSHgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnSHgels_bufferSizeNative(
@@ -2672,6 +2805,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSBgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnSBgels_bufferSizeNative(
@@ -2703,6 +2837,7 @@ public class JCusolverDn
         Pointer dWorkspace, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnSXgels_bufferSizeNative(handle, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes));
     }
     private static native int cusolverDnSXgels_bufferSizeNative(
@@ -2743,6 +2878,7 @@ public class JCusolverDn
         int[] niters, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSXgesvNative(handle, gesv_irs_params, gesv_irs_infos, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, niters, d_info));
     }
     private static native int cusolverDnIRSXgesvNative(
@@ -2770,6 +2906,7 @@ public class JCusolverDn
         int nrhs, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSXgesv_bufferSizeNative(handle, params, n, nrhs, lwork_bytes));
     }
     private static native int cusolverDnIRSXgesv_bufferSizeNative(
@@ -2798,6 +2935,7 @@ public class JCusolverDn
         int[] niters, 
         Pointer d_info)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSXgelsNative(handle, gels_irs_params, gels_irs_infos, m, n, nrhs, dA, ldda, dB, lddb, dX, lddx, dWorkspace, lwork_bytes, niters, d_info));
     }
     private static native int cusolverDnIRSXgelsNative(
@@ -2827,6 +2965,7 @@ public class JCusolverDn
         int nrhs, 
         long[] lwork_bytes)
     {
+        IrsLibrary.load();
         return checkResult(cusolverDnIRSXgels_bufferSizeNative(handle, params, m, n, nrhs, lwork_bytes));
     }
     private static native int cusolverDnIRSXgels_bufferSizeNative(
@@ -5143,6 +5282,7 @@ public class JCusolverDn
         int n, 
         int[] Lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgebrd_bufferSizeNative(handle, m, n, Lwork));
     }
     private static native int cusolverDnSgebrd_bufferSizeNative(
@@ -5158,6 +5298,7 @@ public class JCusolverDn
         int n, 
         int[] Lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgebrd_bufferSizeNative(handle, m, n, Lwork));
     }
     private static native int cusolverDnDgebrd_bufferSizeNative(
@@ -5173,6 +5314,7 @@ public class JCusolverDn
         int n, 
         int[] Lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgebrd_bufferSizeNative(handle, m, n, Lwork));
     }
     private static native int cusolverDnCgebrd_bufferSizeNative(
@@ -5188,6 +5330,7 @@ public class JCusolverDn
         int n, 
         int[] Lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgebrd_bufferSizeNative(handle, m, n, Lwork));
     }
     private static native int cusolverDnZgebrd_bufferSizeNative(
@@ -5211,6 +5354,7 @@ public class JCusolverDn
         int Lwork, 
         Pointer devInfo)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgebrdNative(handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo));
     }
     private static native int cusolverDnSgebrdNative(
@@ -5242,6 +5386,7 @@ public class JCusolverDn
         int Lwork, 
         Pointer devInfo)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgebrdNative(handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo));
     }
     private static native int cusolverDnDgebrdNative(
@@ -5273,6 +5418,7 @@ public class JCusolverDn
         int Lwork, 
         Pointer devInfo)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgebrdNative(handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo));
     }
     private static native int cusolverDnCgebrdNative(
@@ -5304,6 +5450,7 @@ public class JCusolverDn
         int Lwork, 
         Pointer devInfo)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgebrdNative(handle, m, n, A, lda, D, E, TAUQ, TAUP, Work, Lwork, devInfo));
     }
     private static native int cusolverDnZgebrdNative(
@@ -5333,6 +5480,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSorgbr_bufferSizeNative(handle, side, m, n, k, A, lda, tau, lwork));
     }
     private static native int cusolverDnSorgbr_bufferSizeNative(
@@ -5358,6 +5506,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDorgbr_bufferSizeNative(handle, side, m, n, k, A, lda, tau, lwork));
     }
     private static native int cusolverDnDorgbr_bufferSizeNative(
@@ -5383,6 +5532,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCungbr_bufferSizeNative(handle, side, m, n, k, A, lda, tau, lwork));
     }
     private static native int cusolverDnCungbr_bufferSizeNative(
@@ -5408,6 +5558,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZungbr_bufferSizeNative(handle, side, m, n, k, A, lda, tau, lwork));
     }
     private static native int cusolverDnZungbr_bufferSizeNative(
@@ -5435,6 +5586,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSorgbrNative(handle, side, m, n, k, A, lda, tau, work, lwork, info));
     }
     private static native int cusolverDnSorgbrNative(
@@ -5464,6 +5616,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDorgbrNative(handle, side, m, n, k, A, lda, tau, work, lwork, info));
     }
     private static native int cusolverDnDorgbrNative(
@@ -5493,6 +5646,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCungbrNative(handle, side, m, n, k, A, lda, tau, work, lwork, info));
     }
     private static native int cusolverDnCungbrNative(
@@ -5522,6 +5676,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZungbrNative(handle, side, m, n, k, A, lda, tau, work, lwork, info));
     }
     private static native int cusolverDnZungbrNative(
@@ -5550,6 +5705,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsytrd_bufferSizeNative(handle, uplo, n, A, lda, d, e, tau, lwork));
     }
     private static native int cusolverDnSsytrd_bufferSizeNative(
@@ -5575,6 +5731,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsytrd_bufferSizeNative(handle, uplo, n, A, lda, d, e, tau, lwork));
     }
     private static native int cusolverDnDsytrd_bufferSizeNative(
@@ -5600,6 +5757,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnChetrd_bufferSizeNative(handle, uplo, n, A, lda, d, e, tau, lwork));
     }
     private static native int cusolverDnChetrd_bufferSizeNative(
@@ -5625,6 +5783,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZhetrd_bufferSizeNative(handle, uplo, n, A, lda, d, e, tau, lwork));
     }
     private static native int cusolverDnZhetrd_bufferSizeNative(
@@ -5652,6 +5811,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsytrdNative(handle, uplo, n, A, lda, d, e, tau, work, lwork, info));
     }
     private static native int cusolverDnSsytrdNative(
@@ -5681,6 +5841,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsytrdNative(handle, uplo, n, A, lda, d, e, tau, work, lwork, info));
     }
     private static native int cusolverDnDsytrdNative(
@@ -5710,6 +5871,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnChetrdNative(handle, uplo, n, A, lda, d, e, tau, work, lwork, info));
     }
     private static native int cusolverDnChetrdNative(
@@ -5739,6 +5901,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZhetrdNative(handle, uplo, n, A, lda, d, e, tau, work, lwork, info));
     }
     private static native int cusolverDnZhetrdNative(
@@ -5765,6 +5928,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSorgtr_bufferSizeNative(handle, uplo, n, A, lda, tau, lwork));
     }
     private static native int cusolverDnSorgtr_bufferSizeNative(
@@ -5786,6 +5950,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDorgtr_bufferSizeNative(handle, uplo, n, A, lda, tau, lwork));
     }
     private static native int cusolverDnDorgtr_bufferSizeNative(
@@ -5807,6 +5972,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCungtr_bufferSizeNative(handle, uplo, n, A, lda, tau, lwork));
     }
     private static native int cusolverDnCungtr_bufferSizeNative(
@@ -5828,6 +5994,7 @@ public class JCusolverDn
         Pointer tau, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZungtr_bufferSizeNative(handle, uplo, n, A, lda, tau, lwork));
     }
     private static native int cusolverDnZungtr_bufferSizeNative(
@@ -5851,6 +6018,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSorgtrNative(handle, uplo, n, A, lda, tau, work, lwork, info));
     }
     private static native int cusolverDnSorgtrNative(
@@ -5876,6 +6044,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDorgtrNative(handle, uplo, n, A, lda, tau, work, lwork, info));
     }
     private static native int cusolverDnDorgtrNative(
@@ -5901,6 +6070,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCungtrNative(handle, uplo, n, A, lda, tau, work, lwork, info));
     }
     private static native int cusolverDnCungtrNative(
@@ -5926,6 +6096,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZungtrNative(handle, uplo, n, A, lda, tau, work, lwork, info));
     }
     private static native int cusolverDnZungtrNative(
@@ -5955,6 +6126,7 @@ public class JCusolverDn
         int ldc, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSormtr_bufferSizeNative(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork));
     }
     private static native int cusolverDnSormtr_bufferSizeNative(
@@ -5986,6 +6158,7 @@ public class JCusolverDn
         int ldc, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDormtr_bufferSizeNative(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork));
     }
     private static native int cusolverDnDormtr_bufferSizeNative(
@@ -6017,6 +6190,7 @@ public class JCusolverDn
         int ldc, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCunmtr_bufferSizeNative(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork));
     }
     private static native int cusolverDnCunmtr_bufferSizeNative(
@@ -6048,6 +6222,7 @@ public class JCusolverDn
         int ldc, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZunmtr_bufferSizeNative(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork));
     }
     private static native int cusolverDnZunmtr_bufferSizeNative(
@@ -6081,6 +6256,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSormtrNative(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info));
     }
     private static native int cusolverDnSormtrNative(
@@ -6116,6 +6292,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDormtrNative(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info));
     }
     private static native int cusolverDnDormtrNative(
@@ -6151,6 +6328,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCunmtrNative(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info));
     }
     private static native int cusolverDnCunmtrNative(
@@ -6186,6 +6364,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZunmtrNative(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info));
     }
     private static native int cusolverDnZunmtrNative(
@@ -6212,6 +6391,7 @@ public class JCusolverDn
         int n, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgesvd_bufferSizeNative(handle, m, n, lwork));
     }
     private static native int cusolverDnSgesvd_bufferSizeNative(
@@ -6227,6 +6407,7 @@ public class JCusolverDn
         int n, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgesvd_bufferSizeNative(handle, m, n, lwork));
     }
     private static native int cusolverDnDgesvd_bufferSizeNative(
@@ -6242,6 +6423,7 @@ public class JCusolverDn
         int n, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgesvd_bufferSizeNative(handle, m, n, lwork));
     }
     private static native int cusolverDnCgesvd_bufferSizeNative(
@@ -6257,6 +6439,7 @@ public class JCusolverDn
         int n, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgesvd_bufferSizeNative(handle, m, n, lwork));
     }
     private static native int cusolverDnZgesvd_bufferSizeNative(
@@ -6284,6 +6467,7 @@ public class JCusolverDn
         Pointer rwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgesvdNative(handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info));
     }
     private static native int cusolverDnSgesvdNative(
@@ -6323,6 +6507,7 @@ public class JCusolverDn
         Pointer rwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgesvdNative(handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info));
     }
     private static native int cusolverDnDgesvdNative(
@@ -6362,6 +6547,7 @@ public class JCusolverDn
         Pointer rwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgesvdNative(handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info));
     }
     private static native int cusolverDnCgesvdNative(
@@ -6401,6 +6587,7 @@ public class JCusolverDn
         Pointer rwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgesvdNative(handle, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work, lwork, rwork, info));
     }
     private static native int cusolverDnZgesvdNative(
@@ -6434,6 +6621,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsyevd_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork));
     }
     private static native int cusolverDnSsyevd_bufferSizeNative(
@@ -6457,6 +6645,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsyevd_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork));
     }
     private static native int cusolverDnDsyevd_bufferSizeNative(
@@ -6480,6 +6669,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCheevd_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork));
     }
     private static native int cusolverDnCheevd_bufferSizeNative(
@@ -6503,6 +6693,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZheevd_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork));
     }
     private static native int cusolverDnZheevd_bufferSizeNative(
@@ -6528,6 +6719,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsyevdNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info));
     }
     private static native int cusolverDnSsyevdNative(
@@ -6555,6 +6747,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsyevdNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info));
     }
     private static native int cusolverDnDsyevdNative(
@@ -6582,6 +6775,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCheevdNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info));
     }
     private static native int cusolverDnCheevdNative(
@@ -6609,6 +6803,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZheevdNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info));
     }
     private static native int cusolverDnZheevdNative(
@@ -6642,6 +6837,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsyevdx_bufferSizeNative(handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork));
     }
     private static native int cusolverDnSsyevdx_bufferSizeNative(
@@ -6677,6 +6873,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsyevdx_bufferSizeNative(handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork));
     }
     private static native int cusolverDnDsyevdx_bufferSizeNative(
@@ -6712,6 +6909,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCheevdx_bufferSizeNative(handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork));
     }
     private static native int cusolverDnCheevdx_bufferSizeNative(
@@ -6747,6 +6945,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZheevdx_bufferSizeNative(handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, lwork));
     }
     private static native int cusolverDnZheevdx_bufferSizeNative(
@@ -6784,6 +6983,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsyevdxNative(handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info));
     }
     private static native int cusolverDnSsyevdxNative(
@@ -6823,6 +7023,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsyevdxNative(handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info));
     }
     private static native int cusolverDnDsyevdxNative(
@@ -6862,6 +7063,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCheevdxNative(handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info));
     }
     private static native int cusolverDnCheevdxNative(
@@ -6901,6 +7103,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZheevdxNative(handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, meig, W, work, lwork, info));
     }
     private static native int cusolverDnZheevdxNative(
@@ -6943,6 +7146,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsygvdx_bufferSizeNative(handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork));
     }
     private static native int cusolverDnSsygvdx_bufferSizeNative(
@@ -6984,6 +7188,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsygvdx_bufferSizeNative(handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork));
     }
     private static native int cusolverDnDsygvdx_bufferSizeNative(
@@ -7025,6 +7230,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnChegvdx_bufferSizeNative(handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork));
     }
     private static native int cusolverDnChegvdx_bufferSizeNative(
@@ -7066,6 +7272,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZhegvdx_bufferSizeNative(handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, lwork));
     }
     private static native int cusolverDnZhegvdx_bufferSizeNative(
@@ -7109,6 +7316,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsygvdxNative(handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info));
     }
     private static native int cusolverDnSsygvdxNative(
@@ -7154,6 +7362,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsygvdxNative(handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info));
     }
     private static native int cusolverDnDsygvdxNative(
@@ -7199,6 +7408,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnChegvdxNative(handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info));
     }
     private static native int cusolverDnChegvdxNative(
@@ -7244,6 +7454,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZhegvdxNative(handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, meig, W, work, lwork, info));
     }
     private static native int cusolverDnZhegvdxNative(
@@ -7283,6 +7494,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsygvd_bufferSizeNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork));
     }
     private static native int cusolverDnSsygvd_bufferSizeNative(
@@ -7312,6 +7524,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsygvd_bufferSizeNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork));
     }
     private static native int cusolverDnDsygvd_bufferSizeNative(
@@ -7341,6 +7554,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnChegvd_bufferSizeNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork));
     }
     private static native int cusolverDnChegvd_bufferSizeNative(
@@ -7370,6 +7584,7 @@ public class JCusolverDn
         Pointer W, 
         int[] lwork)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZhegvd_bufferSizeNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork));
     }
     private static native int cusolverDnZhegvd_bufferSizeNative(
@@ -7401,6 +7616,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsygvdNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info));
     }
     private static native int cusolverDnSsygvdNative(
@@ -7434,6 +7650,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsygvdNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info));
     }
     private static native int cusolverDnDsygvdNative(
@@ -7467,6 +7684,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnChegvdNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info));
     }
     private static native int cusolverDnChegvdNative(
@@ -7500,6 +7718,7 @@ public class JCusolverDn
         int lwork, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZhegvdNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info));
     }
     private static native int cusolverDnZhegvdNative(
@@ -7521,6 +7740,7 @@ public class JCusolverDn
     public static int cusolverDnCreateSyevjInfo(
         syevjInfo info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCreateSyevjInfoNative(info));
     }
     private static native int cusolverDnCreateSyevjInfoNative(
@@ -7530,6 +7750,7 @@ public class JCusolverDn
     public static int cusolverDnDestroySyevjInfo(
         syevjInfo info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDestroySyevjInfoNative(info));
     }
     private static native int cusolverDnDestroySyevjInfoNative(
@@ -7540,6 +7761,7 @@ public class JCusolverDn
         syevjInfo info, 
         double tolerance)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevjSetToleranceNative(info, tolerance));
     }
     private static native int cusolverDnXsyevjSetToleranceNative(
@@ -7551,6 +7773,7 @@ public class JCusolverDn
         syevjInfo info, 
         int max_sweeps)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevjSetMaxSweepsNative(info, max_sweeps));
     }
     private static native int cusolverDnXsyevjSetMaxSweepsNative(
@@ -7562,6 +7785,7 @@ public class JCusolverDn
         syevjInfo info, 
         int sort_eig)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevjSetSortEigNative(info, sort_eig));
     }
     private static native int cusolverDnXsyevjSetSortEigNative(
@@ -7574,6 +7798,7 @@ public class JCusolverDn
         syevjInfo info, 
         Pointer residual)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevjGetResidualNative(handle, info, residual));
     }
     private static native int cusolverDnXsyevjGetResidualNative(
@@ -7587,6 +7812,7 @@ public class JCusolverDn
         syevjInfo info, 
         Pointer executed_sweeps)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevjGetSweepsNative(handle, info, executed_sweeps));
     }
     private static native int cusolverDnXsyevjGetSweepsNative(
@@ -7607,6 +7833,7 @@ public class JCusolverDn
         syevjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsyevjBatched_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize));
     }
     private static native int cusolverDnSsyevjBatched_bufferSizeNative(
@@ -7634,6 +7861,7 @@ public class JCusolverDn
         syevjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsyevjBatched_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize));
     }
     private static native int cusolverDnDsyevjBatched_bufferSizeNative(
@@ -7661,6 +7889,7 @@ public class JCusolverDn
         syevjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCheevjBatched_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize));
     }
     private static native int cusolverDnCheevjBatched_bufferSizeNative(
@@ -7688,6 +7917,7 @@ public class JCusolverDn
         syevjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZheevjBatched_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork, params, batchSize));
     }
     private static native int cusolverDnZheevjBatched_bufferSizeNative(
@@ -7717,6 +7947,7 @@ public class JCusolverDn
         syevjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsyevjBatchedNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize));
     }
     private static native int cusolverDnSsyevjBatchedNative(
@@ -7748,6 +7979,7 @@ public class JCusolverDn
         syevjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsyevjBatchedNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize));
     }
     private static native int cusolverDnDsyevjBatchedNative(
@@ -7779,6 +8011,7 @@ public class JCusolverDn
         syevjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCheevjBatchedNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize));
     }
     private static native int cusolverDnCheevjBatchedNative(
@@ -7810,6 +8043,7 @@ public class JCusolverDn
         syevjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZheevjBatchedNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batchSize));
     }
     private static native int cusolverDnZheevjBatchedNative(
@@ -7838,6 +8072,7 @@ public class JCusolverDn
         int[] lwork, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsyevj_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork, params));
     }
     private static native int cusolverDnSsyevj_bufferSizeNative(
@@ -7863,6 +8098,7 @@ public class JCusolverDn
         int[] lwork, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsyevj_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork, params));
     }
     private static native int cusolverDnDsyevj_bufferSizeNative(
@@ -7888,6 +8124,7 @@ public class JCusolverDn
         int[] lwork, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCheevj_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork, params));
     }
     private static native int cusolverDnCheevj_bufferSizeNative(
@@ -7913,6 +8150,7 @@ public class JCusolverDn
         int[] lwork, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZheevj_bufferSizeNative(handle, jobz, uplo, n, A, lda, W, lwork, params));
     }
     private static native int cusolverDnZheevj_bufferSizeNative(
@@ -7940,6 +8178,7 @@ public class JCusolverDn
         Pointer info, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsyevjNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params));
     }
     private static native int cusolverDnSsyevjNative(
@@ -7969,6 +8208,7 @@ public class JCusolverDn
         Pointer info, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsyevjNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params));
     }
     private static native int cusolverDnDsyevjNative(
@@ -7998,6 +8238,7 @@ public class JCusolverDn
         Pointer info, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCheevjNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params));
     }
     private static native int cusolverDnCheevjNative(
@@ -8027,6 +8268,7 @@ public class JCusolverDn
         Pointer info, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZheevjNative(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params));
     }
     private static native int cusolverDnZheevjNative(
@@ -8057,6 +8299,7 @@ public class JCusolverDn
         int[] lwork, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsygvj_bufferSizeNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params));
     }
     private static native int cusolverDnSsygvj_bufferSizeNative(
@@ -8088,6 +8331,7 @@ public class JCusolverDn
         int[] lwork, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsygvj_bufferSizeNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params));
     }
     private static native int cusolverDnDsygvj_bufferSizeNative(
@@ -8119,6 +8363,7 @@ public class JCusolverDn
         int[] lwork, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnChegvj_bufferSizeNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params));
     }
     private static native int cusolverDnChegvj_bufferSizeNative(
@@ -8150,6 +8395,7 @@ public class JCusolverDn
         int[] lwork, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZhegvj_bufferSizeNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params));
     }
     private static native int cusolverDnZhegvj_bufferSizeNative(
@@ -8183,6 +8429,7 @@ public class JCusolverDn
         Pointer info, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSsygvjNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params));
     }
     private static native int cusolverDnSsygvjNative(
@@ -8218,6 +8465,7 @@ public class JCusolverDn
         Pointer info, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDsygvjNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params));
     }
     private static native int cusolverDnDsygvjNative(
@@ -8253,6 +8501,7 @@ public class JCusolverDn
         Pointer info, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnChegvjNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params));
     }
     private static native int cusolverDnChegvjNative(
@@ -8288,6 +8537,7 @@ public class JCusolverDn
         Pointer info, 
         syevjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZhegvjNative(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params));
     }
     private static native int cusolverDnZhegvjNative(
@@ -8310,6 +8560,7 @@ public class JCusolverDn
     public static int cusolverDnCreateGesvdjInfo(
         gesvdjInfo info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCreateGesvdjInfoNative(info));
     }
     private static native int cusolverDnCreateGesvdjInfoNative(
@@ -8319,6 +8570,7 @@ public class JCusolverDn
     public static int cusolverDnDestroyGesvdjInfo(
         gesvdjInfo info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDestroyGesvdjInfoNative(info));
     }
     private static native int cusolverDnDestroyGesvdjInfoNative(
@@ -8329,6 +8581,7 @@ public class JCusolverDn
         gesvdjInfo info, 
         double tolerance)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdjSetToleranceNative(info, tolerance));
     }
     private static native int cusolverDnXgesvdjSetToleranceNative(
@@ -8340,6 +8593,7 @@ public class JCusolverDn
         gesvdjInfo info, 
         int max_sweeps)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdjSetMaxSweepsNative(info, max_sweeps));
     }
     private static native int cusolverDnXgesvdjSetMaxSweepsNative(
@@ -8351,6 +8605,7 @@ public class JCusolverDn
         gesvdjInfo info, 
         int sort_svd)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdjSetSortEigNative(info, sort_svd));
     }
     private static native int cusolverDnXgesvdjSetSortEigNative(
@@ -8363,6 +8618,7 @@ public class JCusolverDn
         gesvdjInfo info, 
         Pointer residual)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdjGetResidualNative(handle, info, residual));
     }
     private static native int cusolverDnXgesvdjGetResidualNative(
@@ -8376,6 +8632,7 @@ public class JCusolverDn
         gesvdjInfo info, 
         Pointer executed_sweeps)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdjGetSweepsNative(handle, info, executed_sweeps));
     }
     private static native int cusolverDnXgesvdjGetSweepsNative(
@@ -8400,6 +8657,7 @@ public class JCusolverDn
         gesvdjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgesvdjBatched_bufferSizeNative(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize));
     }
     private static native int cusolverDnSgesvdjBatched_bufferSizeNative(
@@ -8435,6 +8693,7 @@ public class JCusolverDn
         gesvdjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgesvdjBatched_bufferSizeNative(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize));
     }
     private static native int cusolverDnDgesvdjBatched_bufferSizeNative(
@@ -8470,6 +8729,7 @@ public class JCusolverDn
         gesvdjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgesvdjBatched_bufferSizeNative(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize));
     }
     private static native int cusolverDnCgesvdjBatched_bufferSizeNative(
@@ -8505,6 +8765,7 @@ public class JCusolverDn
         gesvdjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgesvdjBatched_bufferSizeNative(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, batchSize));
     }
     private static native int cusolverDnZgesvdjBatched_bufferSizeNative(
@@ -8542,6 +8803,7 @@ public class JCusolverDn
         gesvdjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgesvdjBatchedNative(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize));
     }
     private static native int cusolverDnSgesvdjBatchedNative(
@@ -8581,6 +8843,7 @@ public class JCusolverDn
         gesvdjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgesvdjBatchedNative(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize));
     }
     private static native int cusolverDnDgesvdjBatchedNative(
@@ -8620,6 +8883,7 @@ public class JCusolverDn
         gesvdjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgesvdjBatchedNative(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize));
     }
     private static native int cusolverDnCgesvdjBatchedNative(
@@ -8659,6 +8923,7 @@ public class JCusolverDn
         gesvdjInfo params, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgesvdjBatchedNative(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, batchSize));
     }
     private static native int cusolverDnZgesvdjBatchedNative(
@@ -8696,6 +8961,7 @@ public class JCusolverDn
         int[] lwork, 
         gesvdjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgesvdj_bufferSizeNative(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params));
     }
     private static native int cusolverDnSgesvdj_bufferSizeNative(
@@ -8731,6 +8997,7 @@ public class JCusolverDn
         int[] lwork, 
         gesvdjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgesvdj_bufferSizeNative(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params));
     }
     private static native int cusolverDnDgesvdj_bufferSizeNative(
@@ -8766,6 +9033,7 @@ public class JCusolverDn
         int[] lwork, 
         gesvdjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgesvdj_bufferSizeNative(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params));
     }
     private static native int cusolverDnCgesvdj_bufferSizeNative(
@@ -8801,6 +9069,7 @@ public class JCusolverDn
         int[] lwork, 
         gesvdjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgesvdj_bufferSizeNative(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params));
     }
     private static native int cusolverDnZgesvdj_bufferSizeNative(
@@ -8838,6 +9107,7 @@ public class JCusolverDn
         Pointer info, 
         gesvdjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgesvdjNative(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params));
     }
     private static native int cusolverDnSgesvdjNative(
@@ -8877,6 +9147,7 @@ public class JCusolverDn
         Pointer info, 
         gesvdjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgesvdjNative(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params));
     }
     private static native int cusolverDnDgesvdjNative(
@@ -8916,6 +9187,7 @@ public class JCusolverDn
         Pointer info, 
         gesvdjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgesvdjNative(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params));
     }
     private static native int cusolverDnCgesvdjNative(
@@ -8955,6 +9227,7 @@ public class JCusolverDn
         Pointer info, 
         gesvdjInfo params)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgesvdjNative(handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params));
     }
     private static native int cusolverDnZgesvdjNative(
@@ -8997,6 +9270,7 @@ public class JCusolverDn
         int[] lwork, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgesvdaStridedBatched_bufferSizeNative(handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize));
     }
     private static native int cusolverDnSgesvdaStridedBatched_bufferSizeNative(
@@ -9040,6 +9314,7 @@ public class JCusolverDn
         int[] lwork, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgesvdaStridedBatched_bufferSizeNative(handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize));
     }
     private static native int cusolverDnDgesvdaStridedBatched_bufferSizeNative(
@@ -9083,6 +9358,7 @@ public class JCusolverDn
         int[] lwork, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgesvdaStridedBatched_bufferSizeNative(handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize));
     }
     private static native int cusolverDnCgesvdaStridedBatched_bufferSizeNative(
@@ -9126,6 +9402,7 @@ public class JCusolverDn
         int[] lwork, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgesvdaStridedBatched_bufferSizeNative(handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, lwork, batchSize));
     }
     private static native int cusolverDnZgesvdaStridedBatched_bufferSizeNative(
@@ -9172,6 +9449,7 @@ public class JCusolverDn
         Pointer h_R_nrmF, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSgesvdaStridedBatchedNative(handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize));
     }
     private static native int cusolverDnSgesvdaStridedBatchedNative(
@@ -9221,6 +9499,7 @@ public class JCusolverDn
         Pointer h_R_nrmF, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnDgesvdaStridedBatchedNative(handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize));
     }
     private static native int cusolverDnDgesvdaStridedBatchedNative(
@@ -9270,6 +9549,7 @@ public class JCusolverDn
         Pointer h_R_nrmF, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnCgesvdaStridedBatchedNative(handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize));
     }
     private static native int cusolverDnCgesvdaStridedBatchedNative(
@@ -9319,6 +9599,7 @@ public class JCusolverDn
         Pointer h_R_nrmF, 
         int batchSize)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnZgesvdaStridedBatchedNative(handle, jobz, rank, m, n, d_A, lda, strideA, d_S, strideS, d_U, ldu, strideU, d_V, ldv, strideV, d_work, lwork, d_info, h_R_nrmF, batchSize));
     }
     private static native int cusolverDnZgesvdaStridedBatchedNative(
@@ -9632,6 +9913,7 @@ public class JCusolverDn
         int computeType, 
         long[] workspaceInBytes)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSyevd_bufferSizeNative(handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, workspaceInBytes));
     }
     private static native int cusolverDnSyevd_bufferSizeNative(
@@ -9665,6 +9947,7 @@ public class JCusolverDn
         long workspaceInBytes, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSyevdNative(handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, pBuffer, workspaceInBytes, info));
     }
     private static native int cusolverDnSyevdNative(
@@ -9705,6 +9988,7 @@ public class JCusolverDn
         int computeType, 
         long[] workspaceInBytes)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSyevdx_bufferSizeNative(handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, h_meig, dataTypeW, W, computeType, workspaceInBytes));
     }
     private static native int cusolverDnSyevdx_bufferSizeNative(
@@ -9750,6 +10034,7 @@ public class JCusolverDn
         long workspaceInBytes, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnSyevdxNative(handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, meig64, dataTypeW, W, computeType, pBuffer, workspaceInBytes, info));
     }
     private static native int cusolverDnSyevdxNative(
@@ -9797,6 +10082,7 @@ public class JCusolverDn
         int computeType, 
         long[] workspaceInBytes)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnGesvd_bufferSizeNative(handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, workspaceInBytes));
     }
     private static native int cusolverDnGesvd_bufferSizeNative(
@@ -9844,6 +10130,7 @@ public class JCusolverDn
         long workspaceInBytes, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnGesvdNative(handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, pBuffer, workspaceInBytes, info));
     }
     private static native int cusolverDnGesvdNative(
@@ -10148,6 +10435,7 @@ public class JCusolverDn
         long[] workspaceInBytesOnDevice, 
         long[] workspaceInBytesOnHost)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevd_bufferSizeNative(handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost));
     }
     private static native int cusolverDnXsyevd_bufferSizeNative(
@@ -10184,6 +10472,7 @@ public class JCusolverDn
         long workspaceInBytesOnHost, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevdNative(handle, params, jobz, uplo, n, dataTypeA, A, lda, dataTypeW, W, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info));
     }
     private static native int cusolverDnXsyevdNative(
@@ -10227,6 +10516,7 @@ public class JCusolverDn
         long[] workspaceInBytesOnDevice, 
         long[] workspaceInBytesOnHost)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevdx_bufferSizeNative(handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, h_meig, dataTypeW, W, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost));
     }
     private static native int cusolverDnXsyevdx_bufferSizeNative(
@@ -10275,6 +10565,7 @@ public class JCusolverDn
         long workspaceInBytesOnHost, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXsyevdxNative(handle, params, jobz, range, uplo, n, dataTypeA, A, lda, vl, vu, il, iu, meig64, dataTypeW, W, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info));
     }
     private static native int cusolverDnXsyevdxNative(
@@ -10325,6 +10616,7 @@ public class JCusolverDn
         long[] workspaceInBytesOnDevice, 
         long[] workspaceInBytesOnHost)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvd_bufferSizeNative(handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost));
     }
     private static native int cusolverDnXgesvd_bufferSizeNative(
@@ -10375,6 +10667,7 @@ public class JCusolverDn
         long workspaceInBytesOnHost, 
         Pointer info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdNative(handle, params, jobu, jobvt, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeVT, VT, ldvt, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, info));
     }
     private static native int cusolverDnXgesvdNative(
@@ -10426,6 +10719,7 @@ public class JCusolverDn
         long[] workspaceInBytesOnDevice, 
         long[] workspaceInBytesOnHost)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdp_bufferSizeNative(handle, params, jobz, econ, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeV, V, ldv, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost));
     }
     private static native int cusolverDnXgesvdp_bufferSizeNative(
@@ -10477,6 +10771,7 @@ public class JCusolverDn
         Pointer d_info, 
         Pointer h_err_sigma)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdpNative(handle, params, jobz, econ, m, n, dataTypeA, A, lda, dataTypeS, S, dataTypeU, U, ldu, dataTypeV, V, ldv, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, d_info, h_err_sigma));
     }
     private static native int cusolverDnXgesvdpNative(
@@ -10531,6 +10826,7 @@ public class JCusolverDn
         long[] workspaceInBytesOnDevice, 
         long[] workspaceInBytesOnHost)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdr_bufferSizeNative(handle, params, jobu, jobv, m, n, k, p, niters, dataTypeA, A, lda, dataTypeSrand, Srand, dataTypeUrand, Urand, ldUrand, dataTypeVrand, Vrand, ldVrand, computeType, workspaceInBytesOnDevice, workspaceInBytesOnHost));
     }
     private static native int cusolverDnXgesvdr_bufferSizeNative(
@@ -10587,6 +10883,7 @@ public class JCusolverDn
         long workspaceInBytesOnHost, 
         Pointer d_info)
     {
+        EigenLibrary.load();
         return checkResult(cusolverDnXgesvdrNative(handle, params, jobu, jobv, m, n, k, p, niters, dataTypeA, A, lda, dataTypeSrand, Srand, dataTypeUrand, Urand, ldUrand, dataTypeVrand, Vrand, ldVrand, computeType, bufferOnDevice, workspaceInBytesOnDevice, bufferOnHost, workspaceInBytesOnHost, d_info));
     }
     private static native int cusolverDnXgesvdrNative(
@@ -44,7 +44,8 @@ public class JCusolverMg
     
     static
     {
-        JCusolver.initialize();
+        JCusolver.loadFamilyLibrary("JCusolverMg");
+        JCusolver.initialize(JCusolver.INIT_POINTER_FIELDS);
     }
     
     /**
@@ -43,7 +43,8 @@ public class JCusolverRf
     
     static
     {
-        JCusolver.initialize();
+        JCusolver.loadFamilyLibrary("JCusolverRf");
+        JCusolver.initialize(JCusolver.INIT_POINTER_FIELDS);
     }
     
     /**
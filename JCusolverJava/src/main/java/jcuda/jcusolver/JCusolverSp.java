@@ -45,7 +45,9 @@ public class JCusolverSp
     
     static
     {
-        JCusolver.initialize();
+        JCusolver.loadFamilyLibrary("JCusolverSp");
+        JCusolver.initialize(JCusolver.INIT_POINTER_FIELDS | 
+            JCusolver.INIT_COMPLEX_FIELDS);
     }
     
     /**
@@ -1714,6 +1716,29 @@ public class JCusolverSp
     {
         return checkResult(cusolverSpDcsrqrBufferInfoBatchedNative(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes));
     }
+
+    /**
+     * Calls cusolverSpDcsrqrBufferInfoBatched and returns the status 
+     * without passing it to the exception check, so that the caller 
+     * can handle a failure, independent of the exceptions setting of 
+     * other threads.
+     */
+    static int cusolverSpDcsrqrBufferInfoBatchedUnchecked(
+        cusolverSpHandle handle, 
+        int m, 
+        int n, 
+        int nnz, 
+        cusparseMatDescr descrA, 
+        Pointer csrVal, 
+        Pointer csrRowPtr, 
+        Pointer csrColInd, 
+        int batchSize, 
+        csrqrInfo info, 
+        long[] internalDataInBytes, 
+        long[] workspaceInBytes)
+    {
+        return cusolverSpDcsrqrBufferInfoBatchedNative(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, batchSize, info, internalDataInBytes, workspaceInBytes);
+    }
     private static native int cusolverSpDcsrqrBufferInfoBatchedNative(
         cusolverSpHandle handle, 
         int m, 
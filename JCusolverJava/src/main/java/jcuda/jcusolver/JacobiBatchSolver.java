@@ -0,0 +1,418 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.DeviceMemory.allocate;
+import static jcuda.jcusolver.DeviceMemory.copy;
+import static jcuda.jcusolver.DeviceMemory.free;
+import static jcuda.jcusolver.JCusolver.checkCudaSuccess;
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyDeviceToHost;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyHostToDevice;
+
+import java.util.List;
+
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.runtime.JCuda;
+
+/**
+ * A front-end for the batched Jacobi eigenvalue and singular value 
+ * solvers that accepts matrices of different sizes. <br>
+ * <br>
+ * The batched functions cusolverDnDsyevjBatched and 
+ * cusolverDnDgesvdjBatched require all matrices of a batch to have 
+ * the same size. This class groups the given matrices into buckets 
+ * according to a {@link BatchBucketing}, pads them to the size of 
+ * their bucket, issues one batched call per bucket, and scatters the 
+ * results back into the per-matrix outputs. Matrices that are too 
+ * large for the batched functions are solved individually. <br>
+ * <br>
+ * The matrices are given as host arrays in column-major order, with 
+ * the leading dimension being the number of rows. The results are 
+ * always sorted: Eigenvalues in ascending order, and singular values 
+ * in descending order.<br>
+ * <br>
+ * Instances of this class are not thread-safe. 
+ */
+public class JacobiBatchSolver
+{
+    /**
+     * The cublasFillMode for the lower triangle. All matrices are 
+     * padded completely, so the fill mode does not matter, but 
+     * this avoids a dependency to JCublas.
+     */
+    private static final int CUBLAS_FILL_MODE_LOWER = 0;
+    
+    /**
+     * The handle
+     */
+    private final cusolverDnHandle handle;
+    
+    /**
+     * The bucketing
+     */
+    private final BatchBucketing bucketing;
+    
+    /**
+     * The parameters for the Jacobi method, with sorting enabled
+     */
+    private final JacobiParameters parameters;
+    
+    /**
+     * The pool for the syevjInfo objects
+     */
+    private final JacobiInfoPool<syevjInfo> syevjInfoPool;
+
+    /**
+     * The pool for the gesvdjInfo objects
+     */
+    private final JacobiInfoPool<gesvdjInfo> gesvdjInfoPool;
+
+    /**
+     * Creates a new solver
+     * 
+     * @param handle The handle
+     * @param bucketing The bucketing
+     * @param tolerance The tolerance for the Jacobi method
+     * @param maxSweeps The maximum number of sweeps
+     */
+    public JacobiBatchSolver(cusolverDnHandle handle, 
+        BatchBucketing bucketing, double tolerance, int maxSweeps)
+    {
+        this.handle = handle;
+        this.bucketing = bucketing;
+        this.parameters = new JacobiParameters(tolerance, maxSweeps, 1);
+        this.syevjInfoPool = JacobiInfoPool.forSyevj();
+        this.gesvdjInfoPool = JacobiInfoPool.forGesvdj();
+    }
+    
+    /**
+     * Computes the eigenvalues and (optionally) eigenvectors of the 
+     * given symmetric matrices.
+     * 
+     * @param jobz The cusolverEigMode
+     * @param matrices The matrices, each with size sizes[i]*sizes[i]
+     * @param sizes The sizes of the matrices
+     * @param eigenvalues The arrays that will receive the eigenvalues.
+     * Each array must have a length of at least sizes[i]
+     * @param eigenvectors The arrays that will receive the eigenvectors, 
+     * in column-major order. Each array must have a length of at least 
+     * sizes[i]*sizes[i]. May be <code>null</code> if jobz is 
+     * CUSOLVER_EIG_MODE_NOVECTOR
+     * @return The info values that have been computed for the matrices. 
+     * A value of 0 indicates success, and a positive value indicates
+     * that the method did not converge. 
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public int[] dsyevj(int jobz, double matrices[][], int sizes[], 
+        double eigenvalues[][], double eigenvectors[][])
+    {
+        boolean vectors = (jobz == cusolverEigMode.CUSOLVER_EIG_MODE_VECTOR);
+        int infos[] = new int[matrices.length];
+        List<BatchBucketing.Bucket> buckets = bucketing.assign(sizes);
+        for (BatchBucketing.Bucket bucket : buckets)
+        {
+            int n = bucket.getRows();
+            int batchSize = bucket.isBatched() ? bucket.getBatchSize() : 1;
+            int batchCount = bucket.getBatchSize() / batchSize;
+            
+            // Process either the whole bucket in one batch, or
+            // each matrix as a batch of size 1
+            for (int b = 0; b < batchCount; b++)
+            {
+                int first = b * batchSize;
+                double hostA[] = new double[n * n * batchSize];
+                for (int i = 0; i < batchSize; i++)
+                {
+                    int index = bucket.getIndex(first + i);
+                    int s = sizes[index];
+                    double p = BatchBucketing.computePaddingValue(
+                        matrices[index], s, s);
+                    BatchBucketing.pad(matrices[index], s, s, 
+                        hostA, i * n * n, n, n, p);
+                }
+                double hostW[] = new double[n * batchSize];
+                int hostInfo[] = new int[batchSize];
+                
+                syevj(jobz, n, hostA, hostW, hostInfo, batchSize, 
+                    bucket.isBatched());
+                
+                for (int i = 0; i < batchSize; i++)
+                {
+                    int index = bucket.getIndex(first + i);
+                    int s = sizes[index];
+                    infos[index] = hostInfo[i];
+                    System.arraycopy(
+                        hostW, i * n, eigenvalues[index], 0, s);
+                    if (vectors)
+                    {
+                        for (int c = 0; c < s; c++)
+                        {
+                            System.arraycopy(hostA, i * n * n + c * n, 
+                                eigenvectors[index], c * s, s);
+                        }
+                    }
+                }
+            }
+        }
+        return infos;
+    }
+    
+    /**
+     * Computes the singular value decompositions of the given matrices.
+     * 
+     * @param jobz The cusolverEigMode
+     * @param matrices The matrices, each with size rows[i]*cols[i]
+     * @param rows The numbers of rows of the matrices
+     * @param cols The numbers of columns of the matrices
+     * @param singularValues The arrays that will receive the singular 
+     * values. Each array must have a length of at least 
+     * min(rows[i],cols[i])
+     * @param leftVectors The arrays that will receive the left singular
+     * vectors, in column-major order. Each array must have a length of
+     * at least rows[i]*rows[i]. May be <code>null</code> if jobz is 
+     * CUSOLVER_EIG_MODE_NOVECTOR
+     * @param rightVectors The arrays that will receive the right singular
+     * vectors, in column-major order. Each array must have a length of
+     * at least cols[i]*cols[i]. May be <code>null</code> if jobz is 
+     * CUSOLVER_EIG_MODE_NOVECTOR
+     * @return The info values that have been computed for the matrices. 
+     * A value of 0 indicates success, and a positive value indicates
+     * that the method did not converge. 
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public int[] dgesvdj(int jobz, double matrices[][], 
+        int rows[], int cols[], double singularValues[][], 
+        double leftVectors[][], double rightVectors[][])
+    {
+        boolean vectors = (jobz == cusolverEigMode.CUSOLVER_EIG_MODE_VECTOR);
+        int infos[] = new int[matrices.length];
+        List<BatchBucketing.Bucket> buckets = bucketing.assign(rows, cols);
+        for (BatchBucketing.Bucket bucket : buckets)
+        {
+            int m = bucket.getRows();
+            int n = bucket.getCols();
+            int minMN = Math.min(m, n);
+            int batchSize = bucket.isBatched() ? bucket.getBatchSize() : 1;
+            int batchCount = bucket.getBatchSize() / batchSize;
+            for (int b = 0; b < batchCount; b++)
+            {
+                int first = b * batchSize;
+                double hostA[] = new double[m * n * batchSize];
+                for (int i = 0; i < batchSize; i++)
+                {
+                    int index = bucket.getIndex(first + i);
+                    double p = BatchBucketing.computePaddingValue(
+                        matrices[index], rows[index], cols[index]);
+                    BatchBucketing.pad(matrices[index], 
+                        rows[index], cols[index], 
+                        hostA, i * m * n, m, n, p);
+                }
+                double hostS[] = new double[minMN * batchSize];
+                double hostU[] = new double[m * m * batchSize];
+                double hostV[] = new double[n * n * batchSize];
+                int hostInfo[] = new int[batchSize];
+                
+                gesvdj(jobz, m, n, hostA, hostS, hostU, hostV, hostInfo, 
+                    batchSize, bucket.isBatched());
+                
+                for (int i = 0; i < batchSize; i++)
+                {
+                    int index = bucket.getIndex(first + i);
+                    int r = rows[index];
+                    int c = cols[index];
+                    
+                    // The k padding values are the largest singular 
+                    // values, so the results for the original matrix
+                    // start at index k
+                    int k = m - r;
+                    infos[index] = hostInfo[i];
+                    System.arraycopy(hostS, i * minMN + k, 
+                        singularValues[index], 0, Math.min(r, c));
+                    if (vectors)
+                    {
+                        for (int j = 0; j < r; j++)
+                        {
+                            System.arraycopy(hostU, i * m * m + (k + j) * m, 
+                                leftVectors[index], j * r, r);
+                        }
+                        for (int j = 0; j < c; j++)
+                        {
+                            System.arraycopy(hostV, i * n * n + (k + j) * n, 
+                                rightVectors[index], j * c, c);
+                        }
+                    }
+                }
+            }
+        }
+        return infos;
+    }
+    
+    /**
+     * Release all resources of this solver
+     */
+    public void close()
+    {
+        syevjInfoPool.close();
+        gesvdjInfoPool.close();
+    }
+    
+    /**
+     * Run syevj on the given host data
+     * 
+     * @param jobz The cusolverEigMode
+     * @param n The size of the matrices
+     * @param hostA The matrices. Will receive the eigenvectors
+     * @param hostW Will receive the eigenvalues
+     * @param hostInfo Will receive the info values
+     * @param batchSize The batch size
+     * @param batched Whether the batched function should be used
+     */
+    private void syevj(int jobz, int n, double hostA[], double hostW[], 
+        int hostInfo[], int batchSize, boolean batched)
+    {
+        Pointer dA = allocate((long)hostA.length * Sizeof.DOUBLE);
+        Pointer dW = allocate((long)hostW.length * Sizeof.DOUBLE);
+        Pointer dInfo = allocate(batchSize * Sizeof.INT);
+        Pointer dWork = null;
+        syevjInfo params = syevjInfoPool.acquire(parameters);
+        try
+        {
+            copy(dA, Pointer.to(hostA), (long)hostA.length * Sizeof.DOUBLE, 
+                cudaMemcpyHostToDevice);
+            int lwork[] = { 0 };
+            int uplo = CUBLAS_FILL_MODE_LOWER;
+            if (batched)
+            {
+                checkSuccess(JCusolverDn.cusolverDnDsyevjBatched_bufferSize(
+                    handle, jobz, uplo, n, dA, n, dW, lwork, params, 
+                    batchSize), "cusolverDnDsyevjBatched_bufferSize");
+                dWork = allocate((long)lwork[0] * Sizeof.DOUBLE);
+                checkSuccess(JCusolverDn.cusolverDnDsyevjBatched(
+                    handle, jobz, uplo, n, dA, n, dW, dWork, lwork[0], 
+                    dInfo, params, batchSize), "cusolverDnDsyevjBatched");
+            }
+            else
+            {
+                checkSuccess(JCusolverDn.cusolverDnDsyevj_bufferSize(
+                    handle, jobz, uplo, n, dA, n, dW, lwork, params), 
+                    "cusolverDnDsyevj_bufferSize");
+                dWork = allocate((long)lwork[0] * Sizeof.DOUBLE);
+                checkSuccess(JCusolverDn.cusolverDnDsyevj(
+                    handle, jobz, uplo, n, dA, n, dW, dWork, lwork[0], 
+                    dInfo, params), "cusolverDnDsyevj");
+            }
+            checkCudaSuccess(JCuda.cudaDeviceSynchronize(), 
+                "cudaDeviceSynchronize");
+            copy(Pointer.to(hostA), dA, (long)hostA.length * Sizeof.DOUBLE, 
+                cudaMemcpyDeviceToHost);
+            copy(Pointer.to(hostW), dW, (long)hostW.length * Sizeof.DOUBLE, 
+                cudaMemcpyDeviceToHost);
+            copy(Pointer.to(hostInfo), dInfo, batchSize * Sizeof.INT, 
+                cudaMemcpyDeviceToHost);
+        }
+        finally
+        {
+            syevjInfoPool.release(params);
+            free(dA, dW, dInfo, dWork);
+        }
+    }
+
+    /**
+     * Run gesvdj on the given host data
+     * 
+     * @param jobz The cusolverEigMode
+     * @param m The number of rows of the matrices
+     * @param n The number of columns of the matrices
+     * @param hostA The matrices
+     * @param hostS Will receive the singular values
+     * @param hostU Will receive the left singular vectors
+     * @param hostV Will receive the right singular vectors
+     * @param hostInfo Will receive the info values
+     * @param batchSize The batch size
+     * @param batched Whether the batched function should be used
+     */
+    private void gesvdj(int jobz, int m, int n, double hostA[], 
+        double hostS[], double hostU[], double hostV[], int hostInfo[], 
+        int batchSize, boolean batched)
+    {
+        Pointer dA = allocate((long)hostA.length * Sizeof.DOUBLE);
+        Pointer dS = allocate((long)hostS.length * Sizeof.DOUBLE);
+        Pointer dU = allocate((long)hostU.length * Sizeof.DOUBLE);
+        Pointer dV = allocate((long)hostV.length * Sizeof.DOUBLE);
+        Pointer dInfo = allocate(batchSize * Sizeof.INT);
+        Pointer dWork = null;
+        gesvdjInfo params = gesvdjInfoPool.acquire(parameters);
+        try
+        {
+            copy(dA, Pointer.to(hostA), (long)hostA.length * Sizeof.DOUBLE, 
+                cudaMemcpyHostToDevice);
+            int lwork[] = { 0 };
+            if (batched)
+            {
+                checkSuccess(JCusolverDn.cusolverDnDgesvdjBatched_bufferSize(
+                    handle, jobz, m, n, dA, m, dS, dU, m, dV, n, lwork, 
+                    params, batchSize), "cusolverDnDgesvdjBatched_bufferSize");
+                dWork = allocate((long)lwork[0] * Sizeof.DOUBLE);
+                checkSuccess(JCusolverDn.cusolverDnDgesvdjBatched(
+                    handle, jobz, m, n, dA, m, dS, dU, m, dV, n, 
+                    dWork, lwork[0], dInfo, params, batchSize), 
+                    "cusolverDnDgesvdjBatched");
+            }
+            else
+            {
+                // The non-batched function computes the full U and V
+                // when econ is 0
+                int econ = 0;
+                checkSuccess(JCusolverDn.cusolverDnDgesvdj_bufferSize(
+                    handle, jobz, econ, m, n, dA, m, dS, dU, m, dV, n, 
+                    lwork, params), "cusolverDnDgesvdj_bufferSize");
+                dWork = allocate((long)lwork[0] * Sizeof.DOUBLE);
+                checkSuccess(JCusolverDn.cusolverDnDgesvdj(
+                    handle, jobz, econ, m, n, dA, m, dS, dU, m, dV, n, 
+                    dWork, lwork[0], dInfo, params), "cusolverDnDgesvdj");
+            }
+            checkCudaSuccess(JCuda.cudaDeviceSynchronize(), 
+                "cudaDeviceSynchronize");
+            copy(Pointer.to(hostS), dS, (long)hostS.length * Sizeof.DOUBLE, 
+                cudaMemcpyDeviceToHost);
+            copy(Pointer.to(hostU), dU, (long)hostU.length * Sizeof.DOUBLE, 
+                cudaMemcpyDeviceToHost);
+            copy(Pointer.to(hostV), dV, (long)hostV.length * Sizeof.DOUBLE, 
+                cudaMemcpyDeviceToHost);
+            copy(Pointer.to(hostInfo), dInfo, batchSize * Sizeof.INT, 
+                cudaMemcpyDeviceToHost);
+        }
+        finally
+        {
+            gesvdjInfoPool.release(params);
+            free(dA, dS, dU, dV, dInfo, dWork);
+        }
+    }
+}
@@ -0,0 +1,493 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.DeviceMemory.allocateHost;
+import static jcuda.jcusolver.DeviceMemory.freeHost;
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.Deque;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentLinkedDeque;
+
+import jcuda.NativePointerObject;
+import jcuda.Pointer;
+
+/**
+ * A pool of pre-configured {@link syevjInfo} or {@link gesvdjInfo} 
+ * objects, keyed by their {@link JacobiParameters}. <br>
+ * <br>
+ * Creating and configuring an info requires several native calls. 
+ * This pool creates and configures each info only once, and hands 
+ * it out for exclusive use with {@link #acquire(JacobiParameters)}. 
+ * The configuration of a pooled info is never changed afterwards. <br>
+ * <br>
+ * CUSOLVER stores the residual and the number of executed sweeps of
+ * the most recent call in the info itself. An info may therefore not
+ * be used by multiple threads at the same time. This pool ensures that 
+ * each info is leased to only one thread at a time, and that the 
+ * readouts are copied into a {@link JacobiResult} when the info is 
+ * given back with {@link #release(cusolverDnHandle, NativePointerObject)}.
+ * <br>
+ * <br>
+ * All methods of this class are thread-safe. A typical usage is
+ * <pre><code>
+ * JacobiInfoPool&lt;syevjInfo&gt; pool = JacobiInfoPool.forSyevj();
+ * ...
+ * syevjInfo params = pool.acquire(parameters);
+ * cusolverDnDsyevj(handle, jobz, uplo, n, A, lda, W, 
+ *     work, lwork, devInfo, params);
+ * cudaStreamSynchronize(stream);
+ * JacobiResult result = pool.release(handle, params);
+ * </code></pre>
+ * 
+ * @param <T> The type of the info
+ */
+public abstract class JacobiInfoPool<T extends NativePointerObject>
+{
+    /**
+     * Creates a new pool for {@link syevjInfo} objects
+     * 
+     * @return The pool
+     */
+    public static JacobiInfoPool<syevjInfo> forSyevj()
+    {
+        return new SyevjInfoPool();
+    }
+    
+    /**
+     * Creates a new pool for {@link gesvdjInfo} objects
+     * 
+     * @return The pool
+     */
+    public static JacobiInfoPool<gesvdjInfo> forGesvdj()
+    {
+        return new GesvdjInfoPool();
+    }
+    
+    /**
+     * The size of the page-locked host memory that receives the 
+     * residual (double) and the number of executed sweeps (int)
+     */
+    private static final int READOUT_SIZE = 16;
+
+    /**
+     * The byte offset of the number of executed sweeps in the readout
+     */
+    private static final int READOUT_SWEEPS_OFFSET = 8;
+    
+    /**
+     * An entry of the pool
+     */
+    private static class Entry<T>
+    {
+        /**
+         * The info
+         */
+        final T info;
+        
+        /**
+         * The parameters that the info was configured with
+         */
+        final JacobiParameters parameters;
+        
+        /**
+         * The page-locked host memory for the readouts. This is 
+         * allocated once per entry, because the getters require 
+         * a pointer to native memory.
+         */
+        final Pointer readout;
+        
+        Entry(T info, JacobiParameters parameters, Pointer readout)
+        {
+            this.info = info;
+            this.parameters = parameters;
+            this.readout = readout;
+        }
+    }
+    
+    /**
+     * The idle entries, for each configuration
+     */
+    private final Map<JacobiParameters, Deque<Entry<T>>> idleEntries;
+    
+    /**
+     * The entries that are currently leased, by identity of their info
+     */
+    private final Map<T, Entry<T>> leasedEntries;
+    
+    /**
+     * Whether this pool has been closed
+     */
+    private volatile boolean closed;
+    
+    /**
+     * Default constructor
+     */
+    JacobiInfoPool()
+    {
+        this.idleEntries = 
+            new ConcurrentHashMap<JacobiParameters, Deque<Entry<T>>>();
+        this.leasedEntries = new IdentityHashMap<T, Entry<T>>();
+    }
+    
+    /**
+     * Obtain an info that is configured with the given parameters, for
+     * the exclusive use by the calling thread. If no idle info with 
+     * the given parameters is available, a new one will be created.
+     * The info must be given back with 
+     * {@link #release(cusolverDnHandle, NativePointerObject)} or 
+     * {@link #release(NativePointerObject)}, and must not be destroyed
+     * or reconfigured by the caller.
+     * 
+     * @param parameters The parameters
+     * @return The info
+     * @throws IllegalStateException If this pool has been closed
+     * @throws jcuda.CudaException If exceptions are enabled and 
+     * creating or configuring a new info failed
+     */
+    public T acquire(JacobiParameters parameters)
+    {
+        if (closed)
+        {
+            throw new IllegalStateException("The pool has been closed");
+        }
+        Deque<Entry<T>> idle = idleEntries.get(parameters);
+        Entry<T> entry = idle == null ? null : idle.pollFirst();
+        if (entry == null)
+        {
+            entry = createEntry(parameters);
+        }
+        synchronized (leasedEntries)
+        {
+            leasedEntries.put(entry.info, entry);
+        }
+        return entry.info;
+    }
+    
+    /**
+     * Give back the given info to this pool, after copying the residual 
+     * and the number of executed sweeps of the most recent call into
+     * the returned result. <br>
+     * <br>
+     * The call that used the info must be complete, e.g. by 
+     * synchronizing the stream of the given handle.
+     * 
+     * @param handle The handle that was used for the call
+     * @param info The info, as obtained from 
+     * {@link #acquire(JacobiParameters)}
+     * @return The result
+     * @throws IllegalArgumentException If the given info is not 
+     * currently leased from this pool
+     */
+    public JacobiResult release(cusolverDnHandle handle, T info)
+    {
+        Entry<T> entry = removeLeased(info);
+        Pointer residual = entry.readout;
+        Pointer sweeps = entry.readout.withByteOffset(READOUT_SWEEPS_OFFSET);
+        getResidual(handle, info, residual);
+        getSweeps(handle, info, sweeps);
+        ByteBuffer bb = entry.readout.getByteBuffer(0, READOUT_SIZE)
+            .order(ByteOrder.nativeOrder());
+        JacobiResult result = new JacobiResult(
+            bb.getDouble(0), bb.getInt(READOUT_SWEEPS_OFFSET));
+        returnEntry(entry);
+        return result;
+    }
+    
+    /**
+     * Give back the given info to this pool, without reading the 
+     * results of the most recent call.
+     * 
+     * @param info The info, as obtained from 
+     * {@link #acquire(JacobiParameters)}
+     * @throws IllegalArgumentException If the given info is not 
+     * currently leased from this pool
+     */
+    public void release(T info)
+    {
+        returnEntry(removeLeased(info));
+    }
+    
+    /**
+     * Destroy all idle infos of this pool. Infos that are currently 
+     * leased will be destroyed when they are released. After this 
+     * method has been called, no further infos may be acquired.
+     */
+    public void close()
+    {
+        closed = true;
+        List<Entry<T>> entries = new ArrayList<Entry<T>>();
+        for (Deque<Entry<T>> idle : idleEntries.values())
+        {
+            Entry<T> entry = null;
+            while ((entry = idle.pollFirst()) != null)
+            {
+                entries.add(entry);
+            }
+        }
+        for (Entry<T> entry : entries)
+        {
+            destroyEntry(entry);
+        }
+    }
+    
+    /**
+     * Remove the entry for the given info from the leased entries
+     * 
+     * @param info The info
+     * @return The entry
+     * @throws IllegalArgumentException If the info is not leased
+     */
+    private Entry<T> removeLeased(T info)
+    {
+        Entry<T> entry = null;
+        synchronized (leasedEntries)
+        {
+            entry = leasedEntries.remove(info);
+        }
+        if (entry == null)
+        {
+            throw new IllegalArgumentException(
+                "The info is not leased from this pool: " + info);
+        }
+        return entry;
+    }
+    
+    /**
+     * Put the given entry back into the idle entries, or destroy it
+     * if this pool has been closed
+     * 
+     * @param entry The entry
+     */
+    private void returnEntry(Entry<T> entry)
+    {
+        if (closed)
+        {
+            destroyEntry(entry);
+            return;
+        }
+        Deque<Entry<T>> idle = idleEntries.computeIfAbsent(
+            entry.parameters, p -> new ConcurrentLinkedDeque<Entry<T>>());
+        idle.offerFirst(entry);
+        
+        // The pool may have been closed concurrently, after the check
+        // above. Make sure that the entry does not leak in this case.
+        if (closed && idle.remove(entry))
+        {
+            destroyEntry(entry);
+        }
+    }
+    
+    /**
+     * Create a new entry with an info that is configured with the 
+     * given parameters. If the configuration or the allocation of the
+     * readout memory fails, then the info is destroyed.
+     * 
+     * @param parameters The parameters
+     * @return The entry
+     * @throws jcuda.CudaException If a native call failed
+     */
+    private Entry<T> createEntry(JacobiParameters parameters)
+    {
+        T info = createInfo();
+        try
+        {
+            configure(info, parameters);
+            Pointer readout = allocateHost(READOUT_SIZE);
+            return new Entry<T>(info, parameters, readout);
+        }
+        catch (RuntimeException e)
+        {
+            destroyInfo(info);
+            throw e;
+        }
+    }
+    
+    /**
+     * Destroy the info and the readout memory of the given entry
+     * 
+     * @param entry The entry
+     */
+    private void destroyEntry(Entry<T> entry)
+    {
+        destroyInfo(entry.info);
+        freeHost(entry.readout);
+    }
+    
+    /**
+     * Create a new info
+     * 
+     * @return The info
+     * @throws jcuda.CudaException If the info could not be created
+     */
+    abstract T createInfo();
+
+    /**
+     * Configure the given info with the given parameters
+     * 
+     * @param info The info
+     * @param parameters The parameters
+     * @throws jcuda.CudaException If a parameter could not be set
+     */
+    abstract void configure(T info, JacobiParameters parameters);
+    
+    /**
+     * Destroy the given info
+     * 
+     * @param info The info
+     */
+    abstract void destroyInfo(T info);
+    
+    /**
+     * Write the residual of the most recent call into the given pointer
+     * 
+     * @param handle The handle
+     * @param info The info
+     * @param residual The pointer to the residual
+     */
+    abstract void getResidual(
+        cusolverDnHandle handle, T info, Pointer residual);
+
+    /**
+     * Write the executed sweeps of the most recent call into the given 
+     * pointer
+     * 
+     * @param handle The handle
+     * @param info The info
+     * @param executedSweeps The pointer to the executed sweeps
+     */
+    abstract void getSweeps(
+        cusolverDnHandle handle, T info, Pointer executedSweeps);
+
+    /**
+     * Implementation of a pool for {@link syevjInfo} objects
+     */
+    private static class SyevjInfoPool extends JacobiInfoPool<syevjInfo>
+    {
+        @Override
+        syevjInfo createInfo()
+        {
+            syevjInfo info = new syevjInfo();
+            checkSuccess(JCusolverDn.cusolverDnCreateSyevjInfo(info), 
+                "cusolverDnCreateSyevjInfo");
+            return info;
+        }
+
+        @Override
+        void configure(syevjInfo info, JacobiParameters parameters)
+        {
+            checkSuccess(JCusolverDn.cusolverDnXsyevjSetTolerance(
+                info, parameters.getTolerance()), 
+                "cusolverDnXsyevjSetTolerance");
+            checkSuccess(JCusolverDn.cusolverDnXsyevjSetMaxSweeps(
+                info, parameters.getMaxSweeps()), 
+                "cusolverDnXsyevjSetMaxSweeps");
+            checkSuccess(JCusolverDn.cusolverDnXsyevjSetSortEig(
+                info, parameters.getSortEig()), 
+                "cusolverDnXsyevjSetSortEig");
+        }
+
+        @Override
+        void destroyInfo(syevjInfo info)
+        {
+            JCusolverDn.cusolverDnDestroySyevjInfo(info);
+        }
+
+        @Override
+        void getResidual(
+            cusolverDnHandle handle, syevjInfo info, Pointer residual)
+        {
+            JCusolverDn.cusolverDnXsyevjGetResidual(handle, info, residual);
+        }
+
+        @Override
+        void getSweeps(
+            cusolverDnHandle handle, syevjInfo info, Pointer executedSweeps)
+        {
+            JCusolverDn.cusolverDnXsyevjGetSweeps(
+                handle, info, executedSweeps);
+        }
+    }
+    
+    /**
+     * Implementation of a pool for {@link gesvdjInfo} objects
+     */
+    private static class GesvdjInfoPool extends JacobiInfoPool<gesvdjInfo>
+    {
+        @Override
+        gesvdjInfo createInfo()
+        {
+            gesvdjInfo info = new gesvdjInfo();
+            checkSuccess(JCusolverDn.cusolverDnCreateGesvdjInfo(info), 
+                "cusolverDnCreateGesvdjInfo");
+            return info;
+        }
+
+        @Override
+        void configure(gesvdjInfo info, JacobiParameters parameters)
+        {
+            checkSuccess(JCusolverDn.cusolverDnXgesvdjSetTolerance(
+                info, parameters.getTolerance()), 
+                "cusolverDnXgesvdjSetTolerance");
+            checkSuccess(JCusolverDn.cusolverDnXgesvdjSetMaxSweeps(
+                info, parameters.getMaxSweeps()), 
+                "cusolverDnXgesvdjSetMaxSweeps");
+            checkSuccess(JCusolverDn.cusolverDnXgesvdjSetSortEig(
+                info, parameters.getSortEig()), 
+                "cusolverDnXgesvdjSetSortEig");
+        }
+
+        @Override
+        void destroyInfo(gesvdjInfo info)
+        {
+            JCusolverDn.cusolverDnDestroyGesvdjInfo(info);
+        }
+
+        @Override
+        void getResidual(
+            cusolverDnHandle handle, gesvdjInfo info, Pointer residual)
+        {
+            JCusolverDn.cusolverDnXgesvdjGetResidual(handle, info, residual);
+        }
+
+        @Override
+        void getSweeps(
+            cusolverDnHandle handle, gesvdjInfo info, Pointer executedSweeps)
+        {
+            JCusolverDn.cusolverDnXgesvdjGetSweeps(
+                handle, info, executedSweeps);
+        }
+    }
+}
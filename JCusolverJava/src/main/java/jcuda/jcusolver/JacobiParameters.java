@@ -0,0 +1,159 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * The immutable configuration of a {@link syevjInfo} or 
+ * {@link gesvdjInfo}, consisting of the tolerance, the maximum 
+ * number of sweeps and the sorting flag. <br>
+ * <br>
+ * Instances of this class are used as the keys of a 
+ * {@link JacobiInfoPool}.
+ */
+public final class JacobiParameters
+{
+    /**
+     * The tolerance, as passed to cusolverDnXsyevjSetTolerance
+     * or cusolverDnXgesvdjSetTolerance
+     */
+    private final double tolerance;
+    
+    /**
+     * The maximum number of sweeps, as passed to 
+     * cusolverDnXsyevjSetMaxSweeps or cusolverDnXgesvdjSetMaxSweeps
+     */
+    private final int maxSweeps;
+    
+    /**
+     * The sorting flag, as passed to cusolverDnXsyevjSetSortEig
+     * or cusolverDnXgesvdjSetSortEig
+     */
+    private final int sortEig;
+    
+    /**
+     * Creates new Jacobi parameters
+     * 
+     * @param tolerance The tolerance. A value of 0.0 means that 
+     * the machine accuracy will be used (the CUSOLVER default)
+     * @param maxSweeps The maximum number of sweeps
+     * @param sortEig Whether the results should be sorted (1) or
+     * not (0)
+     * @throws IllegalArgumentException If the tolerance is negative
+     * or not a number, or the maximum number of sweeps is not
+     * positive
+     */
+    public JacobiParameters(double tolerance, int maxSweeps, int sortEig)
+    {
+        if (!(tolerance >= 0.0))
+        {
+            throw new IllegalArgumentException(
+                "The tolerance must be nonnegative, but is " + tolerance);
+        }
+        if (maxSweeps <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The maximum number of sweeps must be positive, but is " 
+                + maxSweeps);
+        }
+        this.tolerance = tolerance;
+        this.maxSweeps = maxSweeps;
+        this.sortEig = sortEig;
+    }
+    
+    /**
+     * Returns the tolerance
+     * 
+     * @return The tolerance
+     */
+    public double getTolerance()
+    {
+        return tolerance;
+    }
+    
+    /**
+     * Returns the maximum number of sweeps
+     * 
+     * @return The maximum number of sweeps
+     */
+    public int getMaxSweeps()
+    {
+        return maxSweeps;
+    }
+    
+    /**
+     * Returns the sorting flag
+     * 
+     * @return The sorting flag
+     */
+    public int getSortEig()
+    {
+        return sortEig;
+    }
+
+    @Override
+    public int hashCode()
+    {
+        long bits = Double.doubleToLongBits(tolerance);
+        int result = (int)(bits ^ (bits >>> 32));
+        result = 31 * result + maxSweeps;
+        result = 31 * result + sortEig;
+        return result;
+    }
+
+    @Override
+    public boolean equals(Object object)
+    {
+        if (this == object)
+        {
+            return true;
+        }
+        if (!(object instanceof JacobiParameters))
+        {
+            return false;
+        }
+        JacobiParameters other = (JacobiParameters)object;
+        return Double.doubleToLongBits(tolerance) == 
+               Double.doubleToLongBits(other.tolerance) &&
+               maxSweeps == other.maxSweeps &&
+               sortEig == other.sortEig;
+    }
+    
+    /**
+     * Returns a String representation of this object.
+     *
+     * @return A String representation of this object.
+     */
+    @Override
+    public String toString()
+    {
+        return "JacobiParameters["+
+            "tolerance="+tolerance+","+
+            "maxSweeps="+maxSweeps+","+
+            "sortEig="+sortEig+"]";
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * The result of a single syevj or gesvdj call, as obtained from
+ * {@link JacobiInfoPool#release(cusolverDnHandle, jcuda.NativePointerObject)}.
+ * <br>
+ * <br>
+ * The values are copied out of the info structure when the info is
+ * returned to the pool, so that they remain valid when the same
+ * info is subsequently used for another call. 
+ */
+public final class JacobiResult
+{
+    /**
+     * The residual, as obtained from cusolverDnXsyevjGetResidual or
+     * cusolverDnXgesvdjGetResidual
+     */
+    private final double residual;
+    
+    /**
+     * The number of executed sweeps, as obtained from 
+     * cusolverDnXsyevjGetSweeps or cusolverDnXgesvdjGetSweeps
+     */
+    private final int executedSweeps;
+    
+    /**
+     * Creates a new result
+     * 
+     * @param residual The residual
+     * @param executedSweeps The number of executed sweeps
+     */
+    JacobiResult(double residual, int executedSweeps)
+    {
+        this.residual = residual;
+        this.executedSweeps = executedSweeps;
+    }
+    
+    /**
+     * Returns the residual
+     * 
+     * @return The residual
+     */
+    public double getResidual()
+    {
+        return residual;
+    }
+    
+    /**
+     * Returns the number of executed sweeps
+     * 
+     * @return The number of executed sweeps
+     */
+    public int getExecutedSweeps()
+    {
+        return executedSweeps;
+    }
+    
+    /**
+     * Returns a String representation of this object.
+     *
+     * @return A String representation of this object.
+     */
+    @Override
+    public String toString()
+    {
+        return "JacobiResult["+
+            "residual="+residual+","+
+            "executedSweeps="+executedSweeps+"]";
+    }
+}
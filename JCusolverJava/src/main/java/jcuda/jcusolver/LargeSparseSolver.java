@@ -0,0 +1,193 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.Future;
+
+import jcuda.CudaException;
+import jcuda.Pointer;
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * A solver for linear systems A*x = b with a {@link CsrMatrix64}, 
+ * whose number of nonzeros may exceed the 32 bit limit of cuSOLVER. 
+ * <br>
+ * <br>
+ * The matrix is split into a {@link BlockDiagonalPartition}. Each 
+ * piece is extracted with 32 bit indices, and solved with a 
+ * {@link SparseSolverSelector}, which selects the Cholesky, LU or QR 
+ * solver based on the structure of the piece. The pieces are solved 
+ * concurrently, by worker threads that each own a cusolverSpHandle. 
+ * The analyses of the pieces are cached, so that solving systems with 
+ * the same matrix and different values only analyzes each piece once.
+ * <br>
+ * <br>
+ * Matrices whose graph has a connected component that does not fit
+ * into 32 bit can not be solved with this class. <br>
+ * <br>
+ * Instances of this class are thread-safe, except for 
+ * {@link #close()}.
+ */
+public class LargeSparseSolver
+{
+    /**
+     * The partition
+     */
+    private final BlockDiagonalPartition partition;
+    
+    /**
+     * The worker threads
+     */
+    private final SpWorkerPool pool;
+    
+    /**
+     * The analyzer, shared by all pieces
+     */
+    private final StructureAnalyzer analyzer;
+    
+    /**
+     * The descriptor of the pieces
+     */
+    private final cusparseMatDescr descr;
+    
+    /**
+     * The lock for scattering the solutions of the pieces
+     */
+    private final Object scatterLock;
+    
+    /**
+     * Creates a new solver. The pointers of the matrix must remain valid
+     * while the solver is used.
+     * 
+     * @param matrix The matrix
+     * @param maxPieceNnz The maximum number of nonzeros of a piece, as
+     * described in {@link BlockDiagonalPartition}
+     * @param threads The number of pieces that are solved concurrently
+     * @throws IllegalArgumentException If the maximum number of nonzeros
+     * or the number of threads is not positive
+     * @throws CudaException If the matrix can not be partitioned
+     */
+    public LargeSparseSolver(CsrMatrix64 matrix, long maxPieceNnz, int threads)
+    {
+        this.partition = new BlockDiagonalPartition(matrix, maxPieceNnz);
+        this.pool = new SpWorkerPool("LargeSparseSolver", threads);
+        this.analyzer = new StructureAnalyzer();
+        this.descr = new cusparseMatDescr();
+        JCusparse.cusparseCreateMatDescr(descr);
+        this.scatterLock = new Object();
+    }
+    
+    /**
+     * Returns the partition of the matrix
+     * 
+     * @return The partition
+     */
+    public BlockDiagonalPartition getPartition()
+    {
+        return partition;
+    }
+    
+    /**
+     * Solve A*x = b
+     * 
+     * @param b The right hand side, with n elements
+     * @param x Will store the solution, with n elements
+     * @param tol The tolerance for deciding singularity
+     * @param reorder The reordering scheme, as described in the
+     * documentation of the cusolverSp&lt;t&gt;csrlsv&lt;x&gt; functions
+     * @return The results of the pieces, in the order of the pieces
+     * @throws CudaException If a solver fails
+     */
+    public SparseSolverSelector.Result[] solve(
+        Pointer b, Pointer x, double tol, int reorder)
+    {
+        int pieceCount = partition.getPieceCount();
+        List<Future<SparseSolverSelector.Result>> futures = 
+            new ArrayList<Future<SparseSolverSelector.Result>>();
+        for (int p = 0; p < pieceCount; p++)
+        {
+            int piece = p;
+            futures.add(pool.submit(handle -> 
+                solvePiece(handle, piece, b, x, tol, reorder)));
+        }
+        SparseSolverSelector.Result results[] = 
+            new SparseSolverSelector.Result[pieceCount];
+        for (int p = 0; p < pieceCount; p++)
+        {
+            results[p] = SpWorkerPool.get(futures.get(p));
+        }
+        return results;
+    }
+    
+    /**
+     * Solve the system of the given piece
+     * 
+     * @param handle The handle
+     * @param piece The piece
+     * @param b The right hand side of the whole system
+     * @param x The solution of the whole system
+     * @param tol The tolerance
+     * @param reorder The reordering scheme
+     * @return The result
+     */
+    private SparseSolverSelector.Result solvePiece(cusolverSpHandle handle, 
+        int piece, Pointer b, Pointer x, double tol, int reorder)
+    {
+        int n = partition.getPieceRows(piece);
+        int nnz = partition.getPieceNnz(piece);
+        int csrRowPtr[] = new int[n + 1];
+        int csrColInd[] = new int[nnz];
+        double csrVal[] = new double[nnz];
+        partition.extract(piece, csrRowPtr, csrColInd, csrVal);
+        double bPiece[] = new double[n];
+        double xPiece[] = new double[n];
+        partition.gather(piece, b, bPiece);
+        SparseSolverSelector selector = 
+            new SparseSolverSelector(handle, analyzer);
+        SparseSolverSelector.Result result = selector.solve(n, nnz, descr, 
+            csrVal, csrRowPtr, csrColInd, bPiece, tol, reorder, xPiece);
+        synchronized (scatterLock)
+        {
+            partition.scatter(piece, xPiece, x);
+        }
+        return result;
+    }
+    
+    /**
+     * Shut down the worker threads and release the partition
+     */
+    public void close()
+    {
+        pool.close();
+        partition.close();
+        JCusparse.cusparseDestroyMatDescr(descr);
+    }
+}
@@ -0,0 +1,179 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.io.IOException;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+
+/**
+ * A {@link RowBlockSource} that reads the rows of a matrix from a 
+ * memory-mapped file. The file must contain the elements of the 
+ * matrix as raw double values in row-major order, without any header.
+ * <br>
+ * <br>
+ * Files that are larger than the maximum size of a single mapping 
+ * are mapped in consecutive windows.
+ */
+public class MappedRowBlockSource implements RowBlockSource
+{
+    /**
+     * The default size of the mapped window, in bytes
+     */
+    private static final long DEFAULT_WINDOW_SIZE = 1L << 28;
+    
+    /**
+     * The path of the file
+     */
+    private final Path path;
+    
+    /**
+     * The number of columns of the matrix
+     */
+    private final int columns;
+    
+    /**
+     * The byte order of the file
+     */
+    private final ByteOrder byteOrder;
+    
+    /**
+     * The number of rows that are mapped at once
+     */
+    private final long windowRows;
+
+    /**
+     * Creates a new source for the given file
+     * 
+     * @param path The path of the file
+     * @param columns The number of columns of the matrix
+     * @param byteOrder The byte order of the values in the file
+     * @throws IllegalArgumentException If the number of columns is 
+     * not positive
+     */
+    public MappedRowBlockSource(Path path, int columns, ByteOrder byteOrder)
+    {
+        if (columns <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The number of columns must be positive, but is " + columns);
+        }
+        this.path = path;
+        this.columns = columns;
+        this.byteOrder = byteOrder;
+        this.windowRows = Math.max(1, 
+            DEFAULT_WINDOW_SIZE / ((long)columns * Double.BYTES));
+    }
+
+    @Override
+    public int getColumns()
+    {
+        return columns;
+    }
+
+    @Override
+    public Reader open() throws IOException
+    {
+        final FileChannel channel = 
+            FileChannel.open(path, StandardOpenOption.READ);
+        final long rowBytes = (long)columns * Double.BYTES;
+        final long totalRows = channel.size() / rowBytes;
+        return new Reader()
+        {
+            /**
+             * The index of the next row to read
+             */
+            private long row = 0;
+            
+            /**
+             * The index of the first row of the current window
+             */
+            private long windowStart = 0;
+            
+            /**
+             * The number of rows in the current window
+             */
+            private long windowSize = 0;
+            
+            /**
+             * The buffer for the current window
+             */
+            private DoubleBuffer window = null;
+
+            @Override
+            public int read(double[] block, int maxRows) throws IOException
+            {
+                int rowsRead = 0;
+                while (rowsRead < maxRows && row < totalRows)
+                {
+                    if (window == null || row >= windowStart + windowSize)
+                    {
+                        windowStart = row;
+                        windowSize = Math.min(windowRows, totalRows - row);
+                        MappedByteBuffer mapped = channel.map(
+                            FileChannel.MapMode.READ_ONLY, 
+                            windowStart * rowBytes, windowSize * rowBytes);
+                        window = mapped.order(byteOrder).asDoubleBuffer();
+                    }
+                    int n = (int)Math.min(maxRows - rowsRead, 
+                        windowStart + windowSize - row);
+                    window.position((int)((row - windowStart) * columns));
+                    window.get(block, rowsRead * columns, n * columns);
+                    rowsRead += n;
+                    row += n;
+                }
+                return rowsRead;
+            }
+
+            @Override
+            public void close() throws IOException
+            {
+                window = null;
+                channel.close();
+            }
+        };
+    }
+    
+    /**
+     * Returns a String representation of this object.
+     *
+     * @return A String representation of this object.
+     */
+    @Override
+    public String toString()
+    {
+        return "MappedRowBlockSource["+
+            "path="+path+","+
+            "columns="+columns+","+
+            "byteOrder="+byteOrder+"]";
+    }
+}
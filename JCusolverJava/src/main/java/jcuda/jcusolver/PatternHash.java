@@ -0,0 +1,101 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * Utility methods for computing hashes of sparsity patterns of matrices 
+ * in CSR format, which are used as keys for caching results that only
+ * depend on the pattern.
+ */
+public final class PatternHash
+{
+    /**
+     * Compute a 64-bit hash of the given sparsity pattern
+     * 
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @return The hash
+     */
+    public static long compute(int m, int n, int nnz, 
+        int csrRowPtrA[], int csrColIndA[])
+    {
+        long hash = 0xcbf29ce484222325L;
+        hash = mix(hash, m);
+        hash = mix(hash, n);
+        hash = mix(hash, nnz);
+        for (int i = 0; i <= m; i++)
+        {
+            hash = mix(hash, csrRowPtrA[i]);
+        }
+        for (int i = 0; i < nnz; i++)
+        {
+            hash = mix(hash, csrColIndA[i]);
+        }
+        return finish(hash);
+    }
+    
+    /**
+     * Mix the given value into the given hash
+     * 
+     * @param hash The hash
+     * @param value The value
+     * @return The new hash
+     */
+    private static long mix(long hash, int value)
+    {
+        return (hash ^ (value & 0xFFFFFFFFL)) * 0x100000001b3L;
+    }
+    
+    /**
+     * Apply a final avalanche step to the given hash
+     * 
+     * @param hash The hash
+     * @return The final hash
+     */
+    private static long finish(long hash)
+    {
+        long h = hash;
+        h ^= h >>> 33;
+        h *= 0xff51afd7ed558ccdL;
+        h ^= h >>> 33;
+        h *= 0xc4ceb9fe1a85ec53L;
+        h ^= h >>> 33;
+        return h;
+    }
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private PatternHash()
+    {
+        // Private constructor to prevent instantiation
+    }
+}
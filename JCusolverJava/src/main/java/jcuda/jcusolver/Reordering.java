@@ -0,0 +1,123 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * A fill-reducing ordering that was selected for a sparsity pattern
+ * by the {@link ReorderingPipeline}
+ */
+public final class Reordering
+{
+    /**
+     * The ordering that produced the permutation
+     */
+    private final SparseOrdering ordering;
+    
+    /**
+     * The permutation
+     */
+    private final int permutation[];
+    
+    /**
+     * The predicted number of nonzeros of the Cholesky factor
+     */
+    private final long predictedFill;
+    
+    /**
+     * Creates a new reordering
+     * 
+     * @param ordering The ordering
+     * @param permutation The permutation. This is not copied.
+     * @param predictedFill The predicted fill
+     */
+    Reordering(SparseOrdering ordering, int permutation[], 
+        long predictedFill)
+    {
+        this.ordering = ordering;
+        this.permutation = permutation;
+        this.predictedFill = predictedFill;
+    }
+    
+    /**
+     * Returns the ordering that produced the permutation
+     * 
+     * @return The ordering
+     */
+    public SparseOrdering getOrdering()
+    {
+        return ordering;
+    }
+    
+    /**
+     * Returns a copy of the permutation. Element k is the index of the 
+     * row and column of the original matrix that becomes row and column 
+     * k of the reordered matrix.
+     * 
+     * @return The permutation
+     */
+    public int[] getPermutation()
+    {
+        return permutation.clone();
+    }
+    
+    /**
+     * Returns the permutation without copying it
+     * 
+     * @return The permutation
+     */
+    int[] permutation()
+    {
+        return permutation;
+    }
+    
+    /**
+     * Returns the predicted number of nonzeros of the Cholesky factor 
+     * of the reordered matrix, as computed by 
+     * {@link SymbolicCholesky#countFactorNonzeros}
+     * 
+     * @return The predicted fill
+     */
+    public long getPredictedFill()
+    {
+        return predictedFill;
+    }
+    
+    /**
+     * Returns a String representation of this object.
+     *
+     * @return A String representation of this object.
+     */
+    @Override
+    public String toString()
+    {
+        return "Reordering["+
+            "ordering="+ordering+","+
+            "size="+permutation.length+","+
+            "predictedFill="+predictedFill+"]";
+    }
+}
@@ -0,0 +1,243 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.logging.Level;
+import java.util.logging.Logger;
+
+/**
+ * A cache for the {@link Reordering} instances that have been selected
+ * by a {@link ReorderingPipeline}, keyed by the {@link PatternHash} of 
+ * the sparsity pattern. <br>
+ * <br>
+ * The cache always stores the reorderings in memory. When it is created
+ * with a directory, then the reorderings are also stored in one file per
+ * pattern in this directory, so that they are available for later runs. 
+ * Files that cannot be read or written are ignored. <br>
+ * <br>
+ * This class is thread-safe.
+ */
+public class ReorderingCache
+{
+    /**
+     * The logger used in this class
+     */
+    private static final Logger logger = 
+        Logger.getLogger(ReorderingCache.class.getName());
+    
+    /**
+     * The magic number at the start of each cache file
+     */
+    private static final int MAGIC = 0x4A43524F;
+    
+    /**
+     * The version of the cache file format
+     */
+    private static final int VERSION = 1;
+    
+    /**
+     * The reorderings in memory
+     */
+    private final Map<Long, Reordering> reorderings;
+    
+    /**
+     * The directory, or <code>null</code>
+     */
+    private final Path directory;
+    
+    /**
+     * Creates a new cache that only stores the reorderings in memory
+     */
+    public ReorderingCache()
+    {
+        this(null);
+    }
+    
+    /**
+     * Creates a new cache that stores the reorderings in memory and 
+     * in the given directory. The directory will be created if it does
+     * not exist.
+     * 
+     * @param directory The directory. If this is <code>null</code>, 
+     * then the reorderings are only stored in memory.
+     */
+    public ReorderingCache(Path directory)
+    {
+        this.reorderings = new ConcurrentHashMap<Long, Reordering>();
+        this.directory = directory;
+    }
+    
+    /**
+     * Returns the reordering for the given pattern hash and size, or 
+     * <code>null</code> if there is none
+     * 
+     * @param hash The pattern hash
+     * @param n The size of the matrix
+     * @return The reordering
+     */
+    public Reordering get(long hash, int n)
+    {
+        Reordering reordering = reorderings.get(hash);
+        if (reordering == null && directory != null)
+        {
+            reordering = read(file(hash));
+            if (reordering != null)
+            {
+                reorderings.putIfAbsent(hash, reordering);
+            }
+        }
+        if (reordering != null && reordering.permutation().length != n)
+        {
+            return null;
+        }
+        return reordering;
+    }
+    
+    /**
+     * Store the given reordering for the given pattern hash
+     * 
+     * @param hash The pattern hash
+     * @param reordering The reordering
+     */
+    public void put(long hash, Reordering reordering)
+    {
+        reorderings.put(hash, reordering);
+        if (directory != null)
+        {
+            write(file(hash), reordering);
+        }
+    }
+    
+    /**
+     * Remove all reorderings from memory. Files are not deleted.
+     */
+    public void clear()
+    {
+        reorderings.clear();
+    }
+    
+    /**
+     * Returns the file for the given hash
+     * 
+     * @param hash The hash
+     * @return The file
+     */
+    private Path file(long hash)
+    {
+        return directory.resolve(String.format("%016x.ordering", hash));
+    }
+    
+    /**
+     * Read the reordering from the given file. Returns <code>null</code>
+     * if the file does not exist or cannot be read.
+     * 
+     * @param file The file
+     * @return The reordering
+     */
+    private static Reordering read(Path file)
+    {
+        if (!Files.isRegularFile(file))
+        {
+            return null;
+        }
+        try (InputStream inputStream = Files.newInputStream(file);
+            DataInputStream in = new DataInputStream(
+                new BufferedInputStream(inputStream)))
+        {
+            if (in.readInt() != MAGIC || in.readInt() != VERSION)
+            {
+                return null;
+            }
+            SparseOrdering ordering = SparseOrdering.valueOf(in.readUTF());
+            long predictedFill = in.readLong();
+            int n = in.readInt();
+            int permutation[] = new int[n];
+            for (int i = 0; i < n; i++)
+            {
+                permutation[i] = in.readInt();
+            }
+            return new Reordering(ordering, permutation, predictedFill);
+        }
+        catch (IOException | IllegalArgumentException e)
+        {
+            logger.log(Level.WARNING, "Could not read " + file, e);
+            return null;
+        }
+    }
+    
+    /**
+     * Write the given reordering to the given file. The file is written
+     * to a temporary file first, and then moved to its final location, 
+     * so that concurrent readers never see a partial file.
+     * 
+     * @param file The file
+     * @param reordering The reordering
+     */
+    private static void write(Path file, Reordering reordering)
+    {
+        try
+        {
+            Files.createDirectories(file.getParent());
+            Path temp = Files.createTempFile(
+                file.getParent(), "ordering", ".tmp");
+            try (OutputStream outputStream = Files.newOutputStream(temp);
+                DataOutputStream out = new DataOutputStream(
+                    new BufferedOutputStream(outputStream)))
+            {
+                int permutation[] = reordering.permutation();
+                out.writeInt(MAGIC);
+                out.writeInt(VERSION);
+                out.writeUTF(reordering.getOrdering().name());
+                out.writeLong(reordering.getPredictedFill());
+                out.writeInt(permutation.length);
+                for (int p : permutation)
+                {
+                    out.writeInt(p);
+                }
+            }
+            Files.move(temp, file, StandardCopyOption.REPLACE_EXISTING, 
+                StandardCopyOption.ATOMIC_MOVE);
+        }
+        catch (IOException e)
+        {
+            logger.log(Level.WARNING, "Could not write " + file, e);
+        }
+    }
+}
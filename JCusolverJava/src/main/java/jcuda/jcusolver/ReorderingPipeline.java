@@ -0,0 +1,254 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+import jcuda.CudaException;
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * A preprocessing stage that selects a fill-reducing ordering for a 
+ * square sparse matrix, and applies it. <br>
+ * <br>
+ * The candidate {@link SparseOrdering orderings} are computed in 
+ * parallel on host threads, each with its own cusolverSpHandle. They 
+ * are scored by the number of nonzeros of the Cholesky factor of the 
+ * reordered, symmetrized pattern, as predicted by the 
+ * {@link SymbolicCholesky symbolic factorization}, and the ordering 
+ * with the smallest fill is selected. The result is stored in a 
+ * {@link ReorderingCache}, so that it is not computed again for the 
+ * same sparsity pattern. <br>
+ * <br>
+ * This class is thread-safe.
+ */
+public class ReorderingPipeline
+{
+    /**
+     * The candidate orderings
+     */
+    private final List<SparseOrdering> candidates;
+    
+    /**
+     * The cache
+     */
+    private final ReorderingCache cache;
+    
+    /**
+     * The executor that computes the orderings
+     */
+    private final ExecutorService executor;
+    
+    /**
+     * Creates a new pipeline that evaluates all orderings, using one 
+     * thread for each of them
+     * 
+     * @param cache The cache
+     */
+    public ReorderingPipeline(ReorderingCache cache)
+    {
+        this(cache, Arrays.asList(SparseOrdering.values()), 
+            SparseOrdering.values().length);
+    }
+    
+    /**
+     * Creates a new pipeline
+     * 
+     * @param cache The cache
+     * @param candidates The candidate orderings
+     * @param threads The number of host threads
+     * @throws IllegalArgumentException If the list of candidates is 
+     * empty, or the number of threads is not positive
+     */
+    public ReorderingPipeline(ReorderingCache cache, 
+        List<SparseOrdering> candidates, int threads)
+    {
+        if (candidates.isEmpty())
+        {
+            throw new IllegalArgumentException(
+                "The list of candidates is empty");
+        }
+        if (threads <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The number of threads must be positive, but is " + threads);
+        }
+        this.cache = cache;
+        this.candidates = new ArrayList<SparseOrdering>(candidates);
+        this.executor = Executors.newFixedThreadPool(threads, runnable ->
+        {
+            Thread thread = new Thread(runnable, "ReorderingPipeline");
+            thread.setDaemon(true);
+            return thread;
+        });
+    }
+    
+    /**
+     * Select the ordering with the smallest predicted fill for the 
+     * given square matrix. If a reordering for the same sparsity pattern
+     * is contained in the cache, then it is returned directly. 
+     * Candidates that fail are skipped.
+     * 
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @return The reordering
+     * @throws CudaException If all candidates failed
+     */
+    public Reordering select(int n, int nnz, cusparseMatDescr descrA, 
+        int csrRowPtrA[], int csrColIndA[])
+    {
+        long hash = PatternHash.compute(n, n, nnz, csrRowPtrA, csrColIndA);
+        Reordering cached = cache.get(hash, n);
+        if (cached != null)
+        {
+            return cached;
+        }
+        int indexBase = JCusparse.cusparseGetMatIndexBase(descrA);
+        List<Future<Reordering>> futures = new ArrayList<Future<Reordering>>();
+        for (SparseOrdering ordering : candidates)
+        {
+            futures.add(executor.submit(() -> 
+                evaluate(ordering, n, nnz, descrA, indexBase, 
+                    csrRowPtrA, csrColIndA)));
+        }
+        Reordering best = null;
+        Throwable failure = null;
+        for (Future<Reordering> future : futures)
+        {
+            try
+            {
+                Reordering reordering = future.get();
+                if (best == null || 
+                    reordering.getPredictedFill() < best.getPredictedFill())
+                {
+                    best = reordering;
+                }
+            }
+            catch (ExecutionException e)
+            {
+                failure = e.getCause();
+            }
+            catch (InterruptedException e)
+            {
+                Thread.currentThread().interrupt();
+                throw new CudaException(
+                    "Interrupted while computing orderings", e);
+            }
+        }
+        if (best == null)
+        {
+            throw new CudaException("All orderings failed", failure);
+        }
+        cache.put(hash, best);
+        return best;
+    }
+    
+    /**
+     * Compute the given ordering and its predicted fill
+     * 
+     * @param ordering The ordering
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param indexBase The index base
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @return The reordering
+     */
+    private static Reordering evaluate(SparseOrdering ordering, 
+        int n, int nnz, cusparseMatDescr descrA, int indexBase, 
+        int csrRowPtrA[], int csrColIndA[])
+    {
+        cusolverSpHandle handle = new cusolverSpHandle();
+        checkSuccess(JCusolverSp.cusolverSpCreate(handle), 
+            "cusolverSpCreate");
+        try
+        {
+            int p[] = new int[n];
+            ordering.compute(handle, n, nnz, descrA, 
+                csrRowPtrA, csrColIndA, p);
+            long fill = SymbolicCholesky.countFactorNonzeros(
+                n, csrRowPtrA, csrColIndA, indexBase, p);
+            return new Reordering(ordering, p, fill);
+        }
+        finally
+        {
+            JCusolverSp.cusolverSpDestroy(handle);
+        }
+    }
+    
+    /**
+     * Apply the given reordering to the given matrix, with 
+     * {@link CsrPermuter#permuteStructure}. The given arrays are not 
+     * modified. The values of the matrix may then be reordered with 
+     * {@link CsrPermutation#permuteValues(double[], double[])}.
+     * 
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param reordering The reordering
+     * @return The reordered structure and the value map
+     * @throws CudaException If the native call failed
+     */
+    public static CsrPermutation apply(int n, int nnz, 
+        cusparseMatDescr descrA, int csrRowPtrA[], int csrColIndA[], 
+        Reordering reordering)
+    {
+        int rowPtr[] = new int[n + 1];
+        int colInd[] = new int[nnz];
+        int map[] = new int[nnz];
+        int p[] = reordering.permutation();
+        checkSuccess(CsrPermuter.permuteStructure(n, n, nnz, 
+            JCusparse.cusparseGetMatIndexBase(descrA), 
+            csrRowPtrA, csrColIndA, p, p, rowPtr, colInd, map), 
+            "permuteStructure");
+        return new CsrPermutation(rowPtr, colInd, map);
+    }
+    
+    /**
+     * Shut down the threads of this pipeline
+     */
+    public void close()
+    {
+        executor.shutdown();
+    }
+}
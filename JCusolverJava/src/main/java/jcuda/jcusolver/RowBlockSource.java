@@ -0,0 +1,78 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.io.Closeable;
+import java.io.IOException;
+
+/**
+ * A source of the rows of a dense matrix that is too large to be 
+ * stored on the device, used by the {@link StreamingRandomizedSvd}. 
+ * <br>
+ * <br>
+ * The rows are delivered in blocks, in row-major order. A source may 
+ * be opened multiple times, and each {@link Reader} must deliver the 
+ * same rows in the same order.
+ */
+public interface RowBlockSource
+{
+    /**
+     * Returns the number of columns of the matrix
+     * 
+     * @return The number of columns
+     */
+    int getColumns();
+    
+    /**
+     * Start a new pass over the rows of the matrix
+     * 
+     * @return The reader for the rows
+     * @throws IOException If an IO error occurs
+     */
+    Reader open() throws IOException;
+    
+    /**
+     * A reader for a single pass over the rows of a {@link RowBlockSource}
+     */
+    interface Reader extends Closeable
+    {
+        /**
+         * Read up to the given number of rows into the given array, in 
+         * row-major order. Fewer rows than requested may only be 
+         * returned at the end of the matrix.
+         * 
+         * @param block The array that receives the rows. Its length 
+         * must be at least maxRows*getColumns()
+         * @param maxRows The maximum number of rows to read
+         * @return The number of rows that have been read. This will be 
+         * 0 if the end of the matrix has been reached.
+         * @throws IOException If an IO error occurs
+         */
+        int read(double block[], int maxRows) throws IOException;
+    }
+}
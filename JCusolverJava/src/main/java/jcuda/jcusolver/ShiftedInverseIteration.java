@@ -0,0 +1,505 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.List;
+import java.util.Random;
+import java.util.concurrent.Future;
+
+import jcuda.Pointer;
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * A driver for cusolverSpDcsreigvsiHost that computes the eigenpairs 
+ * for many shifts of a real, square matrix that is stored on the host. 
+ * <br>
+ * <br>
+ * The shifts are sorted and grouped into clusters of shifts that are 
+ * close to each other. The clusters are processed concurrently on host
+ * threads, each with its own cusolverSpHandle. The shifts within one 
+ * cluster are processed in ascending order. The initial vector for each
+ * shift is a pseudo-random vector that is orthogonalized against the 
+ * eigenvectors that have already been computed in the same cluster. 
+ * This makes it less likely that close shifts converge back to an 
+ * eigenpair that was already found, but it does not prevent it: The 
+ * iteration amplifies any component of such an eigenvector that is 
+ * introduced by rounding errors, so two shifts may still return the 
+ * same eigenpair. (The function factors the shifted matrix internally on
+ * each call, so the factorization itself can not be shared between 
+ * shifts). <br>
+ * <br>
+ * Eigenpairs that converged to the same eigenvalue and the same 
+ * eigenvector from different shifts are reported only once. Shifts may
+ * be chosen with {@link #selectShifts(double, double, int)}, which uses
+ * the eigenvalue counts of cusolverSpDcsreigsHost. <br>
+ * <br>
+ * Instances of this class are thread-safe.
+ */
+public class ShiftedInverseIteration
+{
+    /**
+     * The minimum absolute cosine between two eigenvectors with close 
+     * eigenvalues for them to be considered as the same eigenpair
+     */
+    private static final double DUPLICATE_COSINE = 0.99;
+    
+    /**
+     * The number of rows and columns
+     */
+    private final int m;
+    
+    /**
+     * The number of nonzeros
+     */
+    private final int nnz;
+    
+    /**
+     * The matrix descriptor
+     */
+    private final cusparseMatDescr descrA;
+    
+    /**
+     * The values
+     */
+    private final double csrValA[];
+    
+    /**
+     * The row pointers
+     */
+    private final int csrRowPtrA[];
+    
+    /**
+     * The column indices
+     */
+    private final int csrColIndA[];
+    
+    /**
+     * The index base
+     */
+    private final int indexBase;
+    
+    /**
+     * The tolerance for the convergence of csreigvsi
+     */
+    private final double tolerance;
+    
+    /**
+     * The maximum number of iterations for csreigvsi
+     */
+    private final int maxIterations;
+    
+    /**
+     * The worker threads
+     */
+    private final SpWorkerPool pool;
+    
+    /**
+     * Creates a new instance. The given arrays are not copied, and must
+     * not be modified while this instance is used.
+     * 
+     * @param m The number of rows and columns
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrValA The values
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param tolerance The tolerance for the convergence of csreigvsi
+     * @param maxIterations The maximum number of iterations of csreigvsi
+     * @param threads The number of host threads
+     * @throws IllegalArgumentException If the number of threads is not
+     * positive
+     */
+    public ShiftedInverseIteration(int m, int nnz, cusparseMatDescr descrA, 
+        double csrValA[], int csrRowPtrA[], int csrColIndA[], 
+        double tolerance, int maxIterations, int threads)
+    {
+        this.m = m;
+        this.nnz = nnz;
+        this.descrA = descrA;
+        this.csrValA = csrValA;
+        this.csrRowPtrA = csrRowPtrA;
+        this.csrColIndA = csrColIndA;
+        this.indexBase = JCusparse.cusparseGetMatIndexBase(descrA);
+        this.tolerance = tolerance;
+        this.maxIterations = maxIterations;
+        this.pool = new SpWorkerPool("ShiftedInverseIteration", threads);
+    }
+    
+    /**
+     * Compute the eigenpairs for the given shifts. <br>
+     * <br>
+     * Shifts whose distance is at most the given cluster distance are 
+     * processed sequentially in the same cluster, and the initial vector
+     * of each shift is orthogonalized against the eigenvectors that were 
+     * found for the previous ones. This makes it less likely, but does 
+     * not guarantee, that different shifts of one cluster converge to 
+     * different eigenpairs. Shifts that are equal up to the tolerance 
+     * are only processed once. 
+     * 
+     * @param shifts The shifts
+     * @param clusterDistance The cluster distance
+     * @return The distinct eigenpairs, sorted by eigenvalue
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public List<Eigenpair> solve(double shifts[], double clusterDistance)
+    {
+        double sorted[] = shifts.clone();
+        Arrays.sort(sorted);
+        
+        List<Future<List<Eigenpair>>> futures = 
+            new ArrayList<Future<List<Eigenpair>>>();
+        int start = 0;
+        while (start < sorted.length)
+        {
+            List<Double> cluster = new ArrayList<Double>();
+            cluster.add(sorted[start]);
+            int end = start + 1;
+            while (end < sorted.length && 
+                sorted[end] - sorted[end - 1] <= clusterDistance)
+            {
+                double previous = cluster.get(cluster.size() - 1);
+                if (sorted[end] - previous > 
+                    tolerance * Math.max(1.0, Math.abs(previous)))
+                {
+                    cluster.add(sorted[end]);
+                }
+                end++;
+            }
+            futures.add(pool.submit(handle -> solveCluster(handle, cluster)));
+            start = end;
+        }
+        List<Eigenpair> eigenpairs = new ArrayList<Eigenpair>();
+        for (Future<List<Eigenpair>> future : futures)
+        {
+            eigenpairs.addAll(SpWorkerPool.get(future));
+        }
+        return removeDuplicates(eigenpairs, tolerance);
+    }
+    
+    /**
+     * Compute the eigenpairs for the given ascending shifts sequentially
+     * with cusolverSpDcsreigvsiHost
+     * 
+     * @param handle The handle
+     * @param shifts The shifts
+     * @return The eigenpairs
+     */
+    private List<Eigenpair> solveCluster(
+        cusolverSpHandle handle, List<Double> shifts)
+    {
+        return solveCluster(m, shifts, new ShiftSolver()
+        {
+            @Override
+            public double solve(double shift, double x0[], double x[])
+            {
+                double mu[] = { 0.0 };
+                checkSuccess(JCusolverSp.cusolverSpDcsreigvsiHost(handle, 
+                    m, nnz, descrA, Pointer.to(csrValA), 
+                    Pointer.to(csrRowPtrA), Pointer.to(csrColIndA), shift, 
+                    Pointer.to(x0), maxIterations, tolerance, 
+                    Pointer.to(mu), Pointer.to(x)), 
+                    "cusolverSpDcsreigvsiHost");
+                return mu[0];
+            }
+            
+            @Override
+            public double residual(double mu, double x[])
+            {
+                return ShiftedInverseIteration.this.residual(mu, x);
+            }
+        });
+    }
+    
+    /**
+     * The computation of a single eigenpair, as it is used for the shifts
+     * of one cluster. This is only an interface so that the handling of 
+     * the clusters can be tested without the native library.
+     */
+    interface ShiftSolver
+    {
+        /**
+         * Compute the eigenpair that is closest to the given shift
+         * 
+         * @param shift The shift
+         * @param x0 The initial vector
+         * @param x Will store the eigenvector
+         * @return The eigenvalue
+         */
+        double solve(double shift, double x0[], double x[]);
+        
+        /**
+         * Computes ||A*x - mu*x|| / ||x||
+         * 
+         * @param mu The eigenvalue
+         * @param x The eigenvector
+         * @return The residual norm
+         */
+        double residual(double mu, double x[]);
+    }
+    
+    /**
+     * Compute the eigenpairs for the given ascending shifts sequentially.
+     * The initial vector for each shift is orthogonalized against the 
+     * eigenvectors that have already been computed, so that the 
+     * iteration is less likely to converge to an eigenpair that was 
+     * already found. Rounding errors may still reintroduce components 
+     * of these eigenvectors, which are then amplified if the shift is 
+     * closest to their eigenvalue.
+     * 
+     * @param m The size of the matrix
+     * @param shifts The shifts
+     * @param solver The solver
+     * @return The eigenpairs
+     */
+    static List<Eigenpair> solveCluster(
+        int m, List<Double> shifts, ShiftSolver solver)
+    {
+        List<Eigenpair> eigenpairs = new ArrayList<Eigenpair>();
+        for (double shift : shifts)
+        {
+            double x0[] = initialVector(m, shift, eigenpairs);
+            double x[] = new double[m];
+            double mu = solver.solve(shift, x0, x);
+            eigenpairs.add(new Eigenpair(shift, mu, x, solver.residual(mu, x)));
+        }
+        return eigenpairs;
+    }
+    
+    /**
+     * Creates a pseudo-random initial vector, which is unlikely to be 
+     * orthogonal to the desired eigenvector, and orthogonalizes it 
+     * against the eigenvectors of the given eigenpairs. If nothing 
+     * remains of the vector after the orthogonalization, then the 
+     * original vector is returned.
+     * 
+     * @param m The size of the vector
+     * @param shift The shift, used as the seed
+     * @param found The eigenpairs that have already been found
+     * @return The vector
+     */
+    static double[] initialVector(int m, double shift, List<Eigenpair> found)
+    {
+        Random random = new Random(Double.doubleToLongBits(shift));
+        double x0[] = new double[m];
+        for (int i = 0; i < m; i++)
+        {
+            x0[i] = 0.5 + random.nextDouble();
+        }
+        double norm0 = norm(x0);
+        double x[] = x0.clone();
+        
+        // Modified Gram-Schmidt, repeated once for stability
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (Eigenpair eigenpair : found)
+            {
+                double v[] = eigenpair.eigenvector();
+                double vv = 0.0;
+                double vx = 0.0;
+                for (int i = 0; i < m; i++)
+                {
+                    vv += v[i] * v[i];
+                    vx += v[i] * x[i];
+                }
+                if (vv == 0.0 || Double.isNaN(vv))
+                {
+                    continue;
+                }
+                double f = vx / vv;
+                for (int i = 0; i < m; i++)
+                {
+                    x[i] -= f * v[i];
+                }
+            }
+        }
+        double norm = norm(x);
+        if (!(norm > 1e-8 * norm0))
+        {
+            return x0;
+        }
+        for (int i = 0; i < m; i++)
+        {
+            x[i] /= norm;
+        }
+        return x;
+    }
+    
+    /**
+     * Computes the euclidean norm of the given vector
+     * 
+     * @param x The vector
+     * @return The norm
+     */
+    private static double norm(double x[])
+    {
+        double xx = 0.0;
+        for (int i = 0; i < x.length; i++)
+        {
+            xx += x[i] * x[i];
+        }
+        return Math.sqrt(xx);
+    }
+    
+    /**
+     * Computes ||A*x - mu*x|| / ||x||
+     * 
+     * @param mu The eigenvalue
+     * @param x The eigenvector
+     * @return The residual norm
+     */
+    private double residual(double mu, double x[])
+    {
+        double rr = 0.0;
+        double xx = 0.0;
+        for (int r = 0; r < m; r++)
+        {
+            double ax = 0.0;
+            for (int i = csrRowPtrA[r] - indexBase; 
+                i < csrRowPtrA[r + 1] - indexBase; i++)
+            {
+                ax += csrValA[i] * x[csrColIndA[i] - indexBase];
+            }
+            double d = ax - mu * x[r];
+            rr += d * d;
+            xx += x[r] * x[r];
+        }
+        return xx == 0.0 ? Double.NaN : Math.sqrt(rr / xx);
+    }
+    
+    /**
+     * Sort the given eigenpairs by eigenvalue, and remove the ones that
+     * converged to the same eigenpair as another one. Of the duplicates,
+     * the one with the smallest residual is kept.
+     * 
+     * @param eigenpairs The eigenpairs
+     * @param tolerance The tolerance of the iteration
+     * @return The distinct eigenpairs
+     */
+    static List<Eigenpair> removeDuplicates(
+        List<Eigenpair> eigenpairs, double tolerance)
+    {
+        eigenpairs.sort(Comparator.comparingDouble(Eigenpair::getEigenvalue));
+        List<Eigenpair> result = new ArrayList<Eigenpair>();
+        for (Eigenpair candidate : eigenpairs)
+        {
+            boolean duplicate = false;
+            for (int i = result.size() - 1; i >= 0; i--)
+            {
+                Eigenpair other = result.get(i);
+                double distance = 
+                    candidate.getEigenvalue() - other.getEigenvalue();
+                double limit = Math.sqrt(tolerance) * 
+                    Math.max(1.0, Math.abs(other.getEigenvalue()));
+                if (distance > limit)
+                {
+                    break;
+                }
+                if (Math.abs(cosine(candidate.eigenvector(), 
+                    other.eigenvector())) >= DUPLICATE_COSINE)
+                {
+                    duplicate = true;
+                    if (candidate.getResidual() < other.getResidual())
+                    {
+                        result.set(i, candidate);
+                    }
+                    break;
+                }
+            }
+            if (!duplicate)
+            {
+                result.add(candidate);
+            }
+        }
+        return result;
+    }
+    
+    /**
+     * Computes the cosine of the angle between the given vectors
+     * 
+     * @param x The first vector
+     * @param y The second vector
+     * @return The cosine
+     */
+    private static double cosine(double x[], double y[])
+    {
+        double xy = 0.0;
+        double xx = 0.0;
+        double yy = 0.0;
+        for (int i = 0; i < x.length; i++)
+        {
+            xy += x[i] * y[i];
+            xx += x[i] * x[i];
+            yy += y[i] * y[i];
+        }
+        return xy / Math.sqrt(xx * yy);
+    }
+    
+    /**
+     * Select shifts for the eigenvalues in the given interval of the 
+     * real axis. <br>
+     * <br>
+     * The interval is bisected with a {@link SpectrumSlicer}, which 
+     * uses the eigenvalue counts of cusolverSpDcsreigsHost, until each 
+     * slice contains at most one eigenvalue, or twice the maximum number
+     * of shifts is reached, because empty slices are also counted. The 
+     * shifts are the centers of the non-empty slices.
+     * 
+     * @param lower The lower bound of the interval
+     * @param upper The upper bound of the interval
+     * @param maxShifts The maximum number of shifts
+     * @return The shifts, in ascending order
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public double[] selectShifts(double lower, double upper, int maxShifts)
+    {
+        double height = Math.max(1.0, upper - lower) * 0.1;
+        SpectrumSlicer slicer = new SpectrumSlicer(m, nnz, descrA, 
+            csrValA, csrRowPtrA, csrColIndA, pool, false);
+        List<SpectrumSlice> slices = slicer.bisect(lower, -height * 0.5, 
+            upper, height * 0.5, 1, 2 * maxShifts, true);
+        return slices.stream()
+            .filter(s -> s.getCount() > 0)
+            .mapToDouble(s -> (s.getReLower() + s.getReUpper()) * 0.5)
+            .limit(maxShifts)
+            .toArray();
+    }
+    
+    /**
+     * Shut down the worker threads and destroy their handles
+     */
+    public void close()
+    {
+        pool.close();
+    }
+}
@@ -0,0 +1,171 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+import java.util.function.Function;
+
+import jcuda.CudaException;
+
+/**
+ * Package-private pool of host threads, each of which owns its own 
+ * cusolverSpHandle, for running the host functions of cusolverSp 
+ * concurrently. The handles are created lazily, the first time that 
+ * a worker thread executes a task, and destroyed when the pool is 
+ * closed.
+ */
+class SpWorkerPool
+{
+    /**
+     * The executor
+     */
+    private final ExecutorService executor;
+    
+    /**
+     * The handle of each worker thread
+     */
+    private final ThreadLocal<cusolverSpHandle> handles;
+    
+    /**
+     * All handles that have been created
+     */
+    private final List<cusolverSpHandle> createdHandles;
+    
+    /**
+     * Creates a new pool
+     * 
+     * @param name The name of the worker threads
+     * @param threads The number of threads
+     * @throws IllegalArgumentException If the number of threads is not
+     * positive
+     */
+    SpWorkerPool(String name, int threads)
+    {
+        if (threads <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The number of threads must be positive, but is " + threads);
+        }
+        this.createdHandles = new ArrayList<cusolverSpHandle>();
+        this.handles = ThreadLocal.withInitial(() -> 
+        {
+            cusolverSpHandle handle = new cusolverSpHandle();
+            checkSuccess(JCusolverSp.cusolverSpCreate(handle), 
+                "cusolverSpCreate");
+            synchronized (createdHandles)
+            {
+                createdHandles.add(handle);
+            }
+            return handle;
+        });
+        this.executor = Executors.newFixedThreadPool(threads, runnable ->
+        {
+            Thread thread = new Thread(runnable, name);
+            thread.setDaemon(true);
+            return thread;
+        });
+    }
+    
+    /**
+     * Submit the given task, which receives the handle of the worker 
+     * thread that executes it
+     * 
+     * @param <T> The result type
+     * @param task The task
+     * @return The future
+     */
+    <T> Future<T> submit(Function<cusolverSpHandle, T> task)
+    {
+        Callable<T> callable = () -> task.apply(handles.get());
+        return executor.submit(callable);
+    }
+    
+    /**
+     * Wait for the given future, and return its result
+     * 
+     * @param <T> The result type
+     * @param future The future
+     * @return The result
+     * @throws CudaException If the task caused a CudaException, or the 
+     * thread was interrupted
+     */
+    static <T> T get(Future<T> future)
+    {
+        try
+        {
+            return future.get();
+        }
+        catch (ExecutionException e)
+        {
+            Throwable cause = e.getCause();
+            if (cause instanceof RuntimeException)
+            {
+                throw (RuntimeException)cause;
+            }
+            throw new CudaException("Task failed", cause);
+        }
+        catch (InterruptedException e)
+        {
+            Thread.currentThread().interrupt();
+            throw new CudaException("Interrupted while waiting for a task", e);
+        }
+    }
+    
+    /**
+     * Shut down the threads, and destroy the handles
+     */
+    void close()
+    {
+        executor.shutdown();
+        try
+        {
+            executor.awaitTermination(Long.MAX_VALUE, TimeUnit.DAYS);
+        }
+        catch (InterruptedException e)
+        {
+            Thread.currentThread().interrupt();
+        }
+        synchronized (createdHandles)
+        {
+            for (cusolverSpHandle handle : createdHandles)
+            {
+                JCusolverSp.cusolverSpDestroy(handle);
+            }
+            createdHandles.clear();
+        }
+    }
+}
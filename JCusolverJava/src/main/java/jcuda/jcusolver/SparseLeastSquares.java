@@ -0,0 +1,285 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+import jcuda.NativePointerObject;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * A least squares solver for a sparse m-by-n matrix A, with m &gt;= n, 
+ * that is stored on the host, and that is used with many right hand 
+ * sides. <br>
+ * <br>
+ * When the solver is created, the rank of A and the column permutation
+ * are determined once with the rank-revealing QR of 
+ * cusolverSpDcsrlsqvqrHost. If A has full column rank, then it is 
+ * factored once with the sparse host QR of cuSOLVER, and the factors 
+ * are reused for all right hand sides. <br>
+ * <br>
+ * If A is rank deficient, then nothing is reused: Each right hand side
+ * is solved with a separate call to cusolverSpDcsrlsqvqrHost, which 
+ * computes the rank-revealing QR of A again, so that each solve costs 
+ * as much as the initial factorization. cuSOLVER does not expose the 
+ * factors of this QR. <br>
+ * <br>
+ * In both cases, all columns of a multi-column right hand side are 
+ * solved in a single native call, which also computes the residual 
+ * norms ||A*x - b|| of all columns. <br>
+ * <br>
+ * Instances of this class are thread-safe. The matrix descriptor must
+ * not be destroyed while the solver is used.
+ */
+public class SparseLeastSquares
+{
+    /**
+     * The native factorization
+     */
+    private static class Factorization extends NativePointerObject
+    {
+        // Only used for storing the native pointer
+    }
+    
+    /**
+     * The result of a solve
+     */
+    public static final class Result
+    {
+        /**
+         * The solutions
+         */
+        private final double x[];
+        
+        /**
+         * The residual norms
+         */
+        private final double residualNorms[];
+        
+        /**
+         * Creates a new result
+         * 
+         * @param x The solutions
+         * @param residualNorms The residual norms
+         */
+        Result(double x[], double residualNorms[])
+        {
+            this.x = x;
+            this.residualNorms = residualNorms;
+        }
+        
+        /**
+         * Returns the solutions, as an n-by-nrhs matrix in column-major 
+         * order with a leading dimension of n
+         * 
+         * @return The solutions
+         */
+        public double[] getSolutions()
+        {
+            return x;
+        }
+        
+        /**
+         * Returns the residual norm ||A*x - b|| of each column
+         * 
+         * @return The residual norms
+         */
+        public double[] getResidualNorms()
+        {
+            return residualNorms;
+        }
+    }
+    
+    /**
+     * The handle
+     */
+    private final cusolverSpHandle handle;
+    
+    /**
+     * The number of rows
+     */
+    private final int m;
+    
+    /**
+     * The number of columns
+     */
+    private final int n;
+    
+    /**
+     * The rank of the matrix
+     */
+    private final int rank;
+    
+    /**
+     * The column permutation of the rank-revealing QR
+     */
+    private final int p[];
+    
+    /**
+     * The native factorization
+     */
+    private final Factorization factorization;
+    
+    static
+    {
+        JCusolver.initialize(JCusolver.INIT_POINTER_FIELDS);
+    }
+    
+    /**
+     * Creates a new solver for the given matrix. The matrix is copied.
+     * 
+     * @param handle The handle
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrValA The values
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param tol The tolerance for deciding the rank
+     * @throws IllegalArgumentException If m &lt; n, or the arrays are
+     * too small
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public SparseLeastSquares(cusolverSpHandle handle, int m, int n, 
+        int nnz, cusparseMatDescr descrA, double csrValA[], 
+        int csrRowPtrA[], int csrColIndA[], double tol)
+    {
+        if (m < n)
+        {
+            throw new IllegalArgumentException(
+                "The matrix must have at least as many rows as columns, "
+                + "but has " + m + " rows and " + n + " columns");
+        }
+        if (csrValA.length < nnz || csrRowPtrA.length < m + 1 || 
+            csrColIndA.length < nnz)
+        {
+            throw new IllegalArgumentException(
+                "The matrix arrays are too small for m=" + m 
+                + " and nnz=" + nnz);
+        }
+        this.handle = handle;
+        this.m = m;
+        this.n = n;
+        this.p = new int[n];
+        this.factorization = new Factorization();
+        int rankA[] = { 0 };
+        checkSuccess(factorNative(handle, m, n, nnz, descrA, csrValA, 
+            csrRowPtrA, csrColIndA, tol, factorization, rankA, p), 
+            "SparseLeastSquares factor");
+        this.rank = rankA[0];
+    }
+    private static native int factorNative(cusolverSpHandle handle, 
+        int m, int n, int nnz, cusparseMatDescr descrA, double csrValA[], 
+        int csrRowPtrA[], int csrColIndA[], double tol, 
+        Factorization factorization, int rankA[], int p[]);
+    
+    /**
+     * Returns the numerical rank of the matrix
+     * 
+     * @return The rank
+     */
+    public int getRank()
+    {
+        return rank;
+    }
+    
+    /**
+     * Returns whether the matrix has full column rank, so that the 
+     * QR factorization is reused for all right hand sides
+     * 
+     * @return Whether the matrix has full column rank
+     */
+    public boolean hasFullRank()
+    {
+        return rank == n;
+    }
+    
+    /**
+     * Returns a copy of the column permutation of the rank-revealing QR
+     * 
+     * @return The permutation
+     */
+    public int[] getPermutation()
+    {
+        return p.clone();
+    }
+    
+    /**
+     * Solve the least squares problems for a single right hand side
+     * 
+     * @param b The right hand side, with m elements
+     * @return The result
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public Result solve(double b[])
+    {
+        return solve(b, m, 1);
+    }
+    
+    /**
+     * Solve the least squares problems for all columns of the given 
+     * m-by-nrhs matrix, which is stored in column-major order
+     * 
+     * @param b The right hand sides
+     * @param ldb The leading dimension of b, at least m
+     * @param nrhs The number of right hand sides
+     * @return The result
+     * @throws IllegalArgumentException If the leading dimension or the
+     * array is too small
+     * @throws IllegalStateException If the solver was closed
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public synchronized Result solve(double b[], int ldb, int nrhs)
+    {
+        if (ldb < m || b.length < (long)ldb * nrhs)
+        {
+            throw new IllegalArgumentException(
+                "The right hand side array is too small for ldb=" + ldb 
+                + " and nrhs=" + nrhs);
+        }
+        double x[] = new double[n * nrhs];
+        double residualNorms[] = new double[nrhs];
+        checkSuccess(solveNative(handle, factorization, b, ldb, nrhs, 
+            x, n, residualNorms), "SparseLeastSquares solve");
+        return new Result(x, residualNorms);
+    }
+    private static native int solveNative(cusolverSpHandle handle, 
+        Factorization factorization, double b[], int ldb, int nrhs, 
+        double x[], int ldx, double residualNorms[]);
+    
+    /**
+     * Release the native factorization. Subsequent calls to the solve
+     * methods will cause an IllegalStateException.
+     */
+    public synchronized void close()
+    {
+        destroyNative(factorization);
+    }
+    private static native void destroyNative(Factorization factorization);
+}
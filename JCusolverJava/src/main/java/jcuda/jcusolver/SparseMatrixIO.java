@@ -0,0 +1,217 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.io.IOException;
+
+import jcuda.NativePointerObject;
+import jcuda.Pointer;
+
+/**
+ * Native readers and writers for sparse matrices, which produce
+ * {@link HostCsrMatrix} instances in page-locked host memory, ready
+ * for asynchronous upload. <br>
+ * <br>
+ * Two formats are supported:
+ * <ul>
+ *   <li>
+ *     Matrix Market files, in coordinate or array format, with real, 
+ *     integer, complex or pattern values, and general, symmetric, 
+ *     skew-symmetric or hermitian symmetry. The files are memory-mapped 
+ *     and parsed by multiple host threads, and the symmetric entries 
+ *     are expanded, so that the result always contains the full matrix.
+ *     The entries are converted to CSR in parallel, with sorted column 
+ *     indices in each row.
+ *   </li>
+ *   <li>
+ *     A compact binary CSR format, which is read with a parallel copy
+ *     from a memory mapping. It consists of a 40 byte header, with the 
+ *     int32 magic number 0x5253434A, the int32 version 1, int32 flags
+ *     (1 for complex values), 4 unused bytes, and the int64 values 
+ *     m, n and nnz, followed by the int32 row pointers, the int32 
+ *     column indices, zero padding to a multiple of 8 bytes, and the 
+ *     values. The row pointers and column indices are zero-based. 
+ *     All values are stored in the native byte order of the machine 
+ *     that wrote the file, which is little-endian on all platforms that
+ *     are supported by CUDA. Files with a different byte order are 
+ *     recognized by their magic number, and rejected. When the file is
+ *     opened, the structure is validated in parallel: The row pointers
+ *     must start at 0, not decrease, and end at nnz, and the column 
+ *     indices must be in [0, n).
+ *   </li>
+ * </ul>
+ */
+public final class SparseMatrixIO
+{
+    /**
+     * The native state of a reader
+     */
+    private static class Reader extends NativePointerObject
+    {
+        // Only used for storing the native pointer
+    }
+    
+    /**
+     * The indices of the header values. These must match the 
+     * definitions in SparseMatrixIO.cpp
+     */
+    private static final int HEADER_M = 0;
+    private static final int HEADER_N = 1;
+    private static final int HEADER_NNZ = 2;
+    private static final int HEADER_COMPLEX = 3;
+    private static final int HEADER_COUNT = 4;
+    
+    static
+    {
+        JCusolver.initialize(JCusolver.INIT_POINTER_FIELDS);
+    }
+    
+    /**
+     * Read the given Matrix Market file
+     * 
+     * @param path The path of the file
+     * @return The matrix
+     * @throws IOException If the file can not be read, is not a valid
+     * Matrix Market file, or the matrix is too large for 32 bit indices
+     */
+    public static HostCsrMatrix readMatrixMarket(String path) 
+        throws IOException
+    {
+        Reader reader = new Reader();
+        long header[] = new long[HEADER_COUNT];
+        openMatrixMarketNative(path, reader, header);
+        return read(reader, header);
+    }
+    private static native int openMatrixMarketNative(
+        String path, Reader reader, long header[]) throws IOException;
+    
+    /**
+     * Read the given binary CSR file
+     * 
+     * @param path The path of the file
+     * @return The matrix
+     * @throws IOException If the file can not be read, is not a valid 
+     * binary CSR file, was written with a different byte order, or 
+     * contains an invalid CSR structure
+     */
+    public static HostCsrMatrix readBinary(String path) throws IOException
+    {
+        Reader reader = new Reader();
+        long header[] = new long[HEADER_COUNT];
+        openBinaryNative(path, reader, header);
+        return read(reader, header);
+    }
+    private static native int openBinaryNative(
+        String path, Reader reader, long header[]) throws IOException;
+    
+    /**
+     * Allocate the matrix for the given header, and read the data of
+     * the given reader into it
+     * 
+     * @param reader The reader
+     * @param header The header
+     * @return The matrix
+     */
+    private static HostCsrMatrix read(Reader reader, long header[])
+    {
+        try
+        {
+            HostCsrMatrix matrix = new HostCsrMatrix(
+                (int)header[HEADER_M], (int)header[HEADER_N], 
+                (int)header[HEADER_NNZ], header[HEADER_COMPLEX] != 0);
+            try
+            {
+                JCusolver.checkSuccess(readNative(reader, 
+                    matrix.getCsrRowPtr(), matrix.getCsrColInd(), 
+                    matrix.getCsrVal()), "SparseMatrixIO read");
+            }
+            catch (RuntimeException e)
+            {
+                matrix.close();
+                throw e;
+            }
+            return matrix;
+        }
+        finally
+        {
+            destroyNative(reader);
+        }
+    }
+    private static native int readNative(Reader reader, 
+        Pointer csrRowPtr, Pointer csrColInd, Pointer csrVal);
+    private static native void destroyNative(Reader reader);
+    
+    /**
+     * Write the given matrix to the given file, in the binary CSR format
+     * 
+     * @param path The path of the file
+     * @param matrix The matrix
+     * @throws IOException If the file can not be written
+     */
+    public static void writeBinary(String path, HostCsrMatrix matrix) 
+        throws IOException
+    {
+        writeBinary(path, matrix.getRows(), matrix.getColumns(), 
+            matrix.getNnz(), matrix.isComplex(), matrix.getCsrRowPtr(), 
+            matrix.getCsrColInd(), matrix.getCsrVal());
+    }
+    
+    /**
+     * Write the given matrix to the given file, in the binary CSR format.
+     * The pointers may point to Java arrays or to host memory. The 
+     * row pointers and column indices must be zero-based.
+     * 
+     * @param path The path of the file
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param complex Whether the values are complex
+     * @param csrRowPtr The m+1 row pointers
+     * @param csrColInd The nnz column indices
+     * @param csrVal The nnz real or complex values
+     * @throws IOException If the file can not be written
+     */
+    public static void writeBinary(String path, int m, int n, int nnz, 
+        boolean complex, Pointer csrRowPtr, Pointer csrColInd, 
+        Pointer csrVal) throws IOException
+    {
+        writeBinaryNative(path, m, n, nnz, complex, 
+            csrRowPtr, csrColInd, csrVal);
+    }
+    private static native int writeBinaryNative(String path, 
+        int m, int n, int nnz, boolean complex, Pointer csrRowPtr, 
+        Pointer csrColInd, Pointer csrVal) throws IOException;
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private SparseMatrixIO()
+    {
+        // Private constructor to prevent instantiation
+    }
+}
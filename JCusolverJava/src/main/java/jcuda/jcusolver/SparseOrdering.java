@@ -0,0 +1,136 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.util.Arrays;
+
+import jcuda.Pointer;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * The fill-reducing orderings that are offered by the host functions 
+ * of cusolverSp
+ */
+public enum SparseOrdering
+{
+    /**
+     * Symmetric reverse Cuthill-McKee, cusolverSpXcsrsymrcmHost
+     */
+    SYMRCM
+    {
+        @Override
+        void compute(cusolverSpHandle handle, int n, int nnz, 
+            cusparseMatDescr descrA, int csrRowPtrA[], int csrColIndA[], 
+            int p[])
+        {
+            JCusolver.checkSuccess(JCusolverSp.cusolverSpXcsrsymrcmHost(
+                handle, n, nnz, descrA, Pointer.to(csrRowPtrA), 
+                Pointer.to(csrColIndA), Pointer.to(p)), 
+                "cusolverSpXcsrsymrcmHost");
+        }
+    },
+    
+    /**
+     * Symmetric minimum degree with quotient graph, 
+     * cusolverSpXcsrsymmdqHost
+     */
+    SYMMDQ
+    {
+        @Override
+        void compute(cusolverSpHandle handle, int n, int nnz, 
+            cusparseMatDescr descrA, int csrRowPtrA[], int csrColIndA[], 
+            int p[])
+        {
+            JCusolver.checkSuccess(JCusolverSp.cusolverSpXcsrsymmdqHost(
+                handle, n, nnz, descrA, Pointer.to(csrRowPtrA), 
+                Pointer.to(csrColIndA), Pointer.to(p)), 
+                "cusolverSpXcsrsymmdqHost");
+        }
+    },
+    
+    /**
+     * Symmetric approximate minimum degree, cusolverSpXcsrsymamdHost
+     */
+    SYMAMD
+    {
+        @Override
+        void compute(cusolverSpHandle handle, int n, int nnz, 
+            cusparseMatDescr descrA, int csrRowPtrA[], int csrColIndA[], 
+            int p[])
+        {
+            JCusolver.checkSuccess(JCusolverSp.cusolverSpXcsrsymamdHost(
+                handle, n, nnz, descrA, Pointer.to(csrRowPtrA), 
+                Pointer.to(csrColIndA), Pointer.to(p)), 
+                "cusolverSpXcsrsymamdHost");
+        }
+    },
+    
+    /**
+     * Nested dissection with METIS, cusolverSpXcsrmetisndHost, using 
+     * the default options
+     */
+    METISND
+    {
+        @Override
+        void compute(cusolverSpHandle handle, int n, int nnz, 
+            cusparseMatDescr descrA, int csrRowPtrA[], int csrColIndA[], 
+            int p[])
+        {
+            // METIS uses the default for every option that is -1
+            long options[] = new long[METIS_NOPTIONS];
+            Arrays.fill(options, -1);
+            JCusolver.checkSuccess(JCusolverSp.cusolverSpXcsrmetisndHost(
+                handle, n, nnz, descrA, Pointer.to(csrRowPtrA), 
+                Pointer.to(csrColIndA), options, Pointer.to(p)), 
+                "cusolverSpXcsrmetisndHost");
+        }
+    };
+    
+    /**
+     * The size of the METIS options array
+     */
+    private static final int METIS_NOPTIONS = 40;
+    
+    /**
+     * Compute this ordering for the given square matrix. The permutation
+     * is written into the given array, with p[k] being the index of the 
+     * row and column of A that becomes row and column k.
+     * 
+     * @param handle The handle
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param p The permutation, with n elements
+     * @throws jcuda.CudaException If the native call failed
+     */
+    abstract void compute(cusolverSpHandle handle, int n, int nnz, 
+        cusparseMatDescr descrA, int csrRowPtrA[], int csrColIndA[], 
+        int p[]);
+}
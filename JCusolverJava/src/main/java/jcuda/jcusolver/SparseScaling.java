@@ -0,0 +1,130 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * Native host functions for scaling sparse matrices in CSR format, and
+ * for permuting and scaling dense vectors, used by the 
+ * {@link UnsymmetricTransform}. <br>
+ * <br>
+ * All functions use multiple host threads. They validate the array 
+ * lengths, the structures and the permutations, and return 
+ * CUSOLVER_STATUS_INVALID_VALUE if they are not valid.
+ */
+final class SparseScaling
+{
+    static
+    {
+        JCusolver.initialize();
+    }
+    
+    /**
+     * Compute power-of-two row and column scaling factors r and c, so 
+     * that the largest absolute value in each row and column of 
+     * diag(r)*A*diag(c) is in [0.5, 1). The values of A are not modified.
+     * 
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param indexBase The index base
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param csrValA The values
+     * @param rowScale Will store the m row scaling factors
+     * @param colScale Will store the n column scaling factors
+     * @return The {@link cusolverStatus}. This is 
+     * CUSOLVER_STATUS_INVALID_VALUE if the structure is invalid.
+     */
+    static native int equilibrateNative(int m, int n, int nnz, 
+        int indexBase, int csrRowPtrA[], int csrColIndA[], 
+        double csrValA[], double rowScale[], double colScale[]);
+    
+    /**
+     * Compute the values of diag(r)*B*diag(c), where the values of B are 
+     * given by csrValB[k] = csrValA[map[k]], and B has the given 
+     * structure.
+     * 
+     * @param m The number of rows
+     * @param nnz The number of nonzeros
+     * @param indexBase The index base
+     * @param csrRowPtrB The row pointers of B
+     * @param csrColIndB The column indices of B
+     * @param csrValA The values of A
+     * @param map The value map. May be <code>null</code>, meaning the 
+     * identity.
+     * @param rowScale The row scaling factors
+     * @param colScale The column scaling factors
+     * @param csrValB Will store the scaled values
+     * @return The {@link cusolverStatus}. This is 
+     * CUSOLVER_STATUS_INVALID_VALUE if the structure or the map is 
+     * invalid.
+     */
+    static native int scaleValuesNative(int m, int nnz, int indexBase, 
+        int csrRowPtrB[], int csrColIndB[], double csrValA[], int map[], 
+        double rowScale[], double colScale[], double csrValB[]);
+    
+    /**
+     * Compute dst[k] = scale[k] * src[p[k]] for each of the nrhs columns
+     * 
+     * @param n The number of rows
+     * @param nrhs The number of columns
+     * @param src The source
+     * @param ldSrc The leading dimension of the source
+     * @param p The permutation. May be <code>null</code>.
+     * @param scale The scaling factors. May be <code>null</code>.
+     * @param dst The destination
+     * @param ldDst The leading dimension of the destination
+     * @return The {@link cusolverStatus}
+     */
+    static native int gatherNative(int n, int nrhs, double src[], 
+        int ldSrc, int p[], double scale[], double dst[], int ldDst);
+    
+    /**
+     * Compute dst[p[k]] = scale[k] * src[k] for each of the nrhs columns
+     * 
+     * @param n The number of rows
+     * @param nrhs The number of columns
+     * @param src The source
+     * @param ldSrc The leading dimension of the source
+     * @param p The permutation. May be <code>null</code>.
+     * @param scale The scaling factors. May be <code>null</code>.
+     * @param dst The destination
+     * @param ldDst The leading dimension of the destination
+     * @return The {@link cusolverStatus}
+     */
+    static native int scatterNative(int n, int nrhs, double src[], 
+        int ldSrc, int p[], double scale[], double dst[], int ldDst);
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private SparseScaling()
+    {
+        // Private constructor to prevent instantiation
+    }
+}
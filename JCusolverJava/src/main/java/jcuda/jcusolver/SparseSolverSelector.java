@@ -0,0 +1,354 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.DeviceMemory.allocate;
+import static jcuda.jcusolver.DeviceMemory.copy;
+import static jcuda.jcusolver.DeviceMemory.free;
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyDeviceToHost;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyHostToDevice;
+
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+
+import jcuda.CudaException;
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * A class that solves sparse linear systems A*x = b, with a square 
+ * matrix A in CSR format that is stored on the host, and automatically 
+ * selects the solver based on the {@link StructureAnalysis} of A. <br>
+ * <br>
+ * The solver is selected as described in {@link #select}. When the
+ * Cholesky factorization reports that a matrix is not positive 
+ * definite, the system is solved again with the LU factorization on 
+ * the host, and the pattern of the matrix is no longer routed to the 
+ * Cholesky factorization. <br>
+ * <br>
+ * Each matrix is analyzed when it is solved, without using the cache 
+ * of the {@link StructureAnalyzer}: The selection depends on the 
+ * numeric symmetry and on the diagonal, which may differ between 
+ * matrices with the same pattern, and cusolverSpDcsrlsvchol only reads
+ * the lower triangle, so that it would silently compute a wrong 
+ * solution for an unsymmetric matrix. The analysis is a single pass 
+ * over the matrix, which is cheap compared to the factorization. <br>
+ * <br>
+ * Instances of this class are thread-safe if the handle is only used
+ * by one thread at a time. The matrix descriptors must describe general
+ * matrices.
+ */
+public class SparseSolverSelector
+{
+    /**
+     * The solvers that may be selected
+     */
+    public enum Solver
+    {
+        /**
+         * The sparse Cholesky factorization on the device, 
+         * cusolverSpDcsrlsvchol
+         */
+        CHOLESKY,
+        
+        /**
+         * The sparse LU factorization with partial pivoting on the host, 
+         * cusolverSpDcsrlsvluHost
+         */
+        LU_HOST,
+        
+        /**
+         * The sparse QR factorization on the device, cusolverSpDcsrlsvqr
+         */
+        QR
+    }
+    
+    /**
+     * The result of a solve
+     */
+    public static final class Result
+    {
+        /**
+         * The solver that computed the solution
+         */
+        private final Solver solver;
+        
+        /**
+         * The singularity
+         */
+        private final int singularity;
+        
+        /**
+         * Creates a new result
+         * 
+         * @param solver The solver
+         * @param singularity The singularity
+         */
+        Result(Solver solver, int singularity)
+        {
+            this.solver = solver;
+            this.singularity = singularity;
+        }
+        
+        /**
+         * Returns the solver that computed the solution
+         * 
+         * @return The solver
+         */
+        public Solver getSolver()
+        {
+            return solver;
+        }
+        
+        /**
+         * Returns the singularity that was reported by the solver. This
+         * is -1 if the matrix is invertible, and otherwise the smallest
+         * index of a pivot that is smaller than the tolerance.
+         * 
+         * @return The singularity
+         */
+        public int getSingularity()
+        {
+            return singularity;
+        }
+        
+        /**
+         * Returns whether the solver reported that the matrix is singular
+         * 
+         * @return Whether the matrix is singular
+         */
+        public boolean isSingular()
+        {
+            return singularity >= 0;
+        }
+        
+        @Override
+        public String toString()
+        {
+            return "Result["+
+                "solver="+solver+","+
+                "singularity="+singularity+"]";
+        }
+    }
+    
+    /**
+     * The handle
+     */
+    private final cusolverSpHandle handle;
+    
+    /**
+     * The analyzer
+     */
+    private final StructureAnalyzer analyzer;
+    
+    /**
+     * The pattern hashes of matrices for which the Cholesky factorization
+     * failed
+     */
+    private final Set<Long> notPositiveDefinite;
+    
+    /**
+     * Creates a new selector
+     * 
+     * @param handle The handle
+     * @param analyzer The analyzer, whose tolerance is used for the 
+     * numeric symmetry. It may be shared between several selectors.
+     */
+    public SparseSolverSelector(
+        cusolverSpHandle handle, StructureAnalyzer analyzer)
+    {
+        this.handle = handle;
+        this.analyzer = analyzer;
+        this.notPositiveDefinite = 
+            ConcurrentHashMap.<Long, Boolean>newKeySet();
+    }
+    
+    /**
+     * Select the solver for a matrix with the given analysis:
+     * <ul>
+     *   <li>
+     *     {@link Solver#CHOLESKY} if the matrix is likely to be 
+     *     symmetric positive definite
+     *   </li>
+     *   <li>
+     *     {@link Solver#QR} if the matrix contains empty rows or rows 
+     *     without a diagonal entry, which are often structurally 
+     *     rank deficient, and for which QR is more robust
+     *   </li>
+     *   <li>
+     *     {@link Solver#LU_HOST} otherwise
+     *   </li>
+     * </ul>
+     * 
+     * @param analysis The analysis
+     * @return The solver
+     */
+    public static Solver select(StructureAnalysis analysis)
+    {
+        if (analysis.isLikelySpd())
+        {
+            return Solver.CHOLESKY;
+        }
+        if (analysis.getEmptyRows() > 0 || analysis.getMissingDiagonal() > 0)
+        {
+            return Solver.QR;
+        }
+        return Solver.LU_HOST;
+    }
+    
+    /**
+     * Solve A*x = b with the solver that is selected for A
+     * 
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrValA The values
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param b The right hand side
+     * @param tol The tolerance for deciding singularity
+     * @param reorder The reordering scheme, as described in the
+     * documentation of the cusolverSp&lt;t&gt;csrlsv&lt;x&gt; functions
+     * @param x Will store the solution
+     * @return The result
+     * @throws IllegalArgumentException If the matrix contains duplicate
+     * entries, or an array is too small
+     * @throws CudaException If a solver fails
+     */
+    public Result solve(int n, int nnz, cusparseMatDescr descrA, 
+        double csrValA[], int csrRowPtrA[], int csrColIndA[], 
+        double b[], double tol, int reorder, double x[])
+    {
+        if (b.length < n || x.length < n)
+        {
+            throw new IllegalArgumentException(
+                "The vectors must have a length of at least " + n);
+        }
+        StructureAnalysis analysis = StructureAnalyzer.analyzeUncached(
+            n, n, nnz, JCusparse.cusparseGetMatIndexBase(descrA), 
+            csrValA, csrRowPtrA, csrColIndA, analyzer.getTolerance());
+        long hash = PatternHash.compute(n, n, nnz, csrRowPtrA, csrColIndA);
+        if (analysis.getDuplicateEntries() > 0)
+        {
+            throw new IllegalArgumentException(
+                "The matrix contains " + analysis.getDuplicateEntries() 
+                + " duplicate entries");
+        }
+        Solver solver = select(analysis);
+        if (solver == Solver.CHOLESKY && notPositiveDefinite.contains(hash))
+        {
+            solver = Solver.LU_HOST;
+        }
+        int singularity = solve(solver, n, nnz, descrA, 
+            csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x);
+        if (solver == Solver.CHOLESKY && singularity >= 0)
+        {
+            notPositiveDefinite.add(hash);
+            solver = Solver.LU_HOST;
+            singularity = solve(solver, n, nnz, descrA, 
+                csrValA, csrRowPtrA, csrColIndA, b, tol, reorder, x);
+        }
+        return new Result(solver, singularity);
+    }
+    
+    /**
+     * Solve A*x = b with the given solver
+     * 
+     * @param solver The solver
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrValA The values
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param b The right hand side
+     * @param tol The tolerance
+     * @param reorder The reordering scheme
+     * @param x The solution
+     * @return The singularity
+     */
+    private int solve(Solver solver, int n, int nnz, cusparseMatDescr descrA, 
+        double csrValA[], int csrRowPtrA[], int csrColIndA[], 
+        double b[], double tol, int reorder, double x[])
+    {
+        int singularity[] = { -1 };
+        if (solver == Solver.LU_HOST)
+        {
+            checkSuccess(JCusolverSp.cusolverSpDcsrlsvluHost(handle, 
+                n, nnz, descrA, Pointer.to(csrValA), Pointer.to(csrRowPtrA),
+                Pointer.to(csrColIndA), Pointer.to(b), tol, reorder, 
+                Pointer.to(x), singularity), "cusolverSpDcsrlsvluHost");
+            return singularity[0];
+        }
+        Pointer dCsrValA = null;
+        Pointer dCsrRowPtrA = null;
+        Pointer dCsrColIndA = null;
+        Pointer dB = null;
+        Pointer dX = null;
+        try
+        {
+            dCsrValA = allocate((long)nnz * Sizeof.DOUBLE);
+            dCsrRowPtrA = allocate((long)(n + 1) * Sizeof.INT);
+            dCsrColIndA = allocate((long)nnz * Sizeof.INT);
+            dB = allocate((long)n * Sizeof.DOUBLE);
+            dX = allocate((long)n * Sizeof.DOUBLE);
+            copy(dCsrValA, Pointer.to(csrValA), 
+                (long)nnz * Sizeof.DOUBLE, cudaMemcpyHostToDevice);
+            copy(dCsrRowPtrA, Pointer.to(csrRowPtrA), 
+                (long)(n + 1) * Sizeof.INT, cudaMemcpyHostToDevice);
+            copy(dCsrColIndA, Pointer.to(csrColIndA), 
+                (long)nnz * Sizeof.INT, cudaMemcpyHostToDevice);
+            copy(dB, Pointer.to(b), 
+                (long)n * Sizeof.DOUBLE, cudaMemcpyHostToDevice);
+            if (solver == Solver.CHOLESKY)
+            {
+                checkSuccess(JCusolverSp.cusolverSpDcsrlsvchol(handle, 
+                    n, nnz, descrA, dCsrValA, dCsrRowPtrA, dCsrColIndA, 
+                    dB, tol, reorder, dX, singularity), 
+                    "cusolverSpDcsrlsvchol");
+            }
+            else
+            {
+                checkSuccess(JCusolverSp.cusolverSpDcsrlsvqr(handle, 
+                    n, nnz, descrA, dCsrValA, dCsrRowPtrA, dCsrColIndA, 
+                    dB, tol, reorder, dX, singularity), 
+                    "cusolverSpDcsrlsvqr");
+            }
+            copy(Pointer.to(x), dX, 
+                (long)n * Sizeof.DOUBLE, cudaMemcpyDeviceToHost);
+        }
+        finally
+        {
+            free(dCsrValA, dCsrRowPtrA, dCsrColIndA, dB, dX);
+        }
+        return singularity[0];
+    }
+}
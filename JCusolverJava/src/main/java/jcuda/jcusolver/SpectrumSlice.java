@@ -0,0 +1,154 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * A rectangle in the complex plane, together with the number of 
+ * eigenvalues that it contains, as computed by the 
+ * {@link SpectrumSlicer}
+ */
+public final class SpectrumSlice
+{
+    /**
+     * The lower bound of the real part
+     */
+    private final double reLower;
+    
+    /**
+     * The lower bound of the imaginary part
+     */
+    private final double imLower;
+    
+    /**
+     * The upper bound of the real part
+     */
+    private final double reUpper;
+    
+    /**
+     * The upper bound of the imaginary part
+     */
+    private final double imUpper;
+    
+    /**
+     * The number of eigenvalues
+     */
+    private final int count;
+    
+    /**
+     * Creates a new slice
+     * 
+     * @param reLower The lower bound of the real part
+     * @param imLower The lower bound of the imaginary part
+     * @param reUpper The upper bound of the real part
+     * @param imUpper The upper bound of the imaginary part
+     * @param count The number of eigenvalues
+     */
+    SpectrumSlice(double reLower, double imLower, 
+        double reUpper, double imUpper, int count)
+    {
+        this.reLower = reLower;
+        this.imLower = imLower;
+        this.reUpper = reUpper;
+        this.imUpper = imUpper;
+        this.count = count;
+    }
+    
+    /**
+     * Returns the lower bound of the real part
+     * 
+     * @return The lower bound of the real part
+     */
+    public double getReLower()
+    {
+        return reLower;
+    }
+    
+    /**
+     * Returns the lower bound of the imaginary part
+     * 
+     * @return The lower bound of the imaginary part
+     */
+    public double getImLower()
+    {
+        return imLower;
+    }
+    
+    /**
+     * Returns the upper bound of the real part
+     * 
+     * @return The upper bound of the real part
+     */
+    public double getReUpper()
+    {
+        return reUpper;
+    }
+    
+    /**
+     * Returns the upper bound of the imaginary part
+     * 
+     * @return The upper bound of the imaginary part
+     */
+    public double getImUpper()
+    {
+        return imUpper;
+    }
+    
+    /**
+     * Returns the number of eigenvalues in this slice
+     * 
+     * @return The number of eigenvalues
+     */
+    public int getCount()
+    {
+        return count;
+    }
+    
+    /**
+     * Returns the number of eigenvalues per unit area of this slice
+     * 
+     * @return The density
+     */
+    public double getDensity()
+    {
+        return count / ((reUpper - reLower) * (imUpper - imLower));
+    }
+    
+    /**
+     * Returns a String representation of this object.
+     *
+     * @return A String representation of this object.
+     */
+    @Override
+    public String toString()
+    {
+        return "SpectrumSlice["+
+            "re=["+reLower+","+reUpper+"],"+
+            "im=["+imLower+","+imUpper+"],"+
+            "count="+count+"]";
+    }
+}
@@ -0,0 +1,396 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.List;
+import java.util.concurrent.Future;
+
+import jcuda.Pointer;
+import jcuda.cuDoubleComplex;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * Spectrum slicing for a real, square matrix that is stored on the 
+ * host, based on the eigenvalue counts of cusolverSpDcsreigsHost. <br>
+ * <br>
+ * A rectangular region of the complex plane is recursively bisected. 
+ * All counts of one level of the bisection are computed concurrently 
+ * on host threads, each with its own cusolverSpHandle. The result is 
+ * a list of {@link SpectrumSlice slices} that covers the region, which
+ * may serve as a histogram of the eigenvalue density. <br>
+ * <br>
+ * The contour integration of cusolverSpDcsreigsHost is inaccurate for 
+ * eigenvalues that are close to the boundary of a rectangle. For 
+ * matrices with a real spectrum, the region should therefore be a 
+ * strip around the real axis, and only be split along the real axis.
+ * <br>
+ * <br>
+ * Instances of this class are thread-safe.
+ */
+public class SpectrumSlicer
+{
+    /**
+     * The counting of the eigenvalues in a rectangle. This is only an 
+     * interface so that the bisection and the histogram can be tested 
+     * without the native library.
+     */
+    interface Counter
+    {
+        /**
+         * Submit a task for counting the eigenvalues in the given 
+         * rectangle
+         * 
+         * @param reLower The lower bound of the real part
+         * @param imLower The lower bound of the imaginary part
+         * @param reUpper The upper bound of the real part
+         * @param imUpper The upper bound of the imaginary part
+         * @return The future
+         */
+        Future<SpectrumSlice> submit(double reLower, double imLower, 
+            double reUpper, double imUpper);
+    }
+    
+    /**
+     * The number of rows and columns
+     */
+    private final int m;
+    
+    /**
+     * The number of nonzeros
+     */
+    private final int nnz;
+    
+    /**
+     * The matrix descriptor
+     */
+    private final cusparseMatDescr descrA;
+    
+    /**
+     * The values
+     */
+    private final double csrValA[];
+    
+    /**
+     * The row pointers
+     */
+    private final int csrRowPtrA[];
+    
+    /**
+     * The column indices
+     */
+    private final int csrColIndA[];
+    
+    /**
+     * The worker threads
+     */
+    private final SpWorkerPool pool;
+    
+    /**
+     * Whether the pool is owned by this instance
+     */
+    private final boolean ownsPool;
+    
+    /**
+     * Creates a new instance. The given arrays are not copied, and must
+     * not be modified while this instance is used.
+     * 
+     * @param m The number of rows and columns
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrValA The values
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param threads The number of host threads
+     * @throws IllegalArgumentException If the number of threads is not
+     * positive
+     */
+    public SpectrumSlicer(int m, int nnz, cusparseMatDescr descrA, 
+        double csrValA[], int csrRowPtrA[], int csrColIndA[], int threads)
+    {
+        this(m, nnz, descrA, csrValA, csrRowPtrA, csrColIndA, 
+            new SpWorkerPool("SpectrumSlicer", threads), true);
+    }
+    
+    /**
+     * Creates a new instance that uses the given worker pool
+     * 
+     * @param m The number of rows and columns
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrValA The values
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param pool The worker pool
+     * @param ownsPool Whether {@link #close()} should close the pool
+     */
+    SpectrumSlicer(int m, int nnz, cusparseMatDescr descrA, 
+        double csrValA[], int csrRowPtrA[], int csrColIndA[], 
+        SpWorkerPool pool, boolean ownsPool)
+    {
+        this.m = m;
+        this.nnz = nnz;
+        this.descrA = descrA;
+        this.csrValA = csrValA;
+        this.csrRowPtrA = csrRowPtrA;
+        this.csrColIndA = csrColIndA;
+        this.pool = pool;
+        this.ownsPool = ownsPool;
+    }
+    
+    /**
+     * Count the eigenvalues in the given rectangle
+     * 
+     * @param reLower The lower bound of the real part
+     * @param imLower The lower bound of the imaginary part
+     * @param reUpper The upper bound of the real part
+     * @param imUpper The upper bound of the imaginary part
+     * @return The slice
+     * @throws jcuda.CudaException If the native call failed
+     */
+    public SpectrumSlice count(double reLower, double imLower, 
+        double reUpper, double imUpper)
+    {
+        return SpWorkerPool.get(
+            submitCount(reLower, imLower, reUpper, imUpper));
+    }
+    
+    /**
+     * Split the given rectangle into the given number of slices of 
+     * equal width along the real axis, and count the eigenvalues in 
+     * all of them concurrently
+     * 
+     * @param reLower The lower bound of the real part
+     * @param imLower The lower bound of the imaginary part
+     * @param reUpper The upper bound of the real part
+     * @param imUpper The upper bound of the imaginary part
+     * @param slices The number of slices
+     * @return The slices, in ascending order of the real part
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public List<SpectrumSlice> histogram(double reLower, double imLower, 
+        double reUpper, double imUpper, int slices)
+    {
+        return histogram(this::submitCount, 
+            reLower, imLower, reUpper, imUpper, slices);
+    }
+    
+    /**
+     * Implementation of {@link #histogram(double, double, double, double, 
+     * int)}, with the given counter
+     * 
+     * @param counter The counter
+     * @param reLower The lower bound of the real part
+     * @param imLower The lower bound of the imaginary part
+     * @param reUpper The upper bound of the real part
+     * @param imUpper The upper bound of the imaginary part
+     * @param slices The number of slices
+     * @return The slices, in ascending order of the real part
+     */
+    static List<SpectrumSlice> histogram(Counter counter, 
+        double reLower, double imLower, double reUpper, double imUpper, 
+        int slices)
+    {
+        List<Future<SpectrumSlice>> futures = 
+            new ArrayList<Future<SpectrumSlice>>();
+        double width = (reUpper - reLower) / slices;
+        for (int i = 0; i < slices; i++)
+        {
+            double a = reLower + i * width;
+            double b = i == slices - 1 ? reUpper : a + width;
+            futures.add(counter.submit(a, imLower, b, imUpper));
+        }
+        return collect(futures);
+    }
+    
+    /**
+     * Recursively bisect the given rectangle. <br>
+     * <br>
+     * In each step, all slices that contain more than the given number 
+     * of eigenvalues are split in the middle of their longer side (or 
+     * of their real side, if only real splits are requested). Both 
+     * halves are counted concurrently. The bisection stops when no 
+     * slice has to be split, the maximum number of slices would be 
+     * exceeded, or the slices become too small to be split.
+     * 
+     * @param reLower The lower bound of the real part
+     * @param imLower The lower bound of the imaginary part
+     * @param reUpper The upper bound of the real part
+     * @param imUpper The upper bound of the imaginary part
+     * @param maxCount The maximum number of eigenvalues per slice
+     * @param maxSlices The maximum number of slices
+     * @param realSplitsOnly Whether the slices should only be split 
+     * along the real axis
+     * @return The slices. Slices that contain no eigenvalues are 
+     * included, so that the slices cover the whole rectangle.
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public List<SpectrumSlice> bisect(double reLower, double imLower, 
+        double reUpper, double imUpper, int maxCount, int maxSlices, 
+        boolean realSplitsOnly)
+    {
+        return bisect(this::submitCount, reLower, imLower, reUpper, 
+            imUpper, maxCount, maxSlices, realSplitsOnly);
+    }
+    
+    /**
+     * Implementation of {@link #bisect(double, double, double, double, 
+     * int, int, boolean)}, with the given counter
+     * 
+     * @param counter The counter
+     * @param reLower The lower bound of the real part
+     * @param imLower The lower bound of the imaginary part
+     * @param reUpper The upper bound of the real part
+     * @param imUpper The upper bound of the imaginary part
+     * @param maxCount The maximum number of eigenvalues per slice
+     * @param maxSlices The maximum number of slices
+     * @param realSplitsOnly Whether the slices should only be split 
+     * along the real axis
+     * @return The slices
+     */
+    static List<SpectrumSlice> bisect(Counter counter, 
+        double reLower, double imLower, double reUpper, double imUpper, 
+        int maxCount, int maxSlices, boolean realSplitsOnly)
+    {
+        double minimumWidth = (reUpper - reLower) * 1e-10;
+        double minimumHeight = (imUpper - imLower) * 1e-10;
+        List<SpectrumSlice> slices = new ArrayList<SpectrumSlice>();
+        slices.add(SpWorkerPool.get(
+            counter.submit(reLower, imLower, reUpper, imUpper)));
+        while (true)
+        {
+            // Split the slices with the most eigenvalues first, as long
+            // as the maximum number of slices is not exceeded
+            List<SpectrumSlice> next = new ArrayList<SpectrumSlice>();
+            List<Future<SpectrumSlice>> futures = 
+                new ArrayList<Future<SpectrumSlice>>();
+            List<SpectrumSlice> candidates = new ArrayList<SpectrumSlice>(slices);
+            candidates.sort(Comparator.comparingInt(
+                (SpectrumSlice s) -> -s.getCount()));
+            int available = maxSlices - slices.size();
+            for (SpectrumSlice slice : candidates)
+            {
+                double width = slice.getReUpper() - slice.getReLower();
+                double height = slice.getImUpper() - slice.getImLower();
+                boolean splitReal = realSplitsOnly || width >= height;
+                boolean splittable = splitReal ? 
+                    width > minimumWidth : height > minimumHeight;
+                if (slice.getCount() <= maxCount || !splittable || 
+                    available <= 0)
+                {
+                    next.add(slice);
+                    continue;
+                }
+                available--;
+                if (splitReal)
+                {
+                    double c = (slice.getReLower() + slice.getReUpper()) * 0.5;
+                    futures.add(counter.submit(slice.getReLower(), 
+                        slice.getImLower(), c, slice.getImUpper()));
+                    futures.add(counter.submit(c, slice.getImLower(), 
+                        slice.getReUpper(), slice.getImUpper()));
+                }
+                else
+                {
+                    double c = (slice.getImLower() + slice.getImUpper()) * 0.5;
+                    futures.add(counter.submit(slice.getReLower(), 
+                        slice.getImLower(), slice.getReUpper(), c));
+                    futures.add(counter.submit(slice.getReLower(), c, 
+                        slice.getReUpper(), slice.getImUpper()));
+                }
+            }
+            if (futures.isEmpty())
+            {
+                break;
+            }
+            next.addAll(collect(futures));
+            slices = next;
+        }
+        slices.sort(Comparator.comparingDouble(SpectrumSlice::getReLower)
+            .thenComparingDouble(SpectrumSlice::getImLower));
+        return slices;
+    }
+    
+    /**
+     * Submit a task for counting the eigenvalues in the given rectangle
+     * 
+     * @param reLower The lower bound of the real part
+     * @param imLower The lower bound of the imaginary part
+     * @param reUpper The upper bound of the real part
+     * @param imUpper The upper bound of the imaginary part
+     * @return The future
+     */
+    private Future<SpectrumSlice> submitCount(double reLower, 
+        double imLower, double reUpper, double imUpper)
+    {
+        return pool.submit(handle -> 
+        {
+            int numEigs[] = { 0 };
+            checkSuccess(JCusolverSp.cusolverSpDcsreigsHost(handle, 
+                m, nnz, descrA, Pointer.to(csrValA), Pointer.to(csrRowPtrA),
+                Pointer.to(csrColIndA), 
+                cuDoubleComplex.cuCmplx(reLower, imLower), 
+                cuDoubleComplex.cuCmplx(reUpper, imUpper), 
+                Pointer.to(numEigs)), "cusolverSpDcsreigsHost");
+            return new SpectrumSlice(
+                reLower, imLower, reUpper, imUpper, numEigs[0]);
+        });
+    }
+    
+    /**
+     * Wait for all given futures, and return their results
+     * 
+     * @param futures The futures
+     * @return The results
+     */
+    private static List<SpectrumSlice> collect(
+        List<Future<SpectrumSlice>> futures)
+    {
+        List<SpectrumSlice> result = new ArrayList<SpectrumSlice>();
+        for (Future<SpectrumSlice> future : futures)
+        {
+            result.add(SpWorkerPool.get(future));
+        }
+        return result;
+    }
+    
+    /**
+     * Shut down the worker threads and destroy their handles, if they
+     * are owned by this instance
+     */
+    public void close()
+    {
+        if (ownsPool)
+        {
+            pool.close();
+        }
+    }
+}
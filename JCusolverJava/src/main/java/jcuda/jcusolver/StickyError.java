@@ -0,0 +1,174 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.util.Arrays;
+
+/**
+ * The first native function call that failed while sticky errors were
+ * enabled for a thread. See {@link JCusolver#setStickyErrorsEnabled}.
+ */
+public final class StickyError
+{
+    /**
+     * The function name
+     */
+    private final String functionName;
+    
+    /**
+     * The names of the recorded arguments
+     */
+    private final String argumentNames[];
+    
+    /**
+     * The values of the recorded arguments
+     */
+    private final long arguments[];
+    
+    /**
+     * The returned status
+     */
+    private final int status;
+    
+    /**
+     * The number of calls that failed since the error was cleared
+     */
+    private final long failedCallCount;
+    
+    /**
+     * Creates a new instance
+     * 
+     * @param functionName The function name
+     * @param argumentNames The argument names
+     * @param arguments The argument values
+     * @param status The status
+     * @param failedCallCount The number of failed calls
+     */
+    StickyError(String functionName, String argumentNames[], 
+        long arguments[], int status, long failedCallCount)
+    {
+        this.functionName = functionName;
+        this.argumentNames = argumentNames;
+        this.arguments = arguments;
+        this.status = status;
+        this.failedCallCount = failedCallCount;
+    }
+    
+    /**
+     * Returns the name of the function that failed, for example,
+     * <code>"cusolverDnDpotrf"</code>
+     * 
+     * @return The function name
+     */
+    public String getFunctionName()
+    {
+        return functionName;
+    }
+    
+    /**
+     * Returns a copy of the names of the recorded arguments. These are 
+     * the same integer arguments that are recorded in a call trace.
+     * 
+     * @return The argument names
+     */
+    public String[] getArgumentNames()
+    {
+        return argumentNames.clone();
+    }
+    
+    /**
+     * Returns a copy of the values of the recorded arguments
+     * 
+     * @return The argument values
+     */
+    public long[] getArguments()
+    {
+        return arguments.clone();
+    }
+    
+    /**
+     * Returns the status that was returned by the function
+     * 
+     * @return The status
+     */
+    public int getStatus()
+    {
+        return status;
+    }
+    
+    /**
+     * Returns the number of calls that failed since the error was 
+     * cleared, including the first one
+     * 
+     * @return The number of failed calls
+     */
+    public long getFailedCallCount()
+    {
+        return failedCallCount;
+    }
+    
+    /**
+     * Returns a message that describes the failed call, for example,
+     * <code>"cusolverDnDpotrf(uplo=0, n=100, lda=100) returned 
+     * CUSOLVER_STATUS_INVALID_VALUE"</code>
+     * 
+     * @return The message
+     */
+    public String createMessage()
+    {
+        StringBuilder sb = new StringBuilder();
+        sb.append(functionName).append("(");
+        for (int i = 0; i < argumentNames.length; i++)
+        {
+            if (i > 0)
+            {
+                sb.append(", ");
+            }
+            sb.append(argumentNames[i]).append("=").append(arguments[i]);
+        }
+        sb.append(") returned ").append(cusolverStatus.stringFor(status));
+        if (failedCallCount > 1)
+        {
+            sb.append(" (").append(failedCallCount - 1);
+            sb.append(" more calls failed after it)");
+        }
+        return sb.toString();
+    }
+    
+    @Override
+    public String toString()
+    {
+        return "StickyError["+
+            "functionName="+functionName+","+
+            "argumentNames="+Arrays.toString(argumentNames)+","+
+            "arguments="+Arrays.toString(arguments)+","+
+            "status="+cusolverStatus.stringFor(status)+","+
+            "failedCallCount="+failedCallCount+"]";
+    }
+}
@@ -0,0 +1,721 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.DeviceMemory.allocate;
+import static jcuda.jcusolver.DeviceMemory.allocateHost;
+import static jcuda.jcusolver.DeviceMemory.copy;
+import static jcuda.jcusolver.DeviceMemory.copyAsync;
+import static jcuda.jcusolver.DeviceMemory.free;
+import static jcuda.jcusolver.DeviceMemory.freeHost;
+import static jcuda.jcusolver.DeviceMemory.synchronize;
+import static jcuda.jcusolver.JCusolver.checkCudaSuccess;
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyDeviceToHost;
+import static jcuda.runtime.cudaMemcpyKind.cudaMemcpyHostToDevice;
+
+import java.io.IOException;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.util.Random;
+import java.util.stream.IntStream;
+
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.runtime.JCuda;
+import jcuda.runtime.cudaStream_t;
+
+/**
+ * A randomized singular value decomposition for tall matrices that do 
+ * not fit into device memory. <br>
+ * <br>
+ * cusolverDnXgesvdr requires the whole matrix to be stored on the 
+ * device. This class instead reads the m x n matrix A from a 
+ * {@link RowBlockSource}, in blocks of a fixed number of rows, so 
+ * that the required device memory only depends on the block size 
+ * and on n, but not on m. <br>
+ * <br>
+ * The computation consists of two passes over the matrix:
+ * <ul>
+ *   <li>
+ *     The sketch Y = A * Omega is computed block by block, with a 
+ *     random n x l matrix Omega, where l = rank + oversampling. 
+ *     The R factor of Y is accumulated on the device with a 
+ *     tall-skinny QR: Each block of Y is stacked below the R of the 
+ *     previous blocks, and factored with cusolverDnDgeqrf. The 
+ *     transfer and factorization of one block overlap with the 
+ *     reading and sketching of the next block.
+ *   </li>
+ *   <li>
+ *     The l x n matrix C = Y^T * A is accumulated. With Q = Y * R^-1, 
+ *     the matrix B = Q^T * A is then given by R^-T * C. The SVD of 
+ *     the small matrix B^T is computed with cusolverDnDgesvd.
+ *   </li>
+ * </ul>
+ * If a diagonal element of R is small relative to the largest one, then 
+ * the corresponding column of the sketch is numerically linearly 
+ * dependent on the previous ones. The sketch is then truncated to the 
+ * columns before this one, so that R can be inverted. If fewer than 
+ * rank columns remain, then the matrix does not have the requested 
+ * numerical rank, and an exception is thrown.
+ * The matrix Q is never formed explicitly. Instead, the {@link Result} 
+ * offers an n x rank matrix W with U = A * W, so that the rows of the 
+ * left singular vectors can be computed block by block when needed.
+ * <br>
+ * <br>
+ * The products with Omega and with the blocks of A are computed on 
+ * the host, in parallel. The blocks are provided on the host, and for 
+ * the small number of sketch columns l, each product performs only 
+ * about 2*l floating point operations per element of the block, so 
+ * that it takes roughly as long as transferring the block to the 
+ * device would. Computing them on the host also keeps the transfers 
+ * limited to the small sketch, and avoids a dependency to JCublas. 
+ * The factorizations run on the device.
+ * <br>
+ * <br>
+ * Instances of this class are not thread-safe. 
+ */
+public class StreamingRandomizedSvd
+{
+    /**
+     * The tolerance for the diagonal elements of R, relative to the 
+     * largest absolute diagonal element
+     */
+    private static final double RANK_TOLERANCE = 1e-10;
+    
+    /**
+     * The result of a {@link StreamingRandomizedSvd}
+     */
+    public static final class Result
+    {
+        /**
+         * The number of columns of the matrix
+         */
+        private final int columns;
+        
+        /**
+         * The rank
+         */
+        private final int rank;
+        
+        /**
+         * The singular values
+         */
+        private final double singularValues[];
+        
+        /**
+         * The right singular vectors, n x rank, column-major
+         */
+        private final double rightSingularVectors[];
+        
+        /**
+         * The matrix W with U = A * W, n x rank, column-major
+         */
+        private final double leftProjection[];
+        
+        Result(int columns, int rank, double singularValues[], 
+            double rightSingularVectors[], double leftProjection[])
+        {
+            this.columns = columns;
+            this.rank = rank;
+            this.singularValues = singularValues;
+            this.rightSingularVectors = rightSingularVectors;
+            this.leftProjection = leftProjection;
+        }
+        
+        /**
+         * Returns the rank of the approximation
+         * 
+         * @return The rank
+         */
+        public int getRank()
+        {
+            return rank;
+        }
+        
+        /**
+         * Returns a copy of the singular values, in descending order
+         * 
+         * @return The singular values
+         */
+        public double[] getSingularValues()
+        {
+            return singularValues.clone();
+        }
+        
+        /**
+         * Returns a copy of the right singular vectors, as an n x rank 
+         * matrix in column-major order
+         * 
+         * @return The right singular vectors
+         */
+        public double[] getRightSingularVectors()
+        {
+            return rightSingularVectors.clone();
+        }
+        
+        /**
+         * Returns a copy of the n x rank matrix W, in column-major
+         * order, where the left singular vectors are given by A * W
+         * 
+         * @return The matrix W
+         */
+        public double[] getLeftProjection()
+        {
+            return leftProjection.clone();
+        }
+        
+        /**
+         * Compute the rows of the left singular vectors that correspond 
+         * to the given block of rows of the original matrix
+         * 
+         * @param block The rows of the matrix, in row-major order
+         * @param rows The number of rows
+         * @param target The array that receives the rows of the left 
+         * singular vectors, in row-major order. Its length must be at
+         * least rows*rank.
+         */
+        public void computeLeftSingularVectors(
+            double block[], int rows, double target[])
+        {
+            IntStream.range(0, rows).parallel().forEach(r -> 
+            {
+                for (int j = 0; j < rank; j++)
+                {
+                    double sum = 0.0;
+                    for (int c = 0; c < columns; c++)
+                    {
+                        sum += block[r * columns + c] * 
+                            leftProjection[c + j * columns];
+                    }
+                    target[r * rank + j] = sum;
+                }
+            });
+        }
+    }
+
+    /**
+     * The handle
+     */
+    private final cusolverDnHandle handle;
+    
+    /**
+     * The rank of the approximation
+     */
+    private final int rank;
+    
+    /**
+     * The oversampling
+     */
+    private final int oversampling;
+    
+    /**
+     * The number of rows that are processed at once
+     */
+    private final int blockRows;
+    
+    /**
+     * The random number generator for the sketching matrix
+     */
+    private final Random random;
+    
+    /**
+     * Creates a new instance
+     * 
+     * @param handle The handle. Its stream will be used for all 
+     * device operations
+     * @param rank The rank of the approximation
+     * @param oversampling The oversampling. Common values are 5 to 10
+     * @param blockRows The number of rows that are processed at once
+     * @param seed The seed for the random sketching matrix
+     * @throws IllegalArgumentException If the rank or the number of
+     * rows per block is not positive, or the oversampling is negative
+     */
+    public StreamingRandomizedSvd(cusolverDnHandle handle, int rank, 
+        int oversampling, int blockRows, long seed)
+    {
+        if (rank <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The rank must be positive, but is " + rank);
+        }
+        if (oversampling < 0)
+        {
+            throw new IllegalArgumentException(
+                "The oversampling may not be negative, but is " 
+                + oversampling);
+        }
+        if (blockRows <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The block size must be positive, but is " + blockRows);
+        }
+        this.handle = handle;
+        this.rank = rank;
+        this.oversampling = oversampling;
+        this.blockRows = blockRows;
+        this.random = new Random(seed);
+    }
+    
+    /**
+     * Compute the randomized SVD of the matrix that is provided by 
+     * the given source.
+     * 
+     * @param source The source
+     * @return The result
+     * @throws IOException If reading the source caused an IO error
+     * @throws IllegalArgumentException If the rank is larger than the 
+     * number of columns, the matrix has fewer rows than the rank 
+     * plus the oversampling, or its numerical rank is smaller than 
+     * the rank
+     * @throws jcuda.CudaException If any of the native calls failed
+     */
+    public Result compute(RowBlockSource source) throws IOException
+    {
+        int n = source.getColumns();
+        if (rank > n)
+        {
+            throw new IllegalArgumentException(
+                "The rank " + rank + " is larger than the number of " +
+                "columns, " + n);
+        }
+        int l = Math.min(rank + oversampling, n);
+        double omega[] = new double[n * l];
+        for (int i = 0; i < omega.length; i++)
+        {
+            omega[i] = random.nextGaussian();
+        }
+        
+        double r[] = computeSketchR(source, omega, l);
+        double c[] = computeProjection(source, omega, l);
+        
+        // Truncate the sketch to its leading columns that are 
+        // numerically linearly independent, so that R is invertible.
+        // The row-major n x l matrix Omega is an l x n matrix in 
+        // column-major order.
+        int sketchRank = numericalRank(r, l);
+        if (sketchRank < rank)
+        {
+            throw new IllegalArgumentException(
+                "The sketch has a numerical rank of " + sketchRank + 
+                ", which is smaller than the rank " + rank);
+        }
+        if (sketchRank < l)
+        {
+            r = leadingRows(r, l, sketchRank, sketchRank);
+            c = leadingRows(c, l, n, sketchRank);
+            omega = leadingRows(omega, l, n, sketchRank);
+            l = sketchRank;
+        }
+        
+        // B^T = C^T * R^-1, as an n x l matrix in column-major order
+        double bt[] = new double[n * l];
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = 0; j < l; j++)
+            {
+                double sum = c[j + i * l];
+                for (int k = 0; k < j; k++)
+                {
+                    sum -= bt[i + k * n] * r[k + j * l];
+                }
+                bt[i + j * n] = sum / r[j + j * l];
+            }
+        }
+        
+        // B^T = V * S * Ut^T
+        double s[] = new double[l];
+        double v[] = new double[n * l];
+        double ut[] = new double[l * l];
+        gesvd(bt, n, l, s, v, ut);
+        
+        // W = Omega * R^-1 * Ut(:, 0:rank), where Ut(:,j) is the j-th
+        // row of the computed VT. Solve R * Z = Ut by back-substitution
+        double z[] = new double[l * rank];
+        for (int j = 0; j < rank; j++)
+        {
+            for (int i = l - 1; i >= 0; i--)
+            {
+                double sum = ut[j + i * l];
+                for (int k = i + 1; k < l; k++)
+                {
+                    sum -= r[i + k * l] * z[k + j * l];
+                }
+                z[i + j * l] = sum / r[i + i * l];
+            }
+        }
+        double w[] = new double[n * rank];
+        for (int j = 0; j < rank; j++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                double sum = 0.0;
+                for (int k = 0; k < l; k++)
+                {
+                    sum += omega[i * l + k] * z[k + j * l];
+                }
+                w[i + j * n] = sum;
+            }
+        }
+        
+        double singularValues[] = new double[rank];
+        System.arraycopy(s, 0, singularValues, 0, rank);
+        double rightSingularVectors[] = new double[n * rank];
+        System.arraycopy(v, 0, rightSingularVectors, 0, n * rank);
+        return new Result(n, rank, singularValues, rightSingularVectors, w);
+    }
+    
+    /**
+     * Returns the number of leading diagonal elements of the given 
+     * l x l upper triangular matrix whose absolute value is larger 
+     * than the {@link #RANK_TOLERANCE} relative to the largest 
+     * absolute diagonal element.
+     * 
+     * @param r The matrix, in column-major order
+     * @param l The size of the matrix
+     * @return The number of leading columns that are kept
+     */
+    private static int numericalRank(double r[], int l)
+    {
+        double max = 0.0;
+        for (int j = 0; j < l; j++)
+        {
+            max = Math.max(max, Math.abs(r[j + j * l]));
+        }
+        double threshold = max * RANK_TOLERANCE;
+        for (int j = 0; j < l; j++)
+        {
+            if (!(Math.abs(r[j + j * l]) > threshold))
+            {
+                return j;
+            }
+        }
+        return l;
+    }
+    
+    /**
+     * Returns the leading k rows of the given matrix, in column-major 
+     * order
+     * 
+     * @param a The matrix, in column-major order
+     * @param rows The number of rows of the matrix
+     * @param columns The number of columns that are copied
+     * @param k The number of rows that are copied
+     * @return The k x columns matrix
+     */
+    private static double[] leadingRows(
+        double a[], int rows, int columns, int k)
+    {
+        double result[] = new double[k * columns];
+        for (int j = 0; j < columns; j++)
+        {
+            System.arraycopy(a, j * rows, result, j * k, k);
+        }
+        return result;
+    }
+    
+    /**
+     * Compute the sketch of the given block, Y = A * Omega, and write 
+     * element (i,j) of Y to index offset + i * rowStride + j * 
+     * columnStride of the given target. <br>
+     * <br>
+     * Each row of the sketch is accumulated as a linear combination of
+     * the rows of Omega, so that both the block and Omega are traversed 
+     * contiguously.
+     * 
+     * @param block The block of A, in row-major order
+     * @param rows The number of rows in the block
+     * @param n The number of columns of A
+     * @param omega The sketching matrix, n x l, row-major
+     * @param l The number of columns of the sketch
+     * @param target The target
+     * @param offset The index of the first element in the target
+     * @param rowStride The stride between rows in the target
+     * @param columnStride The stride between columns in the target
+     */
+    private static void sketch(double block[], int rows, int n, 
+        double omega[], int l, double target[], 
+        int offset, int rowStride, int columnStride)
+    {
+        IntStream.range(0, rows).parallel().forEach(i -> 
+        {
+            double row[] = new double[l];
+            for (int k = 0; k < n; k++)
+            {
+                double a = block[i * n + k];
+                for (int j = 0; j < l; j++)
+                {
+                    row[j] += a * omega[k * l + j];
+                }
+            }
+            for (int j = 0; j < l; j++)
+            {
+                target[offset + i * rowStride + j * columnStride] = row[j];
+            }
+        });
+    }
+    
+    /**
+     * Perform the first pass, computing the l x l R factor of the QR
+     * decomposition of Y = A * Omega, in column-major order
+     * 
+     * @param source The source
+     * @param omega The sketching matrix
+     * @param l The number of columns of the sketch
+     * @return The R factor
+     * @throws IOException If an IO error occurs
+     */
+    private double[] computeSketchR(
+        RowBlockSource source, double omega[], int l) throws IOException
+    {
+        int n = source.getColumns();
+        int ld = l + blockRows;
+        long stackBytes = (long)ld * l * Sizeof.DOUBLE;
+        
+        cudaStream_t stream = new cudaStream_t();
+        checkSuccess(JCusolverDn.cusolverDnGetStream(handle, stream), 
+            "cusolverDnGetStream");
+        
+        Pointer staging = null;
+        Pointer hostR = null;
+        Pointer dStack = null;
+        Pointer dTau = null;
+        Pointer dInfo = null;
+        Pointer dWork = null;
+        try (RowBlockSource.Reader reader = source.open())
+        {
+            staging = allocateHost(stackBytes);
+            hostR = allocateHost((long)l * l * Sizeof.DOUBLE);
+            dStack = allocate(stackBytes);
+            dTau = allocate((long)l * Sizeof.DOUBLE);
+            dInfo = allocate(Sizeof.INT);
+            int lwork[] = { 0 };
+            checkSuccess(JCusolverDn.cusolverDnDgeqrf_bufferSize(
+                handle, ld, l, dStack, ld, lwork), 
+                "cusolverDnDgeqrf_bufferSize");
+            dWork = allocate((long)lwork[0] * Sizeof.DOUBLE);
+            
+            double block[] = new double[blockRows * n];
+            double stack[] = new double[ld * l];
+            double r[] = new double[l * l];
+            long totalRows = 0;
+            int index = 0;
+            while (true)
+            {
+                int rows = reader.read(block, blockRows);
+                if (rows == 0)
+                {
+                    break;
+                }
+                totalRows += rows;
+                
+                // Compute the sketch of this block, while the 
+                // previous block is transferred and factored
+                sketch(block, rows, n, omega, l, stack, l, 1, ld);
+                
+                // Wait for the R of the previous block, and place
+                // its upper triangle on top of the sketch. After this,
+                // the staging buffer is no longer used by the previous
+                // transfer, so that one buffer is sufficient.
+                synchronize(stream);
+                if (index > 0)
+                {
+                    readUpperTriangle(hostR, l, r);
+                }
+                for (int j = 0; j < l; j++)
+                {
+                    System.arraycopy(r, j * l, stack, j * ld, l);
+                }
+                
+                DoubleBuffer buffer = staging.getByteBuffer(0, stackBytes)
+                    .order(ByteOrder.nativeOrder()).asDoubleBuffer();
+                buffer.put(stack);
+                
+                copyAsync(dStack, staging, stackBytes, 
+                    cudaMemcpyHostToDevice, stream);
+                checkSuccess(JCusolverDn.cusolverDnDgeqrf(handle, 
+                    l + rows, l, dStack, ld, dTau, dWork, lwork[0], dInfo), 
+                    "cusolverDnDgeqrf");
+                checkCudaSuccess(JCuda.cudaMemcpy2DAsync(
+                    hostR, (long)l * Sizeof.DOUBLE, 
+                    dStack, (long)ld * Sizeof.DOUBLE, 
+                    (long)l * Sizeof.DOUBLE, l, 
+                    cudaMemcpyDeviceToHost, stream), "cudaMemcpy2DAsync");
+                index++;
+            }
+            synchronize(stream);
+            if (totalRows < l)
+            {
+                throw new IllegalArgumentException(
+                    "The matrix has " + totalRows + " rows, but at least " 
+                    + l + " are required");
+            }
+            readUpperTriangle(hostR, l, r);
+            int info[] = { 0 };
+            copy(Pointer.to(info), dInfo, Sizeof.INT, cudaMemcpyDeviceToHost);
+            if (info[0] != 0)
+            {
+                throw new IllegalStateException(
+                    "cusolverDnDgeqrf failed with info " + info[0]);
+            }
+            return r;
+        }
+        finally
+        {
+            freeHost(staging, hostR);
+            free(dStack, dTau, dInfo, dWork);
+        }
+    }
+    
+    /**
+     * Read the upper triangle of the l x l column-major matrix from the 
+     * given host pointer into the given array, setting the lower 
+     * triangle (which contains the Householder vectors) to zero
+     * 
+     * @param hostR The host pointer
+     * @param l The size of the matrix
+     * @param r The target array
+     */
+    private static void readUpperTriangle(Pointer hostR, int l, double r[])
+    {
+        DoubleBuffer buffer = 
+            hostR.getByteBuffer(0, (long)l * l * Sizeof.DOUBLE)
+            .order(ByteOrder.nativeOrder()).asDoubleBuffer();
+        buffer.get(r);
+        for (int j = 0; j < l; j++)
+        {
+            for (int i = j + 1; i < l; i++)
+            {
+                r[i + j * l] = 0.0;
+            }
+        }
+    }
+    
+    /**
+     * Perform the second pass, computing the l x n matrix C = Y^T * A, 
+     * in column-major order
+     * 
+     * @param source The source
+     * @param omega The sketching matrix
+     * @param l The number of columns of the sketch
+     * @return The matrix C
+     * @throws IOException If an IO error occurs
+     */
+    private double[] computeProjection(
+        RowBlockSource source, double omega[], int l) throws IOException
+    {
+        int n = source.getColumns();
+        double c[] = new double[l * n];
+        double block[] = new double[blockRows * n];
+        double y[] = new double[blockRows * l];
+        try (RowBlockSource.Reader reader = source.open())
+        {
+            while (true)
+            {
+                int rows = reader.read(block, blockRows);
+                if (rows == 0)
+                {
+                    break;
+                }
+                
+                // The sketch is stored in row-major order here, so that
+                // column j of C is accumulated as a linear combination 
+                // of the rows of Y, traversing C and Y contiguously
+                sketch(block, rows, n, omega, l, y, 0, l, 1);
+                IntStream.range(0, n).parallel().forEach(j -> 
+                {
+                    int column = j * l;
+                    for (int k = 0; k < rows; k++)
+                    {
+                        double a = block[k * n + j];
+                        for (int i = 0; i < l; i++)
+                        {
+                            c[column + i] += a * y[k * l + i];
+                        }
+                    }
+                });
+            }
+        }
+        return c;
+    }
+    
+    /**
+     * Compute the SVD of the given m x n matrix (with m &gt;= n) with 
+     * cusolverDnDgesvd, computing the first n columns of U and all 
+     * of VT
+     * 
+     * @param a The matrix, column-major
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param s Will receive the singular values
+     * @param u Will receive the m x n matrix U
+     * @param vt Will receive the n x n matrix VT
+     */
+    private void gesvd(double a[], int m, int n, 
+        double s[], double u[], double vt[])
+    {
+        Pointer dA = allocate((long)m * n * Sizeof.DOUBLE);
+        Pointer dS = allocate((long)n * Sizeof.DOUBLE);
+        Pointer dU = allocate((long)m * n * Sizeof.DOUBLE);
+        Pointer dVT = allocate((long)n * n * Sizeof.DOUBLE);
+        Pointer dRwork = allocate((long)n * Sizeof.DOUBLE);
+        Pointer dInfo = allocate(Sizeof.INT);
+        Pointer dWork = null;
+        try
+        {
+            copy(dA, Pointer.to(a), (long)m * n * Sizeof.DOUBLE, 
+                cudaMemcpyHostToDevice);
+            int lwork[] = { 0 };
+            checkSuccess(JCusolverDn.cusolverDnDgesvd_bufferSize(
+                handle, m, n, lwork), "cusolverDnDgesvd_bufferSize");
+            dWork = allocate((long)lwork[0] * Sizeof.DOUBLE);
+            checkSuccess(JCusolverDn.cusolverDnDgesvd(handle, 'S', 'A', 
+                m, n, dA, m, dS, dU, m, dVT, n, dWork, lwork[0], 
+                dRwork, dInfo), "cusolverDnDgesvd");
+            checkCudaSuccess(JCuda.cudaDeviceSynchronize(), 
+                "cudaDeviceSynchronize");
+            int info[] = { 0 };
+            copy(Pointer.to(info), dInfo, Sizeof.INT, cudaMemcpyDeviceToHost);
+            if (info[0] != 0)
+            {
+                throw new IllegalStateException(
+                    "cusolverDnDgesvd failed with info " + info[0]);
+            }
+            copy(Pointer.to(s), dS, (long)n * Sizeof.DOUBLE, 
+                cudaMemcpyDeviceToHost);
+            copy(Pointer.to(u), dU, (long)m * n * Sizeof.DOUBLE, 
+                cudaMemcpyDeviceToHost);
+            copy(Pointer.to(vt), dVT, (long)n * n * Sizeof.DOUBLE, 
+                cudaMemcpyDeviceToHost);
+        }
+        finally
+        {
+            free(dA, dS, dU, dVT, dRwork, dInfo, dWork);
+        }
+    }
+}
@@ -0,0 +1,270 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * The structural and numerical properties of a sparse matrix in CSR 
+ * format, as computed by the {@link StructureAnalyzer}
+ */
+public final class StructureAnalysis
+{
+    /**
+     * Whether the pattern is structurally symmetric
+     */
+    private final boolean structurallySymmetric;
+    
+    /**
+     * Whether the values are symmetric, up to the tolerance
+     */
+    private final boolean numericallySymmetric;
+    
+    /**
+     * Whether all diagonal elements are positive
+     */
+    private final boolean positiveDiagonal;
+    
+    /**
+     * Whether the matrix is weakly diagonally dominant by rows
+     */
+    private final boolean diagonallyDominant;
+    
+    /**
+     * The lower bandwidth
+     */
+    private final long lowerBandwidth;
+    
+    /**
+     * The upper bandwidth
+     */
+    private final long upperBandwidth;
+    
+    /**
+     * The profile
+     */
+    private final long profile;
+    
+    /**
+     * The number of empty rows
+     */
+    private final long emptyRows;
+    
+    /**
+     * The number of duplicate entries
+     */
+    private final long duplicateEntries;
+    
+    /**
+     * The number of rows with unsorted column indices
+     */
+    private final long unsortedRows;
+    
+    /**
+     * The number of rows without a diagonal entry
+     */
+    private final long missingDiagonal;
+    
+    /**
+     * Creates a new analysis from the results of the native analysis
+     * 
+     * @param results The results, in the order that is defined by the
+     * constants in the {@link StructureAnalyzer}
+     */
+    StructureAnalysis(long results[])
+    {
+        this.structurallySymmetric = 
+            results[StructureAnalyzer.STRUCTURALLY_SYMMETRIC] != 0;
+        this.numericallySymmetric = 
+            results[StructureAnalyzer.NUMERICALLY_SYMMETRIC] != 0;
+        this.positiveDiagonal = 
+            results[StructureAnalyzer.POSITIVE_DIAGONAL] != 0;
+        this.diagonallyDominant = 
+            results[StructureAnalyzer.DIAGONALLY_DOMINANT] != 0;
+        this.lowerBandwidth = results[StructureAnalyzer.LOWER_BANDWIDTH];
+        this.upperBandwidth = results[StructureAnalyzer.UPPER_BANDWIDTH];
+        this.profile = results[StructureAnalyzer.PROFILE];
+        this.emptyRows = results[StructureAnalyzer.EMPTY_ROWS];
+        this.duplicateEntries = results[StructureAnalyzer.DUPLICATE_ENTRIES];
+        this.unsortedRows = results[StructureAnalyzer.UNSORTED_ROWS];
+        this.missingDiagonal = results[StructureAnalyzer.MISSING_DIAGONAL];
+    }
+    
+    /**
+     * Returns whether the pattern is structurally symmetric, meaning 
+     * that for each entry (i,j), there is an entry (j,i). This is always
+     * <code>false</code> for matrices that are not square.
+     * 
+     * @return Whether the pattern is structurally symmetric
+     */
+    public boolean isStructurallySymmetric()
+    {
+        return structurallySymmetric;
+    }
+    
+    /**
+     * Returns whether the matrix is structurally symmetric, and each 
+     * value A(i,j) is equal to A(j,i) up to the relative tolerance that 
+     * was used for the analysis. This is always <code>false</code> if
+     * no values have been analyzed.
+     * 
+     * @return Whether the matrix is numerically symmetric
+     */
+    public boolean isNumericallySymmetric()
+    {
+        return numericallySymmetric;
+    }
+    
+    /**
+     * Returns whether all diagonal elements are present and positive. 
+     * This is always <code>false</code> if no values have been analyzed.
+     * 
+     * @return Whether the diagonal is positive
+     */
+    public boolean hasPositiveDiagonal()
+    {
+        return positiveDiagonal;
+    }
+    
+    /**
+     * Returns whether |A(i,i)| &gt;= sum<sub>j!=i</sub> |A(i,j)| for 
+     * all rows i. This is always <code>false</code> if no values have 
+     * been analyzed.
+     * 
+     * @return Whether the matrix is diagonally dominant
+     */
+    public boolean isDiagonallyDominant()
+    {
+        return diagonallyDominant;
+    }
+    
+    /**
+     * Returns whether the matrix is likely to be symmetric positive 
+     * definite. This is the case if it is numerically symmetric and
+     * has a positive diagonal, and it is guaranteed if the matrix is 
+     * additionally diagonally dominant and nonsingular. Otherwise, 
+     * this is only a heuristic.
+     * 
+     * @return Whether the matrix is likely to be SPD
+     */
+    public boolean isLikelySpd()
+    {
+        return numericallySymmetric && positiveDiagonal;
+    }
+    
+    /**
+     * Returns the lower bandwidth, which is the maximum of i-j for 
+     * all entries (i,j)
+     * 
+     * @return The lower bandwidth
+     */
+    public long getLowerBandwidth()
+    {
+        return lowerBandwidth;
+    }
+    
+    /**
+     * Returns the upper bandwidth, which is the maximum of j-i for 
+     * all entries (i,j)
+     * 
+     * @return The upper bandwidth
+     */
+    public long getUpperBandwidth()
+    {
+        return upperBandwidth;
+    }
+    
+    /**
+     * Returns the profile, which is the sum of the distances between 
+     * the first entry of each row and the diagonal, for all rows whose 
+     * first entry is left of the diagonal
+     * 
+     * @return The profile
+     */
+    public long getProfile()
+    {
+        return profile;
+    }
+    
+    /**
+     * Returns the number of rows that do not contain any entries
+     * 
+     * @return The number of empty rows
+     */
+    public long getEmptyRows()
+    {
+        return emptyRows;
+    }
+    
+    /**
+     * Returns the number of entries whose position is equal to the
+     * position of another entry in the same row
+     * 
+     * @return The number of duplicate entries
+     */
+    public long getDuplicateEntries()
+    {
+        return duplicateEntries;
+    }
+    
+    /**
+     * Returns the number of rows whose column indices are not sorted
+     * 
+     * @return The number of unsorted rows
+     */
+    public long getUnsortedRows()
+    {
+        return unsortedRows;
+    }
+    
+    /**
+     * Returns the number of rows that do not contain a diagonal entry.
+     * This is always 0 for matrices that are not square.
+     * 
+     * @return The number of rows without a diagonal entry
+     */
+    public long getMissingDiagonal()
+    {
+        return missingDiagonal;
+    }
+    
+    @Override
+    public String toString()
+    {
+        return "StructureAnalysis["+
+            "structurallySymmetric="+structurallySymmetric+","+
+            "numericallySymmetric="+numericallySymmetric+","+
+            "positiveDiagonal="+positiveDiagonal+","+
+            "diagonallyDominant="+diagonallyDominant+","+
+            "lowerBandwidth="+lowerBandwidth+","+
+            "upperBandwidth="+upperBandwidth+","+
+            "profile="+profile+","+
+            "emptyRows="+emptyRows+","+
+            "duplicateEntries="+duplicateEntries+","+
+            "unsortedRows="+unsortedRows+","+
+            "missingDiagonal="+missingDiagonal+"]";
+    }
+}
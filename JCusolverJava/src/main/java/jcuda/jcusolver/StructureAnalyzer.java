@@ -0,0 +1,298 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import jcuda.CudaException;
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * A class for analyzing the structure of sparse matrices in CSR format
+ * on the host. <br>
+ * <br>
+ * The analysis is done in a single native, multithreaded pass over the
+ * matrix. It computes the structural symmetry, the numeric symmetry 
+ * and indicators for positive definiteness, the bandwidth and profile, 
+ * and the number of empty rows, duplicate entries and unsorted rows. 
+ * See {@link StructureAnalysis} for details. <br>
+ * <br>
+ * The results of {@link #analyze(int, int, int, cusparseMatDescr, 
+ * double[], int[], int[]) analyze} are cached, keyed by the 
+ * {@link PatternHash} of the sparsity pattern and by whether values 
+ * have been given, so that an analysis without values does not hide 
+ * the numeric properties from later calls with values. Applications 
+ * that solve many systems with the same pattern thus only pay for the 
+ * analysis once, instead of calling cusolverSpXcsrissymHost for each 
+ * solve. The cache holds a limited number of analyses, and the least 
+ * recently used ones are removed first. <br>
+ * <br>
+ * Note that the numeric properties in the cached analysis are those of
+ * the values that have been given when the pattern was analyzed first. 
+ * Use {@link #analyzeUncached(int, int, int, int, double[], int[], 
+ * int[], double) analyzeUncached} when the values change qualitatively.
+ * <br>
+ * <br>
+ * This class is thread-safe.
+ */
+public class StructureAnalyzer
+{
+    static
+    {
+        JCusolver.initialize();
+    }
+    
+    /**
+     * The indices of the native results. These must match the 
+     * definitions in StructureAnalyzer.cpp
+     */
+    static final int STRUCTURALLY_SYMMETRIC = 0;
+    static final int NUMERICALLY_SYMMETRIC = 1;
+    static final int POSITIVE_DIAGONAL = 2;
+    static final int DIAGONALLY_DOMINANT = 3;
+    static final int LOWER_BANDWIDTH = 4;
+    static final int UPPER_BANDWIDTH = 5;
+    static final int PROFILE = 6;
+    static final int EMPTY_ROWS = 7;
+    static final int DUPLICATE_ENTRIES = 8;
+    static final int UNSORTED_ROWS = 9;
+    static final int MISSING_DIAGONAL = 10;
+    private static final int RESULT_COUNT = 11;
+    
+    /**
+     * The default relative tolerance for the numeric symmetry
+     */
+    public static final double DEFAULT_TOLERANCE = 1e-12;
+    
+    /**
+     * The default maximum number of cached analyses
+     */
+    public static final int DEFAULT_CAPACITY = 1024;
+    
+    /**
+     * The relative tolerance for the numeric symmetry
+     */
+    private final double tolerance;
+    
+    /**
+     * The cached analyses, in the order of their last use. The keys are
+     * the pattern hashes, shifted left by one, with the lowest bit 
+     * indicating whether values have been given. 
+     */
+    private final Map<Long, StructureAnalysis> analyses;
+    
+    /**
+     * Creates a new analyzer with the {@link #DEFAULT_TOLERANCE} and 
+     * the {@link #DEFAULT_CAPACITY}
+     */
+    public StructureAnalyzer()
+    {
+        this(DEFAULT_TOLERANCE);
+    }
+    
+    /**
+     * Creates a new analyzer with the {@link #DEFAULT_CAPACITY}
+     * 
+     * @param tolerance The relative tolerance for the numeric symmetry:
+     * The values A(i,j) and A(j,i) are considered to be equal if 
+     * |A(i,j)-A(j,i)| &lt;= tolerance * max(|A(i,j)|,|A(j,i)|)
+     * @throws IllegalArgumentException If the tolerance is negative
+     */
+    public StructureAnalyzer(double tolerance)
+    {
+        this(tolerance, DEFAULT_CAPACITY);
+    }
+    
+    /**
+     * Creates a new analyzer
+     * 
+     * @param tolerance The relative tolerance for the numeric symmetry:
+     * The values A(i,j) and A(j,i) are considered to be equal if 
+     * |A(i,j)-A(j,i)| &lt;= tolerance * max(|A(i,j)|,|A(j,i)|)
+     * @param capacity The maximum number of cached analyses
+     * @throws IllegalArgumentException If the tolerance is negative, or
+     * the capacity is not positive
+     */
+    public StructureAnalyzer(double tolerance, int capacity)
+    {
+        if (!(tolerance >= 0))
+        {
+            throw new IllegalArgumentException(
+                "The tolerance must not be negative, but is " + tolerance);
+        }
+        if (capacity <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The capacity must be positive, but is " + capacity);
+        }
+        this.tolerance = tolerance;
+        this.analyses = new LinkedHashMap<Long, StructureAnalysis>(
+            16, 0.75f, true)
+        {
+            /**
+             * Serial UID
+             */
+            private static final long serialVersionUID = 1L;
+
+            @Override
+            protected boolean removeEldestEntry(
+                Map.Entry<Long, StructureAnalysis> eldest)
+            {
+                return size() > capacity;
+            }
+        };
+    }
+    
+    /**
+     * Returns the analysis of the given matrix, computing it if the 
+     * pattern has not been analyzed yet.
+     * 
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor, whose index base is used
+     * @param csrValA The values. May be <code>null</code>, in which
+     * case the numeric properties are not analyzed. 
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @return The analysis
+     * @throws CudaException If the structure is invalid
+     */
+    public StructureAnalysis analyze(int m, int n, int nnz, 
+        cusparseMatDescr descrA, double csrValA[], 
+        int csrRowPtrA[], int csrColIndA[])
+    {
+        long hash = PatternHash.compute(m, n, nnz, csrRowPtrA, csrColIndA);
+        return analyze(hash, m, n, nnz, descrA, 
+            csrValA, csrRowPtrA, csrColIndA);
+    }
+    
+    /**
+     * Returns the analysis of the given matrix, whose pattern has the 
+     * given {@link PatternHash}
+     * 
+     * @param hash The pattern hash
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor
+     * @param csrValA The values. May be <code>null</code>.
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @return The analysis
+     */
+    StructureAnalysis analyze(long hash, int m, int n, int nnz, 
+        cusparseMatDescr descrA, double csrValA[], 
+        int csrRowPtrA[], int csrColIndA[])
+    {
+        Long key = (hash << 1) | (csrValA == null ? 0 : 1);
+        synchronized (analyses)
+        {
+            StructureAnalysis analysis = analyses.get(key);
+            if (analysis != null)
+            {
+                return analysis;
+            }
+        }
+        StructureAnalysis analysis = analyzeUncached(m, n, nnz, 
+            JCusparse.cusparseGetMatIndexBase(descrA), 
+            csrValA, csrRowPtrA, csrColIndA, tolerance);
+        synchronized (analyses)
+        {
+            StructureAnalysis previous = analyses.putIfAbsent(key, analysis);
+            return previous != null ? previous : analysis;
+        }
+    }
+    
+    /**
+     * Returns the relative tolerance for the numeric symmetry
+     * 
+     * @return The tolerance
+     */
+    double getTolerance()
+    {
+        return tolerance;
+    }
+    
+    /**
+     * Returns the number of cached analyses
+     * 
+     * @return The number of cached analyses
+     */
+    public int getCacheSize()
+    {
+        synchronized (analyses)
+        {
+            return analyses.size();
+        }
+    }
+    
+    /**
+     * Remove all cached analyses
+     */
+    public void clear()
+    {
+        synchronized (analyses)
+        {
+            analyses.clear();
+        }
+    }
+    
+    /**
+     * Analyze the given matrix, without caching the result.
+     * 
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param nnz The number of nonzeros
+     * @param indexBase The index base, 0 or 1
+     * @param csrValA The values. May be <code>null</code>, in which
+     * case the numeric properties are not analyzed. 
+     * @param csrRowPtrA The row pointers, with m+1 elements
+     * @param csrColIndA The column indices, with nnz elements
+     * @param tolerance The relative tolerance for the numeric symmetry
+     * @return The analysis
+     * @throws CudaException If the native analysis returns 
+     * CUSOLVER_STATUS_INVALID_VALUE, because the row pointers are not
+     * consistent with nnz, or a column index is out of range
+     */
+    public static StructureAnalysis analyzeUncached(int m, int n, int nnz, 
+        int indexBase, double csrValA[], int csrRowPtrA[], int csrColIndA[], 
+        double tolerance)
+    {
+        long results[] = new long[RESULT_COUNT];
+        JCusolver.checkSuccess(analyzeNative(m, n, nnz, indexBase, 
+            csrRowPtrA, csrColIndA, csrValA, tolerance, results), 
+            "StructureAnalyzer.analyze");
+        return new StructureAnalysis(results);
+    }
+    private static native int analyzeNative(int m, int n, int nnz, 
+        int indexBase, int csrRowPtrA[], int csrColIndA[], 
+        double csrValA[], double tolerance, long results[]);
+}
@@ -0,0 +1,151 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * Utility methods for the symbolic Cholesky factorization of sparse 
+ * matrices in CSR format. These methods only operate on the sparsity 
+ * pattern, and do not require the native library.
+ */
+public final class SymbolicCholesky
+{
+    /**
+     * Compute the number of nonzeros of the Cholesky factor L of the 
+     * matrix P * (A + A^T) * P^T, including the diagonal. This is the 
+     * fill that is predicted for the given ordering. <br>
+     * <br>
+     * The elimination tree and the row counts are computed together in 
+     * a single pass over the rows, so that the running time is 
+     * proportional to the number of nonzeros of L.
+     * 
+     * @param n The size of the matrix
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @param indexBase The index base, 0 or 1
+     * @param p The permutation, with p[k] being the index of the row 
+     * and column of A that becomes row and column k. If this is 
+     * <code>null</code>, then the identity is used.
+     * @return The number of nonzeros of L
+     */
+    public static long countFactorNonzeros(int n, int csrRowPtrA[], 
+        int csrColIndA[], int indexBase, int p[])
+    {
+        int inverse[] = new int[n];
+        for (int k = 0; k < n; k++)
+        {
+            inverse[p == null ? k : p[k]] = k;
+        }
+        
+        // Collect the strictly lower part of the permuted, symmetrized
+        // pattern, row by row. Duplicates do not affect the result.
+        int lowerPtr[] = new int[n + 1];
+        for (int r = 0; r < n; r++)
+        {
+            for (int i = csrRowPtrA[r] - indexBase; 
+                i < csrRowPtrA[r + 1] - indexBase; i++)
+            {
+                int pr = inverse[r];
+                int pc = inverse[csrColIndA[i] - indexBase];
+                if (pr != pc)
+                {
+                    lowerPtr[Math.max(pr, pc) + 1]++;
+                }
+            }
+        }
+        for (int k = 0; k < n; k++)
+        {
+            lowerPtr[k + 1] += lowerPtr[k];
+        }
+        int lowerInd[] = new int[lowerPtr[n]];
+        int position[] = lowerPtr.clone();
+        for (int r = 0; r < n; r++)
+        {
+            for (int i = csrRowPtrA[r] - indexBase; 
+                i < csrRowPtrA[r + 1] - indexBase; i++)
+            {
+                int pr = inverse[r];
+                int pc = inverse[csrColIndA[i] - indexBase];
+                if (pr != pc)
+                {
+                    lowerInd[position[Math.max(pr, pc)]++] = 
+                        Math.min(pr, pc);
+                }
+            }
+        }
+        
+        int parent[] = new int[n];
+        int ancestor[] = new int[n];
+        int mark[] = new int[n];
+        long count = n;
+        for (int k = 0; k < n; k++)
+        {
+            parent[k] = -1;
+            ancestor[k] = -1;
+            mark[k] = k;
+            
+            // Update the elimination tree with row k, using path
+            // compression in the ancestor array
+            for (int i = lowerPtr[k]; i < lowerPtr[k + 1]; i++)
+            {
+                int j = lowerInd[i];
+                while (j != -1 && j < k)
+                {
+                    int next = ancestor[j];
+                    ancestor[j] = k;
+                    if (next == -1)
+                    {
+                        parent[j] = k;
+                    }
+                    j = next;
+                }
+            }
+            
+            // The nonzeros of row k of L are the nodes of the row 
+            // subtree, which are reached from the entries of row k
+            for (int i = lowerPtr[k]; i < lowerPtr[k + 1]; i++)
+            {
+                int j = lowerInd[i];
+                while (mark[j] != k)
+                {
+                    mark[j] = k;
+                    count++;
+                    j = parent[j];
+                }
+            }
+        }
+        return count;
+    }
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private SymbolicCholesky()
+    {
+        // Private constructor to prevent instantiation
+    }
+}
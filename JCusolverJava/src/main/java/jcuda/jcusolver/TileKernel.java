@@ -0,0 +1,139 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * The operations that are used by the {@link TiledCholesky} scheduler. 
+ * <br>
+ * <br>
+ * An implementation manages a fixed number of <i>slots</i>, each of 
+ * which can hold one tile of the lower triangle of the matrix, with a 
+ * leading dimension of {@link TileLayout#getTileSize()}. The scheduler 
+ * moves tiles between the (host) matrix and the slots with 
+ * {@link #load(int, int, int)} and {@link #store(int, int, int)}, and 
+ * performs all computations on the slots. The operations may be 
+ * executed asynchronously, as long as the implementation preserves 
+ * the order of all operations that refer to the same slot. <br>
+ * <br>
+ * For the solve, the implementation additionally holds the right hand 
+ * side, which is divided into blocks of rows according to the tile 
+ * layout. <br>
+ * <br>
+ * See {@link HostTileKernel} for a reference implementation, and
+ * {@link DeviceTileKernel} for the implementation that uses the device.
+ */
+public interface TileKernel
+{
+    /**
+     * Load the tile at the given tile row and column into the given slot
+     * 
+     * @param slot The slot
+     * @param tileRow The tile row
+     * @param tileCol The tile column
+     */
+    void load(int slot, int tileRow, int tileCol);
+    
+    /**
+     * Store the tile from the given slot at the given tile row and column
+     * 
+     * @param slot The slot
+     * @param tileRow The tile row
+     * @param tileCol The tile column
+     */
+    void store(int slot, int tileRow, int tileCol);
+    
+    /**
+     * Compute the Cholesky factorization of the diagonal tile in the given 
+     * slot, overwriting its lower triangle with the factor L
+     * 
+     * @param slot The slot
+     * @param tileIndex The index of the diagonal tile
+     */
+    void potrf(int slot, int tileIndex);
+    
+    /**
+     * Compute A = A * L^-T, where A is the tile in the given slot, and
+     * L is the lower triangle of the diagonal tile in the given slot
+     * 
+     * @param slot The slot of A
+     * @param tileRow The tile row of A
+     * @param diagonalSlot The slot of L
+     * @param tileIndex The index of the diagonal tile L
+     */
+    void trsm(int slot, int tileRow, int diagonalSlot, int tileIndex);
+    
+    /**
+     * Compute the lower triangle of A = A - P * P^T, where A is the 
+     * diagonal tile in the given slot
+     * 
+     * @param slot The slot of A
+     * @param tileIndex The index of the diagonal tile A
+     * @param panelSlot The slot of P
+     * @param panelCol The tile column of P
+     */
+    void syrk(int slot, int tileIndex, int panelSlot, int panelCol);
+    
+    /**
+     * Compute A = A - L * R^T
+     * 
+     * @param slot The slot of A
+     * @param leftSlot The slot of L
+     * @param leftRow The tile row of L
+     * @param rightSlot The slot of R
+     * @param rightRow The tile row of R
+     * @param innerCol The tile column of L and R
+     */
+    void gemm(int slot, int leftSlot, int leftRow, 
+        int rightSlot, int rightRow, int innerCol);
+    
+    /**
+     * Compute B = L^-1 * B, or B = L^-T * B, where B is the given block
+     * of the right hand side, and L is the lower triangle of the 
+     * diagonal tile in the given slot
+     * 
+     * @param rhsBlock The index of the right hand side block B
+     * @param diagonalSlot The slot of L
+     * @param transposed Whether L should be transposed
+     */
+    void solveRhs(int rhsBlock, int diagonalSlot, boolean transposed);
+    
+    /**
+     * Compute B = B - L * S, or B = B - L^T * S, where B and S are the 
+     * given blocks of the right hand side, and L is the tile in the 
+     * given slot
+     * 
+     * @param rhsBlock The index of the right hand side block B
+     * @param tileSlot The slot of L
+     * @param tileRow The tile row of L
+     * @param tileCol The tile column of L
+     * @param sourceRhsBlock The index of the right hand side block S
+     * @param transposed Whether L should be transposed
+     */
+    void updateRhs(int rhsBlock, int tileSlot, int tileRow, int tileCol, 
+        int sourceRhsBlock, boolean transposed);
+}
@@ -0,0 +1,143 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * The layout of a square matrix that is divided into square tiles. 
+ * All tiles have the same size, except for the tiles in the last 
+ * tile row and tile column, which may be smaller.
+ */
+public final class TileLayout
+{
+    /**
+     * The size of the matrix
+     */
+    private final int size;
+    
+    /**
+     * The size of the tiles
+     */
+    private final int tileSize;
+    
+    /**
+     * The number of tiles in each dimension
+     */
+    private final int tileCount;
+    
+    /**
+     * Creates a new tile layout
+     * 
+     * @param size The size of the matrix
+     * @param tileSize The size of the tiles
+     * @throws IllegalArgumentException If any argument is not positive
+     */
+    public TileLayout(int size, int tileSize)
+    {
+        if (size <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The size must be positive, but is " + size);
+        }
+        if (tileSize <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The tile size must be positive, but is " + tileSize);
+        }
+        this.size = size;
+        this.tileSize = tileSize;
+        this.tileCount = (size + tileSize - 1) / tileSize;
+    }
+    
+    /**
+     * Returns the size of the matrix
+     * 
+     * @return The size
+     */
+    public int getSize()
+    {
+        return size;
+    }
+    
+    /**
+     * Returns the (maximum) size of the tiles. This is also the leading
+     * dimension of all tiles.
+     * 
+     * @return The tile size
+     */
+    public int getTileSize()
+    {
+        return tileSize;
+    }
+    
+    /**
+     * Returns the number of tiles in each dimension
+     * 
+     * @return The number of tiles
+     */
+    public int getTileCount()
+    {
+        return tileCount;
+    }
+    
+    /**
+     * Returns the size of the given tile row or column
+     * 
+     * @param index The index of the tile row or column
+     * @return The size
+     */
+    public int getSize(int index)
+    {
+        return Math.min(tileSize, size - index * tileSize);
+    }
+    
+    /**
+     * Returns the offset of the given tile row or column inside the 
+     * matrix
+     * 
+     * @param index The index of the tile row or column
+     * @return The offset
+     */
+    public int getOffset(int index)
+    {
+        return index * tileSize;
+    }
+    
+    /**
+     * Returns a String representation of this object.
+     *
+     * @return A String representation of this object.
+     */
+    @Override
+    public String toString()
+    {
+        return "TileLayout["+
+            "size="+size+","+
+            "tileSize="+tileSize+","+
+            "tileCount="+tileCount+"]";
+    }
+}
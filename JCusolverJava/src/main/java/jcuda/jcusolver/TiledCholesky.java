@@ -0,0 +1,201 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+/**
+ * A scheduler for an out-of-core, left-looking tiled Cholesky 
+ * factorization of a symmetric positive definite matrix, and for the 
+ * corresponding solve. <br>
+ * <br>
+ * Only the lower triangle of the matrix is referenced. For each tile 
+ * column j, the tiles of the column are loaded, updated with the tiles 
+ * of all previous columns, the diagonal tile is factored, and the 
+ * tiles below it are solved with it. Then the column is stored. This 
+ * requires that the tiles of one column, plus a few input tiles, fit 
+ * into the slots of the {@link TileKernel}, but not the whole matrix.
+ * <br>
+ * <br>
+ * The scheduler only issues the operations in a valid order. Whether 
+ * they are executed on the host or on the device, and whether the 
+ * transfers overlap with the computations, is determined by the 
+ * {@link TileKernel}. Input tiles are loaded into rotating slots, so 
+ * that a kernel that executes the operations asynchronously can load 
+ * the next input tiles while the current ones are used.
+ */
+public class TiledCholesky
+{
+    /**
+     * The number of slots for the tiles of the panel row
+     */
+    private static final int PANEL_SLOTS = 2;
+    
+    /**
+     * The tile layout
+     */
+    private final TileLayout layout;
+    
+    /**
+     * The number of rotating slots for input tiles
+     */
+    private final int inputSlots;
+    
+    /**
+     * Creates a new scheduler
+     * 
+     * @param layout The tile layout
+     * @param inputSlots The number of rotating slots for input tiles. 
+     * This should be at least 2, to allow overlapping transfers with
+     * computations.
+     * @throws IllegalArgumentException If the number of input slots 
+     * is not positive
+     */
+    public TiledCholesky(TileLayout layout, int inputSlots)
+    {
+        if (inputSlots <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The number of input slots must be positive, but is " 
+                + inputSlots);
+        }
+        this.layout = layout;
+        this.inputSlots = inputSlots;
+    }
+    
+    /**
+     * Returns the tile layout
+     * 
+     * @return The tile layout
+     */
+    public TileLayout getLayout()
+    {
+        return layout;
+    }
+    
+    /**
+     * Returns the number of slots that the {@link TileKernel} must 
+     * provide for this scheduler
+     * 
+     * @return The number of slots
+     */
+    public int getRequiredSlots()
+    {
+        return layout.getTileCount() + PANEL_SLOTS + inputSlots;
+    }
+    
+    /**
+     * Issue the operations for the factorization to the given kernel. 
+     * Afterwards, the lower triangle of the matrix contains the 
+     * Cholesky factor L, with A = L * L^T
+     * 
+     * @param kernel The kernel
+     */
+    public void factor(TileKernel kernel)
+    {
+        int t = layout.getTileCount();
+        int firstPanelSlot = t;
+        int firstInputSlot = t + PANEL_SLOTS;
+        int inputCounter = 0;
+        for (int j = 0; j < t; j++)
+        {
+            // The tiles of column j are kept in slots 0...t-j-1
+            for (int i = j; i < t; i++)
+            {
+                kernel.load(i - j, i, j);
+            }
+            
+            // Apply the updates from all previous columns
+            for (int k = 0; k < j; k++)
+            {
+                int panelSlot = firstPanelSlot + (k % PANEL_SLOTS);
+                kernel.load(panelSlot, j, k);
+                kernel.syrk(0, j, panelSlot, k);
+                for (int i = j + 1; i < t; i++)
+                {
+                    int inputSlot = 
+                        firstInputSlot + (inputCounter % inputSlots);
+                    inputCounter++;
+                    kernel.load(inputSlot, i, k);
+                    kernel.gemm(i - j, inputSlot, i, panelSlot, j, k);
+                }
+            }
+            
+            kernel.potrf(0, j);
+            for (int i = j + 1; i < t; i++)
+            {
+                kernel.trsm(i - j, i, 0, j);
+            }
+            for (int i = j; i < t; i++)
+            {
+                kernel.store(i - j, i, j);
+            }
+        }
+    }
+    
+    /**
+     * Issue the operations for solving A * X = B to the given kernel, 
+     * where the lower triangle of the matrix contains the Cholesky 
+     * factor that was computed with {@link #factor(TileKernel)}. 
+     * Afterwards, the right hand side of the kernel contains X.
+     * 
+     * @param kernel The kernel
+     */
+    public void solve(TileKernel kernel)
+    {
+        int t = layout.getTileCount();
+        int slots = getRequiredSlots();
+        int slotCounter = 0;
+        
+        // Forward substitution: L * Y = B
+        for (int j = 0; j < t; j++)
+        {
+            for (int k = 0; k < j; k++)
+            {
+                int slot = slotCounter++ % slots;
+                kernel.load(slot, j, k);
+                kernel.updateRhs(j, slot, j, k, k, false);
+            }
+            int slot = slotCounter++ % slots;
+            kernel.load(slot, j, j);
+            kernel.solveRhs(j, slot, false);
+        }
+        
+        // Backward substitution: L^T * X = Y
+        for (int j = t - 1; j >= 0; j--)
+        {
+            for (int i = j + 1; i < t; i++)
+            {
+                int slot = slotCounter++ % slots;
+                kernel.load(slot, i, j);
+                kernel.updateRhs(j, slot, i, j, i, true);
+            }
+            int slot = slotCounter++ % slots;
+            kernel.load(slot, j, j);
+            kernel.solveRhs(j, slot, true);
+        }
+    }
+}
@@ -0,0 +1,175 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+import jcuda.CudaException;
+import jcuda.Pointer;
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * A preprocessing stage for unsymmetric sparse linear systems A*x = b, 
+ * with a square matrix A in CSR format that is stored on the host. <br>
+ * <br>
+ * The preprocessing computes an {@link UnsymmetricTransform} in three 
+ * steps:
+ * <ul>
+ *   <li>
+ *     A row permutation that yields a zero-free diagonal, computed with
+ *     cusolverSpDcsrzfdHost
+ *   </li>
+ *   <li>
+ *     Optionally, a symmetric fill-reducing {@link SparseOrdering} of 
+ *     the matrix with the zero-free diagonal
+ *   </li>
+ *   <li>
+ *     Optionally, a row and column equilibration with power-of-two 
+ *     scaling factors, so that the largest absolute value in each row 
+ *     and column is in [0.5, 1)
+ *   </li>
+ * </ul>
+ * The transformed matrix may then be solved with 
+ * cusolverSpDcsrlsvluHost or cusolverSpDcsrlsvqr, without a further
+ * reordering, which reduces the number of small pivots and the fill.
+ * The right hand sides and solutions are transformed with the 
+ * multithreaded functions of the {@link UnsymmetricTransform}. <br>
+ * <br>
+ * Instances of this class are thread-safe if the handle is only used
+ * by one thread at a time.
+ */
+public class UnsymmetricPreprocessor
+{
+    /**
+     * The handle
+     */
+    private final cusolverSpHandle handle;
+    
+    /**
+     * The fill-reducing ordering, or <code>null</code>
+     */
+    private final SparseOrdering ordering;
+    
+    /**
+     * Whether the matrix should be equilibrated
+     */
+    private final boolean equilibrate;
+    
+    /**
+     * Creates a new preprocessor
+     * 
+     * @param handle The handle
+     * @param ordering The fill-reducing ordering. May be 
+     * <code>null</code>, in which case only the zero-free diagonal 
+     * permutation is applied.
+     * @param equilibrate Whether the rows and columns should be scaled
+     */
+    public UnsymmetricPreprocessor(cusolverSpHandle handle, 
+        SparseOrdering ordering, boolean equilibrate)
+    {
+        this.handle = handle;
+        this.ordering = ordering;
+        this.equilibrate = equilibrate;
+    }
+    
+    /**
+     * Compute the transform for the given matrix
+     * 
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param descrA The matrix descriptor. This must describe a general
+     * matrix, and is also used for the transformed matrix.
+     * @param csrValA The values
+     * @param csrRowPtrA The row pointers
+     * @param csrColIndA The column indices
+     * @return The transform
+     * @throws CudaException If a native call fails
+     */
+    public UnsymmetricTransform preprocess(int n, int nnz, 
+        cusparseMatDescr descrA, double csrValA[], 
+        int csrRowPtrA[], int csrColIndA[])
+    {
+        int indexBase = JCusparse.cusparseGetMatIndexBase(descrA);
+        
+        int zfd[] = new int[n];
+        int numnz[] = { 0 };
+        checkSuccess(JCusolverSp.cusolverSpDcsrzfdHost(handle, n, nnz, 
+            descrA, Pointer.to(csrValA), Pointer.to(csrRowPtrA), 
+            Pointer.to(csrColIndA), Pointer.to(zfd), Pointer.to(numnz)), 
+            "cusolverSpDcsrzfdHost");
+        
+        int identity[] = new int[n];
+        for (int i = 0; i < n; i++)
+        {
+            identity[i] = i;
+        }
+        int p[] = zfd;
+        int q[] = identity;
+        if (ordering != null)
+        {
+            int csrRowPtrZ[] = new int[n + 1];
+            int csrColIndZ[] = new int[nnz];
+            int mapZ[] = new int[nnz];
+            checkSuccess(CsrPermuter.permuteStructure(n, n, nnz, indexBase, 
+                csrRowPtrA, csrColIndA, zfd, identity, 
+                csrRowPtrZ, csrColIndZ, mapZ), "CsrPermuter.permuteStructure");
+            q = new int[n];
+            ordering.compute(handle, n, nnz, descrA, 
+                csrRowPtrZ, csrColIndZ, q);
+            p = new int[n];
+            for (int k = 0; k < n; k++)
+            {
+                p[k] = zfd[q[k]];
+            }
+        }
+        
+        int csrRowPtrB[] = new int[n + 1];
+        int csrColIndB[] = new int[nnz];
+        int map[] = new int[nnz];
+        checkSuccess(CsrPermuter.permuteStructure(n, n, nnz, indexBase, 
+            csrRowPtrA, csrColIndA, p, q, csrRowPtrB, csrColIndB, map), 
+            "CsrPermuter.permuteStructure");
+        
+        double rowScale[] = null;
+        double colScale[] = null;
+        if (equilibrate)
+        {
+            double csrValB[] = new double[nnz];
+            checkSuccess(CsrPermuter.permuteValuesWithValidatedMap(
+                nnz, csrValA, map, csrValB), "CsrPermuter.permuteValues");
+            rowScale = new double[n];
+            colScale = new double[n];
+            checkSuccess(SparseScaling.equilibrateNative(n, n, nnz, 
+                indexBase, csrRowPtrB, csrColIndB, csrValB, 
+                rowScale, colScale), "SparseScaling.equilibrate");
+        }
+        return new UnsymmetricTransform(n, nnz, indexBase, p, q, 
+            rowScale, colScale, csrRowPtrB, csrColIndB, map, numnz[0]);
+    }
+}
@@ -0,0 +1,397 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package jcuda.jcusolver;
+
+import static jcuda.jcusolver.JCusolver.checkSuccess;
+
+/**
+ * The transforms that have been computed by an 
+ * {@link UnsymmetricPreprocessor} for a square matrix A. <br>
+ * <br>
+ * The transformed matrix is B = diag(r) * A(p,q) * diag(c), where p 
+ * and q are zero-based permutations, with row k of A(p,q) being row 
+ * p[k] of A, and column k of A(p,q) being column q[k] of A. The 
+ * system A*x = b is solved by solving B*y = diag(r)*b(p) and then 
+ * computing x(q) = diag(c)*y. <br>
+ * <br>
+ * The structure of B, and the map from the values of A to the values 
+ * of B, are computed once. New values of A with the same structure 
+ * may be transformed with {@link #transformValues}. <br>
+ * <br>
+ * Instances of this class are immutable, and may be used by multiple
+ * threads. The getters return copies of the arrays.
+ */
+public final class UnsymmetricTransform
+{
+    /**
+     * The size of the matrix
+     */
+    private final int n;
+    
+    /**
+     * The number of nonzeros
+     */
+    private final int nnz;
+    
+    /**
+     * The index base
+     */
+    private final int indexBase;
+    
+    /**
+     * The row permutation
+     */
+    private final int p[];
+    
+    /**
+     * The column permutation
+     */
+    private final int q[];
+    
+    /**
+     * The row scaling factors, or <code>null</code>
+     */
+    private final double rowScale[];
+    
+    /**
+     * The column scaling factors, or <code>null</code>
+     */
+    private final double colScale[];
+    
+    /**
+     * The row pointers of B
+     */
+    private final int csrRowPtrB[];
+    
+    /**
+     * The column indices of B
+     */
+    private final int csrColIndB[];
+    
+    /**
+     * The map from the values of A to the values of B
+     */
+    private final int map[];
+    
+    /**
+     * The number of nonzero diagonal elements after the zero-free 
+     * diagonal permutation
+     */
+    private final int numnz;
+    
+    /**
+     * Creates a new transform
+     * 
+     * @param n The size of the matrix
+     * @param nnz The number of nonzeros
+     * @param indexBase The index base
+     * @param p The row permutation
+     * @param q The column permutation
+     * @param rowScale The row scaling factors, or <code>null</code>
+     * @param colScale The column scaling factors, or <code>null</code>
+     * @param csrRowPtrB The row pointers of B
+     * @param csrColIndB The column indices of B
+     * @param map The value map, as computed by 
+     * {@link CsrPermuter#permuteStructure}
+     * @param numnz The number of nonzero diagonal elements
+     */
+    UnsymmetricTransform(int n, int nnz, int indexBase, int p[], int q[], 
+        double rowScale[], double colScale[], 
+        int csrRowPtrB[], int csrColIndB[], int map[], int numnz)
+    {
+        this.n = n;
+        this.nnz = nnz;
+        this.indexBase = indexBase;
+        this.p = p;
+        this.q = q;
+        this.rowScale = rowScale;
+        this.colScale = colScale;
+        this.csrRowPtrB = csrRowPtrB;
+        this.csrColIndB = csrColIndB;
+        this.map = map;
+        this.numnz = numnz;
+    }
+    
+    /**
+     * Returns the size of the matrix
+     * 
+     * @return The size
+     */
+    public int getSize()
+    {
+        return n;
+    }
+    
+    /**
+     * Returns the number of nonzeros
+     * 
+     * @return The number of nonzeros
+     */
+    public int getNnz()
+    {
+        return nnz;
+    }
+    
+    /**
+     * Returns a copy of the row permutation p
+     * 
+     * @return The row permutation
+     */
+    public int[] getRowPermutation()
+    {
+        return p.clone();
+    }
+    
+    /**
+     * Returns a copy of the column permutation q
+     * 
+     * @return The column permutation
+     */
+    public int[] getColumnPermutation()
+    {
+        return q.clone();
+    }
+    
+    /**
+     * Returns a copy of the row scaling factors r, or <code>null</code> 
+     * if the matrix is not scaled
+     * 
+     * @return The row scaling factors
+     */
+    public double[] getRowScale()
+    {
+        return rowScale == null ? null : rowScale.clone();
+    }
+    
+    /**
+     * Returns a copy of the column scaling factors c, or <code>null</code> 
+     * if the matrix is not scaled
+     * 
+     * @return The column scaling factors
+     */
+    public double[] getColumnScale()
+    {
+        return colScale == null ? null : colScale.clone();
+    }
+    
+    /**
+     * Returns a copy of the row pointers of B, with the index base of A
+     * 
+     * @return The row pointers
+     */
+    public int[] getCsrRowPtrB()
+    {
+        return csrRowPtrB.clone();
+    }
+    
+    /**
+     * Returns a copy of the column indices of B, with the index base of A
+     * 
+     * @return The column indices
+     */
+    public int[] getCsrColIndB()
+    {
+        return csrColIndB.clone();
+    }
+    
+    /**
+     * Returns the number of nonzero diagonal elements that have been 
+     * found by cusolverSpDcsrzfdHost. If this is smaller than the size 
+     * of the matrix, then the matrix is structurally singular.
+     * 
+     * @return The number of nonzero diagonal elements
+     */
+    public int getNumnz()
+    {
+        return numnz;
+    }
+    
+    /**
+     * Returns whether the matrix is structurally singular, meaning that 
+     * no zero-free diagonal could be found
+     * 
+     * @return Whether the matrix is structurally singular
+     */
+    public boolean isStructurallySingular()
+    {
+        return numnz < n;
+    }
+    
+    /**
+     * Compute the values of B from the given values of A, which must
+     * have the structure that this transform was computed for
+     * 
+     * @param csrValA The values of A
+     * @param csrValB Will store the values of B
+     * @throws IllegalArgumentException If the arrays are too small or
+     * identical
+     */
+    public void transformValues(double csrValA[], double csrValB[])
+    {
+        checkLength(csrValA, nnz, "csrValA");
+        checkLength(csrValB, nnz, "csrValB");
+        checkDistinct(csrValA, csrValB);
+        if (rowScale == null)
+        {
+            checkSuccess(CsrPermuter.permuteValuesWithValidatedMap(
+                nnz, csrValA, map, csrValB), "CsrPermuter.permuteValues");
+            return;
+        }
+        checkSuccess(SparseScaling.scaleValuesNative(n, nnz, indexBase, 
+            csrRowPtrB, csrColIndB, csrValA, map, rowScale, colScale, 
+            csrValB), "SparseScaling.scaleValues");
+    }
+    
+    /**
+     * Transform the given right hand side b of A*x = b into the right 
+     * hand side of B*y = c, by computing c = diag(r)*b(p)
+     * 
+     * @param b The right hand side of the original system
+     * @param c Will store the right hand side of the transformed system
+     * @throws IllegalArgumentException If the arrays are too small or
+     * identical
+     */
+    public void applyToRightHandSide(double b[], double c[])
+    {
+        applyToRightHandSide(b, n, c, n, 1);
+    }
+    
+    /**
+     * Transform the given right hand sides, which are n-by-nrhs matrices
+     * in column-major order, as described in 
+     * {@link #applyToRightHandSide(double[], double[])}
+     * 
+     * @param b The right hand sides of the original system
+     * @param ldb The leading dimension of b
+     * @param c Will store the right hand sides of the transformed system
+     * @param ldc The leading dimension of c
+     * @param nrhs The number of right hand sides
+     * @throws IllegalArgumentException If the arrays are too small or
+     * identical
+     */
+    public void applyToRightHandSide(
+        double b[], int ldb, double c[], int ldc, int nrhs)
+    {
+        checkMatrix(b, ldb, nrhs, "b");
+        checkMatrix(c, ldc, nrhs, "c");
+        checkDistinct(b, c);
+        checkSuccess(SparseScaling.gatherNative(
+            n, nrhs, b, ldb, p, rowScale, c, ldc), "SparseScaling.gather");
+    }
+    
+    /**
+     * Transform the given solution y of B*y = c into the solution of 
+     * A*x = b, by computing x(q) = diag(c)*y
+     * 
+     * @param y The solution of the transformed system
+     * @param x Will store the solution of the original system
+     * @throws IllegalArgumentException If the arrays are too small or
+     * identical
+     */
+    public void unapplyToSolution(double y[], double x[])
+    {
+        unapplyToSolution(y, n, x, n, 1);
+    }
+    
+    /**
+     * Transform the given solutions, which are n-by-nrhs matrices
+     * in column-major order, as described in 
+     * {@link #unapplyToSolution(double[], double[])}
+     * 
+     * @param y The solutions of the transformed system
+     * @param ldy The leading dimension of y
+     * @param x Will store the solutions of the original system
+     * @param ldx The leading dimension of x
+     * @param nrhs The number of right hand sides
+     * @throws IllegalArgumentException If the arrays are too small or
+     * identical
+     */
+    public void unapplyToSolution(
+        double y[], int ldy, double x[], int ldx, int nrhs)
+    {
+        checkMatrix(y, ldy, nrhs, "y");
+        checkMatrix(x, ldx, nrhs, "x");
+        checkDistinct(y, x);
+        checkSuccess(SparseScaling.scatterNative(
+            n, nrhs, y, ldy, q, colScale, x, ldx), "SparseScaling.scatter");
+    }
+    
+    /**
+     * Make sure that the given array can store an n-by-columns matrix
+     * with the given leading dimension
+     */
+    private void checkMatrix(double array[], int ld, int columns, String name)
+    {
+        if (ld < n || columns < 0)
+        {
+            throw new IllegalArgumentException(
+                "Invalid leading dimension " + ld + " or number of "
+                + "columns " + columns + " for " + name);
+        }
+        if (columns > 0)
+        {
+            checkLength(array, (long)ld * (columns - 1) + n, name);
+        }
+    }
+    
+    /**
+     * Make sure that the given array has at least the given length
+     */
+    private static void checkLength(double array[], long length, String name)
+    {
+        if (array.length < length)
+        {
+            throw new IllegalArgumentException(
+                "The array " + name + " has a length of " + array.length 
+                + ", but at least " + length + " elements are required");
+        }
+    }
+    
+    /**
+     * Make sure that the given arrays are not identical, because the
+     * transforms can not be computed in place
+     */
+    private static void checkDistinct(double a[], double b[])
+    {
+        if (a == b)
+        {
+            throw new IllegalArgumentException(
+                "The transforms can not be computed in place");
+        }
+    }
+    
+    @Override
+    public String toString()
+    {
+        return "UnsymmetricTransform["+
+            "n="+n+","+
+            "nnz="+nnz+","+
+            "numnz="+numnz+","+
+            "scaled="+(rowScale != null)+"]";
+    }
+}
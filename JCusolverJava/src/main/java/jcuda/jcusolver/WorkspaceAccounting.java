@@ -0,0 +1,242 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Accounting of the workspaces that are required by cuSOLVER functions.
+ * When the accounting is {@link #setEnabled(boolean) enabled}, each 
+ * successful call of a <code>bufferSize</code> or <code>BufferInfo</code>
+ * function records the device and host workspace sizes that it returned. 
+ * The sizes are attributed to the handle and the calling thread, and 
+ * the largest sizes are kept for each function.<br>
+ * <br>
+ * The workspace that is recorded for a handle replaces the workspace 
+ * that was previously recorded for the same handle, because a handle 
+ * executes one function at a time. The total workspace is the sum of the 
+ * latest workspaces of all handles, until the handles are destroyed. 
+ * Sizes that are returned as a number of elements are converted into 
+ * bytes. For cusolverMg functions, the size for each device is 
+ * multiplied with the number of devices that have been selected for the 
+ * handle.<br>
+ * <br>
+ * Optionally, a {@link #setBudget(long, long) budget} can be set. When
+ * a <code>bufferSize</code> function returns a size that would cause 
+ * the total workspace to exceed the budget, then it throws a 
+ * <code>CudaException</code> with a message that describes the request,
+ * so that the caller fails before allocating the workspace. Note that
+ * this is checked independent of whether exceptions are enabled via
+ * {@link JCusolver#setExceptionsEnabled(boolean)}.
+ */
+public final class WorkspaceAccounting
+{
+    /**
+     * The indices of the totals. These must match the definitions
+     * in WorkspaceAccounting.cpp
+     */
+    static final int TOTAL_DEVICE_BYTES = 0;
+    static final int TOTAL_HOST_BYTES = 1;
+    static final int PEAK_DEVICE_BYTES = 2;
+    static final int PEAK_HOST_BYTES = 3;
+    static final int REJECTED = 4;
+    static final int DEVICE_BUDGET = 5;
+    static final int HOST_BUDGET = 6;
+    private static final int TOTALS = 7;
+    
+    /**
+     * The indices of the statistics of one function. These must match 
+     * the definitions in WorkspaceAccounting.cpp
+     */
+    static final int FUNCTION_CALLS = 0;
+    static final int FUNCTION_LAST_DEVICE_BYTES = 1;
+    static final int FUNCTION_LAST_HOST_BYTES = 2;
+    static final int FUNCTION_MAX_DEVICE_BYTES = 3;
+    static final int FUNCTION_MAX_HOST_BYTES = 4;
+    private static final int FUNCTION_STATS = 5;
+    
+    /**
+     * The indices of the statistics of one handle. These must match 
+     * the definitions in WorkspaceAccounting.cpp
+     */
+    static final int HANDLE_ADDRESS = 0;
+    static final int HANDLE_FUNCTION_ID = 1;
+    static final int HANDLE_THREAD_INDEX = 2;
+    static final int HANDLE_DEVICE_BYTES = 3;
+    static final int HANDLE_HOST_BYTES = 4;
+    static final int HANDLE_MAX_DEVICE_BYTES = 5;
+    static final int HANDLE_MAX_HOST_BYTES = 6;
+    static final int HANDLE_DEVICE_COUNT = 7;
+    private static final int HANDLE_STATS = 8;
+    
+    /**
+     * The indices of the statistics of one thread. These must match 
+     * the definitions in WorkspaceAccounting.cpp
+     */
+    static final int THREAD_CALLS = 0;
+    static final int THREAD_MAX_DEVICE_BYTES = 1;
+    static final int THREAD_MAX_HOST_BYTES = 2;
+    private static final int THREAD_STATS = 3;
+    
+    static
+    {
+        JCusolver.initialize();
+    }
+    
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private WorkspaceAccounting()
+    {
+        // Private constructor to prevent instantiation
+    }
+    
+    /**
+     * Set whether the workspace sizes are recorded. By default, they are 
+     * not recorded. The budget is only checked while the accounting is
+     * enabled.
+     * 
+     * @param enabled Whether the accounting is enabled
+     */
+    public static void setEnabled(boolean enabled)
+    {
+        setEnabledNative(enabled);
+    }
+    private static native void setEnabledNative(boolean enabled);
+    
+    /**
+     * Returns whether the workspace sizes are recorded
+     * 
+     * @return Whether the accounting is enabled
+     */
+    public static boolean isEnabled()
+    {
+        return isEnabledNative();
+    }
+    private static native boolean isEnabledNative();
+    
+    /**
+     * Set the budget for the total workspace sizes. A value of 0 means 
+     * that there is no budget. Workspaces that have already been 
+     * recorded are not checked against the new budget.
+     * 
+     * @param deviceBytes The budget for the device workspaces, in bytes
+     * @param hostBytes The budget for the host workspaces, in bytes
+     * @throws IllegalArgumentException If a budget is negative
+     */
+    public static void setBudget(long deviceBytes, long hostBytes)
+    {
+        if (deviceBytes < 0 || hostBytes < 0)
+        {
+            throw new IllegalArgumentException(
+                "The budget may not be negative, but is " + 
+                deviceBytes + " (device) and " + hostBytes + " (host)");
+        }
+        setBudgetNative(deviceBytes, hostBytes);
+    }
+    private static native void setBudgetNative(
+        long deviceBytes, long hostBytes);
+    
+    /**
+     * Returns a snapshot of the current workspace accounting. The parts
+     * of the snapshot are obtained one after another, so calls that are
+     * running concurrently may only be reflected in some of them.
+     * 
+     * @return The snapshot
+     */
+    public static WorkspaceSnapshot getSnapshot()
+    {
+        long totals[] = new long[TOTALS];
+        getTotalsNative(totals);
+        
+        String functionNames[] = getFunctionNamesNative();
+        List<WorkspaceSnapshot.FunctionWorkspace> functions = 
+            new ArrayList<WorkspaceSnapshot.FunctionWorkspace>();
+        for (int i = 0; i < functionNames.length; i++)
+        {
+            long stats[] = new long[FUNCTION_STATS];
+            if (getFunctionStatsNative(i, stats))
+            {
+                functions.add(new WorkspaceSnapshot.FunctionWorkspace(
+                    functionNames[i], stats));
+            }
+        }
+        
+        String threadNames[] = getThreadNamesNative();
+        long threadStats[] = getThreadStatsNative();
+        List<WorkspaceSnapshot.ThreadWorkspace> threads = 
+            new ArrayList<WorkspaceSnapshot.ThreadWorkspace>();
+        int threadCount = Math.min(
+            threadNames.length, threadStats.length / THREAD_STATS);
+        for (int i = 0; i < threadCount; i++)
+        {
+            threads.add(new WorkspaceSnapshot.ThreadWorkspace(
+                threadNames[i], Arrays.copyOfRange(threadStats, 
+                    i * THREAD_STATS, (i + 1) * THREAD_STATS)));
+        }
+        
+        long handleStats[] = getHandleStatsNative();
+        List<WorkspaceSnapshot.HandleWorkspace> handles = 
+            new ArrayList<WorkspaceSnapshot.HandleWorkspace>();
+        for (int i = 0; i < handleStats.length; i += HANDLE_STATS)
+        {
+            long stats[] = 
+                Arrays.copyOfRange(handleStats, i, i + HANDLE_STATS);
+            int functionId = (int)stats[HANDLE_FUNCTION_ID];
+            int threadIndex = (int)stats[HANDLE_THREAD_INDEX];
+            String functionName = functionId < functionNames.length ? 
+                functionNames[functionId] : "unknown";
+            String threadName = threadIndex < threadNames.length ? 
+                threadNames[threadIndex] : "unknown";
+            handles.add(new WorkspaceSnapshot.HandleWorkspace(
+                functionName, threadName, stats));
+        }
+        return new WorkspaceSnapshot(totals, functions, handles, threads);
+    }
+    private static native void getTotalsNative(long totals[]);
+    private static native String[] getFunctionNamesNative();
+    private static native boolean getFunctionStatsNative(
+        int functionId, long stats[]);
+    private static native long[] getHandleStatsNative();
+    private static native String[] getThreadNamesNative();
+    private static native long[] getThreadStatsNative();
+    
+    /**
+     * Reset the statistics of the functions and threads, the high-water
+     * marks, and the number of rejected requests. The workspaces of the
+     * handles that have not been destroyed remain accounted.
+     */
+    public static void reset()
+    {
+        resetNative();
+    }
+    private static native void resetNative();
+}
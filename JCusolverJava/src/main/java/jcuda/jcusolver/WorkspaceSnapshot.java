@@ -0,0 +1,547 @@
+/*
+ * JCusolver - Java bindings for CUSOLVER, the NVIDIA CUDA solver
+ * library, to be used with JCuda
+ *
+ * Copyright (c) 2010-2026 Marco Hutter - http://www.jcuda.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+package jcuda.jcusolver;
+
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.List;
+import java.util.Locale;
+
+/**
+ * A snapshot of the workspace sizes that have been recorded by the 
+ * {@link WorkspaceAccounting}. All sizes are in bytes.
+ */
+public final class WorkspaceSnapshot
+{
+    /**
+     * The workspace sizes that have been returned by one function
+     */
+    public static final class FunctionWorkspace
+    {
+        /**
+         * The function name
+         */
+        private final String functionName;
+        
+        /**
+         * The statistics
+         */
+        private final long stats[];
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param functionName The function name
+         * @param stats The statistics
+         */
+        FunctionWorkspace(String functionName, long stats[])
+        {
+            this.functionName = functionName;
+            this.stats = stats;
+        }
+        
+        /**
+         * Returns the name of the function, for example, 
+         * <code>"cusolverDnXgesvdp_bufferSize"</code>
+         * 
+         * @return The function name
+         */
+        public String getFunctionName()
+        {
+            return functionName;
+        }
+        
+        /**
+         * Returns the number of calls that have been recorded
+         * 
+         * @return The number of calls
+         */
+        public long getCalls()
+        {
+            return stats[WorkspaceAccounting.FUNCTION_CALLS];
+        }
+        
+        /**
+         * Returns the device workspace size of the latest call
+         * 
+         * @return The size
+         */
+        public long getLastDeviceBytes()
+        {
+            return stats[WorkspaceAccounting.FUNCTION_LAST_DEVICE_BYTES];
+        }
+        
+        /**
+         * Returns the host workspace size of the latest call
+         * 
+         * @return The size
+         */
+        public long getLastHostBytes()
+        {
+            return stats[WorkspaceAccounting.FUNCTION_LAST_HOST_BYTES];
+        }
+        
+        /**
+         * Returns the largest device workspace size
+         * 
+         * @return The size
+         */
+        public long getMaxDeviceBytes()
+        {
+            return stats[WorkspaceAccounting.FUNCTION_MAX_DEVICE_BYTES];
+        }
+        
+        /**
+         * Returns the largest host workspace size
+         * 
+         * @return The size
+         */
+        public long getMaxHostBytes()
+        {
+            return stats[WorkspaceAccounting.FUNCTION_MAX_HOST_BYTES];
+        }
+        
+        @Override
+        public String toString()
+        {
+            return "FunctionWorkspace["
+                + "functionName=" + functionName + ","
+                + "calls=" + getCalls() + ","
+                + "maxDeviceBytes=" + getMaxDeviceBytes() + ","
+                + "maxHostBytes=" + getMaxHostBytes() + "]";
+        }
+    }
+    
+    /**
+     * The workspace sizes that have most recently been returned for one
+     * handle that has not been destroyed yet
+     */
+    public static final class HandleWorkspace
+    {
+        /**
+         * The name of the function that returned the latest sizes
+         */
+        private final String functionName;
+        
+        /**
+         * The name of the thread that called the function
+         */
+        private final String threadName;
+        
+        /**
+         * The statistics
+         */
+        private final long stats[];
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param functionName The function name
+         * @param threadName The thread name
+         * @param stats The statistics
+         */
+        HandleWorkspace(String functionName, String threadName, 
+            long stats[])
+        {
+            this.functionName = functionName;
+            this.threadName = threadName;
+            this.stats = stats;
+        }
+        
+        /**
+         * Returns the native address of the handle. This is the value 
+         * that is shown in the <code>toString</code> representation of
+         * the handle object.
+         * 
+         * @return The address
+         */
+        public long getHandleAddress()
+        {
+            return stats[WorkspaceAccounting.HANDLE_ADDRESS];
+        }
+        
+        /**
+         * Returns the name of the function that returned the current
+         * workspace sizes of the handle
+         * 
+         * @return The function name
+         */
+        public String getFunctionName()
+        {
+            return functionName;
+        }
+        
+        /**
+         * Returns the name of the thread that called the function. This 
+         * is the name that the thread had when it called a 
+         * <code>bufferSize</code> function for the first time.
+         * 
+         * @return The thread name
+         */
+        public String getThreadName()
+        {
+            return threadName;
+        }
+        
+        /**
+         * Returns the current device workspace size of the handle
+         * 
+         * @return The size
+         */
+        public long getDeviceBytes()
+        {
+            return stats[WorkspaceAccounting.HANDLE_DEVICE_BYTES];
+        }
+        
+        /**
+         * Returns the current host workspace size of the handle
+         * 
+         * @return The size
+         */
+        public long getHostBytes()
+        {
+            return stats[WorkspaceAccounting.HANDLE_HOST_BYTES];
+        }
+        
+        /**
+         * Returns the largest device workspace size of the handle
+         * 
+         * @return The size
+         */
+        public long getMaxDeviceBytes()
+        {
+            return stats[WorkspaceAccounting.HANDLE_MAX_DEVICE_BYTES];
+        }
+        
+        /**
+         * Returns the largest host workspace size of the handle
+         * 
+         * @return The size
+         */
+        public long getMaxHostBytes()
+        {
+            return stats[WorkspaceAccounting.HANDLE_MAX_HOST_BYTES];
+        }
+        
+        /**
+         * Returns the number of devices of the handle. This is the 
+         * number of devices that have been selected for a cusolverMg
+         * handle, and 1 for all other handles.
+         * 
+         * @return The number of devices
+         */
+        public int getDeviceCount()
+        {
+            return (int)stats[WorkspaceAccounting.HANDLE_DEVICE_COUNT];
+        }
+        
+        @Override
+        public String toString()
+        {
+            return "HandleWorkspace["
+                + "handle=0x" + Long.toHexString(getHandleAddress()) + ","
+                + "functionName=" + functionName + ","
+                + "threadName=" + threadName + ","
+                + "deviceBytes=" + getDeviceBytes() + ","
+                + "hostBytes=" + getHostBytes() + "]";
+        }
+    }
+    
+    /**
+     * The workspace sizes that have been returned to one thread
+     */
+    public static final class ThreadWorkspace
+    {
+        /**
+         * The thread name
+         */
+        private final String threadName;
+        
+        /**
+         * The statistics
+         */
+        private final long stats[];
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param threadName The thread name
+         * @param stats The statistics
+         */
+        ThreadWorkspace(String threadName, long stats[])
+        {
+            this.threadName = threadName;
+            this.stats = stats;
+        }
+        
+        /**
+         * Returns the name of the thread. This is the name that the 
+         * thread had when it called a <code>bufferSize</code> function 
+         * for the first time.
+         * 
+         * @return The thread name
+         */
+        public String getThreadName()
+        {
+            return threadName;
+        }
+        
+        /**
+         * Returns the number of calls that have been recorded
+         * 
+         * @return The number of calls
+         */
+        public long getCalls()
+        {
+            return stats[WorkspaceAccounting.THREAD_CALLS];
+        }
+        
+        /**
+         * Returns the largest device workspace size
+         * 
+         * @return The size
+         */
+        public long getMaxDeviceBytes()
+        {
+            return stats[WorkspaceAccounting.THREAD_MAX_DEVICE_BYTES];
+        }
+        
+        /**
+         * Returns the largest host workspace size
+         * 
+         * @return The size
+         */
+        public long getMaxHostBytes()
+        {
+            return stats[WorkspaceAccounting.THREAD_MAX_HOST_BYTES];
+        }
+        
+        @Override
+        public String toString()
+        {
+            return "ThreadWorkspace["
+                + "threadName=" + threadName + ","
+                + "calls=" + getCalls() + ","
+                + "maxDeviceBytes=" + getMaxDeviceBytes() + ","
+                + "maxHostBytes=" + getMaxHostBytes() + "]";
+        }
+    }
+    
+    /**
+     * The totals
+     */
+    private final long totals[];
+    
+    /**
+     * The workspaces of the functions
+     */
+    private final List<FunctionWorkspace> functions;
+    
+    /**
+     * The workspaces of the handles
+     */
+    private final List<HandleWorkspace> handles;
+    
+    /**
+     * The workspaces of the threads
+     */
+    private final List<ThreadWorkspace> threads;
+    
+    /**
+     * Creates a new instance
+     * 
+     * @param totals The totals
+     * @param functions The workspaces of the functions
+     * @param handles The workspaces of the handles
+     * @param threads The workspaces of the threads
+     */
+    WorkspaceSnapshot(long totals[], List<FunctionWorkspace> functions,
+        List<HandleWorkspace> handles, List<ThreadWorkspace> threads)
+    {
+        this.totals = totals;
+        functions.sort(Comparator.comparing(
+            FunctionWorkspace::getMaxDeviceBytes).reversed());
+        handles.sort(Comparator.comparing(
+            HandleWorkspace::getDeviceBytes).reversed());
+        this.functions = Collections.unmodifiableList(functions);
+        this.handles = Collections.unmodifiableList(handles);
+        this.threads = Collections.unmodifiableList(threads);
+    }
+    
+    /**
+     * Returns the sum of the current device workspaces of all handles
+     * 
+     * @return The size
+     */
+    public long getTotalDeviceBytes()
+    {
+        return totals[WorkspaceAccounting.TOTAL_DEVICE_BYTES];
+    }
+    
+    /**
+     * Returns the sum of the current host workspaces of all handles
+     * 
+     * @return The size
+     */
+    public long getTotalHostBytes()
+    {
+        return totals[WorkspaceAccounting.TOTAL_HOST_BYTES];
+    }
+    
+    /**
+     * Returns the largest value of the {@link #getTotalDeviceBytes()}
+     * 
+     * @return The size
+     */
+    public long getPeakDeviceBytes()
+    {
+        return totals[WorkspaceAccounting.PEAK_DEVICE_BYTES];
+    }
+    
+    /**
+     * Returns the largest value of the {@link #getTotalHostBytes()}
+     * 
+     * @return The size
+     */
+    public long getPeakHostBytes()
+    {
+        return totals[WorkspaceAccounting.PEAK_HOST_BYTES];
+    }
+    
+    /**
+     * Returns the number of requests that have been rejected because 
+     * they would have exceeded the budget
+     * 
+     * @return The number of rejected requests
+     */
+    public long getRejected()
+    {
+        return totals[WorkspaceAccounting.REJECTED];
+    }
+    
+    /**
+     * Returns the device workspace budget, or 0 if there is no budget
+     * 
+     * @return The budget
+     */
+    public long getDeviceBudget()
+    {
+        return totals[WorkspaceAccounting.DEVICE_BUDGET];
+    }
+    
+    /**
+     * Returns the host workspace budget, or 0 if there is no budget
+     * 
+     * @return The budget
+     */
+    public long getHostBudget()
+    {
+        return totals[WorkspaceAccounting.HOST_BUDGET];
+    }
+    
+    /**
+     * Returns the workspaces of all functions that have been called, 
+     * sorted by their largest device workspace, in descending order
+     * 
+     * @return The function workspaces
+     */
+    public List<FunctionWorkspace> getFunctions()
+    {
+        return functions;
+    }
+    
+    /**
+     * Returns the current workspaces of all handles that have not been 
+     * destroyed, sorted by their device workspace, in descending order
+     * 
+     * @return The handle workspaces
+     */
+    public List<HandleWorkspace> getHandles()
+    {
+        return handles;
+    }
+    
+    /**
+     * Returns the workspaces of all threads that have called a function
+     * 
+     * @return The thread workspaces
+     */
+    public List<ThreadWorkspace> getThreads()
+    {
+        return threads;
+    }
+    
+    /**
+     * Creates a multi-line report of this snapshot
+     * 
+     * @return The report
+     */
+    public String createReport()
+    {
+        StringBuilder sb = new StringBuilder();
+        sb.append(String.format(Locale.ENGLISH, 
+            "Workspaces: device %d bytes (peak %d, budget %d), "
+            + "host %d bytes (peak %d, budget %d), %d rejected%n",
+            getTotalDeviceBytes(), getPeakDeviceBytes(), getDeviceBudget(),
+            getTotalHostBytes(), getPeakHostBytes(), getHostBudget(),
+            getRejected()));
+        sb.append(String.format(Locale.ENGLISH, "%-44s %10s %16s %16s%n",
+            "Function", "Calls", "Max device", "Max host"));
+        for (FunctionWorkspace f : functions)
+        {
+            sb.append(String.format(Locale.ENGLISH, 
+                "%-44s %10d %16d %16d%n", f.getFunctionName(), 
+                f.getCalls(), f.getMaxDeviceBytes(), f.getMaxHostBytes()));
+        }
+        sb.append(String.format(Locale.ENGLISH, 
+            "%-18s %-24s %-24s %16s %16s%n",
+            "Handle", "Thread", "Function", "Device", "Host"));
+        for (HandleWorkspace h : handles)
+        {
+            sb.append(String.format(Locale.ENGLISH, 
+                "0x%-16x %-24s %-24s %16d %16d%n", h.getHandleAddress(), 
+                h.getThreadName(), h.getFunctionName(), 
+                h.getDeviceBytes(), h.getHostBytes()));
+        }
+        return sb.toString();
+    }
+    
+    @Override
+    public String toString()
+    {
+        return "WorkspaceSnapshot["
+            + "totalDeviceBytes=" + getTotalDeviceBytes() + ","
+            + "totalHostBytes=" + getTotalHostBytes() + ","
+            + "peakDeviceBytes=" + getPeakDeviceBytes() + ","
+            + "peakHostBytes=" + getPeakHostBytes() + ","
+            + "rejected=" + getRejected() + ","
+            + "functions=" + functions.size() + ","
+            + "handles=" + handles.size() + "]";
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import java.util.List;
+
+import org.junit.Test;
+
+/**
+ * Tests for the {@link BatchBucketing}, which do not require 
+ * the native library
+ */
+public class BatchBucketingTest
+{
+    @Test
+    public void testSquareSizesAreGroupedBySizeClass()
+    {
+        BatchBucketing bucketing = new BatchBucketing(8, 32);
+        int sizes[] = { 4, 7, 8, 9, 16, 31, 40 };
+        List<BatchBucketing.Bucket> buckets = bucketing.assign(sizes);
+        
+        assertEquals(4, buckets.size());
+        assertBucket(buckets.get(0), 8, 8, true, 0, 1, 2);
+        assertBucket(buckets.get(1), 16, 16, true, 3, 4);
+        assertBucket(buckets.get(2), 32, 32, true, 5);
+        assertBucket(buckets.get(3), 40, 40, false, 6);
+    }
+    
+    @Test
+    public void testRectangularSizesKeepTheirDifference()
+    {
+        BatchBucketing bucketing = new BatchBucketing(8, 32);
+        int rows[] = { 6, 5, 4 };
+        int cols[] = { 4, 3, 6 };
+        List<BatchBucketing.Bucket> buckets = bucketing.assign(rows, cols);
+        
+        assertEquals(2, buckets.size());
+        assertBucket(buckets.get(0), 8, 6, true, 0, 1);
+        assertBucket(buckets.get(1), 6, 8, true, 2);
+    }
+    
+    @Test
+    public void testPaddingPreservesEigenvalues()
+    {
+        // A symmetric 2x2 matrix with eigenvalues 1 and 3
+        double a[] = { 2, 1, 1, 2 };
+        double p = BatchBucketing.computePaddingValue(a, 2, 2);
+        assertTrue(p > 3.0);
+        
+        double padded[] = new double[4 * 4 + 1];
+        BatchBucketing.pad(a, 2, 2, padded, 1, 4, 4, p);
+        
+        assertEquals(2.0, padded[1 + 0 + 0 * 4], 0.0);
+        assertEquals(1.0, padded[1 + 1 + 0 * 4], 0.0);
+        assertEquals(1.0, padded[1 + 0 + 1 * 4], 0.0);
+        assertEquals(2.0, padded[1 + 1 + 1 * 4], 0.0);
+        assertEquals(p, padded[1 + 2 + 2 * 4], 0.0);
+        assertEquals(p, padded[1 + 3 + 3 * 4], 0.0);
+        assertEquals(0.0, padded[1 + 2 + 0 * 4], 0.0);
+        assertEquals(0.0, padded[1 + 0 + 3 * 4], 0.0);
+    }
+    
+    private static void assertBucket(BatchBucketing.Bucket bucket, 
+        int rows, int cols, boolean batched, int ... indices)
+    {
+        assertEquals(rows, bucket.getRows());
+        assertEquals(cols, bucket.getCols());
+        assertEquals(batched, bucket.isBatched());
+        assertEquals(indices.length, bucket.getBatchSize());
+        for (int i = 0; i < indices.length; i++)
+        {
+            assertEquals(indices[i], bucket.getIndex(i));
+        }
+    }
+}
@@ -0,0 +1,144 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+import jcuda.CudaException;
+import jcuda.Pointer;
+
+/**
+ * Tests for the {@link BlockDiagonalPartition}
+ */
+public class BlockDiagonalPartitionTest
+{
+    // A 5x5 matrix with the components { 0, 2 }, { 1, 3 } and { 4 }
+    private static final long ROW_PTR[] = { 0, 2, 4, 6, 8, 9 };
+    private static final long COL_IND[] = { 0, 2, 1, 3, 0, 2, 1, 3, 4 };
+    private static final double VAL[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    @Test
+    public void testComponentsAreAssignedToPieces()
+    {
+        BlockDiagonalPartition partition = create(ROW_PTR, COL_IND, 4);
+        try
+        {
+            assertEquals(3, partition.getComponentCount());
+            assertEquals(3, partition.getPieceCount());
+            assertEquals(2, partition.getPieceRows(0));
+            assertEquals(4, partition.getPieceNnz(0));
+            assertEquals(1, partition.getPieceRows(2));
+            assertEquals(1, partition.getPieceNnz(2));
+
+            int rowPtr[] = new int[3];
+            int colInd[] = new int[4];
+            double val[] = new double[4];
+            partition.extract(0, rowPtr, colInd, val);
+            assertArrayEquals(new int[] { 0, 2, 4 }, rowPtr);
+            assertArrayEquals(new int[] { 0, 1, 0, 1 }, colInd);
+            assertArrayEquals(new double[] { 1, 2, 5, 6 }, val, 0.0);
+        }
+        finally
+        {
+            partition.close();
+        }
+    }
+
+    @Test
+    public void testLargeLimitCombinesComponents()
+    {
+        BlockDiagonalPartition partition = create(ROW_PTR, COL_IND, 100);
+        try
+        {
+            assertEquals(3, partition.getComponentCount());
+            assertEquals(1, partition.getPieceCount());
+            assertEquals(3, partition.getPieceComponents(0));
+        }
+        finally
+        {
+            partition.close();
+        }
+    }
+
+    @Test
+    public void testGatherAndScatter()
+    {
+        BlockDiagonalPartition partition = create(ROW_PTR, COL_IND, 4);
+        try
+        {
+            double b[] = { 10, 11, 12, 13, 14 };
+            double bPiece[] = new double[2];
+            partition.gather(1, Pointer.to(b), bPiece);
+            assertArrayEquals(new double[] { 11, 13 }, bPiece, 0.0);
+
+            double x[] = new double[5];
+            partition.scatter(1, new double[] { 21, 23 }, Pointer.to(x));
+            assertArrayEquals(new double[] { 0, 21, 0, 23, 0 }, x, 0.0);
+        }
+        finally
+        {
+            partition.close();
+        }
+    }
+
+    @Test(expected = CudaException.class)
+    public void testTooSmallVectorIsRejected()
+    {
+        BlockDiagonalPartition partition = create(ROW_PTR, COL_IND, 4);
+        try
+        {
+            partition.gather(2, Pointer.to(new double[4]), new double[1]);
+        }
+        finally
+        {
+            partition.close();
+        }
+    }
+
+    @Test(expected = CudaException.class)
+    public void testDecreasingRowPointersAreRejected()
+    {
+        create(new long[] { 0, 4, 2, 6, 8, 9 }, COL_IND, 4);
+    }
+
+    @Test(expected = CudaException.class)
+    public void testRowRangeBeyondNnzIsRejected()
+    {
+        // The first row would read the column indices 0 to 9, but
+        // there are only 9 nonzeros
+        create(new long[] { 0, 10, 4, 6, 8, 9 }, COL_IND, 4);
+    }
+
+    @Test(expected = CudaException.class)
+    public void testColumnIndexOutOfRangeIsRejected()
+    {
+        create(ROW_PTR, new long[] { 0, 2, 1, 3, 0, 2, 1, 3, 5 }, 4);
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void testClosedPartitionIsRejected()
+    {
+        BlockDiagonalPartition partition = create(ROW_PTR, COL_IND, 4);
+        partition.close();
+        partition.gather(0, Pointer.to(new double[5]), new double[2]);
+    }
+
+    /**
+     * Creates a partition of the 5x5 matrix with 9 nonzeros that is
+     * given by the given arrays
+     */
+    private static BlockDiagonalPartition create(
+        long rowPtr[], long colInd[], long maxPieceNnz)
+    {
+        CsrMatrix64 matrix = new CsrMatrix64(5, 9, 0,
+            Pointer.to(rowPtr), Pointer.to(colInd), Pointer.to(VAL));
+        return new BlockDiagonalPartition(matrix, maxPieceNnz);
+    }
+}
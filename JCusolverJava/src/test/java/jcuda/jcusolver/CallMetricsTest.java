@@ -0,0 +1,119 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNull;
+
+import java.util.Map;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+/**
+ * Tests for the {@link CallMetrics}. The recorded calls are calls of
+ * cusolverGetProperty with an invalid property type, which do not
+ * require a device.
+ */
+public class CallMetricsTest
+{
+    /**
+     * A library property type that does not exist
+     */
+    private static final int INVALID_TYPE = 1234;
+
+    @Before
+    public void setUp()
+    {
+        CallMetrics.reset();
+        CallMetrics.setEnabled(true);
+    }
+
+    @After
+    public void tearDown()
+    {
+        CallMetrics.setEnabled(false);
+        CallMetrics.reset();
+    }
+
+    @Test
+    public void testMetricsOfEndedThreadsAreMerged() throws Exception
+    {
+        Thread thread = new Thread(() -> callGetProperty(2));
+        thread.start();
+        thread.join();
+        callGetProperty(3);
+
+        FunctionCallMetrics metrics = getPropertyMetrics();
+        assertEquals(5, metrics.getCalls());
+        assertEquals(5, metrics.getErrors());
+        Map<String, Long> errorCounts = metrics.getErrorCounts();
+        assertEquals(1, errorCounts.size());
+        assertEquals(Long.valueOf(5), errorCounts.get(cusolverStatus
+            .stringFor(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE)));
+    }
+
+    @Test
+    public void testResetClearsTheMetrics() throws Exception
+    {
+        Thread thread = new Thread(() -> callGetProperty(2));
+        thread.start();
+        thread.join();
+        callGetProperty(1);
+        CallMetrics.reset();
+        assertNull(getPropertyMetrics());
+
+        callGetProperty(1);
+        assertEquals(1, getPropertyMetrics().getCalls());
+    }
+
+    @Test
+    public void testLastKnownStatusIsNotCountedAsOther()
+    {
+        long counters[] = new long[3];
+        long statuses[] = new long[CallMetrics.STATUS_SLOTS];
+        statuses[cusolverStatus.CUSOLVER_STATUS_INVALID_WORKSPACE] = 2;
+        statuses[CallMetrics.STATUS_SLOTS - 1] = 3;
+        FunctionCallMetrics metrics = new FunctionCallMetrics(
+            "cusolverDnDpotrf", counters, statuses,
+            new long[CallMetrics.BUCKETS]);
+
+        Map<String, Long> errorCounts = metrics.getErrorCounts();
+        assertEquals(Long.valueOf(2), errorCounts.get(cusolverStatus
+            .stringFor(cusolverStatus.CUSOLVER_STATUS_INVALID_WORKSPACE)));
+        assertEquals(Long.valueOf(3), errorCounts.get("OTHER"));
+    }
+
+    /**
+     * Call cusolverGetProperty with an invalid type the given number
+     * of times
+     */
+    private static void callGetProperty(int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            JCusolver.cusolverGetProperty(INVALID_TYPE, new int[1]);
+        }
+    }
+
+    /**
+     * Returns the metrics of cusolverGetProperty, or null if it was not
+     * called since the last reset
+     */
+    private static FunctionCallMetrics getPropertyMetrics()
+    {
+        for (FunctionCallMetrics metrics : CallMetrics.getMetrics())
+        {
+            if (metrics.getFunctionName().equals("cusolverGetProperty"))
+            {
+                return metrics;
+            }
+        }
+        return null;
+    }
+}
@@ -0,0 +1,200 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.Arrays;
+import java.util.List;
+
+import org.junit.Test;
+
+import jcuda.jcusolver.CallRecording.Argument;
+import jcuda.jcusolver.CallRecording.Call;
+import jcuda.jcusolver.CallRecording.Kind;
+
+/**
+ * Tests for reading the call recording format that is described in
+ * CallRecorder.hpp, using files that are written by the test
+ */
+public class CallRecordingTest
+{
+    private static final int MAGIC = 0x5243534A;
+    private static final int VERSION = 1;
+    private static final int FLAG_CONTENTS = 1;
+
+    @Test
+    public void testRecordingIsRead() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC, VERSION, FLAG_CONTENTS);
+        putFunction(bb, 0, "cusolverDnDpotrf");
+        bb.putInt(2).putInt(5).putInt(3).putInt(0);
+        bb.put(new byte[] { 1, 2, 3 });
+
+        ByteBuffer call = createBuffer();
+        call.putInt(1).putInt(0).putLong(1500).putLong(20);
+        call.put((byte)Kind.HANDLE.ordinal()).putLong(0x1000).putLong(0x1000);
+        call.put((byte)Kind.INT.ordinal()).putInt(100);
+        call.put((byte)Kind.DEVICE_POINTER.ordinal());
+        call.putLong(0x2010).putLong(0x2000).putLong(800).putInt(5);
+        call.put((byte)Kind.ARRAY.ordinal()).put((byte)'I').putInt(2);
+        call.putInt(7).putInt(8);
+        call.put((byte)Kind.POINTER_ARRAY.ordinal()).putInt(2);
+        call.put((byte)Kind.NULL.ordinal());
+        call.put((byte)Kind.HOST_BUFFER.ordinal()).putInt(5);
+        putCall(bb, 0, 5, call);
+
+        ByteBuffer secondCall = createBuffer();
+        secondCall.putInt(0).putInt(3).putLong(1000).putLong(10);
+        secondCall.put((byte)Kind.COMPLEX.ordinal());
+        secondCall.putDouble(1.5).putDouble(-2.5).put((byte)1);
+        putCall(bb, 0, 1, secondCall);
+
+        CallRecording recording = read(bb);
+        assertTrue(recording.isContentsRecorded());
+        assertArrayEquals(new byte[] { 1, 2, 3 }, recording.getBlob(5));
+
+        List<Call> calls = recording.getCalls();
+        assertEquals(2, calls.size());
+        Call first = calls.get(0);
+        assertEquals("cusolverDnDpotrf", first.getFunctionName());
+        assertEquals(1, first.getThreadIndex());
+        assertEquals(500, first.getStartNs());
+        assertEquals(20, first.getDurationNs());
+
+        List<Argument> arguments = first.getArguments();
+        assertEquals(5, arguments.size());
+        assertEquals(Kind.HANDLE, arguments.get(0).getKind());
+        assertEquals(0x1000, arguments.get(0).getValue(1));
+        assertEquals(100, arguments.get(1).getValue(0));
+        Argument pointer = arguments.get(2);
+        assertEquals(Kind.DEVICE_POINTER, pointer.getKind());
+        assertEquals(0x2010, pointer.getValue(0));
+        assertEquals(0x2000, pointer.getValue(1));
+        assertEquals(800, pointer.getValue(2));
+        assertEquals(5, pointer.getBlobId());
+        assertArrayEquals(new int[] { 7, 8 },
+            (int[])arguments.get(3).getArray());
+        List<Argument> elements = arguments.get(4).getElements();
+        assertEquals(Kind.NULL, elements.get(0).getKind());
+        assertEquals(Kind.HOST_BUFFER, elements.get(1).getKind());
+        assertEquals(5, elements.get(1).getBlobId());
+
+        Call second = calls.get(1);
+        assertEquals(3, second.getStatus());
+        assertEquals(0, second.getStartNs());
+        Argument complex = second.getArguments().get(0);
+        assertEquals(1.5, complex.getDoubleValue(0), 0.0);
+        assertEquals(-2.5, complex.getDoubleValue(1), 0.0);
+        assertTrue(complex.isDoubleComplex());
+    }
+
+    @Test(expected = IOException.class)
+    public void testInvalidMagicIsRejected() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC + 1, VERSION, 0);
+        read(bb);
+    }
+
+    @Test(expected = IOException.class)
+    public void testUnsupportedVersionIsRejected() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC, VERSION + 1, 0);
+        read(bb);
+    }
+
+    @Test(expected = IOException.class)
+    public void testUnknownFunctionIsRejected() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC, VERSION, 0);
+        putFunction(bb, 0, "cusolverDnCreate");
+        ByteBuffer call = createBuffer();
+        call.putInt(0).putInt(0).putLong(0).putLong(0);
+        putCall(bb, 1, 0, call);
+        read(bb);
+    }
+
+    @Test(expected = IOException.class)
+    public void testTruncatedFileIsRejected() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC, VERSION, 0);
+        bb.putInt(1).putInt(0).putInt(100).putInt(0);
+        bb.put("cusolver".getBytes(StandardCharsets.US_ASCII));
+        read(bb);
+    }
+
+    /**
+     * Creates a buffer with the native byte order
+     */
+    private static ByteBuffer createBuffer()
+    {
+        return ByteBuffer.allocate(4096).order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Put the file header into the given buffer
+     */
+    private static void putHeader(
+        ByteBuffer bb, int magic, int version, int flags)
+    {
+        bb.putInt(magic).putInt(version).putInt(flags);
+    }
+
+    /**
+     * Put a FUNCTION chunk into the given buffer
+     */
+    private static void putFunction(ByteBuffer bb, int id, String name)
+    {
+        byte bytes[] = name.getBytes(StandardCharsets.US_ASCII);
+        bb.putInt(1).putInt(id).putInt(bytes.length).putInt(0);
+        bb.put(bytes);
+    }
+
+    /**
+     * Put a CALL chunk with the data of the given buffer into the given
+     * buffer
+     */
+    private static void putCall(ByteBuffer bb, int functionId,
+        int argumentCount, ByteBuffer data)
+    {
+        bb.putInt(3).putInt(functionId).putInt(argumentCount);
+        bb.putInt(data.position());
+        bb.put(data.array(), 0, data.position());
+    }
+
+    /**
+     * Write the contents of the given buffer into a file, and read it
+     * as a call recording
+     */
+    private static CallRecording read(ByteBuffer bb) throws IOException
+    {
+        File file = File.createTempFile("CallRecordingTest", ".jscr");
+        try
+        {
+            Files.write(file.toPath(),
+                Arrays.copyOf(bb.array(), bb.position()));
+            return CallRecording.read(file.getPath());
+        }
+        finally
+        {
+            file.delete();
+        }
+    }
+}
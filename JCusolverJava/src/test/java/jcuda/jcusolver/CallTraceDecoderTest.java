@@ -0,0 +1,176 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.Arrays;
+import java.util.List;
+
+import org.junit.Test;
+
+import jcuda.jcusolver.CallTraceDecoder.Trace;
+
+/**
+ * Tests for reading the call trace format that is described in
+ * CallTracer.hpp, using files that are written by the test
+ */
+public class CallTraceDecoderTest
+{
+    private static final int MAGIC = 0x5443534A;
+    private static final int VERSION = 1;
+
+    @Test
+    public void testTraceIsRead() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC, VERSION);
+        putFunction(bb, 0, "cusolverDnCreate()");
+        putFunction(bb, 1, "cusolverDnDpotrf(handle, n, lda)");
+        bb.putInt(2).putInt(0).putInt(2).putInt(3);
+        putRecord(bb, 1, 0, 1500, 20, 0x1000, 100, 100, 99);
+        putRecord(bb, 0, 0, 1000, 10, 1, 2, 3, 4);
+        bb.putInt(2).putInt(1).putInt(1).putInt(4);
+        putRecord(bb, 1, 7, 1200, 30, 0x2000, 50, 64, 0);
+
+        Trace trace = read(bb);
+        assertEquals(7, trace.getDroppedCount());
+
+        List<CallTraceRecord> records = trace.getRecords();
+        assertEquals(3, records.size());
+
+        CallTraceRecord first = records.get(0);
+        assertEquals("cusolverDnCreate", first.getFunctionName());
+        assertEquals(0, first.getArgumentNames().length);
+        assertEquals(0, first.getArguments().length);
+        assertEquals(0, first.getStartNs());
+        assertEquals(10, first.getDurationNs());
+        assertEquals(0, first.getThreadIndex());
+
+        CallTraceRecord second = records.get(1);
+        assertEquals("cusolverDnDpotrf", second.getFunctionName());
+        assertArrayEquals(new String[] { "handle", "n", "lda" },
+            second.getArgumentNames());
+        assertArrayEquals(new long[] { 0x2000, 50, 64 },
+            second.getArguments());
+        assertEquals(200, second.getStartNs());
+        assertEquals(30, second.getDurationNs());
+        assertEquals(1, second.getThreadIndex());
+        assertEquals(7, second.getStatus());
+
+        CallTraceRecord third = records.get(2);
+        assertArrayEquals(new long[] { 0x1000, 100, 100 },
+            third.getArguments());
+        assertEquals(500, third.getStartNs());
+        assertEquals(0, third.getThreadIndex());
+        assertEquals(0, third.getStatus());
+    }
+
+    @Test(expected = IOException.class)
+    public void testInvalidMagicIsRejected() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC + 1, VERSION);
+        read(bb);
+    }
+
+    @Test(expected = IOException.class)
+    public void testUnsupportedVersionIsRejected() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC, VERSION + 1);
+        read(bb);
+    }
+
+    @Test(expected = IOException.class)
+    public void testUnknownFunctionIsRejected() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC, VERSION);
+        putFunction(bb, 0, "cusolverDnCreate()");
+        bb.putInt(2).putInt(0).putInt(1).putInt(0);
+        putRecord(bb, 1, 0, 0, 0, 0, 0, 0, 0);
+        read(bb);
+    }
+
+    @Test(expected = IOException.class)
+    public void testTruncatedFileIsRejected() throws IOException
+    {
+        ByteBuffer bb = createBuffer();
+        putHeader(bb, MAGIC, VERSION);
+        putFunction(bb, 0, "cusolverDnCreate()");
+        bb.putInt(2).putInt(0).putInt(2).putInt(0);
+        putRecord(bb, 0, 0, 0, 0, 0, 0, 0, 0);
+        read(bb);
+    }
+
+    /**
+     * Creates a buffer with the native byte order
+     */
+    private static ByteBuffer createBuffer()
+    {
+        return ByteBuffer.allocate(4096).order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Put the file header into the given buffer
+     */
+    private static void putHeader(ByteBuffer bb, int magic, int version)
+    {
+        bb.putInt(magic).putInt(version);
+    }
+
+    /**
+     * Put a FUNCTION chunk into the given buffer
+     */
+    private static void putFunction(ByteBuffer bb, int id, String signature)
+    {
+        byte bytes[] = signature.getBytes(StandardCharsets.US_ASCII);
+        bb.putInt(1).putInt(id).putInt(bytes.length).putInt(0);
+        bb.put(bytes);
+    }
+
+    /**
+     * Put a single record of a RECORDS chunk into the given buffer
+     */
+    private static void putRecord(ByteBuffer bb, int functionId,
+        int status, long startNs, long durationNs, long... args)
+    {
+        bb.putInt(functionId).putInt(status);
+        bb.putLong(startNs).putLong(durationNs);
+        for (long arg : args)
+        {
+            bb.putLong(arg);
+        }
+    }
+
+    /**
+     * Write the contents of the given buffer into a file, and read it
+     * as a call trace
+     */
+    private static Trace read(ByteBuffer bb) throws IOException
+    {
+        File file = File.createTempFile("CallTraceDecoderTest", ".jsct");
+        try
+        {
+            Files.write(file.toPath(),
+                Arrays.copyOf(bb.array(), bb.position()));
+            return CallTraceDecoder.read(file.getPath());
+        }
+        finally
+        {
+            file.delete();
+        }
+    }
+}
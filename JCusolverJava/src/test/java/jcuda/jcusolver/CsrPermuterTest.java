@@ -0,0 +1,98 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+/**
+ * Tests for the validation of the arguments of the {@link CsrPermuter}
+ */
+public class CsrPermuterTest
+{
+    // The 3x3 matrix
+    // [ 1 0 2 ]
+    // [ 0 3 0 ]
+    // [ 4 0 5 ]
+    private static final int ROW_PTR[] = { 0, 2, 3, 5 };
+    private static final int COL_IND[] = { 0, 2, 1, 0, 2 };
+    private static final double VAL[] = { 1, 2, 3, 4, 5 };
+
+    @Test
+    public void testValidPermutation()
+    {
+        int p[] = { 2, 0, 1 };
+        int q[] = { 2, 1, 0 };
+        int rowPtrB[] = new int[4];
+        int colIndB[] = new int[5];
+        double valB[] = new double[5];
+        int map[] = new int[5];
+        int result = CsrPermuter.permute(3, 3, 5, 0, ROW_PTR, COL_IND, VAL,
+            p, q, rowPtrB, colIndB, valB, map);
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_SUCCESS, result);
+        assertArrayEquals(new int[] { 0, 2, 4, 5 }, rowPtrB);
+        assertArrayEquals(new int[] { 0, 2, 0, 2, 1 }, colIndB);
+        assertArrayEquals(new double[] { 5, 4, 2, 1, 3 }, valB, 0.0);
+        assertArrayEquals(new int[] { 4, 3, 1, 0, 2 }, map);
+    }
+
+    @Test
+    public void testInvalidRowPermutationIsRejected()
+    {
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            permuteStructure(ROW_PTR, COL_IND, new int[] { 0, 0, 1 }));
+    }
+
+    @Test
+    public void testDecreasingRowPointersAreRejected()
+    {
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            permuteStructure(new int[] { 0, 3, 2, 5 }, COL_IND,
+                new int[] { 0, 1, 2 }));
+    }
+
+    @Test
+    public void testColumnIndexOutOfRangeIsRejected()
+    {
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            permuteStructure(ROW_PTR, new int[] { 0, 2, 1, 0, 3 },
+                new int[] { 0, 1, 2 }));
+    }
+
+    @Test
+    public void testInvalidValueMapIsRejected()
+    {
+        double valB[] = new double[5];
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            CsrPermuter.permuteValues(5, VAL,
+                new int[] { 0, 1, 2, 3, 5 }, valB));
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            CsrPermuter.permuteValues(5, VAL,
+                new int[] { 0, 1, 2, 3, 3 }, valB));
+    }
+
+    @Test
+    public void testMapIsCopied()
+    {
+        CsrPermutation permutation = new CsrPermutation(
+            ROW_PTR.clone(), COL_IND.clone(), new int[] { 0, 1, 2, 3, 4 });
+        permutation.getMap()[0] = 1000;
+        assertArrayEquals(new int[] { 0, 1, 2, 3, 4 }, permutation.getMap());
+    }
+
+    /**
+     * Calls {@link CsrPermuter#permuteStructure} for the given 3x3
+     * matrix with 5 nonzeros, using the same row and column permutation
+     */
+    private static int permuteStructure(int rowPtr[], int colInd[], int p[])
+    {
+        return CsrPermuter.permuteStructure(3, 3, 5, 0, rowPtr, colInd,
+            p, p, new int[4], new int[5], new int[5]);
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertEquals;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import org.junit.Test;
+
+/**
+ * Tests for the handling of shift clusters in the
+ * {@link ShiftedInverseIteration}, using an inverse iteration for
+ * diagonal matrices on the host
+ */
+public class ShiftedInverseIterationTest
+{
+    private static final double TOLERANCE = 1e-12;
+
+    @Test
+    public void testClusteredSpectrumReturnsAllEigenvalues()
+    {
+        double d[] = { 1.0, 1.001, 1.002, 3.0, 7.0 };
+        List<Eigenpair> eigenpairs = solve(d,
+            0.9996, 1.0011, 1.0021, 2.9, 7.1);
+        assertEquals(d.length, eigenpairs.size());
+        for (int i = 0; i < d.length; i++)
+        {
+            assertEquals(d[i], eigenpairs.get(i).getEigenvalue(), 1e-9);
+        }
+    }
+
+    @Test
+    public void testMultipleEigenvalueReturnsAllEigenvectors()
+    {
+        double d[] = { 1.0, 1.0, 4.0 };
+        List<Eigenpair> eigenpairs = solve(d, 0.999, 1.001);
+        assertEquals(2, eigenpairs.size());
+        assertEquals(1.0, eigenpairs.get(0).getEigenvalue(), 1e-9);
+        assertEquals(1.0, eigenpairs.get(1).getEigenvalue(), 1e-9);
+        double x[] = eigenpairs.get(0).getEigenvector();
+        double y[] = eigenpairs.get(1).getEigenvector();
+        double xy = 0.0;
+        for (int i = 0; i < x.length; i++)
+        {
+            xy += x[i] * y[i];
+        }
+        assertEquals(0.0, xy, 1e-9);
+    }
+
+    @Test
+    public void testInitialVectorIsOrthogonalToFoundEigenvectors()
+    {
+        int m = 4;
+        List<Eigenpair> found = new ArrayList<Eigenpair>();
+        found.add(new Eigenpair(0.0, 0.0, new double[] { 1, 1, 0, 0 }, 0.0));
+        found.add(new Eigenpair(1.0, 1.0, new double[] { 0, 0, 2, 0 }, 0.0));
+        double x0[] = ShiftedInverseIteration.initialVector(m, 1.5, found);
+        for (Eigenpair eigenpair : found)
+        {
+            double v[] = eigenpair.getEigenvector();
+            double vx = 0.0;
+            for (int i = 0; i < m; i++)
+            {
+                vx += v[i] * x0[i];
+            }
+            assertEquals(0.0, vx, 1e-12);
+        }
+    }
+
+    /**
+     * Solve the clustered shifts for the diagonal matrix with the given
+     * diagonal, and remove the duplicates
+     *
+     * @param d The diagonal
+     * @param shifts The ascending shifts
+     * @return The eigenpairs
+     */
+    private static List<Eigenpair> solve(double d[], Double ... shifts)
+    {
+        List<Eigenpair> eigenpairs = ShiftedInverseIteration.solveCluster(
+            d.length, Arrays.asList(shifts), new DiagonalShiftSolver(d));
+        return ShiftedInverseIteration.removeDuplicates(
+            eigenpairs, TOLERANCE);
+    }
+
+    /**
+     * An inverse iteration for a diagonal matrix that, like csreigvsi,
+     * stops as soon as the iterate is an eigenvector, so that it stays
+     * at an eigenpair when it starts there
+     */
+    private static class DiagonalShiftSolver
+        implements ShiftedInverseIteration.ShiftSolver
+    {
+        private final double d[];
+
+        DiagonalShiftSolver(double d[])
+        {
+            this.d = d;
+        }
+
+        @Override
+        public double solve(double shift, double x0[], double x[])
+        {
+            System.arraycopy(x0, 0, x, 0, x.length);
+            double mu = rayleigh(x);
+            for (int iteration = 0; iteration < 1000; iteration++)
+            {
+                if (residual(mu, x) <= TOLERANCE)
+                {
+                    break;
+                }
+                double norm = 0.0;
+                for (int i = 0; i < x.length; i++)
+                {
+                    x[i] /= (d[i] - shift);
+                    norm += x[i] * x[i];
+                }
+                norm = Math.sqrt(norm);
+                for (int i = 0; i < x.length; i++)
+                {
+                    x[i] /= norm;
+                }
+                mu = rayleigh(x);
+            }
+            return mu;
+        }
+
+        @Override
+        public double residual(double mu, double x[])
+        {
+            double rr = 0.0;
+            double xx = 0.0;
+            for (int i = 0; i < x.length; i++)
+            {
+                double r = d[i] * x[i] - mu * x[i];
+                rr += r * r;
+                xx += x[i] * x[i];
+            }
+            return Math.sqrt(rr / xx);
+        }
+
+        private double rayleigh(double x[])
+        {
+            double xdx = 0.0;
+            double xx = 0.0;
+            for (int i = 0; i < x.length; i++)
+            {
+                xdx += x[i] * d[i] * x[i];
+                xx += x[i] * x[i];
+            }
+            return xdx / xx;
+        }
+    }
+}
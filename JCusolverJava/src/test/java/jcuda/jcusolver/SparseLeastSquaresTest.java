@@ -0,0 +1,143 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import org.junit.After;
+import org.junit.Assume;
+import org.junit.Before;
+import org.junit.Test;
+
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+import jcuda.runtime.JCuda;
+
+/**
+ * Tests for the {@link SparseLeastSquares} solver, with small matrices
+ * whose least squares solutions are known. These tests require a 
+ * device, and are skipped if there is none.
+ */
+public class SparseLeastSquaresTest
+{
+    private static final double TOLERANCE = 1e-10;
+
+    /**
+     * The handle
+     */
+    private cusolverSpHandle handle;
+
+    /**
+     * The matrix descriptor
+     */
+    private cusparseMatDescr descrA;
+
+    @Before
+    public void setUp()
+    {
+        int deviceCount[] = { 0 };
+        JCuda.cudaGetDeviceCount(deviceCount);
+        Assume.assumeTrue(deviceCount[0] > 0);
+
+        JCusolver.setExceptionsEnabled(true);
+        handle = new cusolverSpHandle();
+        JCusolverSp.cusolverSpCreate(handle);
+        descrA = new cusparseMatDescr();
+        JCusparse.cusparseCreateMatDescr(descrA);
+    }
+
+    @After
+    public void tearDown()
+    {
+        if (handle != null)
+        {
+            JCusparse.cusparseDestroyMatDescr(descrA);
+            JCusolverSp.cusolverSpDestroy(handle);
+        }
+        JCusolver.setExceptionsEnabled(false);
+    }
+
+    @Test
+    public void testFullRankSolvesAllColumns()
+    {
+        // A = [1 0; 0 1; 1 1]
+        SparseLeastSquares solver = new SparseLeastSquares(handle, 3, 2, 4,
+            descrA, new double[] { 1, 1, 1, 1 }, new int[] { 0, 1, 2, 4 },
+            new int[] { 0, 1, 0, 1 }, TOLERANCE);
+        try
+        {
+            assertTrue(solver.hasFullRank());
+            assertEquals(2, solver.getRank());
+
+            // The solution for b = [1 2 4] is x = [4/3 7/3], with the
+            // residual [1/3 1/3 -1/3]. The second column is 2*b.
+            double b[] = { 1, 2, 4, 2, 4, 8 };
+            SparseLeastSquares.Result result = solver.solve(b, 3, 2);
+            double x[] = result.getSolutions();
+            assertEquals(4.0 / 3.0, x[0], 1e-12);
+            assertEquals(7.0 / 3.0, x[1], 1e-12);
+            assertEquals(8.0 / 3.0, x[2], 1e-12);
+            assertEquals(14.0 / 3.0, x[3], 1e-12);
+            double residualNorms[] = result.getResidualNorms();
+            assertEquals(1.0 / Math.sqrt(3.0), residualNorms[0], 1e-12);
+            assertEquals(2.0 / Math.sqrt(3.0), residualNorms[1], 1e-12);
+        }
+        finally
+        {
+            solver.close();
+        }
+    }
+
+    @Test
+    public void testRankDeficientSolvesAllColumns()
+    {
+        // A = [1 1; 1 1; 1 1], where every least squares solution of 
+        // A*x = [1 2 3] has x0 + x1 = 2, with the residual [-1 0 1]
+        SparseLeastSquares solver = new SparseLeastSquares(handle, 3, 2, 6,
+            descrA, new double[] { 1, 1, 1, 1, 1, 1 }, 
+            new int[] { 0, 2, 4, 6 }, new int[] { 0, 1, 0, 1, 0, 1 }, 
+            TOLERANCE);
+        try
+        {
+            assertFalse(solver.hasFullRank());
+            assertEquals(1, solver.getRank());
+
+            double b[] = { 1, 2, 3, 2, 4, 6 };
+            SparseLeastSquares.Result result = solver.solve(b, 3, 2);
+            double x[] = result.getSolutions();
+            assertEquals(2.0, x[0] + x[1], 1e-12);
+            assertEquals(4.0, x[2] + x[3], 1e-12);
+            double residualNorms[] = result.getResidualNorms();
+            assertEquals(Math.sqrt(2.0), residualNorms[0], 1e-12);
+            assertEquals(2.0 * Math.sqrt(2.0), residualNorms[1], 1e-12);
+        }
+        finally
+        {
+            solver.close();
+        }
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void testSolveAfterCloseIsRejected()
+    {
+        SparseLeastSquares solver = new SparseLeastSquares(handle, 2, 2, 2,
+            descrA, new double[] { 1, 1 }, new int[] { 0, 1, 2 },
+            new int[] { 0, 1 }, TOLERANCE);
+        solver.close();
+        solver.solve(new double[] { 1, 1 });
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testWideMatrixIsRejected()
+    {
+        new SparseLeastSquares(handle, 1, 2, 2, descrA, 
+            new double[] { 1, 1 }, new int[] { 0, 2 }, new int[] { 0, 1 }, 
+            TOLERANCE);
+    }
+}
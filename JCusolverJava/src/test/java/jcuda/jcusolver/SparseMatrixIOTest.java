@@ -0,0 +1,104 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+
+import org.junit.Test;
+
+/**
+ * Tests for the rejection of invalid files by the {@link SparseMatrixIO}
+ */
+public class SparseMatrixIOTest
+{
+    @Test(expected = IOException.class)
+    public void testDecreasingRowPointersAreRejected() throws IOException
+    {
+        readBinary(ByteOrder.nativeOrder(), 3, 3,
+            new int[] { 0, 2, 1, 3 }, new int[] { 0, 1, 2 });
+    }
+
+    @Test(expected = IOException.class)
+    public void testWrongNnzIsRejected() throws IOException
+    {
+        readBinary(ByteOrder.nativeOrder(), 3, 3,
+            new int[] { 0, 1, 2, 2 }, new int[] { 0, 1, 2 });
+    }
+
+    @Test(expected = IOException.class)
+    public void testColumnIndexOutOfRangeIsRejected() throws IOException
+    {
+        readBinary(ByteOrder.nativeOrder(), 3, 3,
+            new int[] { 0, 1, 2, 3 }, new int[] { 0, 1, 3 });
+    }
+
+    @Test(expected = IOException.class)
+    public void testDifferentByteOrderIsRejected() throws IOException
+    {
+        ByteOrder other = ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN ?
+            ByteOrder.BIG_ENDIAN : ByteOrder.LITTLE_ENDIAN;
+        readBinary(other, 3, 3,
+            new int[] { 0, 1, 2, 3 }, new int[] { 0, 1, 2 });
+    }
+
+    @Test(expected = IOException.class)
+    public void testOverflowingArraySizeIsRejected() throws IOException
+    {
+        File file = File.createTempFile("SparseMatrixIOTest", ".mtx");
+        try
+        {
+            String content = "%%MatrixMarket matrix array real general\n"
+                + "4294967296 4294967296\n1.0\n";
+            Files.write(file.toPath(),
+                content.getBytes(StandardCharsets.US_ASCII));
+            SparseMatrixIO.readMatrixMarket(file.getPath());
+        }
+        finally
+        {
+            file.delete();
+        }
+    }
+
+    /**
+     * Writes a binary CSR file with the given byte order, structure and
+     * zero values, and reads it
+     */
+    private static void readBinary(ByteOrder order, int m, int n,
+        int rowPtr[], int colInd[]) throws IOException
+    {
+        int nnz = colInd.length;
+        int indexBytes = 4 * (rowPtr.length + colInd.length);
+        int padding = (8 - (40 + indexBytes) % 8) % 8;
+        ByteBuffer bb = ByteBuffer.allocate(
+            40 + indexBytes + padding + 8 * nnz).order(order);
+        bb.putInt(0x5253434A).putInt(1).putInt(0).putInt(0);
+        bb.putLong(m).putLong(n).putLong(nnz);
+        for (int r : rowPtr)
+        {
+            bb.putInt(r);
+        }
+        for (int c : colInd)
+        {
+            bb.putInt(c);
+        }
+        File file = File.createTempFile("SparseMatrixIOTest", ".csr");
+        try
+        {
+            Files.write(file.toPath(), bb.array());
+            SparseMatrixIO.readBinary(file.getPath());
+        }
+        finally
+        {
+            file.delete();
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertEquals;
+
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+
+import org.junit.Test;
+
+/**
+ * Tests for the bisection and the histogram of the 
+ * {@link SpectrumSlicer}, using a counter for a known real spectrum
+ * on the host
+ */
+public class SpectrumSlicerTest
+{
+    /**
+     * The eigenvalues 1, 2, ..., 8
+     */
+    private static final double EIGENVALUES[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    @Test
+    public void testBisectionSplitsUntilTheMaximumCount()
+    {
+        List<SpectrumSlice> slices = SpectrumSlicer.bisect(
+            SpectrumSlicerTest::count, 0.0, -1.0, 8.5, 1.0, 2, 16, true);
+        assertSlices(slices, 
+            new double[] { 0.0, 2.125, 4.25, 6.375, 8.5 }, 
+            new int[] { 2, 2, 2, 2 });
+    }
+
+    @Test
+    public void testBisectionStopsAtTheMaximumSlices()
+    {
+        List<SpectrumSlice> slices = SpectrumSlicer.bisect(
+            SpectrumSlicerTest::count, 0.0, -1.0, 8.5, 1.0, 2, 3, true);
+        assertSlices(slices, 
+            new double[] { 0.0, 2.125, 4.25, 8.5 }, 
+            new int[] { 2, 2, 4 });
+    }
+
+    @Test
+    public void testHistogramCoversTheRegion()
+    {
+        List<SpectrumSlice> slices = SpectrumSlicer.histogram(
+            SpectrumSlicerTest::count, 0.5, -1.0, 8.5, 1.0, 4);
+        assertSlices(slices, 
+            new double[] { 0.5, 2.5, 4.5, 6.5, 8.5 }, 
+            new int[] { 2, 2, 2, 2 });
+    }
+
+    /**
+     * Assert that the given slices cover the strip between the given 
+     * real boundaries, and contain the given counts
+     *
+     * @param slices The slices
+     * @param boundaries The boundaries
+     * @param counts The counts
+     */
+    private static void assertSlices(List<SpectrumSlice> slices, 
+        double boundaries[], int counts[])
+    {
+        assertEquals(counts.length, slices.size());
+        for (int i = 0; i < counts.length; i++)
+        {
+            SpectrumSlice slice = slices.get(i);
+            assertEquals(boundaries[i], slice.getReLower(), 0.0);
+            assertEquals(boundaries[i + 1], slice.getReUpper(), 0.0);
+            assertEquals(-1.0, slice.getImLower(), 0.0);
+            assertEquals(1.0, slice.getImUpper(), 0.0);
+            assertEquals(counts[i], slice.getCount());
+        }
+    }
+
+    /**
+     * Count the eigenvalues in the given rectangle, including the lower
+     * bounds and excluding the upper bounds
+     */
+    private static CompletableFuture<SpectrumSlice> count(
+        double reLower, double imLower, double reUpper, double imUpper)
+    {
+        int count = 0;
+        for (double eigenvalue : EIGENVALUES)
+        {
+            if (eigenvalue >= reLower && eigenvalue < reUpper && 
+                imLower <= 0.0 && 0.0 < imUpper)
+            {
+                count++;
+            }
+        }
+        return CompletableFuture.completedFuture(
+            new SpectrumSlice(reLower, imLower, reUpper, imUpper, count));
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.fail;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+import jcuda.CudaException;
+
+/**
+ * Tests for the sticky errors of {@link JCusolver}. The failing calls are
+ * cusolverGetProperty with an invalid property type, and a permutation
+ * with an invalid map, which do not require a device.
+ */
+public class StickyErrorsTest
+{
+    /**
+     * A library property type that does not exist
+     */
+    private static final int INVALID_TYPE = 1234;
+    
+    /**
+     * The library property type MAJOR_VERSION
+     */
+    private static final int MAJOR_VERSION = 0;
+    
+    @Before
+    public void setUp()
+    {
+        JCusolver.setExceptionsEnabled(true);
+        JCusolver.setStickyErrorsEnabled(true);
+    }
+    
+    @After
+    public void tearDown()
+    {
+        JCusolver.setStickyErrorsEnabled(false);
+        JCusolver.clearStickyError();
+        JCusolver.setExceptionsEnabled(false);
+    }
+    
+    @Test
+    public void testFailedCallDoesNotThrow()
+    {
+        int result = JCusolver.cusolverGetProperty(
+            INVALID_TYPE, new int[1]);
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE, result);
+    }
+    
+    @Test
+    public void testFirstFailureWins()
+    {
+        JCusolver.cusolverGetProperty(INVALID_TYPE, new int[1]);
+        JCusolver.cusolverGetProperty(INVALID_TYPE + 1, new int[1]);
+        
+        StickyError stickyError = JCusolver.getStickyError();
+        assertNotNull(stickyError);
+        assertEquals("cusolverGetProperty", stickyError.getFunctionName());
+        assertArrayEquals(new String[] { "type" }, 
+            stickyError.getArgumentNames());
+        assertArrayEquals(new long[] { INVALID_TYPE }, 
+            stickyError.getArguments());
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE, 
+            stickyError.getStatus());
+    }
+    
+    @Test
+    public void testLaterFailuresAreCounted()
+    {
+        JCusolver.cusolverGetProperty(INVALID_TYPE, new int[1]);
+        JCusolver.cusolverGetProperty(MAJOR_VERSION, new int[1]);
+        JCusolver.cusolverGetProperty(INVALID_TYPE, new int[1]);
+        JCusolver.cusolverGetProperty(INVALID_TYPE, new int[1]);
+        
+        StickyError stickyError = JCusolver.getStickyError();
+        assertEquals(3, stickyError.getFailedCallCount());
+    }
+    
+    @Test
+    public void testCheckStickyErrorThrowsAndClears()
+    {
+        assertNull(JCusolver.getStickyError());
+        JCusolver.checkStickyError();
+        
+        JCusolver.cusolverGetProperty(INVALID_TYPE, new int[1]);
+        try
+        {
+            JCusolver.checkStickyError();
+            fail("Expected a CudaException");
+        }
+        catch (CudaException e)
+        {
+            // Expected
+        }
+        assertNull(JCusolver.getStickyError());
+    }
+    
+    @Test
+    public void testFailureOfUtilityFunctionIsStored()
+    {
+        double values[] = { 1.0, 2.0 };
+        int result = CsrPermuter.permuteValues(
+            2, values, new int[] { 0, 0 }, new double[2]);
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE, result);
+        
+        StickyError stickyError = JCusolver.getStickyError();
+        assertNotNull(stickyError);
+        assertEquals("CsrPermuter.permuteValues", 
+            stickyError.getFunctionName());
+        assertArrayEquals(new long[] { 2 }, stickyError.getArguments());
+    }
+    
+    @Test
+    public void testDisablingKeepsTheError()
+    {
+        JCusolver.cusolverGetProperty(INVALID_TYPE, new int[1]);
+        JCusolver.setStickyErrorsEnabled(false);
+        assertNotNull(JCusolver.getStickyError());
+        
+        JCusolver.setStickyErrorsEnabled(true);
+        assertNull(JCusolver.getStickyError());
+    }
+}
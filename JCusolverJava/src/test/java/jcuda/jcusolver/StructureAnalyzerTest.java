@@ -0,0 +1,109 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import org.junit.Test;
+
+import jcuda.CudaException;
+import jcuda.jcusparse.JCusparse;
+import jcuda.jcusparse.cusparseMatDescr;
+
+/**
+ * Tests for the {@link StructureAnalyzer}
+ */
+public class StructureAnalyzerTest
+{
+    // The symmetric 2x2 matrix [ 2 2 ; 2 2 ], with the entry (0,1)
+    // stored as two duplicates
+    private static final int ROW_PTR[] = { 0, 3, 5 };
+    private static final int COL_IND[] = { 0, 1, 1, 0, 1 };
+    private static final double VAL[] = { 2, 1, 1, 2, 2 };
+
+    @Test(expected = CudaException.class)
+    public void testRowRangeOutOfBoundsIsRejected()
+    {
+        // The row pointers start at 0 and end at nnz, but the range of
+        // the first row exceeds nnz
+        StructureAnalyzer.analyzeUncached(3, 3, 3, 0, null,
+            new int[] { 0, 5, 2, 3 }, new int[] { 0, 1, 2 }, 0.0);
+    }
+
+    @Test(expected = CudaException.class)
+    public void testColumnIndexOutOfRangeIsRejected()
+    {
+        StructureAnalyzer.analyzeUncached(2, 2, 5, 0, VAL,
+            ROW_PTR, new int[] { 0, 1, 2, 0, 1 }, 0.0);
+    }
+
+    @Test
+    public void testDuplicatesAreSummedForNumericSymmetry()
+    {
+        StructureAnalysis analysis = StructureAnalyzer.analyzeUncached(
+            2, 2, 5, 0, VAL, ROW_PTR, COL_IND, 0.0);
+        assertEquals(1, analysis.getDuplicateEntries());
+        assertTrue(analysis.isStructurallySymmetric());
+        assertTrue(analysis.isNumericallySymmetric());
+
+        double unsymmetric[] = { 2, 1, 2, 2, 2 };
+        analysis = StructureAnalyzer.analyzeUncached(
+            2, 2, 5, 0, unsymmetric, ROW_PTR, COL_IND, 0.0);
+        assertFalse(analysis.isNumericallySymmetric());
+    }
+
+    @Test
+    public void testAnalysisWithoutValuesDoesNotHideNumericProperties()
+    {
+        cusparseMatDescr descrA = new cusparseMatDescr();
+        JCusparse.cusparseCreateMatDescr(descrA);
+        try
+        {
+            StructureAnalyzer analyzer = new StructureAnalyzer();
+            StructureAnalysis structural = analyzer.analyze(
+                2, 2, 5, descrA, null, ROW_PTR, COL_IND);
+            assertFalse(structural.hasPositiveDiagonal());
+            StructureAnalysis numeric = analyzer.analyze(
+                2, 2, 5, descrA, VAL, ROW_PTR, COL_IND);
+            assertTrue(numeric.hasPositiveDiagonal());
+            assertEquals(2, analyzer.getCacheSize());
+        }
+        finally
+        {
+            JCusparse.cusparseDestroyMatDescr(descrA);
+        }
+    }
+
+    @Test
+    public void testCacheIsBounded()
+    {
+        cusparseMatDescr descrA = new cusparseMatDescr();
+        JCusparse.cusparseCreateMatDescr(descrA);
+        try
+        {
+            StructureAnalyzer analyzer = new StructureAnalyzer(0.0, 2);
+            for (int n = 1; n <= 4; n++)
+            {
+                int rowPtr[] = new int[n + 1];
+                int colInd[] = new int[n];
+                for (int i = 0; i < n; i++)
+                {
+                    rowPtr[i + 1] = i + 1;
+                    colInd[i] = i;
+                }
+                analyzer.analyze(n, n, n, descrA, null, rowPtr, colInd);
+            }
+            assertEquals(2, analyzer.getCacheSize());
+        }
+        finally
+        {
+            JCusparse.cusparseDestroyMatDescr(descrA);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+/**
+ * Tests for the {@link SymbolicCholesky} fill prediction
+ */
+public class SymbolicCholeskyTest
+{
+    @Test
+    public void testArrowheadFill()
+    {
+        int n = 6;
+        
+        // An arrowhead matrix with a dense first row and column, 
+        // storing only the lower triangle
+        int rowPtr[] = new int[n + 1];
+        int colInd[] = new int[2 * n - 1];
+        int nnz = 0;
+        for (int r = 0; r < n; r++)
+        {
+            if (r > 0)
+            {
+                colInd[nnz++] = 0;
+            }
+            colInd[nnz++] = r;
+            rowPtr[r + 1] = nnz;
+        }
+        
+        // Eliminating the dense node first fills the whole factor
+        assertEquals(n * (n + 1) / 2, 
+            SymbolicCholesky.countFactorNonzeros(n, rowPtr, colInd, 0, null));
+        
+        // Eliminating it last causes no fill
+        int p[] = new int[n];
+        for (int k = 0; k < n; k++)
+        {
+            p[k] = (k + 1) % n;
+        }
+        assertEquals(2 * n - 1, 
+            SymbolicCholesky.countFactorNonzeros(n, rowPtr, colInd, 0, p));
+    }
+    
+    @Test
+    public void testOneBasedTridiagonal()
+    {
+        int n = 5;
+        int rowPtr[] = { 1, 3, 6, 9, 12, 14 };
+        int colInd[] = { 1, 2,  1, 2, 3,  2, 3, 4,  3, 4, 5,  4, 5 };
+        assertEquals(2 * n - 1, 
+            SymbolicCholesky.countFactorNonzeros(n, rowPtr, colInd, 1, null));
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertEquals;
+
+import java.util.Random;
+
+import org.junit.Test;
+
+/**
+ * Tests for the {@link TiledCholesky} scheduler, using the 
+ * {@link HostTileKernel}, which does not require the native library
+ */
+public class TiledCholeskyTest
+{
+    @Test
+    public void testFactorAndSolveWithPartialTiles()
+    {
+        int n = 11;
+        int nrhs = 2;
+        TileLayout layout = new TileLayout(n, 3);
+        TiledCholesky cholesky = new TiledCholesky(layout, 2);
+        HostTileKernel kernel = 
+            new HostTileKernel(layout, cholesky.getRequiredSlots());
+        
+        double a[] = createSpdMatrix(n, new Random(0));
+        kernel.setMatrix(a);
+        cholesky.factor(kernel);
+        assertEquals(0, kernel.getInfo());
+        
+        // Check that L * L^T = A
+        double l[] = new double[n * n];
+        kernel.getMatrix(l);
+        for (int r = 0; r < n; r++)
+        {
+            for (int c = 0; c <= r; c++)
+            {
+                double sum = 0.0;
+                for (int k = 0; k <= c; k++)
+                {
+                    sum += l[r + k * n] * l[c + k * n];
+                }
+                assertEquals(a[r + c * n], sum, 1e-10);
+            }
+        }
+        
+        // Check that A * X = B
+        Random random = new Random(1);
+        double b[] = new double[n * nrhs];
+        for (int i = 0; i < b.length; i++)
+        {
+            b[i] = random.nextDouble();
+        }
+        kernel.setRightHandSide(b, nrhs);
+        cholesky.solve(kernel);
+        double x[] = new double[n * nrhs];
+        kernel.getSolution(x);
+        for (int col = 0; col < nrhs; col++)
+        {
+            for (int r = 0; r < n; r++)
+            {
+                double sum = 0.0;
+                for (int k = 0; k < n; k++)
+                {
+                    sum += a[r + k * n] * x[k + col * n];
+                }
+                assertEquals(b[r + col * n], sum, 1e-10);
+            }
+        }
+    }
+    
+    @Test
+    public void testNonPositiveDefiniteMatrixIsReported()
+    {
+        int n = 5;
+        TileLayout layout = new TileLayout(n, 2);
+        TiledCholesky cholesky = new TiledCholesky(layout, 2);
+        HostTileKernel kernel = 
+            new HostTileKernel(layout, cholesky.getRequiredSlots());
+        double a[] = createSpdMatrix(n, new Random(0));
+        a[3 + 3 * n] = -1000.0;
+        kernel.setMatrix(a);
+        cholesky.factor(kernel);
+        assertEquals(4, kernel.getInfo());
+    }
+    
+    private static double[] createSpdMatrix(int n, Random random)
+    {
+        double m[] = new double[n * n];
+        for (int i = 0; i < m.length; i++)
+        {
+            m[i] = random.nextDouble();
+        }
+        double a[] = new double[n * n];
+        for (int r = 0; r < n; r++)
+        {
+            for (int c = 0; c < n; c++)
+            {
+                double sum = 0.0;
+                for (int k = 0; k < n; k++)
+                {
+                    sum += m[r + k * n] * m[c + k * n];
+                }
+                a[r + c * n] = sum + (r == c ? n : 0.0);
+            }
+        }
+        return a;
+    }
+}
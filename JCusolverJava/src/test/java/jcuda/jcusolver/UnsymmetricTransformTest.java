@@ -0,0 +1,136 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+/**
+ * Tests for the scaling and permutation of the {@link UnsymmetricTransform}
+ */
+public class UnsymmetricTransformTest
+{
+    // The 3x3 matrix
+    // [ 1 0 2 ]
+    // [ 0 3 0 ]
+    // [ 4 0 5 ]
+    private static final int N = 3;
+    private static final int NNZ = 5;
+    private static final int ROW_PTR[] = { 0, 2, 3, 5 };
+    private static final int COL_IND[] = { 0, 2, 1, 0, 2 };
+    private static final double VAL[] = { 1, 2, 3, 4, 5 };
+
+    @Test
+    public void testScalingRoundTrip()
+    {
+        UnsymmetricTransform transform = createTransform();
+        double valB[] = new double[NNZ];
+        transform.transformValues(VAL, valB);
+
+        // Compute b = A * x
+        double x[] = { 1.0, -2.0, 3.0 };
+        double b[] = multiply(ROW_PTR, COL_IND, VAL, x);
+
+        // The solution of B * y = c is y[k] = x[q[k]] / colScale[k]
+        double c[] = new double[N];
+        transform.applyToRightHandSide(b, c);
+        int q[] = transform.getColumnPermutation();
+        double colScale[] = transform.getColumnScale();
+        double y[] = new double[N];
+        for (int k = 0; k < N; k++)
+        {
+            y[k] = x[q[k]] / colScale[k];
+        }
+        assertArrayEquals(c, multiply(transform.getCsrRowPtrB(),
+            transform.getCsrColIndB(), valB, y), 1e-12);
+
+        double result[] = new double[N];
+        transform.unapplyToSolution(y, result);
+        assertArrayEquals(x, result, 1e-12);
+    }
+
+    @Test
+    public void testGettersReturnCopies()
+    {
+        UnsymmetricTransform transform = createTransform();
+        transform.getRowPermutation()[0] = 1000;
+        transform.getColumnScale()[0] = 1000.0;
+        transform.getCsrColIndB()[0] = 1000;
+        assertArrayEquals(new int[] { 2, 0, 1 },
+            transform.getRowPermutation());
+        assertEquals(0.5, transform.getColumnScale()[0], 0.0);
+        assertEquals(0, transform.getCsrColIndB()[0]);
+    }
+
+    @Test
+    public void testInvalidPermutationIsRejected()
+    {
+        double src[] = { 1, 2, 3 };
+        double dst[] = new double[N];
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            SparseScaling.gatherNative(N, 1, src, N,
+                new int[] { 0, 1, 3 }, null, dst, N));
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            SparseScaling.scatterNative(N, 1, src, N,
+                new int[] { 0, 1, 1 }, null, dst, N));
+    }
+
+    @Test
+    public void testTooSmallArraysAreRejected()
+    {
+        double rowScale[] = new double[N];
+        double colScale[] = new double[N - 1];
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            SparseScaling.equilibrateNative(N, N, NNZ, 0,
+                ROW_PTR, COL_IND, VAL, rowScale, colScale));
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            SparseScaling.scaleValuesNative(N, NNZ, 0, ROW_PTR, COL_IND,
+                VAL, null, rowScale, colScale, new double[NNZ]));
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_INVALID_VALUE,
+            SparseScaling.gatherNative(N, 2, VAL, N,
+                null, null, new double[2 * N], N));
+    }
+
+    /**
+     * Creates a transform with p = { 2, 0, 1 }, q = { 2, 1, 0 } and
+     * power-of-two scaling factors
+     */
+    private static UnsymmetricTransform createTransform()
+    {
+        int p[] = { 2, 0, 1 };
+        int q[] = { 2, 1, 0 };
+        int rowPtrB[] = new int[N + 1];
+        int colIndB[] = new int[NNZ];
+        int map[] = new int[NNZ];
+        assertEquals(cusolverStatus.CUSOLVER_STATUS_SUCCESS,
+            CsrPermuter.permuteStructure(N, N, NNZ, 0, ROW_PTR, COL_IND,
+                p, q, rowPtrB, colIndB, map));
+        double rowScale[] = { 0.25, 1.0, 0.5 };
+        double colScale[] = { 0.5, 2.0, 1.0 };
+        return new UnsymmetricTransform(N, NNZ, 0, p, q,
+            rowScale, colScale, rowPtrB, colIndB, map, N);
+    }
+
+    /**
+     * Computes A * x for the given zero-based CSR matrix
+     */
+    private static double[] multiply(
+        int rowPtr[], int colInd[], double val[], double x[])
+    {
+        double result[] = new double[rowPtr.length - 1];
+        for (int r = 0; r < result.length; r++)
+        {
+            for (int k = rowPtr[r]; k < rowPtr[r + 1]; k++)
+            {
+                result[r] += val[k] * x[colInd[k]];
+            }
+        }
+        return result;
+    }
+}
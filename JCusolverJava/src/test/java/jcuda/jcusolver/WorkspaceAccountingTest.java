@@ -0,0 +1,141 @@
+/*
+ * JCuda - Java bindings for CUDA
+ *
+ * http://www.jcuda.org
+ */
+
+package jcuda.jcusolver;
+
+import static jcuda.jcublas.cublasFillMode.CUBLAS_FILL_MODE_LOWER;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+import org.junit.After;
+import org.junit.Assume;
+import org.junit.Before;
+import org.junit.Test;
+
+import jcuda.CudaException;
+import jcuda.Pointer;
+import jcuda.Sizeof;
+import jcuda.runtime.JCuda;
+
+/**
+ * Tests for the budget of the {@link WorkspaceAccounting}. These tests
+ * require a device, and are skipped if there is none.
+ */
+public class WorkspaceAccountingTest
+{
+    /**
+     * The size of the matrix that the workspace is queried for
+     */
+    private static final int N = 256;
+
+    /**
+     * The handle
+     */
+    private cusolverDnHandle handle;
+
+    /**
+     * The device memory for the matrix
+     */
+    private Pointer dA;
+
+    @Before
+    public void setUp()
+    {
+        int deviceCount[] = { 0 };
+        JCuda.cudaGetDeviceCount(deviceCount);
+        Assume.assumeTrue(deviceCount[0] > 0);
+
+        handle = new cusolverDnHandle();
+        JCusolverDn.cusolverDnCreate(handle);
+        dA = new Pointer();
+        JCuda.cudaMalloc(dA, (long)N * N * Sizeof.DOUBLE);
+        WorkspaceAccounting.setBudget(0, 0);
+        WorkspaceAccounting.reset();
+        WorkspaceAccounting.setEnabled(true);
+    }
+
+    @After
+    public void tearDown()
+    {
+        WorkspaceAccounting.setEnabled(false);
+        WorkspaceAccounting.setBudget(0, 0);
+        if (handle != null)
+        {
+            JCusolverDn.cusolverDnDestroy(handle);
+            JCuda.cudaFree(dA);
+        }
+    }
+
+    @Test
+    public void testWorkspaceIsAccountedUntilHandleIsDestroyed()
+    {
+        long totalBefore =
+            WorkspaceAccounting.getSnapshot().getTotalDeviceBytes();
+        long bytes = queryPotrfWorkspaceBytes();
+
+        WorkspaceSnapshot snapshot = WorkspaceAccounting.getSnapshot();
+        assertEquals(totalBefore + bytes, snapshot.getTotalDeviceBytes());
+        assertTrue(snapshot.getPeakDeviceBytes() >= totalBefore + bytes);
+
+        // Querying again for the same handle replaces the workspace
+        queryPotrfWorkspaceBytes();
+        snapshot = WorkspaceAccounting.getSnapshot();
+        assertEquals(totalBefore + bytes, snapshot.getTotalDeviceBytes());
+
+        JCusolverDn.cusolverDnDestroy(handle);
+        handle = null;
+        JCuda.cudaFree(dA);
+        snapshot = WorkspaceAccounting.getSnapshot();
+        assertEquals(totalBefore, snapshot.getTotalDeviceBytes());
+    }
+
+    @Test
+    public void testExceedingTheBudgetIsRejected()
+    {
+        long bytes = queryPotrfWorkspaceBytes();
+        long totalBefore =
+            WorkspaceAccounting.getSnapshot().getTotalDeviceBytes();
+
+        // Allow the current workspaces, minus one byte of this handle
+        WorkspaceAccounting.setBudget(totalBefore - 1, 0);
+        try
+        {
+            queryPotrfWorkspaceBytes();
+            fail("Expected a CudaException");
+        }
+        catch (CudaException e)
+        {
+            assertTrue(e.getMessage().contains("cusolverDnDpotrf_bufferSize"));
+        }
+        WorkspaceSnapshot snapshot = WorkspaceAccounting.getSnapshot();
+        assertEquals(1, snapshot.getRejected());
+        assertEquals(totalBefore, snapshot.getTotalDeviceBytes());
+
+        // The budget is only checked while the accounting is enabled
+        WorkspaceAccounting.setEnabled(false);
+        assertEquals(bytes, queryPotrfWorkspaceBytes());
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testNegativeBudgetIsRejected()
+    {
+        WorkspaceAccounting.setBudget(-1, 0);
+    }
+
+    /**
+     * Query the workspace size for cusolverDnDpotrf with the handle
+     *
+     * @return The workspace size, in bytes
+     */
+    private long queryPotrfWorkspaceBytes()
+    {
+        int lwork[] = { 0 };
+        JCusolverDn.cusolverDnDpotrf_bufferSize(
+            handle, CUBLAS_FILL_MODE_LOWER, N, dA, N, lwork);
+        return (long)lwork[0] * Sizeof.DOUBLE;
+    }
+}